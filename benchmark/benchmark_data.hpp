@@ -0,0 +1,47 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__BENCHMARK__BENCHMARK_DATA_HPP_
+#define PROGRAMMERS__GEOMETRY__BENCHMARK__BENCHMARK_DATA_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace programmers::geometry::benchmark_data {
+// Point counts from 256 points (4 KiB of coordinates, L1 resident) up to
+// 4 Mi points (64 MiB, DRAM resident) in steps of 8.
+constexpr int64_t kMinimumCount{1 << 8};
+constexpr int64_t kMaximumCount{1 << 22};
+constexpr int64_t kCountMultiplier{8};
+constexpr double kCoordinateRange{1.0e+4};
+constexpr uint64_t kSeed{20240109U};
+
+/**
+ * @brief Create the same uniformly random points in every run
+ */
+inline auto CreateRandomPoints(std::size_t count) -> std::vector<Point2D> {
+  std::mt19937_64 engine(kSeed);
+  std::uniform_real_distribution<double> coordinate(0.0, kCoordinateRange);
+  std::vector<Point2D> points;
+  points.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto x{coordinate(engine)};
+    points.emplace_back(x, coordinate(engine));
+  }
+  return points;
+}
+
+/**
+ * @brief Create the same uniformly random point cloud in every run
+ */
+inline auto CreateRandomCloud(std::size_t count) -> PointCloud2D {
+  return PointCloud2D(CreateRandomPoints(count));
+}
+}  // namespace programmers::geometry::benchmark_data
+
+#endif
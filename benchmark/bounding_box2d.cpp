@@ -0,0 +1,66 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/bounding_box2d.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::BoundingBox2D;
+using programmers::geometry::Point2D;
+namespace data = programmers::geometry::benchmark_data;
+
+const BoundingBox2D kQuery(Point2D(-data::kCoordinateRange / 4.0,
+                                   -data::kCoordinateRange / 4.0),
+                           Point2D(data::kCoordinateRange / 4.0,
+                                   data::kCoordinateRange / 4.0));
+
+// The hand rolled range filter on GetX and GetY that the box replaces.
+auto BenchmarkBoundingBox2DCompareLoop(benchmark::State& state) -> void {
+  const auto points{data::CreateRandomPoints(state.range(0))};
+  const auto minimum{kQuery.GetMinimum()};
+  const auto maximum{kQuery.GetMaximum()};
+  std::vector<bool> inside(points.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      inside[i] = minimum.GetX() <= points[i].GetX() &&
+                  points[i].GetX() <= maximum.GetX() &&
+                  minimum.GetY() <= points[i].GetY() &&
+                  points[i].GetY() <= maximum.GetY();
+    }
+    benchmark::DoNotOptimize(inside);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkBoundingBox2DCompareLoop)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkBoundingBox2DFilterWithin(benchmark::State& state) -> void {
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  std::vector<uint64_t> mask(cloud.Size() / 64U + 1U);
+  for (auto _ : state) {
+    kQuery.FilterWithin(cloud.XData(), cloud.YData(), cloud.Size(),
+                        mask.data());
+    benchmark::DoNotOptimize(mask.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkBoundingBox2DFilterWithin)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkBoundingBox2DFromPoints(benchmark::State& state) -> void {
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(BoundingBox2D::FromPoints(cloud));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkBoundingBox2DFromPoints)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
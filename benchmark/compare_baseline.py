@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 Programmers, All Rights Reserved.
+# Authors: woong137
+
+"""Compare a Google Benchmark JSON report with the checked-in baseline.
+
+Usage:
+    GEOMETRY_BENCHMARKS --benchmark_out=result.json --benchmark_out_format=json
+    compare_baseline.py benchmark/baseline.json result.json [--threshold 0.1]
+
+Benchmarks are matched by name. When the reports were produced with
+--benchmark_repetitions, the median aggregate is compared instead of every
+repetition. The exit status is 1 if any benchmark got slower than the
+threshold allows, so the script can gate a CI job.
+
+The exit status is 2, and nothing is gated, if the baseline is missing, was
+run against a debug build of Google Benchmark, or differs from the current
+report in num_cpus or library_build_type: such timings do not compare.
+baseline.json is not checked in until it is produced on the reference
+machine. Produce it from a Release build with the vendored Google Benchmark
+on that idle machine, with --benchmark_repetitions=3
+--benchmark_report_aggregates_only=true so that it holds medians. Refresh it
+whenever benchmarks are added, or they are reported as new and not gated.
+"""
+
+import argparse
+import json
+import os
+import sys
+
+TIME_UNIT_TO_NANOSECOND = {"ns": 1.0, "us": 1.0e3, "ms": 1.0e6, "s": 1.0e9}
+MISMATCH_STATUS = 2
+
+
+def load_times(path, metric):
+    """Return the context and {name: time in nanoseconds} of a report."""
+    with open(path, encoding="utf-8") as report_file:
+        report = json.load(report_file)
+
+    iterations = {}
+    medians = {}
+    for entry in report.get("benchmarks", []):
+        if entry.get("error_occurred"):
+            continue
+        scale = TIME_UNIT_TO_NANOSECOND[entry.get("time_unit", "ns")]
+        value = entry[metric] * scale
+        if entry.get("run_type") == "aggregate":
+            if entry.get("aggregate_name") == "median":
+                medians[entry["run_name"]] = value
+        else:
+            iterations.setdefault(entry.get("run_name", entry["name"]),
+                                  value)
+    iterations.update(medians)
+    return report.get("context", {}), iterations
+
+
+def format_time(nanoseconds):
+    for unit, scale in (("s", 1.0e9), ("ms", 1.0e6), ("us", 1.0e3)):
+        if nanoseconds >= scale:
+            return f"{nanoseconds / scale:.3f} {unit}"
+    return f"{nanoseconds:.1f} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline", help="baseline JSON report")
+    parser.add_argument("current", help="JSON report to check")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="allowed relative slowdown (default 0.10)")
+    parser.add_argument("--metric", choices=("cpu_time", "real_time"),
+                        default="cpu_time", help="time to compare")
+    arguments = parser.parse_args()
+
+    if not os.path.isfile(arguments.baseline):
+        print(f"error: no baseline at {arguments.baseline}; produce it on "
+              "the reference machine before gating")
+        return MISMATCH_STATUS
+
+    baseline_context, baseline = load_times(arguments.baseline,
+                                            arguments.metric)
+    current_context, current = load_times(arguments.current,
+                                          arguments.metric)
+
+    for key in ("host_name", "mhz_per_cpu"):
+        if baseline_context.get(key) != current_context.get(key):
+            print(f"warning: {key} differs, baseline "
+                  f"{baseline_context.get(key)} vs current "
+                  f"{current_context.get(key)}")
+    mismatches = [key for key in ("num_cpus", "library_build_type")
+                  if baseline_context.get(key) != current_context.get(key)]
+    for key in mismatches:
+        print(f"error: {key} differs, baseline "
+              f"{baseline_context.get(key)} vs current "
+              f"{current_context.get(key)}")
+    if baseline_context.get("library_build_type") != "release":
+        mismatches.append("library_build_type")
+        print("error: the baseline was run against a "
+              f"{baseline_context.get('library_build_type')} build of "
+              "Google Benchmark")
+    if mismatches:
+        print("\nThe reports do not compare; not gating")
+        return MISMATCH_STATUS
+
+    regressions = []
+    width = max((len(name) for name in current), default=4)
+    print(f"{'name':<{width}}  {'baseline':>12}  {'current':>12}  change")
+    for name, time in current.items():
+        if name not in baseline:
+            print(f"{name:<{width}}  {'-':>12}  {format_time(time):>12}  new")
+            continue
+        change = time / baseline[name] - 1.0
+        mark = ""
+        if change > arguments.threshold:
+            regressions.append(name)
+            mark = "  REGRESSION"
+        print(f"{name:<{width}}  {format_time(baseline[name]):>12}  "
+              f"{format_time(time):>12}  {change:+7.1%}{mark}")
+    for name in baseline:
+        if name not in current:
+            print(f"{name:<{width}}  missing from the current report")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) slower than "
+              f"{arguments.threshold:.0%} over the baseline")
+        return 1
+    print("\nNo regression over the baseline")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
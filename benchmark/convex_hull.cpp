@@ -0,0 +1,77 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/convex_hull.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Point2D;
+namespace data = programmers::geometry::benchmark_data;
+
+// What the hull cost before, every point sorted for the monotone chain.
+auto BenchmarkConvexHullSortAll(benchmark::State& state) -> void {
+  const auto points{data::CreateRandomPoints(state.range(0))};
+  const auto cross{[](const Point2D& o, const Point2D& a, const Point2D& b) {
+    return (a.GetX() - o.GetX()) * (b.GetY() - o.GetY()) -
+           (a.GetY() - o.GetY()) * (b.GetX() - o.GetX());
+  }};
+  for (auto _ : state) {
+    auto sorted{points};
+    std::sort(sorted.begin(), sorted.end(),
+              [](const Point2D& lhs, const Point2D& rhs) {
+                return lhs.GetX() < rhs.GetX() ||
+                       (lhs.GetX() == rhs.GetX() && lhs.GetY() < rhs.GetY());
+              });
+    // Lower chain forward, upper chain backward, each without its end.
+    std::vector<Point2D> hull;
+    for (int pass = 0; pass < 2; ++pass) {
+      const auto floor{hull.size()};
+      for (const auto& point : sorted) {
+        while (hull.size() >= floor + 2U &&
+               cross(hull[hull.size() - 2U], hull.back(), point) <= 0.0) {
+          hull.pop_back();
+        }
+        hull.push_back(point);
+      }
+      hull.pop_back();
+      std::reverse(sorted.begin(), sorted.end());
+    }
+    benchmark::DoNotOptimize(hull.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkConvexHullSortAll)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkConvexHullCompute(benchmark::State& state) -> void {
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(programmers::geometry::ComputeConvexHull(cloud));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkConvexHullCompute)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkConvexHullIncremental(benchmark::State& state) -> void {
+  const auto points{data::CreateRandomPoints(state.range(0))};
+  for (auto _ : state) {
+    programmers::geometry::IncrementalConvexHull hull;
+    for (const auto& point : points) {
+      hull.Append(point);
+    }
+    benchmark::DoNotOptimize(hull.GetVertexCount());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkConvexHullIncremental)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
@@ -0,0 +1,106 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/distance.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Distance;
+namespace data = programmers::geometry::benchmark_data;
+
+auto CreateRandomDistances(std::size_t count,
+                           Distance::Type unit = Distance::Type::kMeter)
+    -> std::vector<Distance> {
+  std::vector<Distance> distances;
+  distances.reserve(count);
+  for (const auto& point : data::CreateRandomPoints(count)) {
+    distances.emplace_back(point.GetX(), unit);
+  }
+  return distances;
+}
+
+// Constructing from every unit goes through the unit to nanometer scaling.
+auto BenchmarkDistanceConstruct(benchmark::State& state) -> void {
+  const auto unit{static_cast<Distance::Type>(state.range(0))};
+  const auto points{data::CreateRandomPoints(state.range(1))};
+  for (auto _ : state) {
+    for (const auto& point : points) {
+      benchmark::DoNotOptimize(Distance(point.GetX(), unit));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BenchmarkDistanceConstruct)
+    ->ArgsProduct({benchmark::CreateDenseRange(0, 5, 1),
+                   {data::kMinimumCount}});
+
+auto BenchmarkDistanceGetValue(benchmark::State& state) -> void {
+  const auto unit{static_cast<Distance::Type>(state.range(0))};
+  const auto distances{CreateRandomDistances(state.range(1))};
+  for (auto _ : state) {
+    double sum{0.0};
+    for (const auto& distance : distances) {
+      sum += distance.GetValue(unit);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BenchmarkDistanceGetValue)
+    ->ArgsProduct({benchmark::CreateDenseRange(0, 5, 1),
+                   {data::kMinimumCount}});
+
+auto BenchmarkDistanceAdd(benchmark::State& state) -> void {
+  // Millimeters, so that the checked sum of kMaximumCount distances fits
+  // int64_t nanometers.
+  const auto distances{
+      CreateRandomDistances(state.range(0), Distance::Type::kMillimeter)};
+  for (auto _ : state) {
+    Distance sum(0.0);
+    for (const auto& distance : distances) {
+      sum += distance;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkDistanceAdd)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkDistanceSubtractAndScale(benchmark::State& state) -> void {
+  const auto distances{CreateRandomDistances(state.range(0))};
+  std::vector<Distance> output(distances.size(), Distance(0.0));
+  for (auto _ : state) {
+    for (std::size_t i = 1; i < distances.size(); ++i) {
+      output[i] = (distances[i] - distances[i - 1U]) * 0.5;
+    }
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkDistanceSubtractAndScale)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkDistanceCompare(benchmark::State& state) -> void {
+  const auto distances{CreateRandomDistances(state.range(0))};
+  const Distance threshold(data::kCoordinateRange / 2.0);
+  for (auto _ : state) {
+    std::size_t count{0U};
+    for (const auto& distance : distances) {
+      count += distance < threshold ? 1U : 0U;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkDistanceCompare)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
@@ -0,0 +1,53 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/distance_accumulator.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Distance;
+using programmers::geometry::DistanceAccumulator;
+namespace data = programmers::geometry::benchmark_data;
+
+auto CreateRandomDistances(std::size_t count) -> std::vector<Distance> {
+  std::vector<Distance> distances;
+  distances.reserve(count);
+  for (const auto& point : data::CreateRandomPoints(count)) {
+    distances.emplace_back(point.GetX());
+  }
+  return distances;
+}
+
+// One distance at a time, the same loop as Distance::operator+=.
+auto BenchmarkDistanceAccumulatorAdd(benchmark::State& state) -> void {
+  const auto distances{CreateRandomDistances(state.range(0))};
+  for (auto _ : state) {
+    DistanceAccumulator accumulator;
+    for (const auto& distance : distances) {
+      accumulator += distance;
+    }
+    benchmark::DoNotOptimize(accumulator.GetNanometer());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkDistanceAccumulatorAdd)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkDistanceAccumulatorAddBatch(benchmark::State& state) -> void {
+  const auto distances{CreateRandomDistances(state.range(0))};
+  for (auto _ : state) {
+    DistanceAccumulator accumulator;
+    accumulator.Add(distances);
+    benchmark::DoNotOptimize(accumulator.GetNanometer());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkDistanceAccumulatorAddBatch)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
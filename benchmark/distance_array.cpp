@@ -0,0 +1,84 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/distance_array.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Distance;
+using programmers::geometry::DistanceArray;
+namespace data = programmers::geometry::benchmark_data;
+
+auto CreateRandomValues(std::size_t count) -> std::vector<double> {
+  std::vector<double> values;
+  values.reserve(count);
+  for (const auto& point : data::CreateRandomPoints(count)) {
+    values.push_back(point.GetX());
+  }
+  return values;
+}
+
+// One Distance::GetValue per element, what callers did before DistanceArray.
+auto BenchmarkDistanceGetValueLoop(benchmark::State& state) -> void {
+  const DistanceArray array(CreateRandomValues(state.range(0)).data(),
+                            state.range(0), Distance::Type::kMeter);
+  const auto distances{array.ToDistances()};
+  std::vector<double> values(distances.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < distances.size(); ++i) {
+      values[i] = distances[i].GetValue(Distance::Type::kMillimeter);
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkDistanceGetValueLoop)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkDistanceArrayGetValues(benchmark::State& state) -> void {
+  const DistanceArray array(CreateRandomValues(state.range(0)).data(),
+                            state.range(0), Distance::Type::kMeter);
+  std::vector<double> values(array.Size());
+  for (auto _ : state) {
+    array.GetValues(Distance::Type::kMillimeter, values.data());
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkDistanceArrayGetValues)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkDistanceConstructorLoop(benchmark::State& state) -> void {
+  const auto values{CreateRandomValues(state.range(0))};
+  std::vector<Distance> distances(values.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      distances[i] = Distance(values[i], Distance::Type::kMillimeter);
+    }
+    benchmark::DoNotOptimize(distances.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkDistanceConstructorLoop)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkDistanceArraySetValues(benchmark::State& state) -> void {
+  const auto values{CreateRandomValues(state.range(0))};
+  DistanceArray array(values.size());
+  for (auto _ : state) {
+    array.SetValues(values.data(), values.size(), Distance::Type::kMillimeter);
+    benchmark::DoNotOptimize(array.Data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkDistanceArraySetValues)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
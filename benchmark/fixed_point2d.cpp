@@ -0,0 +1,45 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/fixed_point2d.hpp"
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::FixedPoint2D;
+using programmers::geometry::Int128;
+using programmers::geometry::Point2D;
+namespace data = programmers::geometry::benchmark_data;
+
+auto BenchmarkFixedPoint2DFromPoints(benchmark::State& state) -> void {
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(FixedPoint2D::FromPoints(cloud));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkFixedPoint2DFromPoints)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+// Same loop as BenchmarkPoint2DCalculateSquaredDistance, exact in Int128.
+auto BenchmarkFixedPoint2DCalculateSquaredDistance(benchmark::State& state)
+    -> void {
+  const auto points{
+      FixedPoint2D::FromPoints(data::CreateRandomCloud(state.range(0)))};
+  const auto target{FixedPoint2D::FromPoint2D(Point2D(
+      data::kCoordinateRange / 2.0, data::kCoordinateRange / 2.0))};
+  for (auto _ : state) {
+    Int128 sum;
+    for (const auto& point : points) {
+      sum += point.CalculateSquaredDistance(target);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkFixedPoint2DCalculateSquaredDistance)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
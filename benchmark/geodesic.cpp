@@ -0,0 +1,76 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/geodesic.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::GeodesicCloud;
+using programmers::geometry::GeodesicModel;
+using programmers::geometry::Point2D;
+using programmers::geometry::PointCloud2D;
+namespace data = programmers::geometry::benchmark_data;
+
+auto CreateRandomCoordinates(std::size_t count) -> PointCloud2D {
+  PointCloud2D cloud;
+  cloud.Reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    cloud.PushBack(static_cast<double>(std::rand()) / RAND_MAX * 60.0 + 100.0,
+                   static_cast<double>(std::rand()) / RAND_MAX * 60.0 - 10.0);
+  }
+  return cloud;
+}
+
+// One haversine per pair, what one-to-many queries did before.
+auto BenchmarkGeodesicHaversine(benchmark::State& state) -> void {
+  const auto cloud{CreateRandomCoordinates(state.range(0))};
+  const Point2D target(126.9780, 37.5665);
+  std::vector<double> output(cloud.Size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < cloud.Size(); ++i) {
+      output[i] = programmers::geometry::CalculateGeodesicDistance(
+                      cloud.GetPoint(i), target)
+                      .GetValue(programmers::geometry::Distance::Type::kMeter);
+    }
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkGeodesicHaversine)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkGeodesicCloudSpherical(benchmark::State& state) -> void {
+  const GeodesicCloud cloud(CreateRandomCoordinates(state.range(0)));
+  const Point2D target(126.9780, 37.5665);
+  std::vector<double> output(cloud.Size());
+  for (auto _ : state) {
+    cloud.CalculateDistances(target, output.data());
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkGeodesicCloudSpherical)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkGeodesicCloudEllipsoidal(benchmark::State& state) -> void {
+  const GeodesicCloud cloud(CreateRandomCoordinates(state.range(0)));
+  const Point2D target(126.9780, 37.5665);
+  std::vector<double> output(cloud.Size());
+  for (auto _ : state) {
+    cloud.CalculateDistances(target, output.data(),
+                             GeodesicModel::kEllipsoidal);
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkGeodesicCloudEllipsoidal)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
@@ -0,0 +1,57 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/kd_tree2d.hpp"
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::KdTree2D;
+using programmers::geometry::Point2D;
+namespace data = programmers::geometry::benchmark_data;
+
+constexpr int64_t kQueryCount{1 << 10};
+
+auto BenchmarkKdTree2DBuild(benchmark::State& state) -> void {
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(KdTree2D(cloud));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkKdTree2DBuild)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+auto BenchmarkKdTree2DFindNearest(benchmark::State& state) -> void {
+  const KdTree2D tree(data::CreateRandomCloud(state.range(0)));
+  const auto queries{data::CreateRandomPoints(kQueryCount)};
+  for (auto _ : state) {
+    for (const auto& query : queries) {
+      benchmark::DoNotOptimize(tree.FindNearest(query, 8U));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kQueryCount);
+}
+BENCHMARK(BenchmarkKdTree2DFindNearest)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkKdTree2DFindWithinRadius(benchmark::State& state) -> void {
+  const KdTree2D tree(data::CreateRandomCloud(state.range(0)));
+  const auto queries{data::CreateRandomPoints(kQueryCount)};
+  for (auto _ : state) {
+    for (const auto& query : queries) {
+      benchmark::DoNotOptimize(
+          tree.FindWithinRadius(query, data::kCoordinateRange / 256.0));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kQueryCount);
+}
+BENCHMARK(BenchmarkKdTree2DFindWithinRadius)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
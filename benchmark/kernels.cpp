@@ -0,0 +1,94 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/kernels.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::kernels::Isa;
+namespace kernels = programmers::geometry::kernels;
+namespace data = programmers::geometry::benchmark_data;
+
+/**
+ * @brief Activate the instruction set of the benchmark, false to skip it
+ */
+auto ActivateIsa(benchmark::State& state) -> bool {
+  const auto isa{static_cast<Isa>(state.range(1))};
+  if (kernels::SetActiveIsa(isa) != isa) {
+    kernels::ResetActiveIsa();
+    state.SkipWithError("The host cannot run this instruction set");
+    return false;
+  }
+  state.SetLabel(kernels::GetIsaName(isa));
+  return true;
+}
+
+auto ApplyIsaArguments(benchmark::internal::Benchmark* benchmark) -> void {
+  benchmark->ArgNames({"count", "isa"});
+  for (auto count = data::kMinimumCount; count <= data::kMaximumCount;
+       count *= data::kCountMultiplier) {
+    for (const auto isa :
+         {Isa::kScalar, Isa::kSse2, Isa::kAvx2, Isa::kAvx512}) {
+      benchmark->Args({count, static_cast<int64_t>(isa)});
+    }
+  }
+}
+
+auto BenchmarkKernelsCalculateDistances(benchmark::State& state) -> void {
+  if (!ActivateIsa(state)) {
+    return;
+  }
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  std::vector<double> output(cloud.Size());
+  for (auto _ : state) {
+    kernels::CalculateDistances(cloud.XData(), cloud.YData(), cloud.Size(),
+                                1.0, 2.0, output.data());
+    benchmark::ClobberMemory();
+  }
+  kernels::ResetActiveIsa();
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkKernelsCalculateDistances)->Apply(ApplyIsaArguments);
+
+auto BenchmarkKernelsCalculateSquaredDistances(benchmark::State& state)
+    -> void {
+  if (!ActivateIsa(state)) {
+    return;
+  }
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  std::vector<double> output(cloud.Size());
+  for (auto _ : state) {
+    kernels::CalculateSquaredDistances(cloud.XData(), cloud.YData(),
+                                       cloud.Size(), 1.0, 2.0, output.data());
+    benchmark::ClobberMemory();
+  }
+  kernels::ResetActiveIsa();
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkKernelsCalculateSquaredDistances)->Apply(ApplyIsaArguments);
+
+auto BenchmarkKernelsEncodeHilbert(benchmark::State& state) -> void {
+  if (!ActivateIsa(state)) {
+    return;
+  }
+  const auto count{static_cast<std::size_t>(state.range(0))};
+  std::vector<uint32_t> xs(count);
+  std::vector<uint32_t> ys(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    xs[i] = static_cast<uint32_t>(i * 2654435761U);
+    ys[i] = static_cast<uint32_t>(i * 40503U);
+  }
+  std::vector<uint64_t> output(count);
+  for (auto _ : state) {
+    kernels::EncodeHilbert(xs.data(), ys.data(), count, output.data());
+    benchmark::ClobberMemory();
+  }
+  kernels::ResetActiveIsa();
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkKernelsEncodeHilbert)->Apply(ApplyIsaArguments);
+}  // namespace
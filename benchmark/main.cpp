@@ -0,0 +1,17 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+
+auto main(int32_t argc, char **argv) -> int32_t {
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+
+  return 0;
+}
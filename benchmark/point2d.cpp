@@ -0,0 +1,86 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/point2d.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Point2D;
+using programmers::geometry::Point2F;
+namespace data = programmers::geometry::benchmark_data;
+
+auto BenchmarkPoint2DCalculateDistance(benchmark::State& state) -> void {
+  const auto points{data::CreateRandomPoints(state.range(0))};
+  const Point2D target(data::kCoordinateRange / 2.0,
+                       data::kCoordinateRange / 2.0);
+  for (auto _ : state) {
+    double sum{0.0};
+    for (const auto& point : points) {
+      sum += point.CalculateDistance(target);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkPoint2DCalculateDistance)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkPoint2DCalculateSquaredDistance(benchmark::State& state)
+    -> void {
+  const auto points{data::CreateRandomPoints(state.range(0))};
+  const Point2D target(data::kCoordinateRange / 2.0,
+                       data::kCoordinateRange / 2.0);
+  for (auto _ : state) {
+    double sum{0.0};
+    for (const auto& point : points) {
+      sum += point.CalculateSquaredDistance(target);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkPoint2DCalculateSquaredDistance)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkPoint2DFilterWithinRadius(benchmark::State& state) -> void {
+  const auto points{data::CreateRandomPoints(state.range(0))};
+  const Point2D center(data::kCoordinateRange / 2.0,
+                       data::kCoordinateRange / 2.0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Point2D::FilterWithinRadius(
+        points, center, data::kCoordinateRange / 4.0));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkPoint2DFilterWithinRadius)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+// Same loop as BenchmarkPoint2DCalculateSquaredDistance on 8-byte points.
+auto BenchmarkPoint2FCalculateSquaredDistance(benchmark::State& state)
+    -> void {
+  std::vector<Point2F> points;
+  for (const auto& point : data::CreateRandomPoints(state.range(0))) {
+    points.emplace_back(point);
+  }
+  const Point2F target(static_cast<float>(data::kCoordinateRange / 2.0),
+                       static_cast<float>(data::kCoordinateRange / 2.0));
+  for (auto _ : state) {
+    float sum{0.0F};
+    for (const auto& point : points) {
+      sum += point.CalculateSquaredDistance(target);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkPoint2FCalculateSquaredDistance)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
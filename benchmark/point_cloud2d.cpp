@@ -0,0 +1,62 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/point_cloud2d.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Point2D;
+namespace data = programmers::geometry::benchmark_data;
+
+auto BenchmarkPointCloud2DCalculateDistances(benchmark::State& state)
+    -> void {
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  const Point2D target(data::kCoordinateRange / 2.0,
+                       data::kCoordinateRange / 2.0);
+  std::vector<double> output(cloud.Size());
+  for (auto _ : state) {
+    cloud.CalculateDistances(target, output.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 3 *
+                          static_cast<int64_t>(sizeof(double)));
+}
+BENCHMARK(BenchmarkPointCloud2DCalculateDistances)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkPointCloud2DFilterWithinRadius(benchmark::State& state)
+    -> void {
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  const Point2D center(data::kCoordinateRange / 2.0,
+                       data::kCoordinateRange / 2.0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        cloud.FilterWithinRadius(center, data::kCoordinateRange / 4.0));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkPointCloud2DFilterWithinRadius)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkPointCloud2DTranslate(benchmark::State& state) -> void {
+  auto cloud{data::CreateRandomCloud(state.range(0))};
+  const Point2D offset(1.0, -1.0);
+  for (auto _ : state) {
+    cloud.Translate(offset);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 4 *
+                          static_cast<int64_t>(sizeof(double)));
+}
+BENCHMARK(BenchmarkPointCloud2DTranslate)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
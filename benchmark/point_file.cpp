@@ -0,0 +1,88 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/point_file.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Point2D;
+using programmers::geometry::PointFileReader;
+namespace data = programmers::geometry::benchmark_data;
+
+auto GetTemporaryPath(const std::string& name) -> std::string {
+  return (std::filesystem::temp_directory_path() /
+          ("geometry_benchmark_" + name))
+      .string();
+}
+
+// What loading a point layer did before, parsing one text line per point.
+auto BenchmarkPointFileParseText(benchmark::State& state) -> void {
+  const auto path{GetTemporaryPath("points.txt")};
+  {
+    const auto cloud{data::CreateRandomCloud(state.range(0))};
+    std::ofstream file(path);
+    file.precision(17);
+    for (std::size_t i = 0; i < cloud.Size(); ++i) {
+      file << cloud.GetX(i) << ',' << cloud.GetY(i) << '\n';
+    }
+  }
+  for (auto _ : state) {
+    std::ifstream file(path);
+    std::vector<Point2D> points;
+    std::string line;
+    while (std::getline(file, line)) {
+      char* end{nullptr};
+      const auto x{std::strtod(line.c_str(), &end)};
+      const auto y{std::strtod(end + 1, nullptr)};
+      points.emplace_back(x, y);
+    }
+    benchmark::DoNotOptimize(points.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  std::remove(path.c_str());
+}
+BENCHMARK(BenchmarkPointFileParseText)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkPointFileMapAndScan(benchmark::State& state) -> void {
+  const auto path{GetTemporaryPath("points.bin")};
+  programmers::geometry::WritePointFile(
+      path, data::CreateRandomCloud(state.range(0)));
+  for (auto _ : state) {
+    const PointFileReader reader(path);
+    double sum{0.0};
+    for (std::size_t i = 0; i < reader.Size(); ++i) {
+      sum += reader.XData()[i] + reader.YData()[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  std::remove(path.c_str());
+}
+BENCHMARK(BenchmarkPointFileMapAndScan)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkPointFileWrite(benchmark::State& state) -> void {
+  const auto path{GetTemporaryPath("written.bin")};
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  for (auto _ : state) {
+    programmers::geometry::WritePointFile(path, cloud);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  std::remove(path.c_str());
+}
+BENCHMARK(BenchmarkPointFileWrite)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
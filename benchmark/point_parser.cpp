@@ -0,0 +1,80 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/point_parser.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Point2D;
+namespace data = programmers::geometry::benchmark_data;
+
+auto CreateCsv(std::size_t count) -> std::string {
+  const auto cloud{data::CreateRandomCloud(count)};
+  std::ostringstream text;
+  text.precision(17);
+  for (std::size_t i = 0; i < cloud.Size(); ++i) {
+    text << cloud.GetX(i) << ',' << cloud.GetY(i) << '\n';
+  }
+  return text.str();
+}
+
+// What ingest did before, one iostream extraction per coordinate.
+auto BenchmarkPointParserStream(benchmark::State& state) -> void {
+  const auto text{CreateCsv(state.range(0))};
+  for (auto _ : state) {
+    std::istringstream stream(text);
+    std::vector<Point2D> points;
+    double x{0.0};
+    double y{0.0};
+    char comma{'\0'};
+    while (stream >> x >> comma >> y) {
+      points.emplace_back(x, y);
+    }
+    benchmark::DoNotOptimize(points.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BenchmarkPointParserStream)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkPointParserCsv(benchmark::State& state) -> void {
+  const auto text{CreateCsv(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(programmers::geometry::ParseCsvPoints(text));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BenchmarkPointParserCsv)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkPointParserWkt(benchmark::State& state) -> void {
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  std::ostringstream stream;
+  stream.precision(17);
+  for (std::size_t i = 0; i < cloud.Size(); ++i) {
+    stream << "POINT (" << cloud.GetX(i) << ' ' << cloud.GetY(i) << ")\n";
+  }
+  const auto text{stream.str()};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(programmers::geometry::ParseWkt(text));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BenchmarkPointParserWkt)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
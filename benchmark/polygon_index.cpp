@@ -0,0 +1,91 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/polygon_index.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Point2D;
+using programmers::geometry::Polygon2D;
+using programmers::geometry::PolygonIndex;
+namespace data = programmers::geometry::benchmark_data;
+
+constexpr std::size_t kPolygonCount{1024U};    ///< Polygons of every run
+constexpr std::size_t kVertexCount{64U};       ///< Vertices of a polygon
+constexpr int64_t kMaximumScanCount{1 << 11};  ///< Points of ScanAll
+
+/**
+ * @brief Create regular polygons with a hole spread over the points
+ */
+auto CreatePolygons() -> std::vector<Polygon2D> {
+  std::vector<Polygon2D> polygons;
+  for (const auto& center : data::CreateRandomPoints(kPolygonCount)) {
+    const auto ring{[&](double radius) {
+      Polygon2D::Ring points;
+      for (std::size_t i = 0; i < kVertexCount; ++i) {
+        const auto angle{6.283185307179586 * static_cast<double>(i) /
+                         kVertexCount};
+        points.emplace_back(center.GetX() + radius * std::cos(angle),
+                            center.GetY() + radius * std::sin(angle));
+      }
+      return points;
+    }};
+    polygons.emplace_back(ring(200.0), std::vector<Polygon2D::Ring>{
+                                           ring(50.0)});
+  }
+  return polygons;
+}
+
+// What lookups did before the index, every polygon for every point.
+auto BenchmarkPolygonIndexScanAll(benchmark::State& state) -> void {
+  const auto polygons{CreatePolygons()};
+  const auto points{data::CreateRandomPoints(state.range(0))};
+  std::vector<std::size_t> output(points.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      output[i] = PolygonIndex::kNotFound;
+      for (std::size_t k = 0; k < polygons.size(); ++k) {
+        if (polygons[k].Contains(points[i])) {
+          output[i] = k;
+          break;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkPolygonIndexScanAll)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, kMaximumScanCount);
+
+auto BenchmarkPolygonIndexBuild(benchmark::State& state) -> void {
+  const auto polygons{CreatePolygons()};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(PolygonIndex(polygons));
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(polygons.size()));
+}
+BENCHMARK(BenchmarkPolygonIndexBuild);
+
+auto BenchmarkPolygonIndexFindContaining(benchmark::State& state) -> void {
+  const PolygonIndex index(CreatePolygons());
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  std::vector<std::size_t> output(cloud.Size());
+  for (auto _ : state) {
+    index.FindContaining(cloud.XData(), cloud.YData(), cloud.Size(),
+                         output.data());
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkPolygonIndexFindContaining)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
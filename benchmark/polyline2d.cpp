@@ -0,0 +1,78 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/polyline2d.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Distance;
+using programmers::geometry::DistanceArray;
+using programmers::geometry::Point2D;
+using programmers::geometry::Polyline2D;
+namespace data = programmers::geometry::benchmark_data;
+
+constexpr int64_t kQueryCount{1 << 10};
+
+/**
+ * @brief Random walk through the random points, a vehicle like track
+ */
+auto CreateTrajectory(std::size_t count) -> std::vector<Point2D> {
+  auto points{data::CreateRandomPoints(count)};
+  Point2D position;
+  for (auto& point : points) {
+    position += (point - Point2D(data::kCoordinateRange / 2.0,
+                                 data::kCoordinateRange / 2.0)) /
+                1.0e+3;
+    point = position;
+  }
+  return points;
+}
+
+// What callers did before Polyline2D, re-walking the points for the length.
+auto BenchmarkPolyline2DWalkLength(benchmark::State& state) -> void {
+  const auto points{CreateTrajectory(state.range(0))};
+  for (auto _ : state) {
+    double length{0.0};
+    for (std::size_t i = 1; i < points.size(); ++i) {
+      length += points[i - 1U].CalculateDistance(points[i]);
+    }
+    benchmark::DoNotOptimize(length);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkPolyline2DWalkLength)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkPolyline2DInterpolate(benchmark::State& state) -> void {
+  const Polyline2D polyline(CreateTrajectory(state.range(0)));
+  DistanceArray alongs;
+  for (int64_t i = 0; i < kQueryCount; ++i) {
+    alongs.PushBack(polyline.GetLength() / kQueryCount * i);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(polyline.Interpolate(alongs));
+  }
+  state.SetItemsProcessed(state.iterations() * kQueryCount);
+}
+BENCHMARK(BenchmarkPolyline2DInterpolate)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkPolyline2DFindNearest(benchmark::State& state) -> void {
+  const auto points{CreateTrajectory(state.range(0))};
+  const Polyline2D polyline(points);
+  const auto queries{data::CreateRandomCloud(kQueryCount)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(polyline.FindNearest(queries));
+  }
+  state.SetItemsProcessed(state.iterations() * kQueryCount);
+}
+BENCHMARK(BenchmarkPolyline2DFindNearest)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
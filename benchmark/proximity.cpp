@@ -0,0 +1,68 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/proximity.hpp"
+
+#include <cmath>
+#include <limits>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::PointPair;
+namespace data = programmers::geometry::benchmark_data;
+
+constexpr int64_t kMaximumBruteForceCount{1 << 14};
+
+// What closest pair cost before, every pair of points compared.
+auto BenchmarkProximityClosestPairBruteForce(benchmark::State& state)
+    -> void {
+  const auto points{data::CreateRandomPoints(state.range(0))};
+  for (auto _ : state) {
+    auto best{std::numeric_limits<double>::infinity()};
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      for (auto j = i + 1U; j < points.size(); ++j) {
+        const auto distance{points[i].CalculateDistance(points[j])};
+        best = distance < best ? distance : best;
+      }
+    }
+    benchmark::DoNotOptimize(best);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkProximityClosestPairBruteForce)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, kMaximumBruteForceCount);
+
+auto BenchmarkProximityClosestPair(benchmark::State& state) -> void {
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(programmers::geometry::FindClosestPair(cloud));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkProximityClosestPair)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+// About 100 neighbors per point whatever the count.
+auto BenchmarkProximityPairsWithin(benchmark::State& state) -> void {
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  const auto radius{data::kCoordinateRange *
+                    std::sqrt(32.0 / static_cast<double>(state.range(0)))};
+  std::size_t count{0U};
+  for (auto _ : state) {
+    count = programmers::geometry::FindPairsWithin(
+        cloud, radius, [](const PointPair* pairs, std::size_t size) {
+          benchmark::DoNotOptimize(pairs);
+          benchmark::DoNotOptimize(size);
+        });
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["pairs"] = static_cast<double>(count);
+}
+BENCHMARK(BenchmarkProximityPairsWithin)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
@@ -0,0 +1,61 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/quantity.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Distance;
+using programmers::geometry::Kilometers;
+using programmers::geometry::Meters;
+namespace data = programmers::geometry::benchmark_data;
+
+// The runtime Distance::Type path, for comparison with the folded one below.
+auto BenchmarkQuantityRuntimeConvert(benchmark::State& state) -> void {
+  const auto points{data::CreateRandomPoints(state.range(0))};
+  for (auto _ : state) {
+    double sum{0.0};
+    for (const auto& point : points) {
+      sum += Distance(point.GetX(), Distance::Type::kKilometer)
+                 .GetValue(Distance::Type::kMeter);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkQuantityRuntimeConvert)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkQuantityConvert(benchmark::State& state) -> void {
+  const auto points{data::CreateRandomPoints(state.range(0))};
+  for (auto _ : state) {
+    double sum{0.0};
+    for (const auto& point : points) {
+      sum += Meters(Kilometers(point.GetX())).GetValue();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkQuantityConvert)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkQuantityToDistance(benchmark::State& state) -> void {
+  const auto points{data::CreateRandomPoints(state.range(0))};
+  for (auto _ : state) {
+    for (const auto& point : points) {
+      benchmark::DoNotOptimize(static_cast<Distance>(Kilometers(point.GetX())));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkQuantityToDistance)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
@@ -0,0 +1,86 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/segment_intersection.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Point2D;
+using programmers::geometry::Segment2D;
+using programmers::geometry::SegmentPair;
+namespace data = programmers::geometry::benchmark_data;
+
+constexpr int64_t kMaximumBruteForceCount{1 << 12};  ///< Segments of Pairs
+constexpr double kSegmentLength{20.0};               ///< Side of offsets
+
+/**
+ * @brief Create short segments starting from random points
+ */
+auto CreateSegments(std::size_t count) -> std::vector<Segment2D> {
+  const auto starts{data::CreateRandomPoints(count)};
+  const auto offsets{data::CreateRandomPoints(count)};
+  std::vector<Segment2D> segments;
+  segments.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const Point2D offset(offsets[i].GetX() / 1.0e4 - 0.5,
+                         offsets[i].GetY() / 1.0e4 - 0.5);
+    segments.emplace_back(starts[i], starts[i] + offset * kSegmentLength);
+  }
+  return segments;
+}
+
+// What validation did before, every segment against every other.
+auto BenchmarkSegmentIntersectionPairs(benchmark::State& state) -> void {
+  const auto segments{CreateSegments(state.range(0))};
+  for (auto _ : state) {
+    std::size_t found{0U};
+    for (std::size_t i = 0; i < segments.size(); ++i) {
+      for (std::size_t j = i + 1U; j < segments.size(); ++j) {
+        found += segments[i].Intersects(segments[j]) ? 1U : 0U;
+      }
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkSegmentIntersectionPairs)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, kMaximumBruteForceCount);
+
+auto BenchmarkSegmentIntersectionFind(benchmark::State& state) -> void {
+  const auto segments{CreateSegments(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(programmers::geometry::FindIntersections(
+        segments, [](const SegmentPair* pairs, std::size_t count) {
+          benchmark::DoNotOptimize(pairs);
+          benchmark::DoNotOptimize(count);
+        }));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkSegmentIntersectionFind)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkSegmentIntersectionHas(benchmark::State& state) -> void {
+  // A disjoint grid of segments, so the search has to visit every cell.
+  std::vector<Segment2D> segments;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    const Point2D start(static_cast<double>(i % 1024) * 2.0,
+                        static_cast<double>(i / 1024) * 2.0);
+    segments.emplace_back(start, start + Point2D(1.0, 1.0));
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        programmers::geometry::HasIntersection(segments));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkSegmentIntersectionHas)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
@@ -0,0 +1,76 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/simplification.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Distance;
+using programmers::geometry::Point2D;
+using programmers::geometry::StreamingSimplifier;
+namespace data = programmers::geometry::benchmark_data;
+
+const Distance kTolerance(1.0, Distance::Type::kMeter);
+
+/**
+ * @brief Random walk through the random points, a vehicle like track
+ */
+auto CreateTrajectory(std::size_t count) -> std::vector<Point2D> {
+  auto points{data::CreateRandomPoints(count)};
+  Point2D position;
+  for (auto& point : points) {
+    position += (point - Point2D(data::kCoordinateRange / 2.0,
+                                 data::kCoordinateRange / 2.0)) /
+                1.0e+3;
+    point = position;
+  }
+  return points;
+}
+
+auto BenchmarkSimplifyDouglasPeucker(benchmark::State& state) -> void {
+  const auto points{CreateTrajectory(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        programmers::geometry::ComputeDouglasPeucker(points, kTolerance));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkSimplifyDouglasPeucker)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkSimplifyVisvalingamWhyatt(benchmark::State& state) -> void {
+  const auto points{CreateTrajectory(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        programmers::geometry::ComputeVisvalingamWhyatt(points, kTolerance));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkSimplifyVisvalingamWhyatt)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkSimplifyStreaming(benchmark::State& state) -> void {
+  const auto points{CreateTrajectory(state.range(0))};
+  std::vector<Point2D> output;
+  output.reserve(points.size());
+  for (auto _ : state) {
+    output.clear();
+    StreamingSimplifier simplifier(kTolerance);
+    for (const auto& point : points) {
+      simplifier.Push(point, output);
+    }
+    simplifier.Flush(output);
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkSimplifyStreaming)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
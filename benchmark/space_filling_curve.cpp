@@ -0,0 +1,46 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/space_filling_curve.hpp"
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::CurveQuantizer;
+using programmers::geometry::SpaceFillingCurve;
+namespace geometry = programmers::geometry;
+namespace data = programmers::geometry::benchmark_data;
+
+auto BenchmarkComputeCurveKeys(benchmark::State& state) -> void {
+  const auto curve{static_cast<SpaceFillingCurve>(state.range(1))};
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  const CurveQuantizer quantizer(cloud);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        geometry::ComputeCurveKeys(cloud, quantizer, curve));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkComputeCurveKeys)
+    ->ArgNames({"count", "hilbert"})
+    ->ArgsProduct({benchmark::CreateRange(data::kMinimumCount,
+                                          data::kMaximumCount,
+                                          data::kCountMultiplier),
+                   {0, 1}})
+    ->UseRealTime();
+
+auto BenchmarkSortByKey(benchmark::State& state) -> void {
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  const auto keys{geometry::ComputeCurveKeys(cloud, CurveQuantizer(cloud),
+                                             SpaceFillingCurve::kHilbert)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(geometry::SortByKey(keys));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkSortByKey)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount)
+    ->UseRealTime();
+}  // namespace
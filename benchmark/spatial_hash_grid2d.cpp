@@ -0,0 +1,75 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/spatial_hash_grid2d.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Distance;
+using programmers::geometry::Neighbor;
+using programmers::geometry::Point2D;
+using programmers::geometry::SpatialHashGrid2D;
+namespace data = programmers::geometry::benchmark_data;
+
+constexpr int64_t kQueryCount{1 << 10};
+constexpr double kCellSize{data::kCoordinateRange / 256.0};
+
+auto BenchmarkSpatialHashGrid2DInsert(benchmark::State& state) -> void {
+  const auto points{data::CreateRandomPoints(state.range(0))};
+  SpatialHashGrid2D grid{Distance(kCellSize)};
+  grid.Reserve(points.size());
+  for (auto _ : state) {
+    grid.Clear();
+    for (const auto& point : points) {
+      benchmark::DoNotOptimize(grid.Insert(point));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkSpatialHashGrid2DInsert)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkSpatialHashGrid2DMove(benchmark::State& state) -> void {
+  const auto points{data::CreateRandomPoints(state.range(0))};
+  SpatialHashGrid2D grid{Distance(kCellSize)};
+  std::vector<SpatialHashGrid2D::Handle> handles;
+  for (const auto& point : points) {
+    handles.push_back(grid.Insert(point));
+  }
+  double step{kCellSize / 2.0};
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < handles.size(); ++i) {
+      grid.Move(handles[i], points[i] + Point2D(step, step));
+    }
+    step = -step;
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkSpatialHashGrid2DMove)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkSpatialHashGrid2DFindNearest(benchmark::State& state) -> void {
+  SpatialHashGrid2D grid{Distance(kCellSize)};
+  for (const auto& point : data::CreateRandomPoints(state.range(0))) {
+    grid.Insert(point);
+  }
+  const auto queries{data::CreateRandomPoints(kQueryCount)};
+  std::vector<Neighbor> found;
+  for (auto _ : state) {
+    for (const auto& query : queries) {
+      grid.FindNearest(query, 8U, found);
+      benchmark::DoNotOptimize(found.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kQueryCount);
+}
+BENCHMARK(BenchmarkSpatialHashGrid2DFindNearest)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
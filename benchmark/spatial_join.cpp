@@ -0,0 +1,93 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/spatial_join.hpp"
+
+#include <cmath>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+#include "geometry/kd_tree2d.hpp"
+
+namespace {
+using programmers::geometry::PointPair;
+namespace data = programmers::geometry::benchmark_data;
+namespace geometry = programmers::geometry;
+
+constexpr std::size_t kRightDivisor{16U};  ///< Left points per right point
+
+// About 10 right points within radius of every left point.
+auto GetRadius(int64_t count) -> double {
+  return data::kCoordinateRange *
+         std::sqrt(3.2 * kRightDivisor / static_cast<double>(count));
+}
+
+auto IgnorePairs(const PointPair* pairs, std::size_t size) -> void {
+  benchmark::DoNotOptimize(pairs);
+  benchmark::DoNotOptimize(size);
+}
+
+// What the join did before, one radius query per left point.
+auto BenchmarkSpatialJoinKdTreeQueries(benchmark::State& state) -> void {
+  const auto left{data::CreateRandomCloud(state.range(0))};
+  const auto right{
+      data::CreateRandomCloud(state.range(0) / kRightDivisor)};
+  const auto radius{GetRadius(state.range(0))};
+  for (auto _ : state) {
+    const geometry::KdTree2D tree(right);
+    benchmark::DoNotOptimize(tree.FindWithinRadius(left, radius));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkSpatialJoinKdTreeQueries)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkSpatialJoinWithin(benchmark::State& state) -> void {
+  const auto left{data::CreateRandomCloud(state.range(0))};
+  const auto right{
+      data::CreateRandomCloud(state.range(0) / kRightDivisor)};
+  const auto radius{GetRadius(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        geometry::JoinWithin(left, right, radius, IgnorePairs));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkSpatialJoinWithin)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+// A quarter of the working memory, so the strips go through spill files.
+auto BenchmarkSpatialJoinWithinSpilled(benchmark::State& state) -> void {
+  const auto left{data::CreateRandomCloud(state.range(0))};
+  const auto right{
+      data::CreateRandomCloud(state.range(0) / kRightDivisor)};
+  const auto radius{GetRadius(state.range(0))};
+  geometry::SpatialJoinOptions options;
+  options.memory_limit = (left.Size() + right.Size()) *
+                         geometry::SpatialJoinOptions::kBytesPerPoint / 4U;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        geometry::JoinWithin(left, right, radius, IgnorePairs, options));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkSpatialJoinWithinSpilled)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkSpatialJoinNearest(benchmark::State& state) -> void {
+  const auto left{data::CreateRandomCloud(state.range(0))};
+  const auto right{
+      data::CreateRandomCloud(state.range(0) / kRightDivisor)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        geometry::JoinNearest(left, right, 1U, IgnorePairs));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkSpatialJoinNearest)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
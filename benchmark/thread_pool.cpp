@@ -0,0 +1,55 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/thread_pool.hpp"
+
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::ThreadPool;
+namespace data = programmers::geometry::benchmark_data;
+
+// What every batch call paid before the pool, starting its own threads.
+auto BenchmarkThreadPoolSpawnThreads(benchmark::State& state) -> void {
+  const auto thread_count{ThreadPool::GetDefault().GetThreadCount()};
+  for (auto _ : state) {
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < thread_count; ++i) {
+      threads.emplace_back([]() {});
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BenchmarkThreadPoolSpawnThreads);
+
+auto BenchmarkThreadPoolRun(benchmark::State& state) -> void {
+  auto& pool{ThreadPool::GetDefault()};
+  for (auto _ : state) {
+    pool.Run(pool.GetThreadCount(),
+             [](std::size_t i) { benchmark::DoNotOptimize(i); });
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BenchmarkThreadPoolRun);
+
+auto BenchmarkThreadPoolCalculateDistances(benchmark::State& state) -> void {
+  const auto cloud{data::CreateRandomCloud(state.range(0))};
+  const auto target{data::CreateRandomPoints(1U).front()};
+  std::vector<double> output(cloud.Size());
+  for (auto _ : state) {
+    cloud.CalculateDistances(target, output.data());
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkThreadPoolCalculateDistances)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
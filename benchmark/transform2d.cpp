@@ -0,0 +1,51 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/transform2d.hpp"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "benchmark_data.hpp"
+
+namespace {
+using programmers::geometry::Point2D;
+using programmers::geometry::Transform2D;
+namespace data = programmers::geometry::benchmark_data;
+
+// What a rotate, scale and translate chain cost before, per point operators.
+auto BenchmarkTransform2DPointOperators(benchmark::State& state) -> void {
+  auto points{data::CreateRandomPoints(state.range(0))};
+  const auto cosine{0.8};
+  const auto sine{0.6};
+  const Point2D offset(10.0, -20.0);
+  for (auto _ : state) {
+    for (auto& point : points) {
+      point = Point2D(cosine * point.GetX() - sine * point.GetY(),
+                      sine * point.GetX() + cosine * point.GetY()) *
+                  2.0 +
+              offset;
+    }
+    benchmark::DoNotOptimize(points.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkTransform2DPointOperators)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+
+auto BenchmarkTransform2DApplyInPlace(benchmark::State& state) -> void {
+  auto cloud{data::CreateRandomCloud(state.range(0))};
+  const auto transform{Transform2D(0.8, -0.6, 0.0, 0.6, 0.8, 0.0)
+                           .Then(Transform2D::Scaling(2.0, 2.0))
+                           .Then(Transform2D::Translation({10.0, -20.0}))};
+  for (auto _ : state) {
+    transform.ApplyInPlace(cloud);
+    benchmark::DoNotOptimize(cloud.XData());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BenchmarkTransform2DApplyInPlace)
+    ->RangeMultiplier(data::kCountMultiplier)
+    ->Range(data::kMinimumCount, data::kMaximumCount);
+}  // namespace
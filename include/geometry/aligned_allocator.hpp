@@ -0,0 +1,97 @@
+/**
+ * @file geometry/aligned_allocator.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Allocator returning storage aligned to a fixed boundary
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__ALIGNED_ALLOCATOR_HPP_
+#define PROGRAMMERS__GEOMETRY__ALIGNED_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace programmers::geometry {
+/**
+ * @brief Standard allocator whose storage starts on an Alignment boundary
+ * @tparam T Value type
+ * @tparam Alignment Alignment in bytes, a power of two
+ */
+template <typename T, std::size_t Alignment = 64U>
+class AlignedAllocator {
+  static_assert((Alignment & (Alignment - 1U)) == 0U,
+                "Alignment must be a power of two");
+  static_assert(Alignment >= alignof(T),
+                "Alignment must not be weaker than the value type");
+
+ public:
+  using value_type = T;  ///< Value type
+
+  /**
+   * @brief Rebind the allocator to other value type
+   * @tparam U Other value type
+   */
+  template <typename U>
+  struct rebind {
+    using other = AlignedAllocator<U, Alignment>;  ///< Rebound allocator
+  };
+
+  /**
+   * @brief Construct a new AlignedAllocator object
+   */
+  AlignedAllocator() noexcept = default;
+  /**
+   * @brief Construct from the allocator of other value type
+   * @param other The other allocator
+   */
+  template <typename U>
+  AlignedAllocator(const AlignedAllocator<U, Alignment>& /*other*/) noexcept {}
+
+  /**
+   * @brief Allocate aligned storage for count values
+   * @param count The number of values
+   * @return T* Pointer to the aligned storage
+   */
+  [[nodiscard]] auto allocate(std::size_t count) -> T* {
+    if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T*>(
+        ::operator new(count * sizeof(T), std::align_val_t{Alignment}));
+  }
+  /**
+   * @brief Release storage returned by allocate
+   * @param pointer Pointer to the storage
+   */
+  auto deallocate(T* pointer, std::size_t /*count*/) noexcept -> void {
+    ::operator delete(pointer, std::align_val_t{Alignment});
+  }
+
+  /**
+   * @brief Every instance can release storage of every other instance
+   * @return true Always
+   */
+  template <typename U>
+  auto operator==(const AlignedAllocator<U, Alignment>& /*other*/) const
+      noexcept -> bool {
+    return true;
+  }
+  /**
+   * @brief Every instance can release storage of every other instance
+   * @return false Always
+   */
+  template <typename U>
+  auto operator!=(const AlignedAllocator<U, Alignment>& /*other*/) const
+      noexcept -> bool {
+    return false;
+  }
+};
+}  // namespace programmers::geometry
+
+#endif
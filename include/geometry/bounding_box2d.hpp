@@ -0,0 +1,197 @@
+/**
+ * @file geometry/bounding_box2d.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Axis aligned bounding box class declaration with 2-dimension
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__BOUNDING_BOX_2D_HPP_
+#define PROGRAMMERS__GEOMETRY__BOUNDING_BOX_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Closed axis aligned box with 2-dimension
+ * @details An empty box contains nothing and is the identity of Union. Batch
+ * filters return bitmasks where item i is bit i % kMaskBits of word
+ * i / kMaskBits, kMaskBits being 64.
+ */
+class BoundingBox2D {
+ public:
+  /**
+   * @brief Construct a new empty BoundingBox2D object
+   */
+  BoundingBox2D();
+  /**
+   * @brief Construct a new BoundingBox2D object from two corners
+   * @param minimum The corner with the smallest coordinates
+   * @param maximum The corner with the largest coordinates
+   * @throw std::invalid_argument If a coordinate is NaN or maximum is
+   * smaller than minimum
+   */
+  BoundingBox2D(const Point2D& minimum, const Point2D& maximum);
+
+  /**
+   * @brief Get the smallest box containing points
+   * @param points The points, NaN coordinates are skipped
+   * @return BoundingBox2D The box, empty without points
+   */
+  [[nodiscard]] static auto FromPoints(const PointCloud2D& points)
+      -> BoundingBox2D;
+  /**
+   * @brief Get the smallest box containing points with a parallel reduction
+   * @param xs x coordinates of count points
+   * @param ys y coordinates of count points
+   * @param count The number of points
+   * @return BoundingBox2D The box, empty without points
+   */
+  [[nodiscard]] static auto FromPoints(const double* xs, const double* ys,
+                                       std::size_t count) -> BoundingBox2D;
+
+  /**
+   * @brief Check if the box contains nothing
+   * @return true If empty
+   * @return false If it contains at least one point
+   */
+  [[nodiscard]] auto IsEmpty() const -> bool;
+  /**
+   * @brief Get the corner with the smallest coordinates
+   * @return Point2D (+infinity, +infinity) for an empty box
+   */
+  [[nodiscard]] auto GetMinimum() const -> Point2D;
+  /**
+   * @brief Get the corner with the largest coordinates
+   * @return Point2D (-infinity, -infinity) for an empty box
+   */
+  [[nodiscard]] auto GetMaximum() const -> Point2D;
+  /**
+   * @brief Get the extent along x
+   * @return double The width, 0 for an empty box
+   */
+  [[nodiscard]] auto GetWidth() const -> double;
+  /**
+   * @brief Get the extent along y
+   * @return double The height, 0 for an empty box
+   */
+  [[nodiscard]] auto GetHeight() const -> double;
+
+  /**
+   * @brief Check if a point is inside or on the boundary
+   * @param point The point
+   * @return true If contained
+   * @return false If outside or NaN
+   */
+  [[nodiscard]] auto Contains(const Point2D& point) const -> bool;
+  /**
+   * @brief Check if another box is inside this one
+   * @param other The other box
+   * @return true If other is contained or empty
+   * @return false If a part of other is outside
+   */
+  [[nodiscard]] auto Contains(const BoundingBox2D& other) const -> bool;
+  /**
+   * @brief Check if two boxes share a point
+   * @param other The other box
+   * @return true If the boxes overlap or touch
+   * @return false If they are disjoint or one is empty
+   */
+  [[nodiscard]] auto Intersects(const BoundingBox2D& other) const -> bool;
+  /**
+   * @brief Get the smallest box containing both boxes
+   * @param other The other box
+   * @return BoundingBox2D The union
+   */
+  [[nodiscard]] auto Union(const BoundingBox2D& other) const -> BoundingBox2D;
+  /**
+   * @brief Get the box shared by both boxes
+   * @param other The other box
+   * @return BoundingBox2D The intersection, empty if disjoint
+   */
+  [[nodiscard]] auto Intersection(const BoundingBox2D& other) const
+      -> BoundingBox2D;
+  /**
+   * @brief Grow the box to contain a point
+   * @param point The point, NaN coordinates are skipped
+   */
+  auto Extend(const Point2D& point) -> void;
+
+  /**
+   * @brief Mark the points inside the box
+   * @param points The points
+   * @return std::vector<uint64_t> Bitmask of points.Size() bits
+   */
+  [[nodiscard]] auto FilterWithin(const PointCloud2D& points) const
+      -> std::vector<uint64_t>;
+  /**
+   * @brief Mark the points inside the box
+   * @param xs x coordinates of count points
+   * @param ys y coordinates of count points
+   * @param count The number of points
+   * @param output Destination of ceil(count / 64) words
+   */
+  auto FilterWithin(const double* xs, const double* ys, std::size_t count,
+                    uint64_t* output) const -> void;
+  /**
+   * @brief Mark the boxes sharing a point with the box
+   * @param boxes The boxes
+   * @return std::vector<uint64_t> Bitmask of boxes.size() bits
+   */
+  [[nodiscard]] auto FilterIntersecting(
+      const std::vector<BoundingBox2D>& boxes) const -> std::vector<uint64_t>;
+  /**
+   * @brief Mark the boxes sharing a point with the box
+   * @details Empty boxes in the arrays hold +infinity minimums and
+   * -infinity maximums, so they are never marked.
+   * @param min_xs Minimum x coordinates of count boxes
+   * @param min_ys Minimum y coordinates of count boxes
+   * @param max_xs Maximum x coordinates of count boxes
+   * @param max_ys Maximum y coordinates of count boxes
+   * @param count The number of boxes
+   * @param output Destination of ceil(count / 64) words
+   */
+  auto FilterIntersecting(const double* min_xs, const double* min_ys,
+                          const double* max_xs, const double* max_ys,
+                          std::size_t count, uint64_t* output) const -> void;
+
+  /**
+   * @brief Compare two boxes
+   * @param other The other box
+   * @return true If the corners are equal or both are empty
+   * @return false If they differ
+   */
+  auto operator==(const BoundingBox2D& other) const -> bool;
+  /**
+   * @brief Compare two boxes
+   * @param other The other box
+   * @return true If they differ
+   * @return false If the corners are equal or both are empty
+   */
+  auto operator!=(const BoundingBox2D& other) const -> bool;
+
+ protected:
+ private:
+  /**
+   * @brief Construct a new BoundingBox2D object from {min_x, min_y, max_x,
+   * max_y}, empty if any minimum exceeds its maximum
+   */
+  explicit BoundingBox2D(const double* bounds);
+
+  double min_x_;  ///< Minimum x coordinate
+  double min_y_;  ///< Minimum y coordinate
+  double max_x_;  ///< Maximum x coordinate
+  double max_y_;  ///< Maximum y coordinate
+};
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,140 @@
+/**
+ * @file geometry/convex_hull.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Batch and incremental convex hull declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__CONVEX_HULL_HPP_
+#define PROGRAMMERS__GEOMETRY__CONVEX_HULL_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Find the vertices of the convex hull of points
+ * @details Chunks of points are handled in parallel: an Akl-Toussaint
+ * prefilter drops every point certainly inside the octagon of the eight
+ * extreme points, Andrew's monotone chain builds the hull of the rest, and
+ * the chunk hulls are merged with the same chain. Turns are decided with
+ * the exact orientation predicate, so collinear boundary points are never
+ * reported and the result does not depend on the thread count.
+ * @param points The points
+ * @return std::vector<std::size_t> Indices of the vertices in counter
+ * clockwise order from the one with the smallest x, then y; of duplicate
+ * vertices the smallest index
+ * @throw std::invalid_argument If a coordinate is not finite
+ */
+[[nodiscard]] auto ComputeConvexHull(const PointCloud2D& points)
+    -> std::vector<std::size_t>;
+/**
+ * @brief Find the vertices of the convex hull of points given by columns
+ * @param xs x coordinates of count points
+ * @param ys y coordinates of count points
+ * @param count The number of points
+ * @return std::vector<std::size_t> Indices of the vertices in counter
+ * clockwise order from the one with the smallest x, then y; of duplicate
+ * vertices the smallest index
+ * @throw std::invalid_argument If a coordinate is not finite
+ */
+[[nodiscard]] auto ComputeConvexHull(const double* xs, const double* ys,
+                                     std::size_t count)
+    -> std::vector<std::size_t>;
+
+/**
+ * @brief Convex hull kept up to date as points are appended
+ * @details Only the hull vertices are stored. A point inside the hull is
+ * rejected in O(log h) for h vertices and an outside point replaces the
+ * vertices it sees in O(h), so the hull is the same as ComputeConvexHull
+ * of every point appended so far.
+ */
+class IncrementalConvexHull {
+ public:
+  /**
+   * @brief Construct a new empty IncrementalConvexHull object
+   */
+  IncrementalConvexHull() = default;
+
+  /**
+   * @brief Get the number of points appended
+   * @return std::size_t The number of points, the index of the next one
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Get the number of hull vertices
+   * @return std::size_t The number of vertices
+   */
+  [[nodiscard]] auto GetVertexCount() const -> std::size_t;
+  /**
+   * @brief Get the indices of the hull vertices
+   * @return std::vector<std::size_t> Indices in counter clockwise order from
+   * the vertex with the smallest x, then y
+   */
+  [[nodiscard]] auto GetIndices() const -> std::vector<std::size_t>;
+  /**
+   * @brief Get the hull vertices
+   * @return std::vector<Point2D> Vertices in the order of GetIndices()
+   */
+  [[nodiscard]] auto GetVertices() const -> std::vector<Point2D>;
+  /**
+   * @brief Check if the hull contains point
+   * @param point Point2D object to check
+   * @return true If point is inside or on the boundary
+   * @return false If point is outside
+   */
+  [[nodiscard]] auto Contains(const Point2D& point) const -> bool;
+
+  /**
+   * @brief Append one point
+   * @param point Point2D object indexed Size()
+   * @return true If the hull changed
+   * @return false If point is inside or on the boundary
+   * @throw std::invalid_argument If a coordinate is not finite
+   */
+  auto Append(const Point2D& point) -> bool;
+  /**
+   * @brief Append a batch of points, indexed from Size() in order
+   * @details The batch hull is computed in parallel first, so only its
+   * vertices are inserted one by one.
+   * @param points The points
+   * @return true If the hull changed
+   * @return false If every point is inside or on the boundary
+   * @throw std::invalid_argument If a coordinate is not finite
+   */
+  auto Append(const PointCloud2D& points) -> bool;
+
+ protected:
+ private:
+  /**
+   * @brief Hull vertex and the index of its point
+   */
+  struct Vertex {
+    double x{0.0};
+    double y{0.0};
+    std::size_t index{0U};
+  };
+
+  /**
+   * @brief Insert a finite point outside or on the hull
+   */
+  auto Insert(const Vertex& vertex) -> bool;
+  /**
+   * @brief Get the position of the first vertex of GetIndices()
+   */
+  [[nodiscard]] auto GetFirstVertex() const -> std::size_t;
+
+  std::vector<Vertex> vertices_;  ///< Counter clockwise hull vertices
+  std::size_t size_{0U};          ///< The number of points appended
+};
+}  // namespace programmers::geometry
+
+#endif
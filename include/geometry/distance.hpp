@@ -13,10 +13,20 @@
 #ifndef PROGRAMMERS__GEOMETRY__DISTANCE_HPP_
 #define PROGRAMMERS__GEOMETRY__DISTANCE_HPP_
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
+
+#include "geometry/exact_arithmetic.hpp"
+
 namespace programmers::geometry {
+class DistanceAccumulator;
+
 /**
  * @brief The class for abstracting distance
+ * @details The value is an integer number of nanometers. Arithmetic stays in
+ * integer space, so sums are exact and scaling rounds once, explicitly.
  */
 class Distance {
  public:
@@ -31,12 +41,45 @@ class Distance {
     kMicrometer = 4,
     kNanometer = 5
   };
+  /**
+   * @brief The number of distance types
+   */
+  static constexpr std::size_t kTypeCount{6U};
+  /**
+   * @brief Nanometers in one unit of every distance type, indexed by Type
+   */
+  static constexpr std::array<double, kTypeCount> kNanometerPerUnit{
+      1.0e+12, 1.0e+9, 1.0e+7, 1.0e+6, 1.0e+3, 1.0};
+  /**
+   * @brief Units of every distance type in one nanometer, indexed by Type
+   */
+  static constexpr std::array<double, kTypeCount> kUnitPerNanometer{
+      1.0e-12, 1.0e-9, 1.0e-7, 1.0e-6, 1.0e-3, 1.0};
+
+  /**
+   * @brief Get the index of distance type in the unit tables
+   * @param type The distance type
+   * @return std::size_t The index
+   */
+  [[nodiscard]] static constexpr auto GetTypeIndex(Type type) -> std::size_t {
+    return static_cast<std::size_t>(type);
+  }
+
   /**
    * @brief Construct a new Distance object
    */
   Distance() = default;
 
-  explicit Distance(double input_value, Type input_type=Type::kMeter);
+  /**
+   * @brief Construct a new Distance object from a value in distance type
+   * @param input_value The input distance value
+   * @param input_type The input distance type
+   * @param rounding Rounding of the value to whole nanometers
+   * @throw std::invalid_argument If input_value is not a number
+   * @details Values beyond the int64_t nanometer range saturate.
+   */
+  explicit Distance(double input_value, Type input_type = Type::kMeter,
+                    Rounding rounding = Rounding::kTowardZero);
 
   /**
    * @brief The copy constructor
@@ -64,6 +107,18 @@ class Distance {
    * @return Distance& The reference of distance object
    */
   auto operator=(Distance&& other) -> Distance& = default;
+  /**
+   * @brief Create a Distance object from whole nanometers
+   * @param nanometer The number of nanometers
+   * @return Distance The distance
+   */
+  [[nodiscard]] static auto FromNanometer(int64_t nanometer) -> Distance;
+
+  /**
+   * @brief Get the exact number of nanometers
+   * @return int64_t The number of nanometers
+   */
+  [[nodiscard]] auto GetNanometer() const -> int64_t;
   /**
    * @brief Get the Distance value for distance type
    * @param input_type The input distance type
@@ -74,9 +129,86 @@ class Distance {
    * @brief Set the Distance value for distance type
    * @param input_value The input distance value
    * @param input_type The input distance type
+   * @param rounding Rounding of the value to whole nanometers
    * @return void
+   * @throw std::invalid_argument If input_value is not a number
+   * @details Values beyond the int64_t nanometer range saturate.
    */
-  auto SetValue(double input_value, Type input_type=Type::kMeter) -> void;
+  auto SetValue(double input_value, Type input_type = Type::kMeter,
+                Rounding rounding = Rounding::kTowardZero) -> void;
+
+  /**
+   * @brief Add other distance object
+   * @param other The other distance object
+   * @param policy What to do if the sum does not fit
+   * @return Distance The exact sum
+   * @throw std::overflow_error If the sum does not fit and policy is kChecked
+   */
+  [[nodiscard]] auto Add(const Distance& other,
+                         OverflowPolicy policy = OverflowPolicy::kChecked) const
+      -> Distance;
+  /**
+   * @brief Subtract other distance object
+   * @param other The other distance object
+   * @param policy What to do if the difference does not fit
+   * @return Distance The exact difference
+   * @throw std::overflow_error If the difference does not fit and policy is
+   * kChecked
+   */
+  [[nodiscard]] auto Subtract(
+      const Distance& other,
+      OverflowPolicy policy = OverflowPolicy::kChecked) const -> Distance;
+  /**
+   * @brief Multiply by integer factor
+   * @param factor The factor
+   * @param policy What to do if the product does not fit
+   * @return Distance The exact product
+   * @throw std::overflow_error If the product does not fit and policy is
+   * kChecked
+   */
+  [[nodiscard]] auto Multiply(
+      int64_t factor, OverflowPolicy policy = OverflowPolicy::kChecked) const
+      -> Distance;
+  /**
+   * @brief Multiply by factor, rounding the exact product once
+   * @param factor The factor
+   * @param rounding Rounding of the product to whole nanometers
+   * @param policy What to do if the product does not fit
+   * @return Distance The rounded product
+   * @throw std::invalid_argument If factor is not a number, or infinite
+   * while the distance is zero
+   * @throw std::overflow_error If the product does not fit and policy is
+   * kChecked
+   */
+  [[nodiscard]] auto Multiply(
+      double factor, Rounding rounding = Rounding::kNearest,
+      OverflowPolicy policy = OverflowPolicy::kChecked) const -> Distance;
+  /**
+   * @brief Divide by integer divisor
+   * @param divisor The divisor
+   * @param rounding Rounding of the quotient to whole nanometers
+   * @param policy What to do if the quotient does not fit
+   * @return Distance The rounded quotient
+   * @throw std::invalid_argument If divisor is zero
+   * @throw std::overflow_error If the quotient does not fit and policy is
+   * kChecked
+   */
+  [[nodiscard]] auto Divide(
+      int64_t divisor, Rounding rounding = Rounding::kNearest,
+      OverflowPolicy policy = OverflowPolicy::kChecked) const -> Distance;
+  /**
+   * @brief Divide by divisor, rounding the exact quotient once
+   * @param divisor The divisor
+   * @param rounding Rounding of the quotient to whole nanometers
+   * @param policy What to do if the quotient does not fit
+   * @return Distance The rounded quotient
+   * @throw std::invalid_argument If divisor is zero or not a number
+   * @throw std::overflow_error If the quotient does not fit and policy is
+   * kChecked
+   */
+  [[nodiscard]] auto Divide(
+      double divisor, Rounding rounding = Rounding::kNearest,
+      OverflowPolicy policy = OverflowPolicy::kChecked) const -> Distance;
 
   /**
    * @brief Compare with other distance object for equality
@@ -125,41 +257,86 @@ class Distance {
    * @brief Add other distance object
    * @param other The other distance object
    * @return Distance The result of addition
+   * @throw std::overflow_error If the sum does not fit
    */
   auto operator+(const Distance& other) const -> Distance;
   /**
    * @brief Subtract other distance object
    * @param other The other distance object
    * @return Distance The result of subtraction
+   * @throw std::overflow_error If the difference does not fit
    */
   auto operator-(const Distance& other) const -> Distance;
   /**
-   * @brief Multiply by scale
+   * @brief Multiply by scale, rounding to the nearest nanometer
    * @param scale The scale
    * @return Distance The result of multiplication
+   * @throw std::invalid_argument If scale is not a number
+   * @throw std::overflow_error If the product does not fit
    */
   auto operator*(double scale) const -> Distance;
   /**
-   * @brief Divide by scale
+   * @brief Multiply by integer scale
+   * @param scale The scale
+   * @return Distance The exact result of multiplication
+   * @throw std::overflow_error If the product does not fit
+   */
+  template <typename Integer,
+            std::enable_if_t<std::is_integral_v<Integer>, int> = 0>
+  auto operator*(Integer scale) const -> Distance {
+    if constexpr (std::is_unsigned_v<Integer> &&
+                  sizeof(Integer) >= sizeof(int64_t)) {
+      if (scale > static_cast<uint64_t>(INT64_MAX)) {
+        return Multiply(static_cast<double>(scale));
+      }
+    }
+    return Multiply(static_cast<int64_t>(scale));
+  }
+  /**
+   * @brief Divide by scale, rounding to the nearest nanometer
    * @param scale The scale
    * @return Distance The result of division
+   * @throw std::invalid_argument If scale is zero or not a number
+   * @throw std::overflow_error If the quotient does not fit
    */
   auto operator/(double scale) const -> Distance;
+  /**
+   * @brief Divide by integer scale, rounding to the nearest nanometer
+   * @param scale The scale
+   * @return Distance The result of division
+   * @throw std::invalid_argument If scale is zero
+   * @throw std::overflow_error If the quotient does not fit
+   */
+  template <typename Integer,
+            std::enable_if_t<std::is_integral_v<Integer>, int> = 0>
+  auto operator/(Integer scale) const -> Distance {
+    if constexpr (std::is_unsigned_v<Integer> &&
+                  sizeof(Integer) >= sizeof(int64_t)) {
+      if (scale > static_cast<uint64_t>(INT64_MAX)) {
+        return Divide(static_cast<double>(scale));
+      }
+    }
+    return Divide(static_cast<int64_t>(scale));
+  }
   /**
    * @brief Add and assign other distance object
    * @param other The other distance object
    * @return Distance The result of addition and assignment
+   * @throw std::overflow_error If the sum does not fit
    */
   auto operator+=(const Distance& other) -> void;
   /**
    * @brief Subtract and assign other distance object
    * @param other The other distance object
    * @return Distance The result of subtraction and assignment
+   * @throw std::overflow_error If the difference does not fit
    */
   auto operator-=(const Distance& other) -> void;
 
  protected:
  private:
+  friend class DistanceAccumulator;
+
   int64_t nanometer_{0};  ///< Nanometer
 };  // class Distance
 }  // namespace programmers::geometry
@@ -0,0 +1,115 @@
+/**
+ * @file geometry/distance_accumulator.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Exact 128-bit distance sum declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__DISTANCE_ACCUMULATOR_HPP_
+#define PROGRAMMERS__GEOMETRY__DISTANCE_ACCUMULATOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/exact_arithmetic.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Exact sum of many distances
+ * @details The sum is kept in 128-bit nanometers, so 2^64 distances of any
+ * length add up without overflow or rounding, in any order.
+ */
+class DistanceAccumulator {
+ public:
+  /**
+   * @brief Construct a new empty DistanceAccumulator object
+   */
+  DistanceAccumulator() = default;
+
+  /**
+   * @brief Add distance
+   * @param distance The distance
+   */
+  auto Add(const Distance& distance) -> void;
+  /**
+   * @brief Add count distances
+   * @param distances The distances
+   * @param count The number of distances
+   */
+  auto Add(const Distance* distances, std::size_t count) -> void;
+  /**
+   * @brief Add every distance
+   * @param distances The distances
+   */
+  auto Add(const std::vector<Distance>& distances) -> void;
+  /**
+   * @brief Add the sum and count of other accumulator
+   * @param other The other accumulator
+   */
+  auto Merge(const DistanceAccumulator& other) -> void;
+  /**
+   * @brief Reset to the empty sum
+   */
+  auto Clear() -> void;
+
+  /**
+   * @brief Get the number of added distances
+   * @return uint64_t The number of distances
+   */
+  [[nodiscard]] auto GetCount() const -> uint64_t;
+  /**
+   * @brief Get the exact sum
+   * @return Int128 The sum in nanometers
+   */
+  [[nodiscard]] auto GetNanometer() const -> Int128;
+  /**
+   * @brief Get the sum as Distance
+   * @param policy What to do if the sum does not fit Distance
+   * @return Distance The sum
+   * @throw std::overflow_error If the sum does not fit and policy is kChecked
+   */
+  [[nodiscard]] auto GetSum(
+      OverflowPolicy policy = OverflowPolicy::kChecked) const -> Distance;
+  /**
+   * @brief Get the sum value for distance type, even beyond Distance range
+   * @param input_type The distance type
+   * @return double The value of the sum
+   */
+  [[nodiscard]] auto GetValue(Distance::Type input_type) const -> double;
+  /**
+   * @brief Get the mean distance
+   * @param rounding Rounding of the mean to whole nanometers
+   * @return Distance The mean, which always fits Distance
+   * @throw std::out_of_range If no distance was added
+   */
+  [[nodiscard]] auto GetMean(Rounding rounding = Rounding::kNearest) const
+      -> Distance;
+
+  /**
+   * @brief Add distance
+   * @param distance The distance
+   * @return DistanceAccumulator& The reference of this accumulator
+   */
+  auto operator+=(const Distance& distance) -> DistanceAccumulator&;
+  /**
+   * @brief Add the sum and count of other accumulator
+   * @param other The other accumulator
+   * @return DistanceAccumulator& The reference of this accumulator
+   */
+  auto operator+=(const DistanceAccumulator& other) -> DistanceAccumulator&;
+
+ protected:
+ private:
+  Int128 nanometer_;    ///< Sum in nanometers
+  uint64_t count_{0U};  ///< The number of added distances
+};
+}  // namespace programmers::geometry
+
+#endif
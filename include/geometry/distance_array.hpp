@@ -0,0 +1,188 @@
+/**
+ * @file geometry/distance_array.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Packed distance container and batch unit conversion declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__DISTANCE_ARRAY_HPP_
+#define PROGRAMMERS__GEOMETRY__DISTANCE_ARRAY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geometry/aligned_allocator.hpp"
+#include "geometry/distance.hpp"
+#include "geometry/exact_arithmetic.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Convert nanometers to values in distance type
+ * @details Every output equals Distance::GetValue of the same nanometers.
+ * @param nanometers count nanometers
+ * @param count The number of distances
+ * @param type The distance type of the output
+ * @param output Destination of count values
+ */
+auto ConvertToUnit(const int64_t* nanometers, std::size_t count,
+                   Distance::Type type, double* output) -> void;
+/**
+ * @brief Convert values in distance type to nanometers
+ * @details Every output equals the nanometers of Distance constructed from
+ * the same value, type and rounding, including saturation beyond the int64_t
+ * range.
+ * @param values count values
+ * @param count The number of distances
+ * @param type The distance type of the values
+ * @param output Destination of count nanometers
+ * @param rounding Rounding of the values to whole nanometers
+ * @throw std::invalid_argument If some value is not a number, output is then
+ * complete but holds 0 for those values
+ */
+auto ConvertToNanometer(const double* values, std::size_t count,
+                        Distance::Type type, int64_t* output,
+                        Rounding rounding = Rounding::kTowardZero) -> void;
+
+/**
+ * @brief Distance container keeping nothing but the nanometers
+ * @details Distance carries a vtable pointer next to its 8 byte value. This
+ * container stores the values contiguously, aligned for the batch kernels,
+ * and hands out Distance objects by value.
+ */
+class DistanceArray {
+ public:
+  static constexpr std::size_t kAlignment{64U};  ///< Nanometer alignment
+  /**
+   * @brief Aligned nanometer array type
+   */
+  using NanometerBuffer =
+      std::vector<int64_t, AlignedAllocator<int64_t, kAlignment>>;
+
+  /**
+   * @brief Construct a new empty DistanceArray object
+   */
+  DistanceArray() = default;
+  /**
+   * @brief Construct a new DistanceArray object with count zero distances
+   * @param count The number of distances
+   */
+  explicit DistanceArray(std::size_t count);
+  /**
+   * @brief Construct a new DistanceArray object from Distance objects
+   * @param distances Distance objects to copy
+   */
+  explicit DistanceArray(const std::vector<Distance>& distances);
+  /**
+   * @brief Construct a new DistanceArray object from values in distance type
+   * @param values count values
+   * @param count The number of distances
+   * @param type The distance type of the values
+   * @param rounding Rounding of the values to whole nanometers
+   * @throw std::invalid_argument If some value is not a number
+   */
+  DistanceArray(const double* values, std::size_t count, Distance::Type type,
+                Rounding rounding = Rounding::kTowardZero);
+
+  /**
+   * @brief Get the number of distances
+   * @return std::size_t The number of distances
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Check if the container has no distance
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool;
+  /**
+   * @brief Reserve memory for count distances
+   * @param count The number of distances
+   */
+  auto Reserve(std::size_t count) -> void;
+  /**
+   * @brief Change the number of distances, new ones are zero
+   * @param count The number of distances
+   */
+  auto Resize(std::size_t count) -> void;
+  /**
+   * @brief Remove every distance
+   */
+  auto Clear() -> void;
+  /**
+   * @brief Append distance
+   * @param distance Distance object
+   */
+  auto PushBack(const Distance& distance) -> void;
+
+  /**
+   * @brief Get the distance at index
+   * @param index Index of the distance
+   * @return Distance Copy of the distance
+   */
+  [[nodiscard]] auto GetDistance(std::size_t index) const -> Distance;
+  /**
+   * @brief Set the distance at index
+   * @param index Index of the distance
+   * @param distance Distance object
+   */
+  auto SetDistance(std::size_t index, const Distance& distance) -> void;
+  /**
+   * @brief Get the nanometers of the distance at index
+   * @param index Index of the distance
+   * @return int64_t The number of nanometers
+   */
+  [[nodiscard]] auto GetNanometer(std::size_t index) const -> int64_t;
+  /**
+   * @brief Get the nanometer array
+   * @return const int64_t* Pointer to Size() nanometers
+   */
+  [[nodiscard]] auto Data() const -> const int64_t*;
+  /**
+   * @brief Get the mutable nanometer array
+   * @return int64_t* Pointer to Size() nanometers
+   */
+  [[nodiscard]] auto Data() -> int64_t*;
+  /**
+   * @brief Copy the distances into Distance objects
+   * @return std::vector<Distance> Distance objects
+   */
+  [[nodiscard]] auto ToDistances() const -> std::vector<Distance>;
+
+  /**
+   * @brief Get every distance value for distance type
+   * @param type The distance type
+   * @return std::vector<double> The value of each distance
+   */
+  [[nodiscard]] auto GetValues(Distance::Type type) const
+      -> std::vector<double>;
+  /**
+   * @brief Get every distance value for distance type
+   * @param type The distance type
+   * @param output Destination of Size() values
+   */
+  auto GetValues(Distance::Type type, double* output) const -> void;
+  /**
+   * @brief Replace the distances with values in distance type
+   * @param values count values
+   * @param count The number of distances
+   * @param type The distance type of the values
+   * @param rounding Rounding of the values to whole nanometers
+   * @throw std::invalid_argument If some value is not a number, leaving the
+   * distances unchanged
+   */
+  auto SetValues(const double* values, std::size_t count, Distance::Type type,
+                 Rounding rounding = Rounding::kTowardZero) -> void;
+
+ protected:
+ private:
+  NanometerBuffer nanometers_;  ///< Nanometers of every distance
+};
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,224 @@
+/**
+ * @file geometry/exact_arithmetic.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Rounding, overflow policy and 128-bit integer declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__EXACT_ARITHMETIC_HPP_
+#define PROGRAMMERS__GEOMETRY__EXACT_ARITHMETIC_HPP_
+
+#include <cstdint>
+
+namespace programmers::geometry {
+/**
+ * @brief The enum class for rounding a result to an integer
+ */
+enum class Rounding {
+  kTowardZero = 0,  ///< Truncate
+  kDown = 1,        ///< Toward negative infinity
+  kUp = 2,          ///< Toward positive infinity
+  kNearest = 3,     ///< Nearest, ties away from zero
+  kNearestEven = 4  ///< Nearest, ties to even
+};
+
+/**
+ * @brief The enum class for a result out of the integer range
+ */
+enum class OverflowPolicy {
+  kChecked = 0,  ///< Throw std::overflow_error
+  kSaturate = 1  ///< Clamp to the nearest representable value
+};
+
+/**
+ * @brief Signed 128-bit two's complement integer
+ * @details Portable, so it also works where the compiler has no __int128.
+ * It holds every product of two int64_t and every sum of 2^64 int64_t
+ * exactly, which is what exact distance arithmetic needs.
+ */
+class Int128 {
+ public:
+  /**
+   * @brief Construct a new zero Int128 object
+   */
+  constexpr Int128() = default;
+  /**
+   * @brief Construct a new Int128 object from int64_t
+   * @param value The value
+   */
+  constexpr Int128(int64_t value)
+      : high_(value < 0 ? -1 : 0), low_(static_cast<uint64_t>(value)) {}
+  /**
+   * @brief Construct a new Int128 object from its halves
+   * @param high The upper 64 bits
+   * @param low The lower 64 bits
+   */
+  constexpr Int128(int64_t high, uint64_t low) : high_(high), low_(low) {}
+
+  /**
+   * @brief Multiply two int64_t without overflow
+   * @param lhs Left hand side value
+   * @param rhs Right hand side value
+   * @return Int128 The exact product
+   */
+  [[nodiscard]] static auto Multiply(int64_t lhs, int64_t rhs) -> Int128;
+
+  /**
+   * @brief Get the upper 64 bits
+   * @return int64_t The upper half
+   */
+  [[nodiscard]] auto GetHigh() const -> int64_t;
+  /**
+   * @brief Get the lower 64 bits
+   * @return uint64_t The lower half
+   */
+  [[nodiscard]] auto GetLow() const -> uint64_t;
+  /**
+   * @brief Check if the value is negative
+   * @return true If negative
+   * @return false If zero or positive
+   */
+  [[nodiscard]] auto IsNegative() const -> bool;
+  /**
+   * @brief Check if the value fits int64_t
+   * @return true If it fits
+   * @return false If it does not fit
+   */
+  [[nodiscard]] auto FitsInt64() const -> bool;
+  /**
+   * @brief Convert to int64_t
+   * @param policy What to do if the value does not fit
+   * @return int64_t The value
+   * @throw std::overflow_error If the value does not fit and policy is
+   * kChecked
+   */
+  [[nodiscard]] auto ToInt64(
+      OverflowPolicy policy = OverflowPolicy::kChecked) const -> int64_t;
+  /**
+   * @brief Convert to the nearest double
+   * @return double The value
+   */
+  [[nodiscard]] auto ToDouble() const -> double;
+
+  /**
+   * @brief Shift left, multiplying by 2^shift
+   * @param shift The number of bits, less than 128
+   * @return Int128 The result, wrapped if it does not fit
+   */
+  [[nodiscard]] auto ShiftLeft(uint32_t shift) const -> Int128;
+  /**
+   * @brief Divide by 2^shift
+   * @param shift The number of bits, any size
+   * @param rounding Rounding of the quotient
+   * @return Int128 The rounded quotient
+   */
+  [[nodiscard]] auto ShiftRight(uint32_t shift, Rounding rounding) const
+      -> Int128;
+  /**
+   * @brief Divide by other Int128
+   * @param divisor The divisor
+   * @param rounding Rounding of the quotient
+   * @return Int128 The rounded quotient, wrapped for -2^127 / -1
+   * @throw std::invalid_argument If divisor is zero
+   */
+  [[nodiscard]] auto Divide(const Int128& divisor, Rounding rounding) const
+      -> Int128;
+  /**
+   * @brief Get the square root of a value that is not negative
+   * @param rounding Rounding of the exact square root
+   * @return Int128 The rounded square root, less than 2^64
+   * @throw std::invalid_argument If the value is negative
+   */
+  [[nodiscard]] auto SquareRoot(Rounding rounding) const -> Int128;
+
+  /**
+   * @brief Compare with other Int128 for equality
+   * @param other The other value
+   * @return true If equal
+   * @return false If not equal
+   */
+  auto operator==(const Int128& other) const -> bool;
+  /**
+   * @brief Compare with other Int128 for inequality
+   * @param other The other value
+   * @return true If not equal
+   * @return false If equal
+   */
+  auto operator!=(const Int128& other) const -> bool;
+  /**
+   * @brief Compare with other Int128 for less than
+   * @param other The other value
+   * @return true If less than
+   * @return false If not less than
+   */
+  auto operator<(const Int128& other) const -> bool;
+  /**
+   * @brief Compare with other Int128 for less than or equal
+   * @param other The other value
+   * @return true If less than or equal
+   * @return false If not less than or equal
+   */
+  auto operator<=(const Int128& other) const -> bool;
+  /**
+   * @brief Compare with other Int128 for greater than
+   * @param other The other value
+   * @return true If greater than
+   * @return false If not greater than
+   */
+  auto operator>(const Int128& other) const -> bool;
+  /**
+   * @brief Compare with other Int128 for greater than or equal
+   * @param other The other value
+   * @return true If greater than or equal
+   * @return false If not greater than or equal
+   */
+  auto operator>=(const Int128& other) const -> bool;
+  /**
+   * @brief Negate, wrapping for -2^127
+   * @return Int128 The negated value
+   */
+  auto operator-() const -> Int128;
+  /**
+   * @brief Add other Int128, wrapping on overflow
+   * @param other The other value
+   * @return Int128 The result of addition
+   */
+  auto operator+(const Int128& other) const -> Int128;
+  /**
+   * @brief Subtract other Int128, wrapping on overflow
+   * @param other The other value
+   * @return Int128 The result of subtraction
+   */
+  auto operator-(const Int128& other) const -> Int128;
+  /**
+   * @brief Multiply by other Int128, wrapping on overflow
+   * @param other The other value
+   * @return Int128 The result of multiplication
+   */
+  auto operator*(const Int128& other) const -> Int128;
+  /**
+   * @brief Add and assign other Int128, wrapping on overflow
+   * @param other The other value
+   * @return Int128& The reference of this value
+   */
+  auto operator+=(const Int128& other) -> Int128&;
+  /**
+   * @brief Subtract and assign other Int128, wrapping on overflow
+   * @param other The other value
+   * @return Int128& The reference of this value
+   */
+  auto operator-=(const Int128& other) -> Int128&;
+
+ protected:
+ private:
+  int64_t high_{0};   ///< Upper 64 bits, carrying the sign
+  uint64_t low_{0U};  ///< Lower 64 bits
+};
+}  // namespace programmers::geometry
+
+#endif
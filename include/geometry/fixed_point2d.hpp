@@ -0,0 +1,421 @@
+/**
+ * @file geometry/fixed_point2d.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Fixed-point integer point class declaration with 2-dimension
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__FIXED_POINT_2D_HPP_
+#define PROGRAMMERS__GEOMETRY__FIXED_POINT_2D_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/exact_arithmetic.hpp"
+#include "geometry/kernels.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Point class with 2-dimension on an integer grid
+ * @details Coordinates are whole grid steps of kResolution nanometers, so
+ * with the default resolution a point shares the grid of Distance. Addition,
+ * subtraction, comparison and squared distance are exact, and equal points
+ * always compare equal, which Point2D cannot promise after arithmetic.
+ * @tparam kResolution Nanometers per grid step, at most 3037000499 so that
+ * its square fits int64_t
+ */
+template <int64_t kResolution = 1>
+class BasicFixedPoint2D {
+  static_assert(kResolution > 0 && kResolution <= 3037000499,
+                "kResolution must be in [1, 3037000499] nanometers");
+
+ public:
+  /**
+   * @brief Nanometers per grid step
+   */
+  static constexpr int64_t kNanometerPerStep{kResolution};
+
+  /**
+   * @brief Construct a new BasicFixedPoint2D object at the origin
+   */
+  constexpr BasicFixedPoint2D() = default;
+  /**
+   * @brief Construct a new BasicFixedPoint2D object with x, y grid steps
+   * @param input_x x coordinate in grid steps
+   * @param input_y y coordinate in grid steps
+   */
+  constexpr BasicFixedPoint2D(int64_t input_x, int64_t input_y)
+      : x_(input_x), y_(input_y) {}
+
+  /**
+   * @brief Snap a Point2D object to the grid
+   * @param point Point2D object to convert
+   * @param unit Distance type of one coordinate unit of point
+   * @param rounding Rounding of every coordinate to whole grid steps
+   * @return BasicFixedPoint2D The point, saturated to the int64_t range
+   * @throw std::invalid_argument If a coordinate is not a number
+   */
+  [[nodiscard]] static auto FromPoint2D(
+      const Point2D& point, Distance::Type unit = Distance::Type::kMeter,
+      Rounding rounding = Rounding::kNearest) -> BasicFixedPoint2D {
+    const std::array<double, 2> values{point.GetX(), point.GetY()};
+    std::array<int64_t, 2> steps{};
+    if (!kernels::ConvertToInt64(values.data(), values.size(),
+                                 GetStepPerUnit(unit), rounding,
+                                 steps.data())) {
+      throw std::invalid_argument("BasicFixedPoint2D value is not a number");
+    }
+    return {steps[0], steps[1]};
+  }
+  /**
+   * @brief Snap every point of PointCloud2D object to the grid
+   * @param points PointCloud2D object to convert
+   * @param unit Distance type of one coordinate unit of points
+   * @param rounding Rounding of every coordinate to whole grid steps
+   * @return std::vector<BasicFixedPoint2D> The points in the same order
+   * @throw std::invalid_argument If a coordinate is not a number
+   */
+  [[nodiscard]] static auto FromPoints(
+      const PointCloud2D& points, Distance::Type unit = Distance::Type::kMeter,
+      Rounding rounding = Rounding::kNearest)
+      -> std::vector<BasicFixedPoint2D> {
+    const auto count{points.Size()};
+    std::vector<int64_t> xs(count);
+    std::vector<int64_t> ys(count);
+    const auto scale{GetStepPerUnit(unit)};
+    if (!kernels::ConvertToInt64(points.XData(), count, scale, rounding,
+                                 xs.data()) ||
+        !kernels::ConvertToInt64(points.YData(), count, scale, rounding,
+                                 ys.data())) {
+      throw std::invalid_argument("BasicFixedPoint2D value is not a number");
+    }
+    std::vector<BasicFixedPoint2D> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      result.emplace_back(xs[i], ys[i]);
+    }
+    return result;
+  }
+  /**
+   * @brief Convert every point to PointCloud2D object
+   * @param points BasicFixedPoint2D objects to convert
+   * @param unit Distance type of one coordinate unit of the result
+   * @return PointCloud2D The points in the same order
+   */
+  [[nodiscard]] static auto ToPoints(
+      const std::vector<BasicFixedPoint2D>& points,
+      Distance::Type unit = Distance::Type::kMeter) -> PointCloud2D {
+    const auto count{points.size()};
+    std::vector<int64_t> xs(count);
+    std::vector<int64_t> ys(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      xs[i] = points[i].x_;
+      ys[i] = points[i].y_;
+    }
+    PointCloud2D result(count);
+    const auto scale{GetUnitPerStep(unit)};
+    kernels::ConvertToDouble(xs.data(), count, scale, result.XData());
+    kernels::ConvertToDouble(ys.data(), count, scale, result.YData());
+    return result;
+  }
+
+  /**
+   * @brief Convert to Point2D object
+   * @param unit Distance type of one coordinate unit of the result
+   * @return Point2D The nearest Point2D object
+   */
+  [[nodiscard]] auto ToPoint2D(
+      Distance::Type unit = Distance::Type::kMeter) const -> Point2D {
+    const std::array<int64_t, 2> steps{x_, y_};
+    std::array<double, 2> values{};
+    kernels::ConvertToDouble(steps.data(), steps.size(), GetUnitPerStep(unit),
+                             values.data());
+    return {values[0], values[1]};
+  }
+
+  /**
+   * @brief Get the length of one grid step
+   * @return Distance The resolution of the grid
+   */
+  [[nodiscard]] static auto GetResolution() -> Distance {
+    return Distance::FromNanometer(kResolution);
+  }
+
+  /**
+   * @brief Get x coordinate of this point
+   * @return int64_t x coordinate in grid steps
+   */
+  [[nodiscard]] constexpr auto GetX() const -> int64_t { return x_; }
+  /**
+   * @brief Get y coordinate of this point
+   * @return int64_t y coordinate in grid steps
+   */
+  [[nodiscard]] constexpr auto GetY() const -> int64_t { return y_; }
+  /**
+   * @brief Set x coordinate of this point
+   * @param input_x x coordinate in grid steps
+   */
+  constexpr auto SetX(int64_t input_x) -> void { x_ = input_x; }
+  /**
+   * @brief Set y coordinate of this point
+   * @param input_y y coordinate in grid steps
+   */
+  constexpr auto SetY(int64_t input_y) -> void { y_ = input_y; }
+
+  /**
+   * @brief Calculate exact squared distance between lhs point and rhs point
+   * @param lhs Left hand side BasicFixedPoint2D object
+   * @param rhs Right hand side BasicFixedPoint2D object
+   * @return Int128 Squared Euclidean distance in squared grid steps
+   * @throw std::overflow_error If a coordinate difference is not within
+   * +-(2^63 - 1)
+   */
+  [[nodiscard]] static auto CalculateSquaredDistance(
+      const BasicFixedPoint2D& lhs, const BasicFixedPoint2D& rhs) -> Int128 {
+    const auto dx{SubtractChecked(lhs.x_, rhs.x_)};
+    const auto dy{SubtractChecked(lhs.y_, rhs.y_)};
+    // Two squares of -2^63 would reach 2^127, one past the Int128 range.
+    if (dx == std::numeric_limits<int64_t>::min() ||
+        dy == std::numeric_limits<int64_t>::min()) {
+      throw std::overflow_error("BasicFixedPoint2D difference is too large");
+    }
+    return Int128::Multiply(dx, dx) + Int128::Multiply(dy, dy);
+  }
+  /**
+   * @brief Calculate exact squared distance between this point and target
+   * @param target Other BasicFixedPoint2D object
+   * @return Int128 Squared Euclidean distance in squared grid steps
+   * @throw std::overflow_error If a coordinate difference is not within
+   * +-(2^63 - 1)
+   */
+  [[nodiscard]] auto CalculateSquaredDistance(
+      const BasicFixedPoint2D& target) const -> Int128 {
+    return CalculateSquaredDistance(*this, target);
+  }
+
+  /**
+   * @brief Calculate distance between lhs point and rhs point
+   * @param lhs Left hand side BasicFixedPoint2D object
+   * @param rhs Right hand side BasicFixedPoint2D object
+   * @param rounding Rounding of the exact distance to whole nanometers
+   * @param policy What to do if the distance does not fit
+   * @return Distance Euclidean distance, rounded once
+   * @throw std::overflow_error If a coordinate difference is not within
+   * +-(2^63 - 1), or the distance does not fit and policy is kChecked
+   */
+  [[nodiscard]] static auto CalculateDistance(
+      const BasicFixedPoint2D& lhs, const BasicFixedPoint2D& rhs,
+      Rounding rounding = Rounding::kNearest,
+      OverflowPolicy policy = OverflowPolicy::kChecked) -> Distance {
+    const auto squared{CalculateSquaredDistance(lhs, rhs)};
+    if constexpr (kResolution == 1) {
+      return Distance::FromNanometer(
+          squared.SquareRoot(rounding).ToInt64(policy));
+    } else {
+      // A root of more than INT64_MAX / kResolution steps is too long
+      // anyway. Below it, squared * kResolution^2 is under 2^127.
+      constexpr auto kMaximumStep{std::numeric_limits<int64_t>::max() /
+                                  kResolution};
+      if (squared.SquareRoot(Rounding::kDown) > Int128{kMaximumStep}) {
+        return Distance::FromNanometer(Int128(1, 0U).ToInt64(policy));
+      }
+      return Distance::FromNanometer(
+          (squared * Int128{kResolution * kResolution})
+              .SquareRoot(rounding)
+              .ToInt64(policy));
+    }
+  }
+  /**
+   * @brief Calculate distance between this point and target point
+   * @param target Other BasicFixedPoint2D object
+   * @param rounding Rounding of the exact distance to whole nanometers
+   * @param policy What to do if the distance does not fit
+   * @return Distance Euclidean distance, rounded once
+   * @throw std::overflow_error If a coordinate difference is not within
+   * +-(2^63 - 1), or the distance does not fit and policy is kChecked
+   */
+  [[nodiscard]] auto CalculateDistance(
+      const BasicFixedPoint2D& target, Rounding rounding = Rounding::kNearest,
+      OverflowPolicy policy = OverflowPolicy::kChecked) const -> Distance {
+    return CalculateDistance(*this, target, rounding, policy);
+  }
+
+  /**
+   * @brief Check if lhs point is closer than rhs point to origin point
+   * @param origin BasicFixedPoint2D object to measure from
+   * @param lhs Left hand side BasicFixedPoint2D object
+   * @param rhs Right hand side BasicFixedPoint2D object
+   * @return true If lhs point is strictly closer to origin point
+   * @return false If lhs point is not closer to origin point
+   */
+  [[nodiscard]] static auto IsCloser(const BasicFixedPoint2D& origin,
+                                     const BasicFixedPoint2D& lhs,
+                                     const BasicFixedPoint2D& rhs) -> bool {
+    return CalculateSquaredDistance(origin, lhs) <
+           CalculateSquaredDistance(origin, rhs);
+  }
+  /**
+   * @brief Check exactly if target point lies within radius from this point
+   * @param target Other BasicFixedPoint2D object to check
+   * @param radius Distance type radius, boundary included
+   * @return true If the distance to target point is not greater than radius
+   * @return false If the distance to target point is greater than radius
+   */
+  [[nodiscard]] auto IsWithinRadius(const BasicFixedPoint2D& target,
+                                    const Distance& radius) const -> bool {
+    const auto nanometer{radius.GetNanometer()};
+    if (nanometer < 0) {
+      return false;
+    }
+    // distance <= radius is squared <= radius^2 / kResolution^2, and squared
+    // is whole, so the floor of the right hand side decides it exactly.
+    const auto limit{Int128::Multiply(nanometer, nanometer)
+                         .Divide(Int128{kResolution * kResolution},
+                                 Rounding::kDown)};
+    return CalculateSquaredDistance(target) <= limit;
+  }
+
+  /**
+   * @brief Add other point to this point
+   * @param other
+   * @return BasicFixedPoint2D Result of addition
+   * @throw std::overflow_error If a coordinate does not fit int64_t
+   */
+  auto operator+(const BasicFixedPoint2D& other) const -> BasicFixedPoint2D {
+    return {AddChecked(x_, other.x_), AddChecked(y_, other.y_)};
+  }
+  /**
+   * @brief Subtract other point from this point
+   * @param other
+   * @return BasicFixedPoint2D Result of subtraction
+   * @throw std::overflow_error If a coordinate does not fit int64_t
+   */
+  auto operator-(const BasicFixedPoint2D& other) const -> BasicFixedPoint2D {
+    return {SubtractChecked(x_, other.x_), SubtractChecked(y_, other.y_)};
+  }
+  /**
+   * @brief Add other point to this point and assign to this point
+   * @param other
+   * @return BasicFixedPoint2D& Result of addition and assignment
+   * @throw std::overflow_error If a coordinate does not fit int64_t
+   */
+  auto operator+=(const BasicFixedPoint2D& other) -> BasicFixedPoint2D& {
+    *this = *this + other;
+    return *this;
+  }
+  /**
+   * @brief Subtract other point from this point and assign to this point
+   * @param other
+   * @return BasicFixedPoint2D& Result of subtraction and assignment
+   * @throw std::overflow_error If a coordinate does not fit int64_t
+   */
+  auto operator-=(const BasicFixedPoint2D& other) -> BasicFixedPoint2D& {
+    *this = *this - other;
+    return *this;
+  }
+
+  /**
+   * @brief check if this point is equal to other point
+   * @param other
+   * @return true if this point is equal to other point
+   * @return false if this point is not equal to other point
+   */
+  constexpr auto operator==(const BasicFixedPoint2D& other) const -> bool {
+    return x_ == other.x_ && y_ == other.y_;
+  }
+  /**
+   * @brief check if this point is not equal to other point
+   * @param other
+   * @return true if this point is not equal to other point
+   * @return false if this point is equal to other point
+   */
+  constexpr auto operator!=(const BasicFixedPoint2D& other) const -> bool {
+    return !(*this == other);
+  }
+  /**
+   * @brief check if this point comes before other point, x first then y
+   * @param other
+   * @return true if this point comes before other point
+   * @return false if this point does not come before other point
+   */
+  constexpr auto operator<(const BasicFixedPoint2D& other) const -> bool {
+    return x_ != other.x_ ? x_ < other.x_ : y_ < other.y_;
+  }
+
+ protected:
+ private:
+  /**
+   * @brief Get the grid steps per coordinate unit
+   */
+  static auto GetStepPerUnit(Distance::Type unit) -> double {
+    return Distance::kNanometerPerUnit[Distance::GetTypeIndex(unit)] /
+           static_cast<double>(kResolution);
+  }
+  /**
+   * @brief Get the coordinate units per grid step
+   */
+  static auto GetUnitPerStep(Distance::Type unit) -> double {
+    return static_cast<double>(kResolution) *
+           Distance::kUnitPerNanometer[Distance::GetTypeIndex(unit)];
+  }
+  static auto AddChecked(int64_t lhs, int64_t rhs) -> int64_t {
+    const auto sum{static_cast<int64_t>(static_cast<uint64_t>(lhs) +
+                                        static_cast<uint64_t>(rhs))};
+    // Overflow flips the sign away from both operands.
+    if (((lhs ^ sum) & (rhs ^ sum)) < 0) {
+      throw std::overflow_error("BasicFixedPoint2D does not fit int64_t");
+    }
+    return sum;
+  }
+  static auto SubtractChecked(int64_t lhs, int64_t rhs) -> int64_t {
+    const auto difference{static_cast<int64_t>(static_cast<uint64_t>(lhs) -
+                                               static_cast<uint64_t>(rhs))};
+    if (((lhs ^ rhs) & (lhs ^ difference)) < 0) {
+      throw std::overflow_error("BasicFixedPoint2D does not fit int64_t");
+    }
+    return difference;
+  }
+
+  int64_t x_{0};  ///< x coordinate in grid steps
+  int64_t y_{0};  ///< y coordinate in grid steps
+};
+
+/**
+ * @brief Fixed-point point on the nanometer grid of Distance
+ */
+using FixedPoint2D = BasicFixedPoint2D<>;
+}  // namespace programmers::geometry
+
+namespace std {
+/**
+ * @brief Hash of BasicFixedPoint2D, for deduplication in unordered containers
+ * @tparam kResolution Nanometers per grid step
+ */
+template <int64_t kResolution>
+struct hash<programmers::geometry::BasicFixedPoint2D<kResolution>> {
+  auto operator()(
+      const programmers::geometry::BasicFixedPoint2D<kResolution>& point)
+      const noexcept -> std::size_t {
+    // Multiplicative mix so that neighbouring grid points spread out.
+    constexpr uint64_t kMultiplier{0x9E3779B97F4A7C15U};
+    const auto mixed{(static_cast<uint64_t>(point.GetX()) * kMultiplier) ^
+                     static_cast<uint64_t>(point.GetY())};
+    return static_cast<std::size_t>(mixed * kMultiplier);
+  }
+};
+}  // namespace std
+
+#endif
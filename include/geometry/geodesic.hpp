@@ -0,0 +1,129 @@
+/**
+ * @file geometry/geodesic.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Great circle and ellipsoidal distance declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__GEODESIC_HPP_
+#define PROGRAMMERS__GEOMETRY__GEODESIC_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "geometry/distance.hpp"
+#include "geometry/distance_array.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Earth models in meters
+ */
+namespace geodesic {
+constexpr double kMeanRadius{6371008.8};         ///< Sphere of IUGG mean radius
+constexpr double kSemiMajorAxis{6378137.0};      ///< WGS 84 equatorial radius
+constexpr double kFlattening{1.0 / 298.257223563};  ///< WGS 84 flattening
+}  // namespace geodesic
+
+/**
+ * @brief Model of the earth surface
+ */
+enum class GeodesicModel : uint8_t {
+  kSpherical,   ///< Great circle on the mean sphere, error up to about 0.5 %
+  kEllipsoidal  ///< Vincenty's series on WGS 84, sub-millimeter
+};
+
+/**
+ * @brief Calculate the shortest distance along the earth surface
+ * @details Points hold the longitude as x and the latitude as y, in degrees.
+ * The spherical model uses the haversine formula; the ellipsoidal model
+ * iterates Vincenty's formula, and where it does not converge, near the
+ * antipode, bisects the first azimuth as Karney does.
+ * @param from The first point
+ * @param to The second point
+ * @param model The earth model
+ * @return Distance The distance, rounded to the nearest nanometer
+ * @throw std::invalid_argument If a coordinate is not finite or a latitude
+ * is outside [-90, 90]
+ */
+[[nodiscard]] auto CalculateGeodesicDistance(
+    const Point2D& from, const Point2D& to,
+    GeodesicModel model = GeodesicModel::kSpherical) -> Distance;
+
+/**
+ * @brief Longitude and latitude points prepared for one-to-many distances
+ * @details Every point is also stored as a unit vector. The great circle
+ * distance is 2 * asin(c / 2) of the chord length c between unit vectors,
+ * so the batch path needs no trigonometry per point besides one asin,
+ * and the chord lengths come from the vectorized 3-dimension kernel.
+ * Unlike the cosine form, the chord keeps full precision for close points.
+ */
+class GeodesicCloud {
+ public:
+  /**
+   * @brief Construct a new empty GeodesicCloud object
+   */
+  GeodesicCloud() = default;
+  /**
+   * @brief Construct a new GeodesicCloud object
+   * @param points Longitudes as x and latitudes as y, in degrees
+   * @throw std::invalid_argument If a coordinate is not finite or a latitude
+   * is outside [-90, 90]
+   */
+  explicit GeodesicCloud(const PointCloud2D& points);
+
+  /**
+   * @brief Get the number of points
+   * @return std::size_t The number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Check if the cloud has no point
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool;
+  /**
+   * @brief Get a point
+   * @param index The index, less than Size()
+   * @return Point2D Longitude and latitude in degrees
+   */
+  [[nodiscard]] auto GetPoint(std::size_t index) const -> Point2D;
+
+  /**
+   * @brief Calculate the distance from every point to target in meters
+   * @param target Longitude and latitude of the target in degrees
+   * @param output Destination of Size() distances in meters
+   * @param model The earth model
+   * @throw std::invalid_argument If target is not a valid coordinate
+   */
+  auto CalculateDistances(const Point2D& target, double* output,
+                          GeodesicModel model = GeodesicModel::kSpherical)
+      const -> void;
+  /**
+   * @brief Calculate the distance from every point to target
+   * @param target Longitude and latitude of the target in degrees
+   * @param model The earth model
+   * @return DistanceArray The distances, rounded to the nearest nanometer
+   * @throw std::invalid_argument If target is not a valid coordinate
+   */
+  [[nodiscard]] auto CalculateDistances(
+      const Point2D& target,
+      GeodesicModel model = GeodesicModel::kSpherical) const -> DistanceArray;
+
+ protected:
+ private:
+  PointCloud2D points_;                ///< Longitudes and latitudes
+  PointCloud2D::CoordinateBuffer x_;  ///< x of the unit vectors
+  PointCloud2D::CoordinateBuffer y_;  ///< y of the unit vectors
+  PointCloud2D::CoordinateBuffer z_;  ///< z of the unit vectors, north
+};
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,179 @@
+/**
+ * @file geometry/kd_tree2d.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Static KD-tree spatial index declaration over 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__KD_TREE_2D_HPP_
+#define PROGRAMMERS__GEOMETRY__KD_TREE_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/neighbor.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Static KD-tree over 2-dimension points
+ * @details Nodes live in one array in depth-first order and the points are
+ * reordered into leaf buckets of contiguous coordinates, so building does
+ * one allocation per array and queries never chase heap pointers. Every
+ * query is const and keeps its state on the stack, so one tree can be shared
+ * by any number of threads as long as nobody rebuilds it.
+ */
+class KdTree2D {
+ public:
+  /**
+   * @brief Query result referring to one indexed point
+   */
+  using Neighbor = geometry::Neighbor;
+
+  static constexpr std::size_t kLeafSize{16U};  ///< Maximum points per leaf
+
+  /**
+   * @brief Construct a new empty KdTree2D object
+   */
+  KdTree2D() = default;
+  /**
+   * @brief Construct a new KdTree2D object indexing points
+   * @param points Points to index, referred by their position
+   * @throw std::length_error If there are more than 2^32 - 1 points
+   */
+  explicit KdTree2D(const PointCloud2D& points);
+  /**
+   * @brief Construct a new KdTree2D object indexing points
+   * @param points Points to index, referred by their position
+   * @throw std::length_error If there are more than 2^32 - 1 points
+   */
+  explicit KdTree2D(const std::vector<Point2D>& points);
+  /**
+   * @brief Construct a new KdTree2D object indexing a range of Point2D
+   * @param first Iterator to the first point
+   * @param last Iterator past the last point
+   * @throw std::length_error If there are more than 2^32 - 1 points
+   */
+  template <typename InputIterator>
+  KdTree2D(InputIterator first, InputIterator last) {
+    PointCloud2D points;
+    for (; first != last; ++first) {
+      points.PushBack(*first);
+    }
+    Build(points);
+  }
+
+  /**
+   * @brief Get the number of indexed points
+   * @return std::size_t The number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Check if the tree has no point
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool;
+
+  /**
+   * @brief Find the nearest point to query point
+   * @param query Point2D object to search from
+   * @return Neighbor The nearest point
+   * @throw std::out_of_range If the tree is empty
+   */
+  [[nodiscard]] auto FindNearest(const Point2D& query) const -> Neighbor;
+  /**
+   * @brief Find the k nearest points to query point
+   * @param query Point2D object to search from
+   * @param k The number of points to find
+   * @return std::vector<Neighbor> min(k, Size()) points, nearest first
+   */
+  [[nodiscard]] auto FindNearest(const Point2D& query, std::size_t k) const
+      -> std::vector<Neighbor>;
+  /**
+   * @brief Find the k nearest points to every query point in parallel
+   * @param queries Points to search from
+   * @param k The number of points to find for each query
+   * @return std::vector<Neighbor> Row-major queries.Size() x min(k, Size())
+   * matrix, each row nearest first
+   */
+  [[nodiscard]] auto FindNearest(const PointCloud2D& queries,
+                                 std::size_t k) const -> std::vector<Neighbor>;
+
+  /**
+   * @brief Find the points within radius from query point
+   * @param query Point2D object to search from
+   * @param radius Double type radius, boundary included
+   * @return std::vector<Neighbor> The points in no particular order
+   */
+  [[nodiscard]] auto FindWithinRadius(const Point2D& query,
+                                      double radius) const
+      -> std::vector<Neighbor>;
+  /**
+   * @brief Find the points within radius from query point
+   * @param query Point2D object to search from
+   * @param radius Distance type radius, boundary included
+   * @param unit Distance type of one coordinate unit
+   * @return std::vector<Neighbor> The points in no particular order
+   */
+  [[nodiscard]] auto FindWithinRadius(
+      const Point2D& query, const Distance& radius,
+      Distance::Type unit = Distance::Type::kMeter) const
+      -> std::vector<Neighbor>;
+  /**
+   * @brief Find the points within radius from every query point in parallel
+   * @param queries Points to search from
+   * @param radius Double type radius, boundary included
+   * @return std::vector<std::vector<Neighbor>> The points of each query in
+   * no particular order
+   */
+  [[nodiscard]] auto FindWithinRadius(const PointCloud2D& queries,
+                                      double radius) const
+      -> std::vector<std::vector<Neighbor>>;
+
+ protected:
+ private:
+  /**
+   * @brief Tree node, left child follows its parent in the node array
+   */
+  struct Node {
+    double split{0.0};   ///< Split coordinate of internal node
+    uint32_t begin{0U};  ///< First point of the subtree
+    uint32_t end{0U};    ///< Past the last point of the subtree
+    uint32_t right{0U};  ///< Right child node, 0 for leaf
+    uint32_t axis{0U};   ///< Split axis, 0 for x and 1 for y
+  };
+
+  /**
+   * @brief The number of nodes in the subtree of each point count
+   */
+  using NodeCounts = std::unordered_map<uint32_t, uint32_t>;
+
+  /**
+   * @brief Build the tree over points
+   * @param points Points to index
+   */
+  auto Build(const PointCloud2D& points) -> void;
+  /**
+   * @brief Build the subtree of node over order[begin, end)
+   */
+  auto BuildNode(const PointCloud2D& points, std::vector<uint32_t>& order,
+                 const NodeCounts& node_counts, uint32_t node,
+                 uint32_t begin, uint32_t end) -> void;
+
+  std::vector<Node> nodes_;         ///< Nodes in depth-first order
+  PointCloud2D points_;             ///< Points in leaf order
+  std::vector<uint32_t> indices_;  ///< Input index of points in leaf order
+};
+}  // namespace programmers::geometry
+
+#endif
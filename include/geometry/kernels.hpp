@@ -0,0 +1,264 @@
+/**
+ * @file geometry/kernels.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Vectorized batch kernels with runtime instruction set dispatch
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__KERNELS_HPP_
+#define PROGRAMMERS__GEOMETRY__KERNELS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "geometry/exact_arithmetic.hpp"
+
+/**
+ * @brief Batch kernels over coordinate arrays
+ * @details Every kernel works on structure-of-arrays spans, such as the
+ * arrays of PointCloud2D. The implementation is chosen once per process from
+ * the best instruction set supported by both the build and the host CPU.
+ * Setting the environment variable GEOMETRY_KERNEL_ISA to scalar, sse2, avx2
+ * or avx512, in any case, before the first call caps the choice; any other
+ * value makes kernel calls throw std::invalid_argument. SetActiveIsa changes
+ * it at runtime. Output arrays may be the same as input arrays, but must not
+ * partially overlap them.
+ */
+namespace programmers::geometry::kernels {
+/**
+ * @brief The enum class for instruction set of kernels
+ */
+enum class Isa { kScalar = 0, kSse2 = 1, kAvx2 = 2, kAvx512 = 3 };
+
+/**
+ * @brief Items per word of a bitmask, item i is bit i % 64 of word i / 64
+ */
+constexpr std::size_t kMaskBits{64U};
+
+/**
+ * @brief Get the best instruction set supported by the build and the host
+ * @return Isa The best supported instruction set
+ */
+[[nodiscard]] auto GetSupportedIsa() -> Isa;
+/**
+ * @brief Get the instruction set of the kernels currently in use
+ * @return Isa The active instruction set
+ */
+[[nodiscard]] auto GetActiveIsa() -> Isa;
+/**
+ * @brief Select the instruction set of the kernels
+ * @param isa The requested instruction set, lowered to GetSupportedIsa()
+ * when the host cannot run it
+ * @return Isa The instruction set now in use
+ */
+auto SetActiveIsa(Isa isa) -> Isa;
+/**
+ * @brief Restore the instruction set chosen at startup
+ */
+auto ResetActiveIsa() -> void;
+/**
+ * @brief Get the lower case name of instruction set
+ * @param isa The instruction set
+ * @return const char* The name such as "avx2"
+ */
+[[nodiscard]] auto GetIsaName(Isa isa) -> const char*;
+
+/**
+ * @brief Calculate distance from every point to target point
+ * @param xs x coordinates of count points
+ * @param ys y coordinates of count points
+ * @param count The number of points
+ * @param target_x x coordinate of target point
+ * @param target_y y coordinate of target point
+ * @param output Destination of count Euclidean distances
+ */
+auto CalculateDistances(const double* xs, const double* ys, std::size_t count,
+                        double target_x, double target_y, double* output)
+    -> void;
+/**
+ * @brief Calculate squared distance from every point to target point
+ * @param xs x coordinates of count points
+ * @param ys y coordinates of count points
+ * @param count The number of points
+ * @param target_x x coordinate of target point
+ * @param target_y y coordinate of target point
+ * @param output Destination of count squared Euclidean distances
+ */
+auto CalculateSquaredDistances(const double* xs, const double* ys,
+                               std::size_t count, double target_x,
+                               double target_y, double* output) -> void;
+/**
+ * @brief Calculate distance between the points with same index
+ * @param lhs_xs x coordinates of count left hand side points
+ * @param lhs_ys y coordinates of count left hand side points
+ * @param rhs_xs x coordinates of count right hand side points
+ * @param rhs_ys y coordinates of count right hand side points
+ * @param count The number of points
+ * @param output Destination of count Euclidean distances
+ */
+auto CalculatePairwiseDistances(const double* lhs_xs, const double* lhs_ys,
+                                const double* rhs_xs, const double* rhs_ys,
+                                std::size_t count, double* output) -> void;
+/**
+ * @brief Calculate distance from every 3-dimension point to target point
+ * @param xs x coordinates of count points
+ * @param ys y coordinates of count points
+ * @param zs z coordinates of count points
+ * @param count The number of points
+ * @param target x, y and z coordinates of target point
+ * @param output Destination of count Euclidean distances
+ */
+auto CalculateDistances3D(const double* xs, const double* ys,
+                          const double* zs, std::size_t count,
+                          const double* target, double* output) -> void;
+/**
+ * @brief Add the points with same index
+ * @param lhs_xs x coordinates of count left hand side points
+ * @param lhs_ys y coordinates of count left hand side points
+ * @param rhs_xs x coordinates of count right hand side points
+ * @param rhs_ys y coordinates of count right hand side points
+ * @param count The number of points
+ * @param output_xs Destination of count x coordinates
+ * @param output_ys Destination of count y coordinates
+ */
+auto Add(const double* lhs_xs, const double* lhs_ys, const double* rhs_xs,
+         const double* rhs_ys, std::size_t count, double* output_xs,
+         double* output_ys) -> void;
+/**
+ * @brief Subtract the points with same index
+ * @param lhs_xs x coordinates of count left hand side points
+ * @param lhs_ys y coordinates of count left hand side points
+ * @param rhs_xs x coordinates of count right hand side points
+ * @param rhs_ys y coordinates of count right hand side points
+ * @param count The number of points
+ * @param output_xs Destination of count x coordinates
+ * @param output_ys Destination of count y coordinates
+ */
+auto Subtract(const double* lhs_xs, const double* lhs_ys, const double* rhs_xs,
+              const double* rhs_ys, std::size_t count, double* output_xs,
+              double* output_ys) -> void;
+/**
+ * @brief Multiply every point with scalar
+ * @param xs x coordinates of count points
+ * @param ys y coordinates of count points
+ * @param count The number of points
+ * @param scalar The scalar
+ * @param output_xs Destination of count x coordinates
+ * @param output_ys Destination of count y coordinates
+ */
+auto Scale(const double* xs, const double* ys, std::size_t count,
+           double scalar, double* output_xs, double* output_ys) -> void;
+/**
+ * @brief Add the same offset to every point
+ * @param xs x coordinates of count points
+ * @param ys y coordinates of count points
+ * @param count The number of points
+ * @param offset_x x offset
+ * @param offset_y y offset
+ * @param output_xs Destination of count x coordinates
+ * @param output_ys Destination of count y coordinates
+ */
+auto Translate(const double* xs, const double* ys, std::size_t count,
+               double offset_x, double offset_y, double* output_xs,
+               double* output_ys) -> void;
+/**
+ * @brief Apply the same affine matrix to every point
+ * @details The output may alias the input for an in place update. Kernels
+ * with fused multiply add round once per product, so results may differ from
+ * the scalar kernel in the last bit.
+ * @param xs x coordinates of count points
+ * @param ys y coordinates of count points
+ * @param count The number of points
+ * @param matrix Row major 2x3 matrix {a, b, tx, c, d, ty}, mapping (x, y) to
+ * (a * x + b * y + tx, c * x + d * y + ty)
+ * @param output_xs Destination of count x coordinates
+ * @param output_ys Destination of count y coordinates
+ */
+auto Transform(const double* xs, const double* ys, std::size_t count,
+               const double* matrix, double* output_xs, double* output_ys)
+    -> void;
+/**
+ * @brief Calculate the bounding box of points
+ * @details NaN coordinates are skipped; without any other coordinate the
+ * minimum is +infinity and the maximum -infinity.
+ * @param xs x coordinates of count points
+ * @param ys y coordinates of count points
+ * @param count The number of points
+ * @param output Destination of {min_x, min_y, max_x, max_y}
+ */
+auto CalculateBounds(const double* xs, const double* ys, std::size_t count,
+                     double* output) -> void;
+/**
+ * @brief Mark the points inside a closed box
+ * @param xs x coordinates of count points
+ * @param ys y coordinates of count points
+ * @param count The number of points
+ * @param box {min_x, min_y, max_x, max_y}
+ * @param output Destination of ceil(count / kMaskBits) words, bits past
+ * count cleared
+ */
+auto FilterWithinBox(const double* xs, const double* ys, std::size_t count,
+                     const double* box, uint64_t* output) -> void;
+/**
+ * @brief Mark the boxes sharing a point with a closed box
+ * @param min_xs Minimum x coordinates of count boxes
+ * @param min_ys Minimum y coordinates of count boxes
+ * @param max_xs Maximum x coordinates of count boxes
+ * @param max_ys Maximum y coordinates of count boxes
+ * @param count The number of boxes
+ * @param box {min_x, min_y, max_x, max_y}
+ * @param output Destination of ceil(count / kMaskBits) words, bits past
+ * count cleared
+ */
+auto FilterIntersectingBoxes(const double* min_xs, const double* min_ys,
+                             const double* max_xs, const double* max_ys,
+                             std::size_t count, const double* box,
+                             uint64_t* output) -> void;
+/**
+ * @brief Interleave the bits of every cell into its Z-order (Morton) key
+ * @param xs x cell coordinates of count cells
+ * @param ys y cell coordinates of count cells
+ * @param count The number of cells
+ * @param output Destination of count keys, x bits at even positions
+ */
+auto EncodeMorton(const uint32_t* xs, const uint32_t* ys, std::size_t count,
+                  uint64_t* output) -> void;
+/**
+ * @brief Compute the Hilbert curve key of every cell
+ * @param xs x cell coordinates of count cells
+ * @param ys y cell coordinates of count cells
+ * @param count The number of cells
+ * @param output Destination of count keys on the 2^32 x 2^32 curve
+ */
+auto EncodeHilbert(const uint32_t* xs, const uint32_t* ys, std::size_t count,
+                   uint64_t* output) -> void;
+/**
+ * @brief Convert every integer to double and multiply by scale
+ * @param values count integers, such as nanometers
+ * @param count The number of values
+ * @param scale The factor applied after the exact conversion
+ * @param output Destination of count values, double(values[i]) * scale
+ */
+auto ConvertToDouble(const int64_t* values, std::size_t count, double scale,
+                     double* output) -> void;
+/**
+ * @brief Multiply every value by scale and round it to int64_t
+ * @param values count values
+ * @param count The number of values
+ * @param scale The factor applied before rounding
+ * @param rounding Rounding of values[i] * scale to an integer
+ * @param output Destination of count integers, saturated to the int64_t
+ * range, 0 where the product is not a number
+ * @return true If every product is a number
+ * @return false If some product is not a number
+ */
+auto ConvertToInt64(const double* values, std::size_t count, double scale,
+                    Rounding rounding, int64_t* output) -> bool;
+}  // namespace programmers::geometry::kernels
+
+#endif
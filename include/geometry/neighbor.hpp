@@ -0,0 +1,43 @@
+/**
+ * @file geometry/neighbor.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Neighbor search result declaration shared by spatial indices
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__NEIGHBOR_HPP_
+#define PROGRAMMERS__GEOMETRY__NEIGHBOR_HPP_
+
+#include <cstddef>
+
+#include "geometry/distance.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Search result referring to one indexed point
+ */
+struct Neighbor {
+  std::size_t index{0U};         ///< Index or handle of the point
+  double squared_distance{0.0};  ///< Squared distance to the query point
+
+  /**
+   * @brief Get the distance to the query point
+   * @return double Euclidean distance
+   */
+  [[nodiscard]] auto GetDistance() const -> double;
+  /**
+   * @brief Get the distance to the query point as Distance object
+   * @param unit Distance type of one coordinate unit
+   * @return Distance Euclidean distance
+   */
+  [[nodiscard]] auto ToDistance(
+      Distance::Type unit = Distance::Type::kMeter) const -> Distance;
+};
+}  // namespace programmers::geometry
+
+#endif
@@ -13,134 +13,231 @@
 #ifndef PROGRAMMERS__GEOMETRY__POINT_2D_HPP_
 #define PROGRAMMERS__GEOMETRY__POINT_2D_HPP_
 
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "geometry/distance.hpp"
+
 namespace programmers::geometry {
 /**
  * @brief Point class with 2-dimension
+ * @details Point2D is the double precision instantiation. Point2F halves the
+ * point to 8 bytes for rendering and coarse filtering, where the precision
+ * of float is enough. Converting between them is explicit.
+ * @tparam T Floating point type of the coordinates, float or double
  */
-class Point2D {
+template <typename T>
+class BasicPoint2D {
+  static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                "BasicPoint2D supports float and double coordinates");
+
  public:
   /**
-   * @brief Construct a new Point2D object
+   * @brief Floating point type of the coordinates
+   */
+  using ValueType = T;
+
+  /**
+   * @brief Construct a new BasicPoint2D object
+   */
+  BasicPoint2D() = default;
+  /**
+   * @brief Construct a new BasicPoint2D object with x, y value
+   * @param x T type x coordinate value
+   * @param y T type y coordinate value
    */
-  Point2D() = default;
+  BasicPoint2D(T input_x, T input_y);
   /**
-   * @brief Construct a new Point2D object with x, y value
-   * @param x Double type x coordinate value
-   * @param y Double type y coordinate value
+   * @brief Convert a BasicPoint2D object of other precision
+   * @param other BasicPoint2D object, rounded to the nearest T coordinates
    */
-  Point2D(double input_x, double input_y);
+  template <typename U>
+  explicit BasicPoint2D(const BasicPoint2D<U>& other)
+      : x_(static_cast<T>(other.GetX())), y_(static_cast<T>(other.GetY())) {}
 
   /**
-   * @brief Copy construct a new Point2D object with other Point2D object
-   * @param other Point2D object
+   * @brief Copy construct a new BasicPoint2D object with other object
+   * @param other BasicPoint2D object
    */
-  Point2D(const Point2D& other) = default;
+  BasicPoint2D(const BasicPoint2D& other) = default;
   /**
-   * @brief Move construct a new Point2D object with other Point2D object
-   * @param other Point2D object
+   * @brief Move construct a new BasicPoint2D object with other object
+   * @param other BasicPoint2D object
    */
-  Point2D(Point2D&& other) noexcept = default;
+  BasicPoint2D(BasicPoint2D&& other) noexcept = default;
 
   /**
-   * @brief Destroy the Point2D object
+   * @brief Destroy the BasicPoint2D object
    */
-  virtual ~Point2D() = default;
+  ~BasicPoint2D() = default;
 
   /**
    * @brief Copy assignment operator
-   * @param other Point2D object
-   * @return Point2D& Reference of Point2D object
+   * @param other BasicPoint2D object
+   * @return BasicPoint2D& Reference of BasicPoint2D object
    */
-  auto operator=(const Point2D& other) -> Point2D& = default;
+  auto operator=(const BasicPoint2D& other) -> BasicPoint2D& = default;
   /**
    * @brief Move assignment operator
-   * @param other Point2D object
-   * @return Point2D& Reference of Point2D object
+   * @param other BasicPoint2D object
+   * @return BasicPoint2D& Reference of BasicPoint2D object
    */
-  auto operator=(Point2D&& other) -> Point2D& = default;
+  auto operator=(BasicPoint2D&& other) -> BasicPoint2D& = default;
 
   /**
    * @brief Calculate distance between this point and target point
-   * @param target Other Point2D object to calculate distance
-   * @return double Euclidean distance between this point and target point
+   * @param target Other BasicPoint2D object to calculate distance
+   * @return T Euclidean distance between this point and target point
    */
-  [[nodiscard]] auto CalculateDistance(const Point2D& target) const -> double;
+  [[nodiscard]] auto CalculateDistance(const BasicPoint2D& target) const -> T;
 
   /**
    * @brief Calculate distance between lhs point and rhs point
-   * @param lhs Left hand side Point2D object
-   * @param rhs Right hand side Point2D object
-   * @return double Euclidean distance between lhs point and rhs point
+   * @param lhs Left hand side BasicPoint2D object
+   * @param rhs Right hand side BasicPoint2D object
+   * @return T Euclidean distance between lhs point and rhs point
    */
-  [[nodiscard]] static auto CalculateDistance(const Point2D& lhs,
-                                              const Point2D& rhs) -> double;
+  [[nodiscard]] static auto CalculateDistance(const BasicPoint2D& lhs,
+                                              const BasicPoint2D& rhs) -> T;
 
   /**
-   * @brief Calculate distance between lhs point and rhs point
-   * @param lhs Left hand side Point2D object
-   * @param rhs Right hand side Point2D object
-   * @return double Euclidean distance between lhs point and rhs point
+   * @brief Calculate squared distance between this point and target point
+   * @param target Other BasicPoint2D object to calculate squared distance
+   * @return T Squared Euclidean distance between this point and target
+   * point
+   */
+  [[nodiscard]] auto CalculateSquaredDistance(const BasicPoint2D& target) const
+      -> T;
+
+  /**
+   * @brief Calculate squared distance between lhs point and rhs point
+   * @param lhs Left hand side BasicPoint2D object
+   * @param rhs Right hand side BasicPoint2D object
+   * @return T Squared Euclidean distance between lhs point and rhs point
+   */
+  [[nodiscard]] static auto CalculateSquaredDistance(const BasicPoint2D& lhs,
+                                                     const BasicPoint2D& rhs)
+      -> T;
+
+  /**
+   * @brief Check if lhs point is closer than rhs point to origin point
+   * @param origin BasicPoint2D object to measure from
+   * @param lhs Left hand side BasicPoint2D object
+   * @param rhs Right hand side BasicPoint2D object
+   * @return true If lhs point is strictly closer to origin point
+   * @return false If lhs point is not closer to origin point
+   */
+  [[nodiscard]] static auto IsCloser(const BasicPoint2D& origin,
+                                     const BasicPoint2D& lhs,
+                                     const BasicPoint2D& rhs) -> bool;
+
+  /**
+   * @brief Check if target point lies within radius from this point
+   * @param target Other BasicPoint2D object to check
+   * @param radius T type radius, boundary included
+   * @return true If the distance to target point is not greater than radius
+   * @return false If the distance to target point is greater than radius
+   */
+  [[nodiscard]] auto IsWithinRadius(const BasicPoint2D& target, T radius) const
+      -> bool;
+  /**
+   * @brief Check if target point lies within radius from this point
+   * @param target Other BasicPoint2D object to check
+   * @param radius Distance type radius, boundary included
+   * @param unit Distance type of one coordinate unit
+   * @return true If the distance to target point is not greater than radius
+   * @return false If the distance to target point is greater than radius
+   */
+  [[nodiscard]] auto IsWithinRadius(
+      const BasicPoint2D& target, const Distance& radius,
+      Distance::Type unit = Distance::Type::kMeter) const -> bool;
+
+  /**
+   * @brief Find the points lying within radius from center point
+   * @param points BasicPoint2D objects to filter
+   * @param center BasicPoint2D object to measure from
+   * @param radius T type radius, boundary included
+   * @return std::vector<std::size_t> Ascending indices of the points within
+   * radius
+   */
+  [[nodiscard]] static auto FilterWithinRadius(
+      const std::vector<BasicPoint2D>& points, const BasicPoint2D& center,
+      T radius) -> std::vector<std::size_t>;
+  /**
+   * @brief Find the points lying within radius from center point
+   * @param points BasicPoint2D objects to filter
+   * @param center BasicPoint2D object to measure from
+   * @param radius Distance type radius, boundary included
+   * @param unit Distance type of one coordinate unit
+   * @return std::vector<std::size_t> Ascending indices of the points within
+   * radius
    */
+  [[nodiscard]] static auto FilterWithinRadius(
+      const std::vector<BasicPoint2D>& points, const BasicPoint2D& center,
+      const Distance& radius, Distance::Type unit = Distance::Type::kMeter)
+      -> std::vector<std::size_t>;
+
   /**
    * @brief Set x coordinate value
-   * @param coordinateX Double type input x coordinate value
+   * @param coordinateX T type input x coordinate value
    */
-  void SetX(double input_x);
+  void SetX(T input_x);
   /**
    * @brief Set y coordinate value
-   * @param coordinateY Double type input y coordinate value
+   * @param coordinateY T type input y coordinate value
    */
-  void SetY(double input_y);
+  void SetY(T input_y);
 
   /**
    * @brief Get x coordinate value of this point
-   * @return double x coordinate value of this point
+   * @return T x coordinate value of this point
    */
-  [[nodiscard]] auto GetX() const -> double;
+  [[nodiscard]] auto GetX() const -> T;
   /**
    * @brief Get y coordinate value of this point
-   * @return double y coordinate value of this point
+   * @return T y coordinate value of this point
    */
-  [[nodiscard]] auto GetY() const -> double;
+  [[nodiscard]] auto GetY() const -> T;
 
   /**
    * @brief Add other point to this point
    * @param other
-   * @return Point2D Result of addition
+   * @return BasicPoint2D Result of addition
    */
-  auto operator+(const Point2D& other) const -> Point2D;
+  auto operator+(const BasicPoint2D& other) const -> BasicPoint2D;
   /**
    * @brief Subtract other point from this point
    * @param other
-   * @return Point2D Result of subtraction
+   * @return BasicPoint2D Result of subtraction
    */
-  auto operator-(const Point2D& other) const -> Point2D;
+  auto operator-(const BasicPoint2D& other) const -> BasicPoint2D;
 
   /**
    * @brief Add other point to this point and assign to this point
    * @param other
    * @return Point Result of addition and assignment
    */
-  auto operator+=(const Point2D& other) -> Point2D&;
+  auto operator+=(const BasicPoint2D& other) -> BasicPoint2D&;
   /**
    * @brief Subtract other point from this point and assign to this point
    * @param other
    * @return Point Result of subtraction and assignment
    */
-  auto operator-=(const Point2D& other) -> Point2D&;
+  auto operator-=(const BasicPoint2D& other) -> BasicPoint2D&;
 
   /**
    * @brief Multiply this point with scalar
    * @param scalar
-   * @return Point2D Result of multiplication
+   * @return BasicPoint2D Result of multiplication
    */
-  auto operator*(double scalar) const -> Point2D;
+  auto operator*(T scalar) const -> BasicPoint2D;
   /**
    * @brief Divide this point with scalar
    * @param scalar
-   * @return Point2D Result of division
+   * @return BasicPoint2D Result of division
    */
-  auto operator/(double scalar) const -> Point2D;
+  auto operator/(T scalar) const -> BasicPoint2D;
 
   /**
    * @brief check if this point is equal to other point
@@ -148,7 +245,7 @@ class Point2D {
    * @return true if this point is equal to other point
    * @return false if this point is not equal to other point
    */
-  auto operator==(const Point2D& other) const -> bool;
+  auto operator==(const BasicPoint2D& other) const -> bool;
 
   /**
    * @brief check if this point is not equal to other point
@@ -156,14 +253,26 @@ class Point2D {
    * @return true if this point is not equal to other point
    * @return false if this point is equal to other point
    */
-  auto operator!=(const Point2D& other) const -> bool;
+  auto operator!=(const BasicPoint2D& other) const -> bool;
 
  protected:
  private:
-  double x_{0.0};  ///< x coordinate
-  double y_{0.0};  ///< y coordinate
+  T x_{0};  ///< x coordinate
+  T y_{0};  ///< y coordinate
 };
 
+extern template class BasicPoint2D<float>;
+extern template class BasicPoint2D<double>;
+
+/**
+ * @brief Point with double precision coordinates
+ */
+using Point2D = BasicPoint2D<double>;
+/**
+ * @brief Point with single precision coordinates, 8 bytes per point
+ */
+using Point2F = BasicPoint2D<float>;
+
 }  // namespace programmers::geometry
 
 #endif
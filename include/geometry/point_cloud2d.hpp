@@ -0,0 +1,242 @@
+/**
+ * @file geometry/point_cloud2d.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Structure-of-arrays container of 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__POINT_CLOUD_2D_HPP_
+#define PROGRAMMERS__GEOMETRY__POINT_CLOUD_2D_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/aligned_allocator.hpp"
+#include "geometry/point2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Point container keeping x and y coordinates in separate arrays
+ * @details Both coordinate arrays are contiguous and start on a kAlignment
+ * boundary, so batch operations stream through them without touching any
+ * per-point object.
+ */
+class PointCloud2D {
+ public:
+  static constexpr std::size_t kAlignment{64U};  ///< Coordinate alignment
+  /**
+   * @brief Aligned coordinate array type
+   */
+  using CoordinateBuffer =
+      std::vector<double, AlignedAllocator<double, kAlignment>>;
+
+  /**
+   * @brief Construct a new empty PointCloud2D object
+   */
+  PointCloud2D() = default;
+  /**
+   * @brief Construct a new PointCloud2D object with count origin points
+   * @param count The number of points
+   */
+  explicit PointCloud2D(std::size_t count);
+  /**
+   * @brief Construct a new PointCloud2D object from Point2D objects
+   * @param points Point2D objects to copy
+   */
+  explicit PointCloud2D(const std::vector<Point2D>& points);
+
+  /**
+   * @brief Get the number of points
+   * @return std::size_t The number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Check if the container has no point
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool;
+  /**
+   * @brief Reserve storage for count points
+   * @param count The number of points
+   */
+  auto Reserve(std::size_t count) -> void;
+  /**
+   * @brief Resize to count points, new points are the origin
+   * @param count The number of points
+   */
+  auto Resize(std::size_t count) -> void;
+  /**
+   * @brief Remove every point
+   */
+  auto Clear() -> void;
+
+  /**
+   * @brief Append a point
+   * @param point Point2D object to append
+   */
+  auto PushBack(const Point2D& point) -> void;
+  /**
+   * @brief Append a point with x, y value
+   * @param input_x Double type x coordinate value
+   * @param input_y Double type y coordinate value
+   */
+  auto PushBack(double input_x, double input_y) -> void;
+
+  /**
+   * @brief Get the point at index
+   * @param index Index of the point
+   * @return Point2D Copy of the point
+   */
+  [[nodiscard]] auto GetPoint(std::size_t index) const -> Point2D;
+  /**
+   * @brief Set the point at index
+   * @param index Index of the point
+   * @param point Point2D object to store
+   */
+  auto SetPoint(std::size_t index, const Point2D& point) -> void;
+  /**
+   * @brief Get x coordinate value of the point at index
+   * @param index Index of the point
+   * @return double x coordinate value
+   */
+  [[nodiscard]] auto GetX(std::size_t index) const -> double;
+  /**
+   * @brief Get y coordinate value of the point at index
+   * @param index Index of the point
+   * @return double y coordinate value
+   */
+  [[nodiscard]] auto GetY(std::size_t index) const -> double;
+
+  /**
+   * @brief Get the aligned x coordinate array
+   * @return const double* Pointer to Size() x coordinate values
+   */
+  [[nodiscard]] auto XData() const -> const double*;
+  /**
+   * @brief Get the aligned y coordinate array
+   * @return const double* Pointer to Size() y coordinate values
+   */
+  [[nodiscard]] auto YData() const -> const double*;
+  /**
+   * @brief Get the mutable aligned x coordinate array
+   * @return double* Pointer to Size() x coordinate values
+   */
+  [[nodiscard]] auto XData() -> double*;
+  /**
+   * @brief Get the mutable aligned y coordinate array
+   * @return double* Pointer to Size() y coordinate values
+   */
+  [[nodiscard]] auto YData() -> double*;
+
+  /**
+   * @brief Copy the points out to Point2D objects
+   * @return std::vector<Point2D> Point2D objects in container order
+   */
+  [[nodiscard]] auto ToPoints() const -> std::vector<Point2D>;
+
+  /**
+   * @brief Calculate distance from every point to target point
+   * @param target Point2D object to calculate distance
+   * @return std::vector<double> Size() Euclidean distances
+   */
+  [[nodiscard]] auto CalculateDistances(const Point2D& target) const
+      -> std::vector<double>;
+  /**
+   * @brief Calculate distance from every point to target point
+   * @param target Point2D object to calculate distance
+   * @param output Destination of Size() Euclidean distances
+   */
+  auto CalculateDistances(const Point2D& target, double* output) const -> void;
+  /**
+   * @brief Calculate squared distance from every point to target point
+   * @param target Point2D object to calculate squared distance
+   * @return std::vector<double> Size() squared Euclidean distances
+   */
+  [[nodiscard]] auto CalculateSquaredDistances(const Point2D& target) const
+      -> std::vector<double>;
+  /**
+   * @brief Calculate squared distance from every point to target point
+   * @param target Point2D object to calculate squared distance
+   * @param output Destination of Size() squared Euclidean distances
+   */
+  auto CalculateSquaredDistances(const Point2D& target, double* output) const
+      -> void;
+  /**
+   * @brief Find the points lying within radius from center point
+   * @param center Point2D object to measure from
+   * @param radius Double type radius, boundary included
+   * @return std::vector<std::size_t> Ascending indices of the points within
+   * radius
+   */
+  [[nodiscard]] auto FilterWithinRadius(const Point2D& center,
+                                        double radius) const
+      -> std::vector<std::size_t>;
+  /**
+   * @brief Find the points lying within radius from center point
+   * @param center Point2D object to measure from
+   * @param radius Distance type radius, boundary included
+   * @param unit Distance type of one coordinate unit
+   * @return std::vector<std::size_t> Ascending indices of the points within
+   * radius
+   */
+  [[nodiscard]] auto FilterWithinRadius(
+      const Point2D& center, const Distance& radius,
+      Distance::Type unit = Distance::Type::kMeter) const
+      -> std::vector<std::size_t>;
+  /**
+   * @brief Calculate distance between the points with same index
+   * @param other Other container with the same size
+   * @return std::vector<double> Size() Euclidean distances
+   * @throw std::invalid_argument If the sizes differ
+   */
+  [[nodiscard]] auto CalculatePairwiseDistances(const PointCloud2D& other) const
+      -> std::vector<double>;
+  /**
+   * @brief Calculate distance from every point to every target point
+   * @param targets Target points
+   * @return std::vector<double> Row-major Size() x targets.Size() matrix,
+   * element (i, j) is the distance between point i and target j
+   */
+  [[nodiscard]] auto CalculateDistanceMatrix(const PointCloud2D& targets) const
+      -> std::vector<double>;
+
+  /**
+   * @brief Add offset to every point
+   * @param offset Point2D object to add
+   */
+  auto Translate(const Point2D& offset) -> void;
+  /**
+   * @brief Multiply every point with scalar
+   * @param scalar
+   */
+  auto Scale(double scalar) -> void;
+  /**
+   * @brief Add the point with same index of other container to every point
+   * @param other Other container with the same size
+   * @return PointCloud2D& Reference of this container
+   * @throw std::invalid_argument If the sizes differ
+   */
+  auto operator+=(const PointCloud2D& other) -> PointCloud2D&;
+  /**
+   * @brief Subtract the point with same index of other container from every
+   * point
+   * @param other Other container with the same size
+   * @return PointCloud2D& Reference of this container
+   * @throw std::invalid_argument If the sizes differ
+   */
+  auto operator-=(const PointCloud2D& other) -> PointCloud2D&;
+
+ protected:
+ private:
+  CoordinateBuffer x_;  ///< x coordinates
+  CoordinateBuffer y_;  ///< y coordinates
+};
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,202 @@
+/**
+ * @file geometry/point_file.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Memory mapped binary columnar point file declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__POINT_FILE_HPP_
+#define PROGRAMMERS__GEOMETRY__POINT_FILE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/distance_array.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Distance attribute column written with the points
+ */
+struct PointFileAttribute {
+  std::string name;                     ///< Unique name, kMaximumNameSize
+  const DistanceArray* values{nullptr};  ///< One distance per point
+};
+
+/**
+ * @brief Layout constants of the point file format
+ * @details All fields are native endian; the byte order field tells a reader
+ * on a different machine to reject the file instead of misreading it.
+ *
+ * | Offset | Content                                                    |
+ * | ------ | ---------------------------------------------------------- |
+ * | 0      | 64 byte header, see the constants below                    |
+ * | 64     | attribute_count 64 byte entries: name[56], column offset   |
+ * | k * 64 | x column, y column and attribute columns, each 64 aligned  |
+ *
+ * x and y are count doubles, attributes are count int64_t nanometers.
+ */
+namespace point_file {
+constexpr char kMagic[8]{'P', 'G', 'E', 'O', 'P', 'T', 'S', '\0'};
+constexpr uint32_t kVersion{1U};                ///< Current format version
+constexpr uint32_t kByteOrder{0x01020304U};     ///< Written natively
+constexpr std::size_t kHeaderSize{64U};         ///< Header bytes
+constexpr std::size_t kAttributeEntrySize{64U};  ///< Directory entry bytes
+constexpr std::size_t kMaximumNameSize{55U};    ///< Name bytes without '\0'
+constexpr std::size_t kAlignment{64U};          ///< Column alignment
+}  // namespace point_file
+
+/**
+ * @brief Write points and distance attributes as a point file
+ * @param path Destination file, replaced if it exists
+ * @param points Points to write
+ * @param attributes Attribute columns, each with one value per point
+ * @throw std::invalid_argument If an attribute is null, has another size,
+ * or its name is empty, too long or repeated
+ * @throw std::system_error If the file cannot be written
+ */
+auto WritePointFile(const std::string& path, const PointCloud2D& points,
+                    const std::vector<PointFileAttribute>& attributes = {})
+    -> void;
+
+/**
+ * @brief Read only memory mapping of a point file
+ * @details Nothing is parsed or copied when opening: the columns are views
+ * into the mapping, paged in by the operating system on first touch, and
+ * can be passed straight to the kernels. The views are valid while the
+ * reader lives.
+ */
+class PointFileReader {
+ public:
+  /**
+   * @brief Construct a new empty PointFileReader object
+   */
+  PointFileReader() = default;
+  /**
+   * @brief Construct a new PointFileReader object mapping a file
+   * @param path The point file
+   * @throw std::system_error If the file cannot be opened or mapped
+   * @throw std::runtime_error If the file is not a valid point file
+   */
+  explicit PointFileReader(const std::string& path);
+  /**
+   * @brief Construct a new PointFileReader object by moving a mapping
+   * @param other Reader left empty
+   */
+  PointFileReader(PointFileReader&& other) noexcept;
+  /**
+   * @brief Move assignment operator
+   * @param other Reader left empty
+   * @return PointFileReader& This reader
+   */
+  auto operator=(PointFileReader&& other) noexcept -> PointFileReader&;
+  PointFileReader(const PointFileReader&) = delete;
+  auto operator=(const PointFileReader&) -> PointFileReader& = delete;
+  /**
+   * @brief Destroy the PointFileReader object, unmapping the file
+   */
+  ~PointFileReader();
+
+  /**
+   * @brief Check if a file is mapped
+   * @return true If a file is mapped
+   * @return false If empty
+   */
+  [[nodiscard]] auto IsOpen() const -> bool;
+  /**
+   * @brief Get the number of points
+   * @return std::size_t The number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Get a point
+   * @param index The point index, less than Size()
+   * @return Point2D The point
+   */
+  [[nodiscard]] auto GetPoint(std::size_t index) const -> Point2D;
+  /**
+   * @brief Get the x column
+   * @return const double* Size() x coordinates in the mapping
+   */
+  [[nodiscard]] auto XData() const -> const double*;
+  /**
+   * @brief Get the y column
+   * @return const double* Size() y coordinates in the mapping
+   */
+  [[nodiscard]] auto YData() const -> const double*;
+  /**
+   * @brief Copy the points into a point cloud
+   * @return PointCloud2D The points
+   */
+  [[nodiscard]] auto ToPointCloud() const -> PointCloud2D;
+
+  /**
+   * @brief Get the number of attribute columns
+   * @return std::size_t The number of attributes
+   */
+  [[nodiscard]] auto GetAttributeCount() const -> std::size_t;
+  /**
+   * @brief Get the name of an attribute
+   * @param attribute The attribute index, less than GetAttributeCount()
+   * @return std::string The name
+   */
+  [[nodiscard]] auto GetAttributeName(std::size_t attribute) const
+      -> std::string;
+  /**
+   * @brief Find an attribute by name
+   * @param name The name
+   * @return std::size_t The attribute index
+   * @throw std::out_of_range If there is no such attribute
+   */
+  [[nodiscard]] auto FindAttribute(const std::string& name) const
+      -> std::size_t;
+  /**
+   * @brief Get an attribute column
+   * @param attribute The attribute index, less than GetAttributeCount()
+   * @return const int64_t* Size() nanometers in the mapping
+   */
+  [[nodiscard]] auto AttributeData(std::size_t attribute) const
+      -> const int64_t*;
+  /**
+   * @brief Get an attribute value
+   * @param attribute The attribute index, less than GetAttributeCount()
+   * @param index The point index, less than Size()
+   * @return Distance The value
+   */
+  [[nodiscard]] auto GetDistance(std::size_t attribute,
+                                 std::size_t index) const -> Distance;
+
+  /**
+   * @brief Calculate distance from every point to target point
+   * @param target Point2D object to calculate distance
+   * @param output Destination of Size() Euclidean distances
+   */
+  auto CalculateDistances(const Point2D& target, double* output) const
+      -> void;
+
+ protected:
+ private:
+  /**
+   * @brief Unmap the file, leaving the reader empty
+   */
+  auto Close() noexcept -> void;
+
+  const unsigned char* data_{nullptr};   ///< Start of the mapping
+  std::size_t size_{0U};                 ///< Mapped bytes
+  std::size_t count_{0U};                ///< The number of points
+  const double* xs_{nullptr};            ///< x column
+  const double* ys_{nullptr};            ///< y column
+  std::vector<const int64_t*> attributes_;  ///< Attribute columns
+};
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,130 @@
+/**
+ * @file geometry/point_parser.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief CSV and WKT point text parser declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__POINT_PARSER_HPP_
+#define PROGRAMMERS__GEOMETRY__POINT_PARSER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "geometry/point_cloud2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Error in parsed text with its position
+ */
+class ParseError : public std::runtime_error {
+ public:
+  /**
+   * @brief Construct a new ParseError object
+   * @param line 1 based line number
+   * @param column 1 based byte column in the line
+   * @param message What was expected
+   */
+  ParseError(std::size_t line, std::size_t column, const std::string& message);
+
+  /**
+   * @brief Get the line number
+   * @return std::size_t 1 based line number
+   */
+  [[nodiscard]] auto GetLine() const -> std::size_t;
+  /**
+   * @brief Get the column
+   * @return std::size_t 1 based byte column in the line
+   */
+  [[nodiscard]] auto GetColumn() const -> std::size_t;
+
+ protected:
+ private:
+  std::size_t line_;    ///< 1 based line number
+  std::size_t column_;  ///< 1 based byte column
+};
+
+/**
+ * @brief Layout of point CSV text
+ */
+struct CsvFormat {
+  char delimiter{','};       ///< Field separator
+  std::size_t x_field{0U};   ///< 0 based field holding x
+  std::size_t y_field{1U};   ///< 0 based field holding y
+  bool has_header{false};    ///< Whether the first line names the fields
+};
+
+/**
+ * @brief Geometry type of a WKT line
+ */
+enum class WktType : uint8_t {
+  kPoint,       ///< POINT (x y)
+  kLineString,  ///< LINESTRING (x y, x y, ...)
+};
+
+/**
+ * @brief Geometries parsed from WKT text, vertices stored contiguously
+ */
+struct WktCollection {
+  PointCloud2D points;                ///< Vertices of every geometry in order
+  std::vector<std::size_t> offsets;   ///< Geometry i owns vertices
+                                      ///< [offsets[i], offsets[i + 1])
+  std::vector<WktType> types;         ///< Type of every geometry
+};
+
+/**
+ * @brief Parse one point per line of CSV text
+ * @details Fields are unquoted; spaces and tabs around a number are
+ * ignored, as are empty lines and fields other than x and y. Large text is
+ * split at line boundaries and the chunks are parsed in parallel.
+ * @param text The text
+ * @param format The field layout
+ * @return PointCloud2D The points in line order
+ * @throw ParseError At the first malformed line
+ * @throw std::invalid_argument If x_field equals y_field
+ */
+[[nodiscard]] auto ParseCsvPoints(std::string_view text,
+                                  const CsvFormat& format = {})
+    -> PointCloud2D;
+/**
+ * @brief Parse one point per line of a CSV file
+ * @param path The file
+ * @param format The field layout
+ * @return PointCloud2D The points in line order
+ * @throw ParseError At the first malformed line
+ * @throw std::invalid_argument If x_field equals y_field
+ * @throw std::system_error If the file cannot be read
+ */
+[[nodiscard]] auto ReadCsvPoints(const std::string& path,
+                                 const CsvFormat& format = {}) -> PointCloud2D;
+
+/**
+ * @brief Parse one WKT POINT or LINESTRING per line
+ * @details Keywords are case insensitive and EMPTY geometries have no
+ * vertex. Large text is split at line boundaries and the chunks are parsed
+ * in parallel.
+ * @param text The text
+ * @return WktCollection The geometries in line order
+ * @throw ParseError At the first malformed line
+ */
+[[nodiscard]] auto ParseWkt(std::string_view text) -> WktCollection;
+/**
+ * @brief Parse one WKT POINT or LINESTRING per line of a file
+ * @param path The file
+ * @return WktCollection The geometries in line order
+ * @throw ParseError At the first malformed line
+ * @throw std::system_error If the file cannot be read
+ */
+[[nodiscard]] auto ReadWkt(const std::string& path) -> WktCollection;
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ * @file geometry/polygon2d.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Polygon class with holes declaration with 2-dimension
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__POLYGON_2D_HPP_
+#define PROGRAMMERS__GEOMETRY__POLYGON_2D_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/bounding_box2d.hpp"
+#include "geometry/point2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Polygon with an exterior ring and any number of hole rings
+ * @details Rings are closed implicitly, so the last vertex connects to the
+ * first, and a repeated first vertex at the end is dropped. Containment
+ * follows the even-odd rule over every ring with a half-open horizontal
+ * ray: an edge crosses the ray of y when exactly one end is above y, and
+ * counts when the point is strictly left of it by the exact orientation
+ * predicate. Rings are expected to be simple; their orientation does not
+ * matter.
+ */
+class Polygon2D {
+ public:
+  /**
+   * @brief Ring of vertices type
+   */
+  using Ring = std::vector<Point2D>;
+
+  /**
+   * @brief Construct a new empty Polygon2D object containing nothing
+   */
+  Polygon2D() = default;
+  /**
+   * @brief Construct a new Polygon2D object
+   * @param exterior The exterior ring
+   * @param holes The hole rings, inside the exterior
+   * @throw std::invalid_argument If a ring has fewer than 3 vertices or a
+   * coordinate is not finite
+   */
+  explicit Polygon2D(Ring exterior, std::vector<Ring> holes = {});
+
+  /**
+   * @brief Get the exterior ring
+   * @return const Ring& The exterior vertices
+   */
+  [[nodiscard]] auto GetExterior() const -> const Ring&;
+  /**
+   * @brief Get the hole rings
+   * @return const std::vector<Ring>& The holes
+   */
+  [[nodiscard]] auto GetHoles() const -> const std::vector<Ring>&;
+  /**
+   * @brief Get the number of vertices, which is also the number of edges
+   * @return std::size_t The number of vertices of every ring
+   */
+  [[nodiscard]] auto GetVertexCount() const -> std::size_t;
+  /**
+   * @brief Get the bounding box of the exterior
+   * @return BoundingBox2D The box, empty for an empty polygon
+   */
+  [[nodiscard]] auto GetBoundingBox() const -> BoundingBox2D;
+  /**
+   * @brief Calculate the area of the exterior minus the holes
+   * @return double The area
+   */
+  [[nodiscard]] auto CalculateArea() const -> double;
+
+  /**
+   * @brief Check if the polygon contains point, testing every edge
+   * @param point Point2D object to check
+   * @return true If point is inside by the even-odd rule
+   * @return false If point is outside
+   */
+  [[nodiscard]] auto Contains(const Point2D& point) const -> bool;
+
+ protected:
+ private:
+  Ring exterior_;            ///< The exterior ring
+  std::vector<Ring> holes_;  ///< The hole rings
+};
+}  // namespace programmers::geometry
+
+#endif
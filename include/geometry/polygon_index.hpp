@@ -0,0 +1,142 @@
+/**
+ * @file geometry/polygon_index.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Point in polygon index over many polygons declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__POLYGON_INDEX_HPP_
+#define PROGRAMMERS__GEOMETRY__POLYGON_INDEX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "geometry/bounding_box2d.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+#include "geometry/polygon2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Preprocessed polygons answering which one contains a point
+ * @details A uniform grid over all polygons lists the polygons whose box
+ * overlaps each cell. Every polygon cuts its height into horizontal bands
+ * holding the edges that overlap them, so a query only tests the few edges
+ * of one band, in a branch-free loop over edge columns that the compiler
+ * vectorizes; only edges within the error bound of the point go through
+ * the exact predicate. Polygons with long edges, such as combs, get fewer
+ * and taller bands so that the bands hold at most 8 copies per edge.
+ * Results are the same as Polygon2D::Contains.
+ */
+class PolygonIndex {
+ public:
+  /**
+   * @brief Result of a point inside no polygon
+   */
+  static constexpr std::size_t kNotFound{
+      std::numeric_limits<std::size_t>::max()};
+
+  /**
+   * @brief Construct a new empty PolygonIndex object
+   */
+  PolygonIndex() = default;
+  /**
+   * @brief Construct a new PolygonIndex object over polygons
+   * @param polygons Polygons referred by their position
+   * @throw std::length_error If there are more than 2^32 - 1 polygons
+   */
+  explicit PolygonIndex(std::vector<Polygon2D> polygons);
+
+  /**
+   * @brief Get the number of polygons
+   * @return std::size_t The number of polygons
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Get a polygon
+   * @param index The polygon index, less than Size()
+   * @return const Polygon2D& The polygon
+   */
+  [[nodiscard]] auto GetPolygon(std::size_t index) const -> const Polygon2D&;
+
+  /**
+   * @brief Find the polygon containing point
+   * @param point Point2D object to locate
+   * @return std::size_t The smallest index of a polygon containing point,
+   * kNotFound if none does or a coordinate is NaN
+   */
+  [[nodiscard]] auto FindContaining(const Point2D& point) const
+      -> std::size_t;
+  /**
+   * @brief Find the polygon containing every point in parallel
+   * @param points Points to locate
+   * @return std::vector<std::size_t> Result of FindContaining per point
+   */
+  [[nodiscard]] auto FindContaining(const PointCloud2D& points) const
+      -> std::vector<std::size_t>;
+  /**
+   * @brief Find the polygon containing every point in parallel
+   * @param xs x coordinates of count points
+   * @param ys y coordinates of count points
+   * @param count The number of points
+   * @param output Destination of count results of FindContaining
+   */
+  auto FindContaining(const double* xs, const double* ys, std::size_t count,
+                      std::size_t* output) const -> void;
+
+ protected:
+ private:
+  /**
+   * @brief Horizontal bands of one polygon
+   */
+  struct Bands {
+    double min_y{0.0};      ///< Bottom of band 0
+    double height{1.0};     ///< Height of one band
+    std::size_t first{0U};  ///< First band in band_begins_
+    std::size_t count{0U};  ///< The number of bands
+  };
+
+  /**
+   * @brief Append the bands of a polygon
+   */
+  auto BuildBands(const Polygon2D& polygon) -> void;
+  /**
+   * @brief Build the grid of cells listing overlapping polygons
+   */
+  auto BuildGrid() -> void;
+  /**
+   * @brief Get the cell of value on an axis of count cells from origin
+   */
+  [[nodiscard]] auto GetCell(double value, double origin,
+                             std::size_t count) const -> std::size_t;
+  /**
+   * @brief Check if a polygon contains point using its bands
+   */
+  [[nodiscard]] auto Contains(std::size_t polygon, double x, double y) const
+      -> bool;
+
+  std::vector<Polygon2D> polygons_;       ///< The polygons
+  std::vector<BoundingBox2D> boxes_;      ///< Exterior box of each polygon
+  std::vector<Bands> bands_;              ///< Bands of each polygon
+  std::vector<std::size_t> band_begins_;  ///< First edge of every band
+  std::vector<double> lower_xs_;          ///< Lower end x of band edges
+  std::vector<double> lower_ys_;          ///< Lower end y of band edges
+  std::vector<double> upper_xs_;          ///< Upper end x of band edges
+  std::vector<double> upper_ys_;          ///< Upper end y of band edges
+  BoundingBox2D grid_box_;                ///< Box of every polygon
+  double cell_size_{1.0};                 ///< Side of one cell
+  std::size_t columns_{0U};               ///< The number of cell columns
+  std::size_t rows_{0U};                  ///< The number of cell rows
+  std::vector<std::size_t> cell_begins_;  ///< First entry of every cell
+  std::vector<uint32_t> cell_polygons_;   ///< Polygons of the cells
+};
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,197 @@
+/**
+ * @file geometry/polyline2d.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Polyline class declaration with arc length prefix sums
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__POLYLINE_2D_HPP_
+#define PROGRAMMERS__GEOMETRY__POLYLINE_2D_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/distance_array.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Nearest point on a polyline to a query point
+ */
+struct PolylineProjection {
+  Point2D point;                 ///< Nearest point on the polyline
+  Distance along;                ///< Arc length from the first vertex
+  std::size_t segment{0U};       ///< Segment from vertex segment to + 1
+  double squared_distance{0.0};  ///< Squared distance to the query point
+};
+
+/**
+ * @brief Open polyline, such as a trajectory, with arc length queries
+ * @details The arc length from the first vertex to every vertex is kept as
+ * exact nanometer prefix sums, each segment rounded once to the nearest
+ * nanometer, so the total length is not re-walked. A hierarchy of segment
+ * bounding boxes over runs of 2^k consecutive segments answers nearest
+ * point queries. Both are updated in O(log n) when a vertex is appended.
+ */
+class Polyline2D {
+ public:
+  /**
+   * @brief Construct a new empty Polyline2D object
+   * @param unit Distance type of one coordinate unit
+   */
+  explicit Polyline2D(Distance::Type unit = Distance::Type::kMeter);
+  /**
+   * @brief Construct a new Polyline2D object through points
+   * @param points Vertices in order
+   * @param unit Distance type of one coordinate unit
+   * @throw std::invalid_argument If a segment length is not a number
+   * @throw std::overflow_error If the length does not fit Distance
+   */
+  explicit Polyline2D(const std::vector<Point2D>& points,
+                      Distance::Type unit = Distance::Type::kMeter);
+
+  /**
+   * @brief Get the number of vertices
+   * @return std::size_t The number of vertices
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Check if the polyline has no vertex
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool;
+  /**
+   * @brief Reserve storage for count vertices
+   * @param count The number of vertices
+   */
+  auto Reserve(std::size_t count) -> void;
+  /**
+   * @brief Remove every vertex
+   */
+  auto Clear() -> void;
+  /**
+   * @brief Append a vertex at the end, in O(log n)
+   * @param point The vertex
+   * @throw std::invalid_argument If the new segment length is not a number
+   * @throw std::overflow_error If the length does not fit Distance
+   */
+  auto Append(const Point2D& point) -> void;
+
+  /**
+   * @brief Get the distance type of one coordinate unit
+   * @return Distance::Type The unit
+   */
+  [[nodiscard]] auto GetUnit() const -> Distance::Type;
+  /**
+   * @brief Get a vertex
+   * @param index The vertex index, less than Size()
+   * @return Point2D The vertex
+   */
+  [[nodiscard]] auto GetPoint(std::size_t index) const -> Point2D;
+  /**
+   * @brief Get every vertex
+   * @return const PointCloud2D& The vertices in order
+   */
+  [[nodiscard]] auto GetPoints() const -> const PointCloud2D&;
+  /**
+   * @brief Get the total length
+   * @return Distance The length, zero for less than two vertices
+   */
+  [[nodiscard]] auto GetLength() const -> Distance;
+  /**
+   * @brief Get the arc length from the first vertex to a vertex
+   * @param index The vertex index, less than Size()
+   * @return Distance The arc length
+   */
+  [[nodiscard]] auto GetLength(std::size_t index) const -> Distance;
+  /**
+   * @brief Get the arc length to every vertex
+   * @return const DistanceArray& Size() non-decreasing arc lengths
+   */
+  [[nodiscard]] auto GetLengths() const -> const DistanceArray&;
+
+  /**
+   * @brief Find the segment containing the point at an arc length
+   * @param along The arc length, clamped to [0, GetLength()]
+   * @return std::size_t The segment index, less than Size() - 1
+   * @throw std::out_of_range If there are less than two vertices
+   */
+  [[nodiscard]] auto FindSegment(const Distance& along) const -> std::size_t;
+  /**
+   * @brief Get the point at an arc length in O(log n)
+   * @param along The arc length, clamped to [0, GetLength()]
+   * @return Point2D The point
+   * @throw std::out_of_range If the polyline is empty
+   */
+  [[nodiscard]] auto Interpolate(const Distance& along) const -> Point2D;
+  /**
+   * @brief Get the point at every arc length
+   * @details Each search starts from the segment of the previous arc length
+   * when it is not smaller, so ascending arc lengths cost O(log gap) each.
+   * @param alongs The arc lengths, each clamped to [0, GetLength()]
+   * @return PointCloud2D The points in the same order
+   * @throw std::out_of_range If the polyline is empty
+   */
+  [[nodiscard]] auto Interpolate(const DistanceArray& alongs) const
+      -> PointCloud2D;
+
+  /**
+   * @brief Find the nearest point on the polyline to query point
+   * @param query Point2D object to search from
+   * @return PolylineProjection The nearest point
+   * @throw std::out_of_range If the polyline is empty
+   */
+  [[nodiscard]] auto FindNearest(const Point2D& query) const
+      -> PolylineProjection;
+  /**
+   * @brief Find the nearest point on the polyline to every query point
+   * @param queries Points to search from
+   * @return std::vector<PolylineProjection> The nearest points in the same
+   * order
+   * @throw std::out_of_range If the polyline is empty
+   */
+  [[nodiscard]] auto FindNearest(const PointCloud2D& queries) const
+      -> std::vector<PolylineProjection>;
+
+ protected:
+ private:
+  /**
+   * @brief Axis aligned bounding box of a run of segments
+   */
+  struct Box {
+    double min_x{0.0};  ///< Minimum x coordinate
+    double min_y{0.0};  ///< Minimum y coordinate
+    double max_x{0.0};  ///< Maximum x coordinate
+    double max_y{0.0};  ///< Maximum y coordinate
+  };
+
+  /**
+   * @brief Get the point at an arc length on segment
+   */
+  auto InterpolateSegment(std::size_t segment, int64_t along) const
+      -> Point2D;
+  /**
+   * @brief Project query point onto segment
+   */
+  auto ProjectSegment(std::size_t segment, double query_x,
+                      double query_y) const -> PolylineProjection;
+
+  Distance::Type unit_;      ///< Distance type of one coordinate unit
+  PointCloud2D points_;      ///< Vertices in order
+  DistanceArray lengths_;    ///< Arc length to every vertex
+  /**
+   * @brief levels_[k][j] bounds segments [j * 2^k, (j + 1) * 2^k)
+   */
+  std::vector<std::vector<Box>> levels_;
+};
+}  // namespace programmers::geometry
+
+#endif
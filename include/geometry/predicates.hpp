@@ -0,0 +1,71 @@
+/**
+ * @file geometry/predicates.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Robust geometric predicates declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__PREDICATES_HPP_
+#define PROGRAMMERS__GEOMETRY__PREDICATES_HPP_
+
+#include <cstdint>
+#include <limits>
+
+#include "geometry/point2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief The enum class for the turn of three points
+ */
+enum class Orientation : int8_t {
+  kClockwise = -1,        ///< Right turn
+  kCollinear = 0,         ///< On one line
+  kCounterClockwise = 1,  ///< Left turn
+};
+
+namespace predicates {
+/**
+ * @brief Relative error bound of the floating orientation determinant
+ * @details (ax - cx) * (by - cy) - (ay - cy) * (bx - cx) has the exact sign
+ * when its magnitude exceeds this times the sum of the magnitudes of both
+ * products (Shewchuk's ccwerrboundA).
+ */
+constexpr double kOrientationErrorBound{
+    (3.0 + 16.0 * std::numeric_limits<double>::epsilon() / 2.0) *
+    std::numeric_limits<double>::epsilon() / 2.0};
+}  // namespace predicates
+
+/**
+ * @brief Calculate the exact turn of three points
+ * @details The floating determinant decides unless it is within its error
+ * bound of zero; only then is it evaluated exactly with floating point
+ * expansions, so the result is exact for every finite input whose products
+ * neither overflow nor underflow.
+ * @param a The first point
+ * @param b The second point
+ * @param c The third point
+ * @return Orientation Turn of a -> b -> c
+ */
+[[nodiscard]] auto CalculateOrientation(const Point2D& a, const Point2D& b,
+                                        const Point2D& c) -> Orientation;
+/**
+ * @brief Calculate the exact turn of three points given by coordinates
+ * @param ax x coordinate of the first point
+ * @param ay y coordinate of the first point
+ * @param bx x coordinate of the second point
+ * @param by y coordinate of the second point
+ * @param cx x coordinate of the third point
+ * @param cy y coordinate of the third point
+ * @return Orientation Turn of a -> b -> c
+ */
+[[nodiscard]] auto CalculateOrientation(double ax, double ay, double bx,
+                                        double by, double cx, double cy)
+    -> Orientation;
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,112 @@
+/**
+ * @file geometry/proximity.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Closest pair and distance self-join declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__PROXIMITY_HPP_
+#define PROGRAMMERS__GEOMETRY__PROXIMITY_HPP_
+
+#include <cstddef>
+#include <functional>
+
+#include "geometry/distance.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Two points and their distance
+ */
+struct PointPair {
+  std::size_t first{0U};         ///< Index of the first point, the smaller
+                                 ///< in a self-join, the left in a join
+  std::size_t second{0U};        ///< Index of the second point
+  double squared_distance{0.0};  ///< Squared distance of the points
+
+  /**
+   * @brief Get the distance between the points
+   * @return double Euclidean distance
+   */
+  [[nodiscard]] auto GetDistance() const -> double;
+  /**
+   * @brief Get the distance between the points as Distance object
+   * @param unit Distance type of one coordinate unit
+   * @return Distance Euclidean distance
+   */
+  [[nodiscard]] auto ToDistance(
+      Distance::Type unit = Distance::Type::kMeter) const -> Distance;
+};
+
+/**
+ * @brief Receiver of a batch of pairs, calls serialized
+ */
+using PairCallback = std::function<void(const PointPair*, std::size_t)>;
+
+/**
+ * @brief Find the two closest points with divide and conquer
+ * @details The points are sorted by x with the parallel radix sort, then
+ * halves are solved in parallel and merged by y, O(n log n) in total. The
+ * result does not depend on the thread count.
+ * @param points The points
+ * @return PointPair The closest pair
+ * @throw std::invalid_argument If there are fewer than 2 points or a
+ * coordinate is not finite
+ * @throw std::length_error If there are more than 2^32 - 2 points
+ */
+[[nodiscard]] auto FindClosestPair(const PointCloud2D& points) -> PointPair;
+
+/**
+ * @brief Stream every pair of points within radius to a callback
+ * @details Points are bucketed into a grid of cells at least radius wide
+ * and each cell is joined with itself and four of its neighbors in
+ * parallel. Every thread buffers a bounded batch of pairs and hands it to
+ * callback, so memory does not grow with the number of pairs.
+ * @param points The points
+ * @param radius Double type radius, boundary included
+ * @param callback Called with batches of pairs in no particular order, one
+ * call at a time but from any thread
+ * @return std::size_t The number of pairs
+ * @throw std::invalid_argument If radius is negative or not finite, or a
+ * coordinate is not finite
+ * @throw std::length_error If there are more than 2^32 - 2 points
+ */
+auto FindPairsWithin(const PointCloud2D& points, double radius,
+                     const PairCallback& callback) -> std::size_t;
+/**
+ * @brief Stream every pair of points within radius to a callback
+ * @param points The points
+ * @param radius Distance type radius, boundary included
+ * @param callback Called with batches of pairs in no particular order, one
+ * call at a time but from any thread
+ * @param unit Distance type of one coordinate unit
+ * @return std::size_t The number of pairs
+ * @throw std::invalid_argument If a coordinate is not finite
+ * @throw std::length_error If there are more than 2^32 - 2 points
+ */
+auto FindPairsWithin(const PointCloud2D& points, const Distance& radius,
+                     const PairCallback& callback,
+                     Distance::Type unit = Distance::Type::kMeter)
+    -> std::size_t;
+/**
+ * @brief Write the pairs of points within radius into a buffer
+ * @param points The points
+ * @param radius Double type radius, boundary included
+ * @param output Destination of up to capacity pairs in no particular order
+ * @param capacity The number of pairs output can hold
+ * @return std::size_t The number of pairs, more than capacity if some were
+ * dropped
+ * @throw std::invalid_argument If radius is negative or not finite, or a
+ * coordinate is not finite
+ * @throw std::length_error If there are more than 2^32 - 2 points
+ */
+auto FindPairsWithin(const PointCloud2D& points, double radius,
+                     PointPair* output, std::size_t capacity) -> std::size_t;
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,334 @@
+/**
+ * @file geometry/quantity.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Compile-time unit distance quantity declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__QUANTITY_HPP_
+#define PROGRAMMERS__GEOMETRY__QUANTITY_HPP_
+
+#include "geometry/distance.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Distance value whose unit is part of the type
+ * @details Everything is constexpr. Converting to another unit is one
+ * multiply by a constant folded at compile time, and none for the same unit.
+ * Quantity converts implicitly from and to Distance, so it can be passed
+ * wherever a Distance is expected.
+ * @tparam kUnit The distance type of the value
+ */
+template <Distance::Type kUnit>
+class Quantity {
+ public:
+  /**
+   * @brief The distance type of the value
+   */
+  static constexpr Distance::Type kType{kUnit};
+
+  /**
+   * @brief Construct a new zero Quantity object
+   */
+  constexpr Quantity() = default;
+  /**
+   * @brief Construct a new Quantity object
+   * @param value The value in kUnit
+   */
+  constexpr explicit Quantity(double value) : value_(value) {}
+  /**
+   * @brief Construct a new Quantity object from other unit
+   * @param other The quantity in other unit
+   */
+  template <Distance::Type kOtherUnit>
+  constexpr Quantity(const Quantity<kOtherUnit>& other)
+      : value_(other.GetValue() * GetScale<kOtherUnit>()) {}
+  /**
+   * @brief Construct a new Quantity object from Distance
+   * @param distance The distance
+   */
+  Quantity(const Distance& distance)
+      : value_(static_cast<double>(distance.GetNanometer()) *
+               Distance::kUnitPerNanometer[Distance::GetTypeIndex(kUnit)]) {}
+
+  /**
+   * @brief Convert to Distance, truncating to whole nanometers
+   * @return Distance The distance
+   */
+  operator Distance() const {
+    return Distance(value_ * GetScale<kUnit, Distance::Type::kNanometer>(),
+                    Distance::Type::kNanometer);
+  }
+
+  /**
+   * @brief Get the value in kUnit
+   * @return double The value
+   */
+  [[nodiscard]] constexpr auto GetValue() const -> double { return value_; }
+  /**
+   * @brief Get the value in other unit
+   * @tparam kOtherUnit The other distance type
+   * @return Quantity<kOtherUnit> The converted quantity
+   */
+  template <Distance::Type kOtherUnit>
+  [[nodiscard]] constexpr auto To() const -> Quantity<kOtherUnit> {
+    return Quantity<kOtherUnit>(*this);
+  }
+
+  /**
+   * @brief Compare with other quantity for equality
+   * @param other The other quantity
+   * @return true If equal
+   * @return false If not equal
+   */
+  constexpr auto operator==(const Quantity& other) const -> bool {
+    return value_ == other.value_;
+  }
+  /**
+   * @brief Compare with other quantity for inequality
+   * @param other The other quantity
+   * @return true If not equal
+   * @return false If equal
+   */
+  constexpr auto operator!=(const Quantity& other) const -> bool {
+    return value_ != other.value_;
+  }
+  /**
+   * @brief Compare with other quantity for less than
+   * @param other The other quantity
+   * @return true If less than
+   * @return false If not less than
+   */
+  constexpr auto operator<(const Quantity& other) const -> bool {
+    return value_ < other.value_;
+  }
+  /**
+   * @brief Compare with other quantity for less than or equal
+   * @param other The other quantity
+   * @return true If less than or equal
+   * @return false If not less than or equal
+   */
+  constexpr auto operator<=(const Quantity& other) const -> bool {
+    return value_ <= other.value_;
+  }
+  /**
+   * @brief Compare with other quantity for greater than
+   * @param other The other quantity
+   * @return true If greater than
+   * @return false If not greater than
+   */
+  constexpr auto operator>(const Quantity& other) const -> bool {
+    return value_ > other.value_;
+  }
+  /**
+   * @brief Compare with other quantity for greater than or equal
+   * @param other The other quantity
+   * @return true If greater than or equal
+   * @return false If not greater than or equal
+   */
+  constexpr auto operator>=(const Quantity& other) const -> bool {
+    return value_ >= other.value_;
+  }
+  /**
+   * @brief Negate
+   * @return Quantity The negated quantity
+   */
+  constexpr auto operator-() const -> Quantity { return Quantity(-value_); }
+  /**
+   * @brief Add other quantity
+   * @param other The other quantity
+   * @return Quantity The result of addition
+   */
+  constexpr auto operator+(const Quantity& other) const -> Quantity {
+    return Quantity(value_ + other.value_);
+  }
+  /**
+   * @brief Subtract other quantity
+   * @param other The other quantity
+   * @return Quantity The result of subtraction
+   */
+  constexpr auto operator-(const Quantity& other) const -> Quantity {
+    return Quantity(value_ - other.value_);
+  }
+  /**
+   * @brief Multiply by scale
+   * @param scale The scale
+   * @return Quantity The result of multiplication
+   */
+  constexpr auto operator*(double scale) const -> Quantity {
+    return Quantity(value_ * scale);
+  }
+  /**
+   * @brief Divide by scale
+   * @param scale The scale
+   * @return Quantity The result of division
+   */
+  constexpr auto operator/(double scale) const -> Quantity {
+    return Quantity(value_ / scale);
+  }
+  /**
+   * @brief Get the ratio to other quantity
+   * @param other The other quantity
+   * @return double The ratio
+   */
+  constexpr auto operator/(const Quantity& other) const -> double {
+    return value_ / other.value_;
+  }
+  /**
+   * @brief Add and assign other quantity
+   * @param other The other quantity
+   * @return Quantity& The reference of this quantity
+   */
+  constexpr auto operator+=(const Quantity& other) -> Quantity& {
+    value_ += other.value_;
+    return *this;
+  }
+  /**
+   * @brief Subtract and assign other quantity
+   * @param other The other quantity
+   * @return Quantity& The reference of this quantity
+   */
+  constexpr auto operator-=(const Quantity& other) -> Quantity& {
+    value_ -= other.value_;
+    return *this;
+  }
+
+ protected:
+ private:
+  /**
+   * @brief Get the factor from one unit of kFrom to kTo
+   */
+  template <Distance::Type kFrom, Distance::Type kTo = kUnit>
+  static constexpr auto GetScale() -> double {
+    return Distance::kNanometerPerUnit[Distance::GetTypeIndex(kFrom)] /
+           Distance::kNanometerPerUnit[Distance::GetTypeIndex(kTo)];
+  }
+
+  double value_{0.0};  ///< Value in kUnit
+};
+
+/**
+ * @brief Multiply quantity by scale
+ * @param scale The scale
+ * @param quantity The quantity
+ * @return Quantity<kUnit> The result of multiplication
+ */
+template <Distance::Type kUnit>
+constexpr auto operator*(double scale, const Quantity<kUnit>& quantity)
+    -> Quantity<kUnit> {
+  return quantity * scale;
+}
+
+using Kilometers = Quantity<Distance::Type::kKilometer>;
+using Meters = Quantity<Distance::Type::kMeter>;
+using Centimeters = Quantity<Distance::Type::kCentimeter>;
+using Millimeters = Quantity<Distance::Type::kMillimeter>;
+using Micrometers = Quantity<Distance::Type::kMicrometer>;
+using Nanometers = Quantity<Distance::Type::kNanometer>;
+
+namespace literals {
+/**
+ * @brief Kilometers literal
+ * @param value The value
+ * @return Kilometers The quantity
+ */
+constexpr auto operator""_km(long double value) -> Kilometers {
+  return Kilometers(static_cast<double>(value));
+}
+/**
+ * @brief Kilometers literal
+ * @param value The value
+ * @return Kilometers The quantity
+ */
+constexpr auto operator""_km(unsigned long long value) -> Kilometers {
+  return Kilometers(static_cast<double>(value));
+}
+/**
+ * @brief Meters literal
+ * @param value The value
+ * @return Meters The quantity
+ */
+constexpr auto operator""_m(long double value) -> Meters {
+  return Meters(static_cast<double>(value));
+}
+/**
+ * @brief Meters literal
+ * @param value The value
+ * @return Meters The quantity
+ */
+constexpr auto operator""_m(unsigned long long value) -> Meters {
+  return Meters(static_cast<double>(value));
+}
+/**
+ * @brief Centimeters literal
+ * @param value The value
+ * @return Centimeters The quantity
+ */
+constexpr auto operator""_cm(long double value) -> Centimeters {
+  return Centimeters(static_cast<double>(value));
+}
+/**
+ * @brief Centimeters literal
+ * @param value The value
+ * @return Centimeters The quantity
+ */
+constexpr auto operator""_cm(unsigned long long value) -> Centimeters {
+  return Centimeters(static_cast<double>(value));
+}
+/**
+ * @brief Millimeters literal
+ * @param value The value
+ * @return Millimeters The quantity
+ */
+constexpr auto operator""_mm(long double value) -> Millimeters {
+  return Millimeters(static_cast<double>(value));
+}
+/**
+ * @brief Millimeters literal
+ * @param value The value
+ * @return Millimeters The quantity
+ */
+constexpr auto operator""_mm(unsigned long long value) -> Millimeters {
+  return Millimeters(static_cast<double>(value));
+}
+/**
+ * @brief Micrometers literal
+ * @param value The value
+ * @return Micrometers The quantity
+ */
+constexpr auto operator""_um(long double value) -> Micrometers {
+  return Micrometers(static_cast<double>(value));
+}
+/**
+ * @brief Micrometers literal
+ * @param value The value
+ * @return Micrometers The quantity
+ */
+constexpr auto operator""_um(unsigned long long value) -> Micrometers {
+  return Micrometers(static_cast<double>(value));
+}
+/**
+ * @brief Nanometers literal
+ * @param value The value
+ * @return Nanometers The quantity
+ */
+constexpr auto operator""_nm(long double value) -> Nanometers {
+  return Nanometers(static_cast<double>(value));
+}
+/**
+ * @brief Nanometers literal
+ * @param value The value
+ * @return Nanometers The quantity
+ */
+constexpr auto operator""_nm(unsigned long long value) -> Nanometers {
+  return Nanometers(static_cast<double>(value));
+}
+}  // namespace literals
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * @file geometry/segment2d.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Line segment class declaration with 2-dimension
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__SEGMENT_2D_HPP_
+#define PROGRAMMERS__GEOMETRY__SEGMENT_2D_HPP_
+
+#include "geometry/bounding_box2d.hpp"
+#include "geometry/point2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Closed line segment between two points with 2-dimension
+ * @details A segment whose ends are equal is a single point.
+ */
+class Segment2D {
+ public:
+  /**
+   * @brief Construct a new Segment2D object, a point at the origin
+   */
+  Segment2D() = default;
+  /**
+   * @brief Construct a new Segment2D object
+   * @param start The first end
+   * @param end The second end
+   */
+  Segment2D(const Point2D& start, const Point2D& end);
+
+  /**
+   * @brief Get the first end
+   * @return Point2D The first end
+   */
+  [[nodiscard]] auto GetStart() const -> Point2D;
+  /**
+   * @brief Get the second end
+   * @return Point2D The second end
+   */
+  [[nodiscard]] auto GetEnd() const -> Point2D;
+  /**
+   * @brief Get the bounding box of the ends
+   * @return BoundingBox2D The box
+   * @throw std::invalid_argument If a coordinate is NaN
+   */
+  [[nodiscard]] auto GetBoundingBox() const -> BoundingBox2D;
+  /**
+   * @brief Calculate the length
+   * @return double Euclidean distance between the ends
+   */
+  [[nodiscard]] auto CalculateLength() const -> double;
+
+  /**
+   * @brief Check if the segment shares a point with another, exactly
+   * @details Uses the exact orientation predicate, so touching ends,
+   * an end on the other segment and collinear overlaps all count.
+   * @param other Segment2D object to check
+   * @return true If the segments share at least one point
+   * @return false If they are disjoint
+   */
+  [[nodiscard]] auto Intersects(const Segment2D& other) const -> bool;
+
+  /**
+   * @brief Equal operator
+   * @param other Segment2D object to compare
+   * @return true If both ends are equal in order
+   * @return false If an end differs
+   */
+  auto operator==(const Segment2D& other) const -> bool;
+  /**
+   * @brief Not equal operator
+   * @param other Segment2D object to compare
+   * @return true If an end differs
+   * @return false If both ends are equal in order
+   */
+  auto operator!=(const Segment2D& other) const -> bool;
+
+ protected:
+ private:
+  Point2D start_;  ///< The first end
+  Point2D end_;    ///< The second end
+};
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,86 @@
+/**
+ * @file geometry/segment_intersection.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Intersections within large segment sets declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__SEGMENT_INTERSECTION_HPP_
+#define PROGRAMMERS__GEOMETRY__SEGMENT_INTERSECTION_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "geometry/segment2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Two intersecting segments
+ */
+struct SegmentPair {
+  std::size_t first{0U};   ///< Index of the first segment, the smaller
+  std::size_t second{0U};  ///< Index of the second segment
+};
+
+/**
+ * @brief Receiver of a batch of segment pairs, calls serialized
+ */
+using SegmentPairCallback =
+    std::function<void(const SegmentPair*, std::size_t)>;
+
+/**
+ * @brief Options of segment intersection searches
+ */
+struct SegmentIntersectionOptions {
+  /**
+   * @brief Whether segments meeting only at an end they share are skipped
+   * @details Consecutive segments of a network share their ends, which is
+   * not an error. Segments sharing an end still count when they overlap
+   * beyond it, and an end lying inside another segment always counts.
+   */
+  bool ignore_shared_ends{false};
+};
+
+/**
+ * @brief Stream every pair of intersecting segments to a callback
+ * @details Segments are bucketed by their boxes into a uniform grid of
+ * cells about as wide as an average segment. The segments of a cell are
+ * kept sorted by their left end and swept in x, and a pair is only tested
+ * in the cell holding the lower left corner of the overlap of their boxes,
+ * so it is reported once. Cells are swept in parallel and every candidate
+ * goes through the exact Segment2D::Intersects.
+ * @param segments The segments
+ * @param callback Called with batches of pairs in no particular order, one
+ * call at a time but from any thread
+ * @param options Whether shared ends are skipped
+ * @return std::size_t The number of pairs
+ * @throw std::invalid_argument If a coordinate is not finite
+ * @throw std::length_error If there are more than 2^32 - 2 segments
+ */
+auto FindIntersections(const std::vector<Segment2D>& segments,
+                       const SegmentPairCallback& callback,
+                       const SegmentIntersectionOptions& options = {})
+    -> std::size_t;
+/**
+ * @brief Check if any two segments intersect
+ * @details Searches like FindIntersections, and every thread stops as soon
+ * as one of them finds a pair.
+ * @param segments The segments
+ * @param options Whether shared ends are skipped
+ * @return true If two segments intersect
+ * @return false If no two segments intersect
+ * @throw std::invalid_argument If a coordinate is not finite
+ * @throw std::length_error If there are more than 2^32 - 2 segments
+ */
+[[nodiscard]] auto HasIntersection(
+    const std::vector<Segment2D>& segments,
+    const SegmentIntersectionOptions& options = {}) -> bool;
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * @file geometry/simplification.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Polyline simplification declaration, offline and streaming
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__SIMPLIFICATION_HPP_
+#define PROGRAMMERS__GEOMETRY__SIMPLIFICATION_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/point2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Find the vertices kept by Douglas-Peucker simplification
+ * @details Every removed vertex lies within tolerance of the segment of
+ * kept vertices around it. Large ranges are split across threads, and the
+ * result is the same as the sequential algorithm.
+ * @param points Vertices of the polyline in order
+ * @param tolerance The largest distance of a removed vertex
+ * @param unit Distance type of one coordinate unit
+ * @return std::vector<std::size_t> Ascending indices of the kept vertices,
+ * always including the first and the last
+ * @throw std::invalid_argument If tolerance is negative
+ */
+[[nodiscard]] auto ComputeDouglasPeucker(
+    const std::vector<Point2D>& points, const Distance& tolerance,
+    Distance::Type unit = Distance::Type::kMeter) -> std::vector<std::size_t>;
+/**
+ * @brief Simplify a polyline with Douglas-Peucker
+ * @param points Vertices of the polyline in order
+ * @param tolerance The largest distance of a removed vertex
+ * @param unit Distance type of one coordinate unit
+ * @return std::vector<Point2D> The kept vertices in order
+ * @throw std::invalid_argument If tolerance is negative
+ */
+[[nodiscard]] auto SimplifyDouglasPeucker(
+    const std::vector<Point2D>& points, const Distance& tolerance,
+    Distance::Type unit = Distance::Type::kMeter) -> std::vector<Point2D>;
+
+/**
+ * @brief Find the vertices kept by Visvalingam-Whyatt simplification
+ * @details The vertex spanning the smallest triangle with its neighbours is
+ * removed repeatedly while that area is below tolerance^2. The area of a
+ * vertex never drops below the area of a vertex removed before it.
+ * @param points Vertices of the polyline in order
+ * @param tolerance Side of the square whose area is the threshold
+ * @param unit Distance type of one coordinate unit
+ * @return std::vector<std::size_t> Ascending indices of the kept vertices,
+ * always including the first and the last
+ * @throw std::invalid_argument If tolerance is negative
+ */
+[[nodiscard]] auto ComputeVisvalingamWhyatt(
+    const std::vector<Point2D>& points, const Distance& tolerance,
+    Distance::Type unit = Distance::Type::kMeter) -> std::vector<std::size_t>;
+/**
+ * @brief Simplify a polyline with Visvalingam-Whyatt
+ * @param points Vertices of the polyline in order
+ * @param tolerance Side of the square whose area is the threshold
+ * @param unit Distance type of one coordinate unit
+ * @return std::vector<Point2D> The kept vertices in order
+ * @throw std::invalid_argument If tolerance is negative
+ */
+[[nodiscard]] auto SimplifyVisvalingamWhyatt(
+    const std::vector<Point2D>& points, const Distance& tolerance,
+    Distance::Type unit = Distance::Type::kMeter) -> std::vector<Point2D>;
+
+/**
+ * @brief Simplifier emitting vertices while the polyline still arrives
+ * @details Opening window Douglas-Peucker: the last emitted vertex anchors
+ * a window of pending vertices. A new vertex extends the window while every
+ * pending vertex stays within tolerance of the segment from the anchor to
+ * it. Otherwise the previous vertex is emitted and anchors a new window.
+ * The window is capped, so memory stays bounded whatever the trace length,
+ * and every removed vertex lies within tolerance of the output.
+ */
+class StreamingSimplifier {
+ public:
+  static constexpr std::size_t kDefaultWindow{1024U};  ///< Default cap
+
+  /**
+   * @brief Construct a new StreamingSimplifier object
+   * @param tolerance The largest distance of a removed vertex
+   * @param unit Distance type of one coordinate unit
+   * @param window The largest number of pending vertices, at least 1; the
+   * newest pending vertex is kept as the candidate end, so at most window - 1
+   * consecutive vertices are dropped
+   * @throw std::invalid_argument If tolerance is negative or window is 0
+   */
+  explicit StreamingSimplifier(const Distance& tolerance,
+                               Distance::Type unit = Distance::Type::kMeter,
+                               std::size_t window = kDefaultWindow);
+
+  /**
+   * @brief Add the next vertex of the polyline
+   * @param point The vertex
+   * @param output Destination the emitted vertices are appended to
+   */
+  auto Push(const Point2D& point, std::vector<Point2D>& output) -> void;
+  /**
+   * @brief End the polyline, emitting its last vertex, and start a new one
+   * @param output Destination the emitted vertices are appended to
+   */
+  auto Flush(std::vector<Point2D>& output) -> void;
+
+  /**
+   * @brief Get the number of vertices waiting for a decision
+   * @return std::size_t The number of pending vertices, at most the window
+   */
+  [[nodiscard]] auto GetPendingCount() const -> std::size_t;
+
+ protected:
+ private:
+  /**
+   * @brief Check if every pending vertex is within tolerance of the segment
+   * from the anchor to point
+   */
+  [[nodiscard]] auto Covers(const Point2D& point) const -> bool;
+
+  double squared_tolerance_;     ///< Squared tolerance in coordinate units
+  std::size_t window_;           ///< The largest number of pending vertices
+  bool started_{false};          ///< Whether the anchor is set
+  Point2D anchor_;               ///< The last emitted vertex
+  std::vector<Point2D> pending_;  ///< Vertices after the anchor
+};
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,203 @@
+/**
+ * @file geometry/space_filling_curve.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Morton and Hilbert curve keys and curve order declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__SPACE_FILLING_CURVE_HPP_
+#define PROGRAMMERS__GEOMETRY__SPACE_FILLING_CURVE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief The enum class for space-filling curve
+ */
+enum class SpaceFillingCurve { kMorton, kHilbert };
+
+/**
+ * @brief Map of coordinates to the cells of the 2^32 x 2^32 curve grid
+ * @details Both axes share one scale, so cells stay square and the curve
+ * keeps its locality on elongated point sets.
+ */
+class CurveQuantizer {
+ public:
+  /**
+   * @brief Construct a new CurveQuantizer object covering [0, 2^32)
+   */
+  CurveQuantizer() = default;
+  /**
+   * @brief Construct a new CurveQuantizer object covering a rectangle
+   * @param minimum Corner with the smallest coordinates
+   * @param maximum Corner with the largest coordinates
+   * @throw std::invalid_argument If a corner is not finite or maximum is
+   * smaller than minimum
+   */
+  CurveQuantizer(const Point2D& minimum, const Point2D& maximum);
+  /**
+   * @brief Construct a new CurveQuantizer object covering points
+   * @param points Points to cover, non-finite coordinates are ignored
+   */
+  explicit CurveQuantizer(const PointCloud2D& points);
+
+  /**
+   * @brief Get the cell containing point
+   * @param point Point2D object, clamped to the covered rectangle
+   * @return std::pair<uint32_t, uint32_t> x and y cell coordinates
+   */
+  [[nodiscard]] auto Quantize(const Point2D& point) const
+      -> std::pair<uint32_t, uint32_t>;
+  /**
+   * @brief Get the cell containing every point
+   * @param xs x coordinates of count points
+   * @param ys y coordinates of count points
+   * @param count The number of points
+   * @param cell_xs Destination of count x cell coordinates
+   * @param cell_ys Destination of count y cell coordinates
+   */
+  auto Quantize(const double* xs, const double* ys, std::size_t count,
+                uint32_t* cell_xs, uint32_t* cell_ys) const -> void;
+
+ protected:
+ private:
+  double minimum_x_{0.0};  ///< x coordinate of cell 0
+  double minimum_y_{0.0};  ///< y coordinate of cell 0
+  double scale_{1.0};      ///< Cells per coordinate unit
+};
+
+/**
+ * @brief Get the Z-order (Morton) key of cell
+ * @param x x cell coordinate, stored in the even bits
+ * @param y y cell coordinate, stored in the odd bits
+ * @return uint64_t The key
+ */
+[[nodiscard]] auto EncodeMorton(uint32_t x, uint32_t y) -> uint64_t;
+/**
+ * @brief Get the cell of Z-order (Morton) key
+ * @param key The key
+ * @return std::pair<uint32_t, uint32_t> x and y cell coordinates
+ */
+[[nodiscard]] auto DecodeMorton(uint64_t key) -> std::pair<uint32_t, uint32_t>;
+/**
+ * @brief Get the Hilbert curve key of cell
+ * @param x x cell coordinate
+ * @param y y cell coordinate
+ * @return uint64_t The key, consecutive keys are edge-adjacent cells
+ */
+[[nodiscard]] auto EncodeHilbert(uint32_t x, uint32_t y) -> uint64_t;
+
+/**
+ * @brief Compute the curve key of every point
+ * @param points Points to encode
+ * @param quantizer Map of the points to curve cells
+ * @param curve The space-filling curve
+ * @return std::vector<uint64_t> The key of each point
+ */
+[[nodiscard]] auto ComputeCurveKeys(const PointCloud2D& points,
+                                    const CurveQuantizer& quantizer,
+                                    SpaceFillingCurve curve)
+    -> std::vector<uint64_t>;
+/**
+ * @brief Get the stable ascending order of keys with a parallel radix sort
+ * @param keys The keys to sort
+ * @return std::vector<uint32_t> Index of the key at every sorted position
+ * @throw std::length_error If there are more than 2^32 - 1 keys
+ */
+[[nodiscard]] auto SortByKey(const std::vector<uint64_t>& keys)
+    -> std::vector<uint32_t>;
+/**
+ * @brief Get the order of points along the curve over their bounds
+ * @param points Points to order
+ * @param curve The space-filling curve
+ * @return std::vector<uint32_t> Index of the point at every curve position
+ * @throw std::length_error If there are more than 2^32 - 1 points
+ */
+[[nodiscard]] auto ComputeCurveOrder(
+    const PointCloud2D& points,
+    SpaceFillingCurve curve = SpaceFillingCurve::kHilbert)
+    -> std::vector<uint32_t>;
+
+/**
+ * @brief Rearrange points so that position i holds points[order[i]]
+ * @param points Points to rearrange
+ * @param order Permutation of the point indices
+ * @throw std::invalid_argument If the sizes differ
+ */
+auto ApplyOrder(PointCloud2D& points, const std::vector<uint32_t>& order)
+    -> void;
+/**
+ * @brief Rearrange values so that position i holds values[order[i]]
+ * @param values Values to rearrange
+ * @param order Permutation of the value indices
+ * @throw std::invalid_argument If the sizes differ
+ */
+template <typename Value>
+auto ApplyOrder(std::vector<Value>& values, const std::vector<uint32_t>& order)
+    -> void {
+  if (values.size() != order.size()) {
+    throw std::invalid_argument("ApplyOrder sizes differ");
+  }
+  std::vector<Value> reordered;
+  reordered.reserve(values.size());
+  for (const auto index : order) {
+    reordered.push_back(std::move(values[index]));
+  }
+  values.swap(reordered);
+}
+
+/**
+ * @brief Sort points along the curve over their bounds
+ * @param points Points to sort
+ * @param curve The space-filling curve
+ * @return std::vector<uint32_t> Former index of the point at every position
+ * @throw std::length_error If there are more than 2^32 - 1 points
+ */
+auto ReorderAlongCurve(PointCloud2D& points,
+                       SpaceFillingCurve curve = SpaceFillingCurve::kHilbert)
+    -> std::vector<uint32_t>;
+/**
+ * @brief Sort points along the curve over their bounds
+ * @param points Points to sort
+ * @param curve The space-filling curve
+ * @return std::vector<uint32_t> Former index of the point at every position
+ * @throw std::length_error If there are more than 2^32 - 1 points
+ */
+auto ReorderAlongCurve(std::vector<Point2D>& points,
+                       SpaceFillingCurve curve = SpaceFillingCurve::kHilbert)
+    -> std::vector<uint32_t>;
+/**
+ * @brief Sort points and their payload along the curve over the points
+ * @param points Points to sort
+ * @param payload Value attached to each point, moved with its point
+ * @param curve The space-filling curve
+ * @return std::vector<uint32_t> Former index of the point at every position
+ * @throw std::invalid_argument If the sizes differ
+ * @throw std::length_error If there are more than 2^32 - 1 points
+ */
+template <typename Payload>
+auto ReorderAlongCurve(PointCloud2D& points, std::vector<Payload>& payload,
+                       SpaceFillingCurve curve = SpaceFillingCurve::kHilbert)
+    -> std::vector<uint32_t> {
+  if (payload.size() != points.Size()) {
+    throw std::invalid_argument("ReorderAlongCurve payload size differs");
+  }
+  auto order{ReorderAlongCurve(points, curve)};
+  ApplyOrder(payload, order);
+  return order;
+}
+}  // namespace programmers::geometry
+
+#endif
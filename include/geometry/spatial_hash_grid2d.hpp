@@ -0,0 +1,229 @@
+/**
+ * @file geometry/spatial_hash_grid2d.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Dynamic uniform grid spatial hash declaration over 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__SPATIAL_HASH_GRID_2D_HPP_
+#define PROGRAMMERS__GEOMETRY__SPATIAL_HASH_GRID_2D_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "geometry/distance.hpp"
+#include "geometry/neighbor.hpp"
+#include "geometry/point2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Uniform grid of square cells hashed on their integer coordinates
+ * @details Points are nodes of a pooled array and every occupied cell heads
+ * an intrusive list of its points, so insert, move and remove are O(1)
+ * amortized. Removed nodes and emptied cells are recycled, so once the pool
+ * and the cell table have grown to the working set, updates do not allocate.
+ * Queries only visit the cells overlapping the search area.
+ */
+class SpatialHashGrid2D {
+ public:
+  using Handle = uint32_t;  ///< Stable identifier of an inserted point
+  static constexpr Handle kInvalidHandle{
+      std::numeric_limits<Handle>::max()};  ///< Handle of no point
+
+  /**
+   * @brief Construct a new SpatialHashGrid2D object
+   * @param cell_size Distance type edge length of one cell
+   * @param unit Distance type of one coordinate unit
+   * @throw std::invalid_argument If cell_size is not positive
+   */
+  explicit SpatialHashGrid2D(const Distance& cell_size,
+                             Distance::Type unit = Distance::Type::kMeter);
+
+  /**
+   * @brief Get the edge length of one cell in coordinate units
+   * @return double The cell size
+   */
+  [[nodiscard]] auto GetCellSize() const -> double;
+  /**
+   * @brief Get the number of points
+   * @return std::size_t The number of points
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Check if the grid has no point
+   * @return true If empty
+   * @return false If not empty
+   */
+  [[nodiscard]] auto Empty() const -> bool;
+  /**
+   * @brief Reserve the pool and the cell table for count points
+   * @param count The number of points
+   */
+  auto Reserve(std::size_t count) -> void;
+  /**
+   * @brief Remove every point, keeping the storage
+   */
+  auto Clear() -> void;
+
+  /**
+   * @brief Insert a point
+   * @param point Point2D object to insert
+   * @return Handle Identifier of the point until it is removed
+   * @throw std::invalid_argument If a coordinate is not finite
+   */
+  auto Insert(const Point2D& point) -> Handle;
+  /**
+   * @brief Move a point to other position
+   * @param handle Identifier of the point
+   * @param point New position
+   * @throw std::out_of_range If handle does not refer to a point
+   * @throw std::invalid_argument If a coordinate is not finite
+   */
+  auto Move(Handle handle, const Point2D& point) -> void;
+  /**
+   * @brief Remove a point
+   * @param handle Identifier of the point
+   * @throw std::out_of_range If handle does not refer to a point
+   */
+  auto Remove(Handle handle) -> void;
+  /**
+   * @brief Check if handle refers to a point
+   * @param handle Identifier of the point
+   * @return true If the point exists
+   * @return false If the point does not exist
+   */
+  [[nodiscard]] auto Contains(Handle handle) const -> bool;
+  /**
+   * @brief Get the position of a point
+   * @param handle Identifier of the point
+   * @return Point2D The position
+   * @throw std::out_of_range If handle does not refer to a point
+   */
+  [[nodiscard]] auto GetPoint(Handle handle) const -> Point2D;
+
+  /**
+   * @brief Find the points within radius from query point
+   * @param query Point2D object to search from
+   * @param radius Double type radius, boundary included
+   * @return std::vector<Neighbor> Handles of the points in no particular
+   * order, none for a non-finite query
+   */
+  [[nodiscard]] auto FindWithinRadius(const Point2D& query,
+                                      double radius) const
+      -> std::vector<Neighbor>;
+  /**
+   * @brief Find the points within radius from query point
+   * @param query Point2D object to search from
+   * @param radius Distance type radius, boundary included
+   * @param unit Distance type of one coordinate unit
+   * @return std::vector<Neighbor> Handles of the points in no particular order
+   */
+  [[nodiscard]] auto FindWithinRadius(
+      const Point2D& query, const Distance& radius,
+      Distance::Type unit = Distance::Type::kMeter) const
+      -> std::vector<Neighbor>;
+  /**
+   * @brief Find the points within radius from query point into a buffer
+   * @param query Point2D object to search from
+   * @param radius Double type radius, boundary included
+   * @param output Cleared and filled with the handles of the points, none
+   * for a non-finite query, its capacity is reused across calls
+   */
+  auto FindWithinRadius(const Point2D& query, double radius,
+                        std::vector<Neighbor>& output) const -> void;
+  /**
+   * @brief Find the k nearest points to query point
+   * @param query Point2D object to search from
+   * @param k The number of points to find
+   * @return std::vector<Neighbor> Handles of min(k, Size()) points, nearest
+   * first, none for a non-finite query
+   */
+  [[nodiscard]] auto FindNearest(const Point2D& query, std::size_t k) const
+      -> std::vector<Neighbor>;
+  /**
+   * @brief Find the k nearest points to query point into a buffer
+   * @param query Point2D object to search from
+   * @param k The number of points to find
+   * @param output Cleared and filled with the handles of min(k, Size())
+   * points nearest first, none for a non-finite query, its capacity is
+   * reused across calls
+   */
+  auto FindNearest(const Point2D& query, std::size_t k,
+                   std::vector<Neighbor>& output) const -> void;
+
+ protected:
+ private:
+  /**
+   * @brief Pooled point node
+   */
+  struct Node {
+    double x{0.0};                    ///< x coordinate
+    double y{0.0};                    ///< y coordinate
+    uint32_t cell{0U};                ///< Slot of the cell in the cell table
+    Handle previous{kInvalidHandle};  ///< Previous node in the cell
+    Handle next{kInvalidHandle};      ///< Next node in the cell or free list
+    bool alive{false};                ///< Whether the node holds a point
+  };
+  /**
+   * @brief Slot of the open addressing cell table
+   */
+  struct Cell {
+    int64_t x{0};                 ///< Integer x coordinate of the cell
+    int64_t y{0};                 ///< Integer y coordinate of the cell
+    Handle head{kInvalidHandle};  ///< First node in the cell
+    uint32_t count{0U};           ///< The number of nodes in the cell
+    bool used{false};             ///< Whether the slot is taken by a cell
+  };
+
+  /**
+   * @brief Get the integer coordinate of the cell containing value
+   */
+  [[nodiscard]] auto ToCellCoordinate(double value) const -> int64_t;
+  /**
+   * @brief Find the slot of cell (x, y)
+   * @return uint32_t The slot, or the table size if there is no such cell
+   */
+  [[nodiscard]] auto FindCell(int64_t cell_x, int64_t cell_y) const
+      -> uint32_t;
+  /**
+   * @brief Find or create the slot of cell (x, y)
+   */
+  auto AcquireCell(int64_t cell_x, int64_t cell_y) -> uint32_t;
+  /**
+   * @brief Rebuild the cell table with capacity slots, dropping empty cells
+   */
+  auto RehashCells(std::size_t capacity) -> void;
+  /**
+   * @brief Link node at the head of cell
+   */
+  auto LinkNode(Handle handle, uint32_t cell) -> void;
+  /**
+   * @brief Unlink node from its cell
+   */
+  auto UnlinkNode(Handle handle) -> void;
+  /**
+   * @brief Append every node of cell slot within squared radius
+   */
+  auto CollectCell(uint32_t cell, double query_x, double query_y,
+                   double squared_radius, std::vector<Neighbor>& output) const
+      -> void;
+
+  double cell_size_{1.0};             ///< Edge length of one cell
+  double inverse_cell_size_{1.0};     ///< Reciprocal of the cell size
+  std::vector<Node> nodes_;           ///< Node pool indexed by handle
+  Handle free_head_{kInvalidHandle};  ///< First recycled node
+  std::size_t size_{0U};              ///< The number of points
+  std::vector<Cell> cells_;           ///< Open addressing cell table
+  std::size_t used_cells_{0U};        ///< The number of taken slots
+  std::size_t occupied_cells_{0U};    ///< The number of non-empty cells
+};
+}  // namespace programmers::geometry
+
+#endif
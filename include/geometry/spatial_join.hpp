@@ -0,0 +1,139 @@
+/**
+ * @file geometry/spatial_join.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Partitioned spatial join of two point sets declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__SPATIAL_JOIN_HPP_
+#define PROGRAMMERS__GEOMETRY__SPATIAL_JOIN_HPP_
+
+#include <cstddef>
+
+#include "geometry/distance.hpp"
+#include "geometry/point_cloud2d.hpp"
+#include "geometry/point_file.hpp"
+#include "geometry/proximity.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Coordinate columns of a point set owned elsewhere
+ * @details The constructors are implicit so that a PointCloud2D or a mapped
+ * point file can be passed wherever columns are expected. The columns must
+ * outlive the call they are passed to.
+ */
+struct PointColumns {
+  /**
+   * @brief Construct a new PointColumns object viewing a point cloud
+   * @param points The points
+   */
+  PointColumns(const PointCloud2D& points);
+  /**
+   * @brief Construct a new PointColumns object viewing a point file
+   * @param reader The mapped point file
+   */
+  PointColumns(const PointFileReader& reader);
+  /**
+   * @brief Construct a new PointColumns object viewing raw columns
+   * @param xs x coordinates of count points
+   * @param ys y coordinates of count points
+   * @param count The number of points
+   */
+  PointColumns(const double* xs, const double* ys, std::size_t count);
+
+  const double* xs{nullptr};  ///< x column
+  const double* ys{nullptr};  ///< y column
+  std::size_t count{0U};      ///< The number of points
+};
+
+/**
+ * @brief Options of a spatial join
+ */
+struct SpatialJoinOptions {
+  /**
+   * @brief Approximate working bytes per point of an in-memory join
+   */
+  static constexpr std::size_t kBytesPerPoint{64U};
+
+  /**
+   * @brief Working memory in bytes, 0 for no limit
+   * @details A join within radius whose inputs need more than this is cut
+   * into x strips that are spilled to temporary files and joined one by
+   * one. Strips still over the limit are cut again along y, and points that
+   * no cut separates are joined in blocks, which is slower but bounded.
+   * A nearest join keeps an index of the right set in memory and processes
+   * the left set in blocks of this size.
+   */
+  std::size_t memory_limit{0U};
+};
+
+/**
+ * @brief Stream every pair of left and right points within radius
+ * @details Both sets are bucketed on a shared grid of cells at least
+ * radius wide and the left cells are joined with their right neighbors in
+ * parallel. Pairs are handed to callback in bounded batches with first
+ * indexing left and second indexing right.
+ * @param left The left points
+ * @param right The right points
+ * @param radius Double type radius, boundary included
+ * @param callback Called with batches of pairs in no particular order, one
+ * call at a time but from any thread
+ * @param options The memory limit
+ * @return std::size_t The number of pairs
+ * @throw std::invalid_argument If radius is negative or not finite, or a
+ * coordinate is not finite
+ * @throw std::length_error If a set or a strip has more than 2^32 - 2
+ * points
+ * @throw std::system_error If a spill file cannot be written or read
+ */
+auto JoinWithin(const PointColumns& left, const PointColumns& right,
+                double radius, const PairCallback& callback,
+                const SpatialJoinOptions& options = {}) -> std::size_t;
+/**
+ * @brief Stream every pair of left and right points within radius
+ * @param left The left points
+ * @param right The right points
+ * @param radius Distance type radius, boundary included
+ * @param callback Called with batches of pairs in no particular order, one
+ * call at a time but from any thread
+ * @param unit Distance type of one coordinate unit
+ * @param options The memory limit
+ * @return std::size_t The number of pairs
+ * @throw std::invalid_argument If a coordinate is not finite
+ * @throw std::length_error If a set or a strip has more than 2^32 - 2
+ * points
+ * @throw std::system_error If a spill file cannot be written or read
+ */
+auto JoinWithin(const PointColumns& left, const PointColumns& right,
+                const Distance& radius, const PairCallback& callback,
+                Distance::Type unit = Distance::Type::kMeter,
+                const SpatialJoinOptions& options = {}) -> std::size_t;
+
+/**
+ * @brief Stream the k nearest right points of every left point
+ * @details The right set is indexed by a KdTree2D and the left points are
+ * visited in Hilbert curve order, so consecutive queries walk the same part
+ * of the tree. The min(k, right.count) pairs of one left point arrive
+ * nearest first and together in one batch, first indexing left and second
+ * indexing right.
+ * @param left The left points
+ * @param right The right points
+ * @param k The number of right points for each left point
+ * @param callback Called with batches of pairs, one call at a time but from
+ * any thread
+ * @param options The memory limit
+ * @return std::size_t The number of pairs
+ * @throw std::invalid_argument If a coordinate is not finite
+ * @throw std::length_error If a set has more than 2^32 - 2 points
+ */
+auto JoinNearest(const PointColumns& left, const PointColumns& right,
+                 std::size_t k, const PairCallback& callback,
+                 const SpatialJoinOptions& options = {}) -> std::size_t;
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,272 @@
+/**
+ * @file geometry/thread_pool.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Work stealing thread pool and parallel loop declaration
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__THREAD_POOL_HPP_
+#define PROGRAMMERS__GEOMETRY__THREAD_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace programmers::geometry {
+class ThreadPool;
+
+/**
+ * @brief How a range is cut into chunks
+ */
+enum class Chunking : uint8_t {
+  kAdaptive,  ///< At most 4 chunks per thread and ceil(count / grain)
+              ///< chunks, of nearly equal size
+  kFixed,     ///< Chunks of exactly grain items whatever the thread count,
+              ///< so reductions give the same result on every machine
+};
+
+/**
+ * @brief Where chunks are queued first, a hint that stealing may override
+ */
+enum class Affinity : uint8_t {
+  kAny,     ///< Queued on the caller, idle threads steal them
+  kStable,  ///< Contiguous runs of chunks queued on the same thread on every
+            ///< call, so repeated passes over the same data reuse caches
+};
+
+/**
+ * @brief Options of ParallelFor and ParallelReduce
+ */
+struct ParallelOptions {
+  static constexpr std::size_t kDefaultGrain{1U << 14U};  ///< Default grain
+
+  std::size_t grain{kDefaultGrain};         ///< Items per chunk, at least 1
+  Chunking chunking{Chunking::kAdaptive};   ///< How the range is cut
+  Affinity affinity{Affinity::kAny};        ///< Where chunks start
+  ThreadPool* pool{nullptr};                ///< nullptr for the default pool
+};
+
+/**
+ * @brief Pool of worker threads with one work stealing queue each
+ * @details A call queues its tasks and then runs tasks itself until all of
+ * them are done, so calls nest: a task may call Run again on the same pool.
+ * A worker takes its newest task first and steals the oldest task of
+ * another queue when its own is empty. The workers live as long as the
+ * pool, so a call pays no thread startup.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @brief Construct a new ThreadPool object
+   * @param thread_count Threads running tasks including the caller, 0 for
+   * the hardware concurrency; a pool of 1 runs everything on the caller
+   */
+  explicit ThreadPool(std::size_t thread_count = 0U);
+  ThreadPool(const ThreadPool&) = delete;
+  auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+  /**
+   * @brief Destroy the ThreadPool object, joining the workers
+   */
+  ~ThreadPool();
+
+  /**
+   * @brief Get the pool shared by the library, created on first use
+   * @return ThreadPool& The default pool with the hardware concurrency
+   */
+  [[nodiscard]] static auto GetDefault() -> ThreadPool&;
+
+  /**
+   * @brief Get the number of threads running tasks
+   * @return std::size_t Workers plus the calling thread
+   */
+  [[nodiscard]] auto GetThreadCount() const -> std::size_t;
+
+  /**
+   * @brief Run task(i) for every i in [0, task_count) and wait
+   * @param task_count The number of tasks
+   * @param task The task, called concurrently
+   * @param affinity Where the tasks are queued first
+   * @throw Any exception of a task, the first one caught, after every
+   * started task finished
+   */
+  auto Run(std::size_t task_count,
+           const std::function<void(std::size_t)>& task,
+           Affinity affinity = Affinity::kAny) -> void;
+
+ protected:
+ private:
+  struct Job;
+  /**
+   * @brief One call of a job's task
+   */
+  struct Task {
+    Job* job{nullptr};      ///< Job the task belongs to
+    std::size_t index{0U};  ///< Argument of the task
+  };
+  /**
+   * @brief Task queue of one thread
+   */
+  struct Queue {
+    std::mutex mutex;         ///< Guards tasks
+    std::deque<Task> tasks;   ///< Owner pops the back, thieves the front
+  };
+
+  /**
+   * @brief Run one queued task, own queue first, then steal
+   * @return true If a task was run
+   * @return false If every queue was empty
+   */
+  auto RunOne(std::size_t queue) -> bool;
+  /**
+   * @brief Loop of worker thread
+   */
+  auto Work(std::size_t queue) -> void;
+  /**
+   * @brief Get the queue of the calling thread, the shared one if external
+   */
+  [[nodiscard]] auto GetCallerQueue() const -> std::size_t;
+
+  std::vector<std::unique_ptr<Queue>> queues_;  ///< Workers, then callers
+  std::vector<std::thread> workers_;            ///< Worker threads
+  std::atomic<std::size_t> queued_{0U};         ///< Tasks in any queue
+  std::mutex sleep_mutex_;                      ///< Guards sleeping workers
+  std::condition_variable wake_;                ///< Signals queued tasks
+  bool stop_{false};                            ///< Whether workers exit
+};
+
+/**
+ * @brief Chunk boundaries of [0, count), fixed before any task runs
+ */
+class Partition {
+ public:
+  /**
+   * @brief Construct a new Partition object
+   * @param count The number of items
+   * @param options The grain and chunking; adaptive chunking depends on the
+   * thread count of the pool
+   */
+  Partition(std::size_t count, const ParallelOptions& options);
+
+  /**
+   * @brief Get the number of chunks
+   * @return std::size_t The number of chunks, 0 for no item
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Get the first item of a chunk
+   * @param chunk The chunk, at most Size(); Size() gives the item count
+   * @return std::size_t The first item
+   */
+  [[nodiscard]] auto GetBegin(std::size_t chunk) const -> std::size_t;
+
+ protected:
+ private:
+  std::size_t count_;        ///< The number of items
+  std::size_t chunk_count_;  ///< The number of chunks
+  std::size_t grain_;        ///< Chunk size of fixed chunking, 0 otherwise
+};
+
+/**
+ * @brief Get the pool of options
+ * @param options The options
+ * @return ThreadPool& options.pool, or the default pool
+ */
+[[nodiscard]] auto GetPool(const ParallelOptions& options) -> ThreadPool&;
+
+/**
+ * @brief Run task(begin, end) over the chunks of [0, count) and wait
+ * @param count The number of items
+ * @param task The task, called concurrently on disjoint ranges
+ * @param options The chunking, affinity and pool
+ */
+template <typename Task>
+auto ParallelFor(std::size_t count, const Task& task,
+                 const ParallelOptions& options = {}) -> void {
+  const Partition partition(count, options);
+  if (partition.Size() == 1U) {
+    task(std::size_t{0U}, count);
+    return;
+  }
+  GetPool(options).Run(
+      partition.Size(),
+      [&](std::size_t chunk) {
+        task(partition.GetBegin(chunk), partition.GetBegin(chunk + 1U));
+      },
+      options.affinity);
+}
+
+/**
+ * @brief Reduce the chunks of [0, count) in parallel
+ * @details Chunk results are combined in chunk order on the caller, so the
+ * result depends only on the partition, which fixed chunking pins down.
+ * @param count The number of items
+ * @param identity The value of no item, the start of every chunk
+ * @param map map(begin, end) reduces one chunk, called concurrently
+ * @param combine combine(lhs, rhs) joins two adjacent results
+ * @param options The chunking, affinity and pool
+ * @return T The combined result
+ */
+template <typename T, typename Map, typename Combine>
+auto ParallelReduce(std::size_t count, const T& identity, const Map& map,
+                    const Combine& combine,
+                    const ParallelOptions& options = {}) -> T {
+  const Partition partition(count, options);
+  if (partition.Size() <= 1U) {
+    return partition.Size() == 0U ? identity
+                                  : combine(identity, map(std::size_t{0U},
+                                                          count));
+  }
+  std::vector<T> partials(partition.Size(), identity);
+  GetPool(options).Run(
+      partition.Size(),
+      [&](std::size_t chunk) {
+        partials[chunk] =
+            map(partition.GetBegin(chunk), partition.GetBegin(chunk + 1U));
+      },
+      options.affinity);
+  auto result{identity};
+  for (auto& partial : partials) {
+    result = combine(std::move(result), std::move(partial));
+  }
+  return result;
+}
+
+/**
+ * @brief Run two tasks, possibly in parallel, and wait for both
+ * @param left The first task
+ * @param right The second task, run on the caller unless stolen
+ * @param pool The pool, nullptr for the default pool
+ */
+template <typename Left, typename Right>
+auto ParallelInvoke(const Left& left, const Right& right,
+                    ThreadPool* pool = nullptr) -> void {
+  auto& target{pool != nullptr ? *pool : ThreadPool::GetDefault()};
+  if (target.GetThreadCount() == 1U) {
+    left();
+    right();
+    return;
+  }
+  target.Run(2U, [&](std::size_t index) {
+    if (index == 0U) {
+      left();
+    } else {
+      right();
+    }
+  });
+}
+}  // namespace programmers::geometry
+
+#endif
@@ -0,0 +1,170 @@
+/**
+ * @file geometry/transform2d.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Affine transform class declaration with 2-dimension
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__TRANSFORM_2D_HPP_
+#define PROGRAMMERS__GEOMETRY__TRANSFORM_2D_HPP_
+
+#include <array>
+#include <cstddef>
+
+#include "geometry/point2d.hpp"
+#include "geometry/point_cloud2d.hpp"
+
+namespace programmers::geometry {
+/**
+ * @brief Affine transform with 2-dimension
+ * @details The transform maps (x, y) to (a * x + b * y + tx,
+ * c * x + d * y + ty). Any chain of translations, rotations, scalings and
+ * shears composes into one transform, so a buffer is updated in a single
+ * pass whatever the chain length.
+ */
+class Transform2D {
+ public:
+  /**
+   * @brief Construct a new identity Transform2D object
+   */
+  Transform2D();
+  /**
+   * @brief Construct a new Transform2D object from its matrix
+   * @param a Factor of x in the new x
+   * @param b Factor of y in the new x
+   * @param tx Offset of the new x
+   * @param c Factor of x in the new y
+   * @param d Factor of y in the new y
+   * @param ty Offset of the new y
+   */
+  Transform2D(double a, double b, double tx, double c, double d, double ty);
+
+  /**
+   * @brief Get the transform leaving every point unchanged
+   * @return Transform2D The identity
+   */
+  [[nodiscard]] static auto Identity() -> Transform2D;
+  /**
+   * @brief Get a translation
+   * @param offset Offset added to every point
+   * @return Transform2D The translation
+   */
+  [[nodiscard]] static auto Translation(const Point2D& offset) -> Transform2D;
+  /**
+   * @brief Get a counterclockwise rotation about the origin
+   * @param radians The angle in radians
+   * @return Transform2D The rotation
+   */
+  [[nodiscard]] static auto Rotation(double radians) -> Transform2D;
+  /**
+   * @brief Get a counterclockwise rotation about a center
+   * @param radians The angle in radians
+   * @param center The fixed point of the rotation
+   * @return Transform2D The rotation
+   */
+  [[nodiscard]] static auto Rotation(double radians, const Point2D& center)
+      -> Transform2D;
+  /**
+   * @brief Get a scaling about the origin
+   * @param scale_x Factor of x
+   * @param scale_y Factor of y
+   * @return Transform2D The scaling
+   */
+  [[nodiscard]] static auto Scaling(double scale_x, double scale_y)
+      -> Transform2D;
+  /**
+   * @brief Get a shear about the origin
+   * @param shear_x Factor of y added to x
+   * @param shear_y Factor of x added to y
+   * @return Transform2D The shear
+   */
+  [[nodiscard]] static auto Shearing(double shear_x, double shear_y)
+      -> Transform2D;
+
+  /**
+   * @brief Get the row major matrix
+   * @return const std::array<double, 6>& {a, b, tx, c, d, ty}
+   */
+  [[nodiscard]] auto GetMatrix() const -> const std::array<double, 6>&;
+  /**
+   * @brief Get the determinant of the linear part
+   * @return double a * d - b * c, the factor applied to areas
+   */
+  [[nodiscard]] auto GetDeterminant() const -> double;
+  /**
+   * @brief Get the transform undoing this one
+   * @return Transform2D The inverse
+   * @throw std::invalid_argument If the determinant is zero or not finite
+   */
+  [[nodiscard]] auto Inverse() const -> Transform2D;
+  /**
+   * @brief Get the transform applying this one, then next
+   * @param next The transform applied second
+   * @return Transform2D next * *this
+   */
+  [[nodiscard]] auto Then(const Transform2D& next) const -> Transform2D;
+
+  /**
+   * @brief Transform one point
+   * @param point The point
+   * @return Point2D The transformed point
+   */
+  [[nodiscard]] auto Apply(const Point2D& point) const -> Point2D;
+  /**
+   * @brief Transform every point of a cloud into a new cloud
+   * @param cloud The points
+   * @return PointCloud2D The transformed points
+   */
+  [[nodiscard]] auto Apply(const PointCloud2D& cloud) const -> PointCloud2D;
+  /**
+   * @brief Transform every point of a cloud in place
+   * @param cloud The points, overwritten
+   */
+  auto ApplyInPlace(PointCloud2D& cloud) const -> void;
+  /**
+   * @brief Transform count points in one fused pass
+   * @details Batches go through the vectorized kernels, which may fuse the
+   * multiply and add, so a result may differ from Apply(Point2D) in the last
+   * bit. The output may alias the input.
+   * @param xs x coordinates of count points
+   * @param ys y coordinates of count points
+   * @param count The number of points
+   * @param output_xs Destination of count x coordinates
+   * @param output_ys Destination of count y coordinates
+   */
+  auto Apply(const double* xs, const double* ys, std::size_t count,
+             double* output_xs, double* output_ys) const -> void;
+
+  /**
+   * @brief Compose two transforms
+   * @param other The transform applied first
+   * @return Transform2D The transform applying other, then *this
+   */
+  auto operator*(const Transform2D& other) const -> Transform2D;
+  /**
+   * @brief Compare two transforms for an identical matrix
+   * @param other The other transform
+   * @return true If every entry is equal
+   * @return false If any entry differs
+   */
+  auto operator==(const Transform2D& other) const -> bool;
+  /**
+   * @brief Compare two transforms for a different matrix
+   * @param other The other transform
+   * @return true If any entry differs
+   * @return false If every entry is equal
+   */
+  auto operator!=(const Transform2D& other) const -> bool;
+
+ protected:
+ private:
+  std::array<double, 6> matrix_;  ///< {a, b, tx, c, d, ty}
+};
+}  // namespace programmers::geometry
+
+#endif
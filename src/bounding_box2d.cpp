@@ -0,0 +1,205 @@
+/**
+ * @file geometry/bounding_box2d.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Axis aligned bounding box class developments with 2-dimension
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/bounding_box2d.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "geometry/kernels.hpp"
+#include "geometry/thread_pool.hpp"
+
+namespace {
+constexpr double kInfinity{std::numeric_limits<double>::infinity()};
+
+/**
+ * @brief Get the number of bitmask words of count items
+ */
+auto GetWordCount(std::size_t count) -> std::size_t {
+  using programmers::geometry::kernels::kMaskBits;
+  return count / kMaskBits + (count % kMaskBits != 0U ? 1U : 0U);
+}
+
+/**
+ * @brief Run task(begin, end) over item ranges starting on word boundaries
+ */
+template <typename Task>
+auto ParallelForWords(std::size_t count, const Task& task) -> void {
+  using programmers::geometry::kernels::kMaskBits;
+  programmers::geometry::ParallelFor(
+      GetWordCount(count), [&](std::size_t begin, std::size_t end) {
+        task(begin * kMaskBits, std::min(count, end * kMaskBits));
+      });
+}
+}  // namespace
+
+namespace programmers::geometry {
+BoundingBox2D::BoundingBox2D()
+    : min_x_(kInfinity),
+      min_y_(kInfinity),
+      max_x_(-kInfinity),
+      max_y_(-kInfinity) {}
+
+BoundingBox2D::BoundingBox2D(const Point2D& minimum, const Point2D& maximum)
+    : min_x_(minimum.GetX()),
+      min_y_(minimum.GetY()),
+      max_x_(maximum.GetX()),
+      max_y_(maximum.GetY()) {
+  // Comparisons with NaN are false, so this also rejects NaN.
+  if (!(min_x_ <= max_x_ && min_y_ <= max_y_)) {
+    throw std::invalid_argument("BoundingBox2D corners are not ordered");
+  }
+}
+
+BoundingBox2D::BoundingBox2D(const double* bounds) : BoundingBox2D() {
+  if (bounds[0] <= bounds[2] && bounds[1] <= bounds[3]) {
+    min_x_ = bounds[0];
+    min_y_ = bounds[1];
+    max_x_ = bounds[2];
+    max_y_ = bounds[3];
+  }
+}
+
+auto BoundingBox2D::FromPoints(const PointCloud2D& points) -> BoundingBox2D {
+  return FromPoints(points.XData(), points.YData(), points.Size());
+}
+
+auto BoundingBox2D::FromPoints(const double* xs, const double* ys,
+                               std::size_t count) -> BoundingBox2D {
+  // A point with one NaN coordinate still bounds the other one, so the
+  // axes are reduced separately and the box built once at the end.
+  using Bounds = std::array<double, 4>;
+  const auto bounds{ParallelReduce(
+      count, Bounds{kInfinity, kInfinity, -kInfinity, -kInfinity},
+      [&](std::size_t begin, std::size_t end) {
+        Bounds chunk{};
+        kernels::CalculateBounds(xs + begin, ys + begin, end - begin,
+                                 chunk.data());
+        return chunk;
+      },
+      [](const Bounds& lhs, const Bounds& rhs) {
+        return Bounds{std::min(lhs[0], rhs[0]), std::min(lhs[1], rhs[1]),
+                      std::max(lhs[2], rhs[2]), std::max(lhs[3], rhs[3])};
+      })};
+  return BoundingBox2D(bounds.data());
+}
+
+auto BoundingBox2D::IsEmpty() const -> bool { return min_x_ > max_x_; }
+
+auto BoundingBox2D::GetMinimum() const -> Point2D { return {min_x_, min_y_}; }
+
+auto BoundingBox2D::GetMaximum() const -> Point2D { return {max_x_, max_y_}; }
+
+auto BoundingBox2D::GetWidth() const -> double {
+  return IsEmpty() ? 0.0 : max_x_ - min_x_;
+}
+
+auto BoundingBox2D::GetHeight() const -> double {
+  return IsEmpty() ? 0.0 : max_y_ - min_y_;
+}
+
+auto BoundingBox2D::Contains(const Point2D& point) const -> bool {
+  return min_x_ <= point.GetX() && point.GetX() <= max_x_ &&
+         min_y_ <= point.GetY() && point.GetY() <= max_y_;
+}
+
+auto BoundingBox2D::Contains(const BoundingBox2D& other) const -> bool {
+  return other.IsEmpty() ||
+         (min_x_ <= other.min_x_ && other.max_x_ <= max_x_ &&
+          min_y_ <= other.min_y_ && other.max_y_ <= max_y_);
+}
+
+auto BoundingBox2D::Intersects(const BoundingBox2D& other) const -> bool {
+  return other.min_x_ <= max_x_ && min_x_ <= other.max_x_ &&
+         other.min_y_ <= max_y_ && min_y_ <= other.max_y_;
+}
+
+auto BoundingBox2D::Union(const BoundingBox2D& other) const -> BoundingBox2D {
+  const std::array<double, 4> bounds{
+      std::min(min_x_, other.min_x_), std::min(min_y_, other.min_y_),
+      std::max(max_x_, other.max_x_), std::max(max_y_, other.max_y_)};
+  return BoundingBox2D(bounds.data());
+}
+
+auto BoundingBox2D::Intersection(const BoundingBox2D& other) const
+    -> BoundingBox2D {
+  const std::array<double, 4> bounds{
+      std::max(min_x_, other.min_x_), std::max(min_y_, other.min_y_),
+      std::min(max_x_, other.max_x_), std::min(max_y_, other.max_y_)};
+  return BoundingBox2D(bounds.data());
+}
+
+auto BoundingBox2D::Extend(const Point2D& point) -> void {
+  const std::array<double, 4> bounds{
+      std::min(min_x_, point.GetX()), std::min(min_y_, point.GetY()),
+      std::max(max_x_, point.GetX()), std::max(max_y_, point.GetY())};
+  *this = BoundingBox2D(bounds.data());
+}
+
+auto BoundingBox2D::FilterWithin(const PointCloud2D& points) const
+    -> std::vector<uint64_t> {
+  std::vector<uint64_t> mask(GetWordCount(points.Size()));
+  FilterWithin(points.XData(), points.YData(), points.Size(), mask.data());
+  return mask;
+}
+
+auto BoundingBox2D::FilterWithin(const double* xs, const double* ys,
+                                 std::size_t count, uint64_t* output) const
+    -> void {
+  const std::array<double, 4> box{min_x_, min_y_, max_x_, max_y_};
+  ParallelForWords(count, [&](std::size_t begin, std::size_t end) {
+    kernels::FilterWithinBox(xs + begin, ys + begin, end - begin, box.data(),
+                             output + begin / kernels::kMaskBits);
+  });
+}
+
+auto BoundingBox2D::FilterIntersecting(
+    const std::vector<BoundingBox2D>& boxes) const -> std::vector<uint64_t> {
+  std::vector<uint64_t> mask(GetWordCount(boxes.size()));
+  ParallelForWords(boxes.size(), [&](std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      if (Intersects(boxes[i])) {
+        mask[i / kernels::kMaskBits] |= uint64_t{1U}
+                                        << (i % kernels::kMaskBits);
+      }
+    }
+  });
+  return mask;
+}
+
+auto BoundingBox2D::FilterIntersecting(const double* min_xs,
+                                       const double* min_ys,
+                                       const double* max_xs,
+                                       const double* max_ys,
+                                       std::size_t count,
+                                       uint64_t* output) const -> void {
+  const std::array<double, 4> box{min_x_, min_y_, max_x_, max_y_};
+  ParallelForWords(count, [&](std::size_t begin, std::size_t end) {
+    const auto word{begin / kernels::kMaskBits};
+    kernels::FilterIntersectingBoxes(min_xs + begin, min_ys + begin,
+                                     max_xs + begin, max_ys + begin,
+                                     end - begin, box.data(), output + word);
+  });
+}
+
+auto BoundingBox2D::operator==(const BoundingBox2D& other) const -> bool {
+  return min_x_ == other.min_x_ && min_y_ == other.min_y_ &&
+         max_x_ == other.max_x_ && max_y_ == other.max_y_;
+}
+
+auto BoundingBox2D::operator!=(const BoundingBox2D& other) const -> bool {
+  return !(*this == other);
+}
+}  // namespace programmers::geometry
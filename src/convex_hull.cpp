@@ -0,0 +1,378 @@
+/**
+ * @file geometry/convex_hull.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Batch and incremental convex hull developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/convex_hull.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "geometry/predicates.hpp"
+#include "geometry/thread_pool.hpp"
+
+namespace {
+using programmers::geometry::CalculateOrientation;
+using programmers::geometry::Orientation;
+
+constexpr std::size_t kDirectionCount{8U};  ///< Extreme points of octagon
+
+/**
+ * @brief Point of the hull computation with its index
+ */
+struct Candidate {
+  double x{0.0};
+  double y{0.0};
+  std::size_t index{0U};
+};
+
+template <typename T>
+auto Orient(const T& a, const T& b, const T& c) -> Orientation {
+  return CalculateOrientation(a.x, a.y, b.x, b.y, c.x, c.y);
+}
+
+auto CheckFinite(double x, double y) -> void {
+  if (!std::isfinite(x) || !std::isfinite(y)) {
+    throw std::invalid_argument("Convex hull of non-finite point");
+  }
+}
+
+/**
+ * @brief Build the hull with Andrew's monotone chain
+ * @return std::vector<T> Counter clockwise vertices from the smallest x,
+ * then y; of duplicates the smallest index
+ */
+template <typename T>
+auto BuildHull(std::vector<T> points) -> std::vector<T> {
+  std::sort(points.begin(), points.end(), [](const T& lhs, const T& rhs) {
+    return std::tie(lhs.x, lhs.y, lhs.index) <
+           std::tie(rhs.x, rhs.y, rhs.index);
+  });
+  points.erase(std::unique(points.begin(), points.end(),
+                           [](const T& lhs, const T& rhs) {
+                             return lhs.x == rhs.x && lhs.y == rhs.y;
+                           }),
+               points.end());
+  if (points.size() <= 2U) {
+    return points;
+  }
+
+  std::vector<T> hull(2U * points.size());
+  std::size_t size{0U};
+  const auto push{[&](const T& point, std::size_t floor) {
+    // Pop every vertex that is not a strict left turn, collinear included.
+    while (size >= floor && Orient(hull[size - 2U], hull[size - 1U],
+                                   point) != Orientation::kCounterClockwise) {
+      --size;
+    }
+    hull[size++] = point;
+  }};
+  for (const auto& point : points) {
+    push(point, 2U);
+  }
+  const auto lower_size{size + 1U};
+  for (auto i = points.size() - 1U; i > 0U; --i) {
+    push(points[i - 1U], lower_size);
+  }
+  // The chain ends on the first vertex again.
+  hull.resize(size - 1U);
+  return hull;
+}
+
+/**
+ * @brief Get the score of a point in an extreme direction, larger is further
+ */
+auto GetScore(const Candidate& point, std::size_t direction) -> double {
+  // Counter clockwise from the bottom, every 45 degrees.
+  switch (direction) {
+    case 0U:
+      return -point.y;
+    case 1U:
+      return point.x - point.y;
+    case 2U:
+      return point.x;
+    case 3U:
+      return point.x + point.y;
+    case 4U:
+      return point.y;
+    case 5U:
+      return point.y - point.x;
+    case 6U:
+      return -point.x;
+    default:
+      return -point.x - point.y;
+  }
+}
+
+using Extremes = std::array<Candidate, kDirectionCount>;
+
+auto IsFurther(const Candidate& lhs, const Candidate& rhs,
+               std::size_t direction) -> bool {
+  const auto lhs_score{GetScore(lhs, direction)};
+  const auto rhs_score{GetScore(rhs, direction)};
+  return lhs_score > rhs_score ||
+         (lhs_score == rhs_score && lhs.index < rhs.index);
+}
+
+/**
+ * @brief Get the distinct vertices of the octagon of extreme points
+ */
+auto GetOctagon(const Extremes& extremes) -> std::vector<Candidate> {
+  std::vector<Candidate> octagon;
+  for (const auto& extreme : extremes) {
+    if (octagon.empty() || octagon.back().x != extreme.x ||
+        octagon.back().y != extreme.y) {
+      octagon.push_back(extreme);
+    }
+  }
+  while (octagon.size() > 1U && octagon.back().x == octagon.front().x &&
+         octagon.back().y == octagon.front().y) {
+    octagon.pop_back();
+  }
+  return octagon;
+}
+
+/**
+ * @brief Check if point is certainly strictly inside every octagon edge
+ * @details The floating determinant only decides beyond its error bound, so
+ * a dropped point is never a hull vertex; an uncertain one is kept.
+ */
+auto IsInsideOctagon(const std::vector<Candidate>& octagon, double x,
+                     double y) -> bool {
+  for (std::size_t i = 0; i < octagon.size(); ++i) {
+    const auto& a{octagon[i]};
+    const auto& b{octagon[i + 1U == octagon.size() ? 0U : i + 1U]};
+    const auto left{(a.x - x) * (b.y - y)};
+    const auto right{(a.y - y) * (b.x - x)};
+    const auto bound{
+        programmers::geometry::predicates::kOrientationErrorBound *
+        (std::abs(left) + std::abs(right))};
+    if (!(left - right > bound)) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+namespace programmers::geometry {
+auto ComputeConvexHull(const PointCloud2D& points)
+    -> std::vector<std::size_t> {
+  return ComputeConvexHull(points.XData(), points.YData(), points.Size());
+}
+
+auto ComputeConvexHull(const double* xs, const double* ys, std::size_t count)
+    -> std::vector<std::size_t> {
+  if (count == 0U) {
+    return {};
+  }
+  const auto get_point{
+      [&](std::size_t i) { return Candidate{xs[i], ys[i], i}; }};
+  Extremes first{};
+  first.fill(get_point(0U));
+  const auto extremes{ParallelReduce(
+      count, first,
+      [&](std::size_t begin, std::size_t end) {
+        Extremes chunk{};
+        chunk.fill(get_point(begin));
+        for (auto i = begin; i < end; ++i) {
+          CheckFinite(xs[i], ys[i]);
+          const auto point{get_point(i)};
+          for (std::size_t direction = 0; direction < kDirectionCount;
+               ++direction) {
+            if (IsFurther(point, chunk[direction], direction)) {
+              chunk[direction] = point;
+            }
+          }
+        }
+        return chunk;
+      },
+      [](Extremes lhs, const Extremes& rhs) {
+        for (std::size_t direction = 0; direction < kDirectionCount;
+             ++direction) {
+          if (IsFurther(rhs[direction], lhs[direction], direction)) {
+            lhs[direction] = rhs[direction];
+          }
+        }
+        return lhs;
+      })};
+
+  const auto octagon{GetOctagon(extremes)};
+  const auto filter{octagon.size() >= 3U};
+  const auto hull{ParallelReduce(
+      count, std::vector<Candidate>{},
+      [&](std::size_t begin, std::size_t end) {
+        std::vector<Candidate> survivors;
+        for (auto i = begin; i < end; ++i) {
+          if (!filter || !IsInsideOctagon(octagon, xs[i], ys[i])) {
+            survivors.push_back(get_point(i));
+          }
+        }
+        return BuildHull(std::move(survivors));
+      },
+      [](std::vector<Candidate> lhs, const std::vector<Candidate>& rhs) {
+        lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+        return BuildHull(std::move(lhs));
+      })};
+
+  std::vector<std::size_t> indices;
+  indices.reserve(hull.size());
+  for (const auto& vertex : hull) {
+    indices.push_back(vertex.index);
+  }
+  return indices;
+}
+
+auto IncrementalConvexHull::Size() const -> std::size_t { return size_; }
+
+auto IncrementalConvexHull::GetVertexCount() const -> std::size_t {
+  return vertices_.size();
+}
+
+auto IncrementalConvexHull::GetIndices() const -> std::vector<std::size_t> {
+  std::vector<std::size_t> indices;
+  indices.reserve(vertices_.size());
+  const auto first{GetFirstVertex()};
+  for (std::size_t i = 0; i < vertices_.size(); ++i) {
+    indices.push_back(vertices_[(first + i) % vertices_.size()].index);
+  }
+  return indices;
+}
+
+auto IncrementalConvexHull::GetVertices() const -> std::vector<Point2D> {
+  std::vector<Point2D> vertices;
+  vertices.reserve(vertices_.size());
+  const auto first{GetFirstVertex()};
+  for (std::size_t i = 0; i < vertices_.size(); ++i) {
+    const auto& vertex{vertices_[(first + i) % vertices_.size()]};
+    vertices.emplace_back(vertex.x, vertex.y);
+  }
+  return vertices;
+}
+
+auto IncrementalConvexHull::Contains(const Point2D& point) const -> bool {
+  const Vertex target{point.GetX(), point.GetY(), 0U};
+  const auto count{vertices_.size()};
+  if (count <= 2U) {
+    if (count == 0U) {
+      return false;
+    }
+    const auto& a{vertices_.front()};
+    const auto& b{vertices_.back()};
+    return Orient(a, b, target) == Orientation::kCollinear &&
+           std::min(a.x, b.x) <= target.x && target.x <= std::max(a.x, b.x) &&
+           std::min(a.y, b.y) <= target.y && target.y <= std::max(a.y, b.y);
+  }
+
+  // Binary search the wedge of the fan from vertex 0 holding target.
+  const auto& origin{vertices_.front()};
+  if (Orient(origin, vertices_[1], target) == Orientation::kClockwise ||
+      Orient(origin, vertices_.back(), target) ==
+          Orientation::kCounterClockwise) {
+    return false;
+  }
+  std::size_t low{1U};
+  auto high{count - 1U};
+  while (high - low > 1U) {
+    const auto middle{low + (high - low) / 2U};
+    if (Orient(origin, vertices_[middle], target) !=
+        Orientation::kClockwise) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  return Orient(vertices_[low], vertices_[low + 1U], target) !=
+         Orientation::kClockwise;
+}
+
+auto IncrementalConvexHull::Append(const Point2D& point) -> bool {
+  CheckFinite(point.GetX(), point.GetY());
+  return Insert({point.GetX(), point.GetY(), size_++});
+}
+
+auto IncrementalConvexHull::Append(const PointCloud2D& points) -> bool {
+  const auto hull{ComputeConvexHull(points)};
+  bool changed{false};
+  for (const auto index : hull) {
+    changed = Insert({points.GetX(index), points.GetY(index),
+                      size_ + index}) ||
+              changed;
+  }
+  size_ += points.Size();
+  return changed;
+}
+
+auto IncrementalConvexHull::Insert(const Vertex& vertex) -> bool {
+  const auto count{vertices_.size()};
+  if (count < 3U) {
+    auto points{vertices_};
+    points.push_back(vertex);
+    vertices_ = BuildHull(std::move(points));
+    return std::any_of(
+        vertices_.begin(), vertices_.end(),
+        [&](const Vertex& other) { return other.index == vertex.index; });
+  }
+  if (Contains(Point2D(vertex.x, vertex.y))) {
+    return false;
+  }
+
+  // The edges seeing vertex are contiguous; find one, then grow the run.
+  const auto at{[&](std::size_t i) -> const Vertex& {
+    return vertices_[i % count];
+  }};
+  const auto sees{[&](std::size_t edge) {
+    return Orient(at(edge), at(edge + 1U), vertex) == Orientation::kClockwise;
+  }};
+  std::size_t first{0U};
+  while (!sees(first)) {
+    ++first;
+  }
+  // Positions are kept above count so that stepping back never wraps.
+  first += count;
+  auto last{first};
+  while (sees(first - 1U)) {
+    --first;
+  }
+  while (sees(last + 1U)) {
+    ++last;
+  }
+  // A neighbor left between the previous vertex and the new one is dropped.
+  if (Orient(at(first - 1U), at(first), vertex) == Orientation::kCollinear) {
+    --first;
+  }
+  if (Orient(vertex, at(last + 1U), at(last + 2U)) ==
+      Orientation::kCollinear) {
+    ++last;
+  }
+
+  std::vector<Vertex> vertices;
+  vertices.reserve(count + 1U - (last - first));
+  for (auto i = last + 1U; i <= first + count; ++i) {
+    vertices.push_back(at(i));
+  }
+  vertices.push_back(vertex);
+  vertices_ = std::move(vertices);
+  return true;
+}
+
+auto IncrementalConvexHull::GetFirstVertex() const -> std::size_t {
+  const auto first{std::min_element(
+      vertices_.begin(), vertices_.end(),
+      [](const Vertex& lhs, const Vertex& rhs) {
+        return std::tie(lhs.x, lhs.y) < std::tie(rhs.x, rhs.y);
+      })};
+  return static_cast<std::size_t>(first - vertices_.begin());
+}
+}  // namespace programmers::geometry
@@ -12,65 +12,191 @@
 
 #include "geometry/distance.hpp"
 
+#include <cmath>
 #include <cstdint>
-#include <sys/stat.h>
+#include <limits>
+#include <stdexcept>
+
+#include "kernels/rounding.hpp"
 
 namespace {
-constexpr int64_t kKilometerToNanometer{static_cast<int64_t>(1.0e+12)};
-constexpr int64_t kMeterToNanometer{static_cast<int64_t>(1.0e+9)};
-constexpr int64_t kCentimeterToNanometer{static_cast<int64_t>(1.0e+7)};
-constexpr int64_t kMillimeterToNanometer{static_cast<int64_t>(1.0e+6)};
-constexpr int64_t kMicrometerToNanometer{static_cast<int64_t>(1.0e+3)};
-constexpr double kNanometerToKilometer{static_cast<double>(1.0e-12)};
-constexpr double kNanometerToMeter{static_cast<double>(1.0e-9)};
-constexpr double kNanometerToCentimeter{static_cast<double>(1.0e-7)};
-constexpr double kNanometerToMillimeter{static_cast<double>(1.0e-6)};
-constexpr double kNanometerToMicrometer{static_cast<double>(1.0e-3)};
+using programmers::geometry::Int128;
+using programmers::geometry::OverflowPolicy;
+using programmers::geometry::Rounding;
 
-auto ScaleDistanceToNanometer(double input_value,
-                              programmers::geometry::Distance::Type input_type)
-    -> int64_t {
-  int64_t result{static_cast<int64_t>(input_value)};
-  if (input_type == programmers::geometry::Distance::Type::kKilometer) {
-    result = static_cast<int64_t>(input_value * kKilometerToNanometer);
-  } else if (input_type == programmers::geometry::Distance::Type::kMeter) {
-    result = static_cast<int64_t>(input_value * kMeterToNanometer);
-  } else if (input_type == programmers::geometry::Distance::Type::kCentimeter) {
-    result = static_cast<int64_t>(input_value * kCentimeterToNanometer);
-  } else if (input_type == programmers::geometry::Distance::Type::kMillimeter) {
-    result = static_cast<int64_t>(input_value * kMillimeterToNanometer);
-  } else if (input_type == programmers::geometry::Distance::Type::kMicrometer) {
-    result = static_cast<int64_t>(input_value * kMicrometerToNanometer);
-  } else if (input_type == programmers::geometry::Distance::Type::kNanometer) {
-    result = static_cast<int64_t>(input_value);
+constexpr int32_t kMantissaBits{53};
+constexpr int32_t kInt128Bits{127};
+
+auto SaturateNanometer(bool negative, OverflowPolicy policy) -> int64_t {
+  if (policy == OverflowPolicy::kChecked) {
+    throw std::overflow_error("Distance does not fit int64_t nanometers");
+  }
+  return negative ? std::numeric_limits<int64_t>::min()
+                  : std::numeric_limits<int64_t>::max();
+}
+
+auto RoundToNanometer(double value, Rounding rounding) -> int64_t {
+  if (std::isnan(value)) {
+    throw std::invalid_argument("Distance value is not a number");
+  }
+  return programmers::geometry::kernels::RoundToInt64(value, rounding);
+}
+
+/**
+ * @brief Split finite non-zero value into integer mantissa * 2^exponent
+ */
+auto SplitDouble(double value, int32_t& exponent) -> int64_t {
+  int binary_exponent{0};
+  const auto fraction{std::frexp(value, &binary_exponent)};
+  exponent = binary_exponent - kMantissaBits;
+  return static_cast<int64_t>(std::ldexp(fraction, kMantissaBits));
+}
+
+/**
+ * @brief Get the number of significant bits of the magnitude of value
+ */
+auto GetBitWidth(int64_t value) -> int32_t {
+  auto magnitude{value < 0 ? 0U - static_cast<uint64_t>(value)
+                           : static_cast<uint64_t>(value)};
+  int32_t width{0};
+  for (; magnitude != 0U; magnitude >>= 1U) {
+    ++width;
   }
-  return result;
+  return width;
+}
+
+auto ScaleDistanceToNanometer(double input_value,
+                              programmers::geometry::Distance::Type input_type,
+                              Rounding rounding) -> int64_t {
+  using programmers::geometry::Distance;
+  return RoundToNanometer(
+      input_value *
+          Distance::kNanometerPerUnit[Distance::GetTypeIndex(input_type)],
+      rounding);
 }
 }  // namespace
 
 namespace programmers::geometry {
 
-Distance::Distance(double input_value, Type input_type)
-    : nanometer_(ScaleDistanceToNanometer(input_value, input_type)) {}
+Distance::Distance(double input_value, Type input_type, Rounding rounding)
+    : nanometer_(ScaleDistanceToNanometer(input_value, input_type, rounding)) {
+}
+
+auto Distance::FromNanometer(int64_t nanometer) -> Distance {
+  Distance distance;
+  distance.nanometer_ = nanometer;
+  return distance;
+}
+
+auto Distance::GetNanometer() const -> int64_t { return nanometer_; }
 
 auto Distance::GetValue(const Type &input_type) const -> double {
-  auto result{static_cast<double>(nanometer_)};
-  if (input_type == programmers::geometry::Distance::Type::kKilometer) {
-    result = result * kNanometerToKilometer;
-  } else if (input_type == programmers::geometry::Distance::Type::kMeter) {
-    result = result * kNanometerToMeter;
-  } else if (input_type == programmers::geometry::Distance::Type::kCentimeter) {
-    result = result * kNanometerToCentimeter;
-  } else if (input_type == programmers::geometry::Distance::Type::kMillimeter) {
-    result = result * kNanometerToMillimeter;
-  } else if (input_type == programmers::geometry::Distance::Type::kMicrometer) {
-    result = result * kNanometerToMicrometer;
+  return static_cast<double>(nanometer_) *
+         kUnitPerNanometer[GetTypeIndex(input_type)];
+}
+
+auto Distance::SetValue(double input_value, Type input_type,
+                        Rounding rounding) -> void {
+  nanometer_ = ScaleDistanceToNanometer(input_value, input_type, rounding);
+}
+
+auto Distance::Add(const Distance &other, OverflowPolicy policy) const
+    -> Distance {
+  const auto sum{static_cast<int64_t>(static_cast<uint64_t>(nanometer_) +
+                                      static_cast<uint64_t>(other.nanometer_))};
+  // Overflow flips the sign away from both operands.
+  if (((nanometer_ ^ sum) & (other.nanometer_ ^ sum)) < 0) {
+    return FromNanometer(SaturateNanometer(nanometer_ < 0, policy));
+  }
+  return FromNanometer(sum);
+}
+
+auto Distance::Subtract(const Distance &other, OverflowPolicy policy) const
+    -> Distance {
+  const auto difference{
+      static_cast<int64_t>(static_cast<uint64_t>(nanometer_) -
+                           static_cast<uint64_t>(other.nanometer_))};
+  if (((nanometer_ ^ other.nanometer_) & (nanometer_ ^ difference)) < 0) {
+    return FromNanometer(SaturateNanometer(nanometer_ < 0, policy));
+  }
+  return FromNanometer(difference);
+}
+
+auto Distance::Multiply(int64_t factor, OverflowPolicy policy) const
+    -> Distance {
+  return FromNanometer(Int128::Multiply(nanometer_, factor).ToInt64(policy));
+}
+
+auto Distance::Multiply(double factor, Rounding rounding,
+                        OverflowPolicy policy) const -> Distance {
+  if (std::isnan(factor) || (std::isinf(factor) && nanometer_ == 0)) {
+    throw std::invalid_argument("Distance factor is not a number");
+  }
+  if (factor == 0.0 || nanometer_ == 0) {
+    return Distance{};
+  }
+  const auto negative{(nanometer_ < 0) != std::signbit(factor)};
+  if (std::isinf(factor)) {
+    return FromNanometer(SaturateNanometer(negative, policy));
   }
-  return result;
+  // factor is exactly mantissa * 2^exponent, so the product is exact in
+  // Int128 before the one rounding of the shift.
+  int32_t exponent{0};
+  const auto mantissa{SplitDouble(factor, exponent)};
+  const auto product{Int128::Multiply(nanometer_, mantissa)};
+  if (exponent <= 0) {
+    return FromNanometer(
+        product.ShiftRight(static_cast<uint32_t>(-exponent), rounding)
+            .ToInt64(policy));
+  }
+  // 2^52 <= |product| < 2^116, so a shift that could leave Int128 leaves
+  // int64_t first.
+  if (exponent + kMantissaBits + 63 > kInt128Bits) {
+    return FromNanometer(SaturateNanometer(negative, policy));
+  }
+  return FromNanometer(
+      product.ShiftLeft(static_cast<uint32_t>(exponent)).ToInt64(policy));
 }
 
-auto Distance::SetValue(double input_value, Type input_type) -> void {
-  nanometer_ = ScaleDistanceToNanometer(input_value, input_type);
+auto Distance::Divide(int64_t divisor, Rounding rounding,
+                      OverflowPolicy policy) const -> Distance {
+  return FromNanometer(
+      Int128(nanometer_).Divide(Int128(divisor), rounding).ToInt64(policy));
+}
+
+auto Distance::Divide(double divisor, Rounding rounding,
+                      OverflowPolicy policy) const -> Distance {
+  if (std::isnan(divisor) || divisor == 0.0) {
+    throw std::invalid_argument("Distance divisor is zero or not a number");
+  }
+  if (std::isinf(divisor) || nanometer_ == 0) {
+    return Distance{};
+  }
+  int32_t exponent{0};
+  const auto mantissa{SplitDouble(divisor, exponent)};
+  if (exponent >= 0) {
+    // Above 2^127 the quotient is a tiny fraction, rounded by its sign.
+    if (exponent + kMantissaBits > kInt128Bits) {
+      const auto dividend{std::signbit(divisor) ? -Int128(nanometer_)
+                                                : Int128(nanometer_)};
+      return FromNanometer(
+          dividend.ShiftRight(kInt128Bits + 2U, rounding).ToInt64(policy));
+    }
+    const auto scaled_divisor{
+        Int128(mantissa).ShiftLeft(static_cast<uint32_t>(exponent))};
+    return FromNanometer(
+        Int128(nanometer_).Divide(scaled_divisor, rounding).ToInt64(policy));
+  }
+  // The quotient is at least |nanometer| * 2^(-exponent - 53), so a dividend
+  // too wide for Int128 means int64_t overflow anyway.
+  if (GetBitWidth(nanometer_) - exponent > kInt128Bits - 1) {
+    const auto negative{(nanometer_ < 0) != std::signbit(divisor)};
+    return FromNanometer(SaturateNanometer(negative, policy));
+  }
+  const auto dividend{
+      Int128(nanometer_).ShiftLeft(static_cast<uint32_t>(-exponent))};
+  return FromNanometer(
+      dividend.Divide(Int128(mantissa), rounding).ToInt64(policy));
 }
 
 auto Distance::operator==(const Distance &other) const -> bool {
@@ -97,28 +223,26 @@ auto Distance::operator>=(const Distance &other) const -> bool {
   return (nanometer_ >= other.nanometer_);
 }
 auto Distance::operator+(const Distance &other) const -> Distance {
-  return Distance{static_cast<double>(nanometer_ + other.nanometer_),
-                  Type::kNanometer};
+  return Add(other);
 }
 
 auto Distance::operator-(const Distance &other) const -> Distance {
-  return Distance{static_cast<double>(nanometer_ - other.nanometer_),
-                  Type::kNanometer};
+  return Subtract(other);
 }
 
 auto Distance::operator*(double scale) const -> Distance {
-  return Distance{static_cast<double>(nanometer_ * scale), Type::kNanometer};
+  return Multiply(scale);
 }
 
 auto Distance::operator/(double scale) const -> Distance {
-  return Distance{static_cast<double>(nanometer_ / scale), Type::kNanometer};
+  return Divide(scale);
 }
 
 auto Distance::operator+=(const Distance &other) -> void {
-  nanometer_ += other.nanometer_;
+  *this = Add(other);
 }
 
 auto Distance::operator-=(const Distance &other) -> void {
-  nanometer_ -= other.nanometer_;
+  *this = Subtract(other);
 }
 }  // namespace programmers::geometry
@@ -0,0 +1,95 @@
+/**
+ * @file geometry/distance_accumulator.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Exact 128-bit distance sum developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/distance_accumulator.hpp"
+
+#include <stdexcept>
+
+#include "geometry/thread_pool.hpp"
+
+namespace programmers::geometry {
+auto DistanceAccumulator::Add(const Distance& distance) -> void {
+  nanometer_ += Int128(distance.nanometer_);
+  ++count_;
+}
+
+auto DistanceAccumulator::Add(const Distance* distances, std::size_t count)
+    -> void {
+  // Integer sums are exact, so the chunks may add up in any order.
+  const auto sum{ParallelReduce(
+      count, Int128(),
+      [distances](std::size_t begin, std::size_t end) {
+        // Carry into the upper half by hand, the loop then has no branch.
+        uint64_t low{0U};
+        uint64_t high{0U};
+        for (auto i = begin; i < end; ++i) {
+          const auto value{distances[i].nanometer_};
+          const auto previous{low};
+          low += static_cast<uint64_t>(value);
+          high += value < 0 ? ~uint64_t{0U} : 0U;
+          high += low < previous ? 1U : 0U;
+        }
+        return Int128(static_cast<int64_t>(high), low);
+      },
+      [](const Int128& lhs, const Int128& rhs) { return lhs + rhs; })};
+  nanometer_ += sum;
+  count_ += count;
+}
+
+auto DistanceAccumulator::Add(const std::vector<Distance>& distances)
+    -> void {
+  Add(distances.data(), distances.size());
+}
+
+auto DistanceAccumulator::Merge(const DistanceAccumulator& other) -> void {
+  nanometer_ += other.nanometer_;
+  count_ += other.count_;
+}
+
+auto DistanceAccumulator::Clear() -> void { *this = DistanceAccumulator(); }
+
+auto DistanceAccumulator::GetCount() const -> uint64_t { return count_; }
+
+auto DistanceAccumulator::GetNanometer() const -> Int128 { return nanometer_; }
+
+auto DistanceAccumulator::GetSum(OverflowPolicy policy) const -> Distance {
+  return Distance::FromNanometer(nanometer_.ToInt64(policy));
+}
+
+auto DistanceAccumulator::GetValue(Distance::Type input_type) const
+    -> double {
+  return nanometer_.ToDouble() *
+         Distance::kUnitPerNanometer[Distance::GetTypeIndex(input_type)];
+}
+
+auto DistanceAccumulator::GetMean(Rounding rounding) const -> Distance {
+  if (count_ == 0U) {
+    throw std::out_of_range("DistanceAccumulator is empty");
+  }
+  // count_ may not fit int64_t, so it is the low half of a positive Int128.
+  const Int128 count(0, count_);
+  return Distance::FromNanometer(
+      nanometer_.Divide(count, rounding).ToInt64());
+}
+
+auto DistanceAccumulator::operator+=(const Distance& distance)
+    -> DistanceAccumulator& {
+  Add(distance);
+  return *this;
+}
+
+auto DistanceAccumulator::operator+=(const DistanceAccumulator& other)
+    -> DistanceAccumulator& {
+  Merge(other);
+  return *this;
+}
+}  // namespace programmers::geometry
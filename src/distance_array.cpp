@@ -0,0 +1,111 @@
+/**
+ * @file geometry/distance_array.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Packed distance container and batch unit conversion developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/distance_array.hpp"
+
+#include <stdexcept>
+
+#include "geometry/kernels.hpp"
+
+namespace programmers::geometry {
+auto ConvertToUnit(const int64_t* nanometers, std::size_t count,
+                   Distance::Type type, double* output) -> void {
+  kernels::ConvertToDouble(
+      nanometers, count,
+      Distance::kUnitPerNanometer[Distance::GetTypeIndex(type)], output);
+}
+
+auto ConvertToNanometer(const double* values, std::size_t count,
+                        Distance::Type type, int64_t* output,
+                        Rounding rounding) -> void {
+  const auto is_number{kernels::ConvertToInt64(
+      values, count, Distance::kNanometerPerUnit[Distance::GetTypeIndex(type)],
+      rounding, output)};
+  if (!is_number) {
+    throw std::invalid_argument("Distance value is not a number");
+  }
+}
+
+DistanceArray::DistanceArray(std::size_t count) : nanometers_(count) {}
+
+DistanceArray::DistanceArray(const std::vector<Distance>& distances) {
+  Reserve(distances.size());
+  for (const auto& distance : distances) {
+    PushBack(distance);
+  }
+}
+
+DistanceArray::DistanceArray(const double* values, std::size_t count,
+                             Distance::Type type, Rounding rounding) {
+  SetValues(values, count, type, rounding);
+}
+
+auto DistanceArray::Size() const -> std::size_t { return nanometers_.size(); }
+auto DistanceArray::Empty() const -> bool { return nanometers_.empty(); }
+
+auto DistanceArray::Reserve(std::size_t count) -> void {
+  nanometers_.reserve(count);
+}
+auto DistanceArray::Resize(std::size_t count) -> void {
+  nanometers_.resize(count);
+}
+auto DistanceArray::Clear() -> void { nanometers_.clear(); }
+
+auto DistanceArray::PushBack(const Distance& distance) -> void {
+  nanometers_.push_back(distance.GetNanometer());
+}
+
+auto DistanceArray::GetDistance(std::size_t index) const -> Distance {
+  return Distance::FromNanometer(nanometers_[index]);
+}
+auto DistanceArray::SetDistance(std::size_t index, const Distance& distance)
+    -> void {
+  nanometers_[index] = distance.GetNanometer();
+}
+auto DistanceArray::GetNanometer(std::size_t index) const -> int64_t {
+  return nanometers_[index];
+}
+
+auto DistanceArray::Data() const -> const int64_t* {
+  return nanometers_.data();
+}
+auto DistanceArray::Data() -> int64_t* { return nanometers_.data(); }
+
+auto DistanceArray::ToDistances() const -> std::vector<Distance> {
+  std::vector<Distance> distances;
+  distances.reserve(Size());
+  for (const auto nanometer : nanometers_) {
+    distances.push_back(Distance::FromNanometer(nanometer));
+  }
+  return distances;
+}
+
+auto DistanceArray::GetValues(Distance::Type type) const
+    -> std::vector<double> {
+  std::vector<double> values(Size());
+  GetValues(type, values.data());
+  return values;
+}
+
+auto DistanceArray::GetValues(Distance::Type type, double* output) const
+    -> void {
+  ConvertToUnit(nanometers_.data(), Size(), type, output);
+}
+
+auto DistanceArray::SetValues(const double* values, std::size_t count,
+                              Distance::Type type, Rounding rounding) -> void {
+  // Converted aside, so a throw leaves the distances unchanged.
+  NanometerBuffer nanometers(count);
+  ConvertToNanometer(values, count, type, nanometers.data(), rounding);
+  nanometers_.swap(nanometers);
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,391 @@
+/**
+ * @file geometry/exact_arithmetic.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Rounding, overflow policy and 128-bit integer developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/exact_arithmetic.hpp"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+using programmers::geometry::Int128;
+using programmers::geometry::Rounding;
+
+constexpr double kTwoToThe64{18446744073709551616.0};
+constexpr double kRootMargin{1.0e-15};
+
+#if defined(__SIZEOF_INT128__)
+__extension__ using NativeInt128 = __int128;
+__extension__ using NativeUint128 = unsigned __int128;
+#endif
+
+/**
+ * @brief Unsigned 128-bit magnitude of an Int128
+ */
+struct Magnitude {
+  uint64_t high{0U};
+  uint64_t low{0U};
+};
+
+auto IsZero(const Magnitude& value) -> bool {
+  return (value.high | value.low) == 0U;
+}
+
+auto IsLess(const Magnitude& lhs, const Magnitude& rhs) -> bool {
+  return lhs.high != rhs.high ? lhs.high < rhs.high : lhs.low < rhs.low;
+}
+
+auto ShiftLeft(const Magnitude& value, uint32_t shift) -> Magnitude {
+  if (shift == 0U) {
+    return value;
+  }
+  if (shift >= 64U) {
+    return {value.low << (shift - 64U), 0U};
+  }
+  return {(value.high << shift) | (value.low >> (64U - shift)),
+          value.low << shift};
+}
+
+auto ShiftRight(const Magnitude& value, uint32_t shift) -> Magnitude {
+  if (shift == 0U) {
+    return value;
+  }
+  if (shift >= 64U) {
+    return {0U, value.high >> (shift - 64U)};
+  }
+  return {value.high >> shift,
+          (value.low >> shift) | (value.high << (64U - shift))};
+}
+
+auto Subtract(const Magnitude& lhs, const Magnitude& rhs) -> Magnitude {
+  return {lhs.high - rhs.high - (lhs.low < rhs.low ? 1U : 0U),
+          lhs.low - rhs.low};
+}
+
+auto Increment(const Magnitude& value) -> Magnitude {
+  return {value.high + (value.low == std::numeric_limits<uint64_t>::max()
+                            ? 1U
+                            : 0U),
+          value.low + 1U};
+}
+
+auto GetMagnitude(const Int128& value) -> Magnitude {
+  const auto absolute{value.IsNegative() ? -value : value};
+  return {static_cast<uint64_t>(absolute.GetHigh()), absolute.GetLow()};
+}
+
+auto FromMagnitude(const Magnitude& magnitude, bool negative) -> Int128 {
+  const Int128 value(static_cast<int64_t>(magnitude.high), magnitude.low);
+  return negative ? -value : value;
+}
+
+/**
+ * @brief Multiply two unsigned 64-bit values into 128 bits
+ */
+auto MultiplyMagnitude(uint64_t lhs, uint64_t rhs) -> Magnitude {
+#if defined(__SIZEOF_INT128__)
+  const auto product{NativeUint128{lhs} * rhs};
+  return {static_cast<uint64_t>(product >> 64U),
+          static_cast<uint64_t>(product)};
+#else
+  constexpr uint64_t kLowMask{0xFFFFFFFFU};
+  const auto lhs_low{lhs & kLowMask};
+  const auto lhs_high{lhs >> 32U};
+  const auto rhs_low{rhs & kLowMask};
+  const auto rhs_high{rhs >> 32U};
+  const auto low_low{lhs_low * rhs_low};
+  const auto high_low{lhs_high * rhs_low};
+  const auto low_high{lhs_low * rhs_high};
+  const auto middle{(low_low >> 32U) + (high_low & kLowMask) +
+                    (low_high & kLowMask)};
+  return {lhs_high * rhs_high + (high_low >> 32U) + (low_high >> 32U) +
+              (middle >> 32U),
+          (middle << 32U) | (low_low & kLowMask)};
+#endif
+}
+
+/**
+ * @brief Divide magnitudes, remainder is stored in remainder
+ */
+auto DivideMagnitude(const Magnitude& dividend, const Magnitude& divisor,
+                     Magnitude& remainder) -> Magnitude {
+  if ((dividend.high | divisor.high) == 0U) {
+    remainder = {0U, dividend.low % divisor.low};
+    return {0U, dividend.low / divisor.low};
+  }
+#if defined(__SIZEOF_INT128__)
+  const auto native_dividend{(NativeUint128{dividend.high} << 64U) |
+                             dividend.low};
+  const auto native_divisor{(NativeUint128{divisor.high} << 64U) |
+                            divisor.low};
+  const auto quotient{native_dividend / native_divisor};
+  const auto rest{native_dividend % native_divisor};
+  remainder = {static_cast<uint64_t>(rest >> 64U), static_cast<uint64_t>(rest)};
+  return {static_cast<uint64_t>(quotient >> 64U),
+          static_cast<uint64_t>(quotient)};
+#else
+  // Shift-subtract long division, one quotient bit per step.
+  Magnitude quotient;
+  remainder = {};
+  for (int32_t bit = 127; bit >= 0; --bit) {
+    remainder = ShiftLeft(remainder, 1U);
+    remainder.low |= ShiftRight(dividend, static_cast<uint32_t>(bit)).low & 1U;
+    if (!IsLess(remainder, divisor)) {
+      remainder = Subtract(remainder, divisor);
+      if (bit >= 64) {
+        quotient.high |= uint64_t{1U} << static_cast<uint32_t>(bit - 64);
+      } else {
+        quotient.low |= uint64_t{1U} << static_cast<uint32_t>(bit);
+      }
+    }
+  }
+  return quotient;
+#endif
+}
+
+/**
+ * @brief Round the truncated quotient magnitude of a division
+ * @param quotient Truncated quotient magnitude
+ * @param inexact Whether the remainder is not zero
+ * @param half Sign of remainder - divisor / 2
+ * @param negative Whether the exact quotient is negative
+ */
+auto RoundMagnitude(const Magnitude& quotient, bool inexact, int32_t half,
+                    bool negative, Rounding rounding) -> Magnitude {
+  if (!inexact) {
+    return quotient;
+  }
+  auto away{false};
+  switch (rounding) {
+    case Rounding::kTowardZero:
+      break;
+    case Rounding::kDown:
+      away = negative;
+      break;
+    case Rounding::kUp:
+      away = !negative;
+      break;
+    case Rounding::kNearest:
+      away = half >= 0;
+      break;
+    case Rounding::kNearestEven:
+      away = half > 0 || (half == 0 && (quotient.low & 1U) != 0U);
+      break;
+  }
+  return away ? Increment(quotient) : quotient;
+}
+
+auto CompareHalf(const Magnitude& remainder, const Magnitude& divisor)
+    -> int32_t {
+  // remainder < divisor, so divisor - remainder does not wrap.
+  const auto rest{Subtract(divisor, remainder)};
+  if (IsLess(remainder, rest)) {
+    return -1;
+  }
+  return IsLess(rest, remainder) ? 1 : 0;
+}
+}  // namespace
+
+namespace programmers::geometry {
+auto Int128::Multiply(int64_t lhs, int64_t rhs) -> Int128 {
+#if defined(__SIZEOF_INT128__)
+  const auto product{NativeInt128{lhs} * rhs};
+  return {static_cast<int64_t>(product >> 64U),
+          static_cast<uint64_t>(product)};
+#else
+  const auto negative{(lhs < 0) != (rhs < 0)};
+  const auto lhs_magnitude{lhs < 0 ? 0U - static_cast<uint64_t>(lhs)
+                                   : static_cast<uint64_t>(lhs)};
+  const auto rhs_magnitude{rhs < 0 ? 0U - static_cast<uint64_t>(rhs)
+                                   : static_cast<uint64_t>(rhs)};
+  const auto product{MultiplyMagnitude(lhs_magnitude, rhs_magnitude)};
+  return FromMagnitude(product, negative);
+#endif
+}
+
+auto Int128::GetHigh() const -> int64_t { return high_; }
+
+auto Int128::GetLow() const -> uint64_t { return low_; }
+
+auto Int128::IsNegative() const -> bool { return high_ < 0; }
+
+auto Int128::FitsInt64() const -> bool {
+  return high_ == (static_cast<int64_t>(low_) < 0 ? -1 : 0);
+}
+
+auto Int128::ToInt64(OverflowPolicy policy) const -> int64_t {
+  if (FitsInt64()) {
+    return static_cast<int64_t>(low_);
+  }
+  if (policy == OverflowPolicy::kChecked) {
+    throw std::overflow_error("Int128 value does not fit int64_t");
+  }
+  return IsNegative() ? std::numeric_limits<int64_t>::min()
+                      : std::numeric_limits<int64_t>::max();
+}
+
+auto Int128::ToDouble() const -> double {
+  if (FitsInt64()) {
+    return static_cast<double>(static_cast<int64_t>(low_));
+  }
+  const auto magnitude{GetMagnitude(*this)};
+  const auto value{static_cast<double>(magnitude.high) * kTwoToThe64 +
+                   static_cast<double>(magnitude.low)};
+  return IsNegative() ? -value : value;
+}
+
+auto Int128::ShiftLeft(uint32_t shift) const -> Int128 {
+  const auto shifted{
+      ::ShiftLeft(Magnitude{static_cast<uint64_t>(high_), low_}, shift)};
+  return {static_cast<int64_t>(shifted.high), shifted.low};
+}
+
+auto Int128::ShiftRight(uint32_t shift, Rounding rounding) const -> Int128 {
+  if (shift == 0U) {
+    return *this;
+  }
+  const auto negative{IsNegative()};
+  const auto magnitude{GetMagnitude(*this)};
+  if (shift >= 128U) {
+    // The quotient magnitude is below one. It is exactly one half only for
+    // -2^127 / 2^128.
+    const auto half{shift == 128U && magnitude.high == (uint64_t{1U} << 63U)
+                        ? 0
+                        : -1};
+    return FromMagnitude(
+        RoundMagnitude({}, !IsZero(magnitude), half, negative, rounding),
+        negative);
+  }
+  const auto quotient{::ShiftRight(magnitude, shift)};
+  const auto remainder{Subtract(magnitude, ::ShiftLeft(quotient, shift))};
+  const auto divisor{::ShiftLeft(Magnitude{0U, 1U}, shift)};
+  return FromMagnitude(
+      RoundMagnitude(quotient, !IsZero(remainder),
+                     CompareHalf(remainder, divisor), negative, rounding),
+      negative);
+}
+
+auto Int128::Divide(const Int128& divisor, Rounding rounding) const
+    -> Int128 {
+  if (divisor == Int128{}) {
+    throw std::invalid_argument("Int128 division by zero");
+  }
+  const auto negative{IsNegative() != divisor.IsNegative()};
+  const auto divisor_magnitude{GetMagnitude(divisor)};
+  Magnitude remainder;
+  const auto quotient{
+      DivideMagnitude(GetMagnitude(*this), divisor_magnitude, remainder)};
+  return FromMagnitude(
+      RoundMagnitude(quotient, !IsZero(remainder),
+                     CompareHalf(remainder, divisor_magnitude), negative,
+                     rounding),
+      negative);
+}
+
+auto Int128::SquareRoot(Rounding rounding) const -> Int128 {
+  if (IsNegative()) {
+    throw std::invalid_argument("Int128 square root of negative value");
+  }
+  if (*this == Int128{}) {
+    return {};
+  }
+  // Start above the root from the double estimate, then Newton steps on
+  // integers decrease monotonically to floor(sqrt(value)).
+  const auto estimate{std::sqrt(ToDouble()) * (1.0 + kRootMargin) + 2.0};
+  Int128 root{estimate < kTwoToThe64
+                  ? Int128(0, static_cast<uint64_t>(estimate))
+                  : Int128(0, std::numeric_limits<uint64_t>::max())};
+  for (;;) {
+    const auto next{(root + Divide(root, Rounding::kDown)).ShiftRight(
+        1U, Rounding::kDown)};
+    if (next >= root) {
+      break;
+    }
+    root = next;
+  }
+  const auto remainder{*this - root * root};
+  auto up{false};
+  switch (rounding) {
+    case Rounding::kTowardZero:
+    case Rounding::kDown:
+      break;
+    case Rounding::kUp:
+      up = remainder != Int128{};
+      break;
+    case Rounding::kNearest:
+    case Rounding::kNearestEven:
+      // value > (root + 1/2)^2 exactly when remainder > root, never a tie.
+      up = remainder > root;
+      break;
+  }
+  return up ? root + Int128{1} : root;
+}
+
+auto Int128::operator==(const Int128& other) const -> bool {
+  return high_ == other.high_ && low_ == other.low_;
+}
+
+auto Int128::operator!=(const Int128& other) const -> bool {
+  return !(*this == other);
+}
+
+auto Int128::operator<(const Int128& other) const -> bool {
+  return high_ != other.high_ ? high_ < other.high_ : low_ < other.low_;
+}
+
+auto Int128::operator<=(const Int128& other) const -> bool {
+  return !(other < *this);
+}
+
+auto Int128::operator>(const Int128& other) const -> bool {
+  return other < *this;
+}
+
+auto Int128::operator>=(const Int128& other) const -> bool {
+  return !(*this < other);
+}
+
+auto Int128::operator-() const -> Int128 { return Int128{} - *this; }
+
+auto Int128::operator+(const Int128& other) const -> Int128 {
+  const auto low{low_ + other.low_};
+  const auto high{static_cast<uint64_t>(high_) +
+                  static_cast<uint64_t>(other.high_) +
+                  (low < low_ ? 1U : 0U)};
+  return {static_cast<int64_t>(high), low};
+}
+
+auto Int128::operator-(const Int128& other) const -> Int128 {
+  const auto low{low_ - other.low_};
+  const auto high{static_cast<uint64_t>(high_) -
+                  static_cast<uint64_t>(other.high_) -
+                  (low_ < other.low_ ? 1U : 0U)};
+  return {static_cast<int64_t>(high), low};
+}
+
+auto Int128::operator*(const Int128& other) const -> Int128 {
+  const auto low{MultiplyMagnitude(low_, other.low_)};
+  const auto high{low.high + static_cast<uint64_t>(high_) * other.low_ +
+                  low_ * static_cast<uint64_t>(other.high_)};
+  return {static_cast<int64_t>(high), low.low};
+}
+
+auto Int128::operator+=(const Int128& other) -> Int128& {
+  *this = *this + other;
+  return *this;
+}
+
+auto Int128::operator-=(const Int128& other) -> Int128& {
+  *this = *this - other;
+  return *this;
+}
+}  // namespace programmers::geometry
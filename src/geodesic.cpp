@@ -0,0 +1,322 @@
+/**
+ * @file geometry/geodesic.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Great circle and ellipsoidal distance developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/geodesic.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "geometry/kernels.hpp"
+#include "geometry/thread_pool.hpp"
+
+namespace {
+using programmers::geometry::Point2D;
+namespace geodesic = programmers::geometry::geodesic;
+
+constexpr double kRadianPerDegree{3.14159265358979323846 / 180.0};
+constexpr double kPi{3.14159265358979323846};
+constexpr uint32_t kMaximumIterations{200U};
+constexpr double kConvergence{1.0e-12};  ///< Longitude change in radians
+
+/**
+ * @brief Throw if point is not a finite longitude and latitude
+ */
+auto Validate(const Point2D& point) -> void {
+  if (!std::isfinite(point.GetX()) || !std::isfinite(point.GetY()) ||
+      point.GetY() < -90.0 || point.GetY() > 90.0) {
+    throw std::invalid_argument("Not a longitude and latitude");
+  }
+}
+
+/**
+ * @brief Great circle distance in meters with the haversine formula
+ */
+auto CalculateHaversine(const Point2D& from, const Point2D& to) -> double {
+  const auto latitude_from{from.GetY() * kRadianPerDegree};
+  const auto latitude_to{to.GetY() * kRadianPerDegree};
+  const auto half_latitude{std::sin((latitude_to - latitude_from) / 2.0)};
+  const auto half_longitude{
+      std::sin((to.GetX() - from.GetX()) * kRadianPerDegree / 2.0)};
+  const auto haversine{half_latitude * half_latitude +
+                       std::cos(latitude_from) * std::cos(latitude_to) *
+                           half_longitude * half_longitude};
+  return 2.0 * geodesic::kMeanRadius *
+         std::asin(std::min(1.0, std::sqrt(haversine)));
+}
+
+constexpr double kA{geodesic::kSemiMajorAxis};  ///< Semi-major axis
+constexpr double kF{geodesic::kFlattening};     ///< Flattening
+constexpr double kB{kA * (1.0 - kF)};           ///< Semi-minor axis
+
+/**
+ * @brief Longitude minus its value on the auxiliary sphere, Vincenty's
+ * series in the flattening
+ */
+auto CalculateLongitudeOffset(double sigma, double sin_sigma,
+                              double cos_sigma, double cos_2sigma_m,
+                              double sin_alpha, double cos_squared_alpha)
+    -> double {
+  const auto c{kF / 16.0 * cos_squared_alpha *
+               (4.0 + kF * (4.0 - 3.0 * cos_squared_alpha))};
+  return (1.0 - c) * kF * sin_alpha *
+         (sigma + c * sin_sigma *
+                      (cos_2sigma_m +
+                       c * cos_sigma *
+                           (-1.0 + 2.0 * cos_2sigma_m * cos_2sigma_m)));
+}
+
+/**
+ * @brief Length in meters of a geodesic spanning sigma on the auxiliary
+ * sphere, Vincenty's series in the second eccentricity
+ */
+auto CalculateLength(double sigma, double sin_sigma, double cos_sigma,
+                     double cos_2sigma_m, double cos_squared_alpha)
+    -> double {
+  const auto u_squared{cos_squared_alpha * (kA * kA - kB * kB) / (kB * kB)};
+  const auto a{1.0 + u_squared / 16384.0 *
+                         (4096.0 + u_squared * (-768.0 + u_squared *
+                                                    (320.0 - 175.0 *
+                                                                 u_squared)))};
+  const auto b{u_squared / 1024.0 *
+               (256.0 +
+                u_squared * (-128.0 + u_squared * (74.0 - 47.0 * u_squared)))};
+  const auto cos_squared_2sigma_m{cos_2sigma_m * cos_2sigma_m};
+  const auto delta_sigma{
+      b * sin_sigma *
+      (cos_2sigma_m +
+       b / 4.0 *
+           (cos_sigma * (-1.0 + 2.0 * cos_squared_2sigma_m) -
+            b / 6.0 * cos_2sigma_m * (-3.0 + 4.0 * sin_sigma * sin_sigma) *
+                (-3.0 + 4.0 * cos_squared_2sigma_m)))};
+  return kB * a * (sigma - delta_sigma);
+}
+
+/**
+ * @brief Ellipsoidal distance in meters solving for the first azimuth
+ * @details For nearly antipodal points, where Vincenty's iteration on the
+ * longitude fails. Following Karney, the points are arranged so that the
+ * first latitude is the most southern and the longitude difference is in
+ * [0, pi]; the longitude reached at the second latitude then grows with
+ * the first azimuth on [0, pi], so bisection always converges. The series
+ * are Vincenty's, so both paths agree to his accuracy.
+ */
+auto CalculateByAzimuth(double reduced_from, double reduced_to,
+                        double longitude) -> double {
+  if (std::abs(reduced_from) < std::abs(reduced_to)) {
+    std::swap(reduced_from, reduced_to);
+  }
+  if (reduced_from > 0.0) {
+    reduced_from = -reduced_from;
+    reduced_to = -reduced_to;
+  }
+  longitude = std::abs(longitude);
+  // A negative zero keeps the start on the southern side of the equator.
+  const auto sin_u1{-std::abs(std::sin(reduced_from))};
+  const auto cos_u1{std::cos(reduced_from)};
+  const auto sin_u2{std::sin(reduced_to)};
+  const auto cos_u2{std::cos(reduced_to)};
+  if (sin_u1 == 0.0 && longitude <= (1.0 - kF) * kPi) {
+    return kA * longitude;
+  }
+  // cos^2(u2) - cos^2(u1), in its better conditioned form.
+  const auto difference{cos_u1 < -sin_u1
+                            ? (cos_u2 - cos_u1) * (cos_u2 + cos_u1)
+                            : (sin_u1 - sin_u2) * (sin_u1 + sin_u2)};
+
+  double sigma{0.0};
+  double cos_2sigma_m{0.0};
+  double cos_squared_alpha{0.0};
+  const auto solve{[&](double azimuth) {
+    const auto sin_azimuth{std::sin(azimuth)};
+    const auto cos_azimuth{std::cos(azimuth)};
+    const auto sin_alpha{sin_azimuth * cos_u1};
+    cos_squared_alpha = 1.0 - sin_alpha * sin_alpha;
+    const auto north_from{cos_azimuth * cos_u1};
+    const auto north_to{std::sqrt(
+        std::max(0.0, north_from * north_from + difference))};
+    const auto sigma_from{std::atan2(sin_u1, north_from)};
+    const auto sigma_to{std::atan2(sin_u2, north_to)};
+    const auto omega{std::atan2(sin_alpha * sin_u2, north_to) -
+                     std::atan2(sin_alpha * sin_u1, north_from)};
+    sigma = sigma_to - sigma_from;
+    cos_2sigma_m = std::cos(sigma_from + sigma_to);
+    return omega - CalculateLongitudeOffset(sigma, std::sin(sigma),
+                                            std::cos(sigma), cos_2sigma_m,
+                                            sin_alpha, cos_squared_alpha);
+  }};
+  auto lower{0.0};
+  auto upper{kPi};
+  while (true) {
+    const auto middle{(lower + upper) / 2.0};
+    if (middle <= lower || middle >= upper) {
+      break;
+    }
+    (solve(middle) < longitude ? lower : upper) = middle;
+  }
+  static_cast<void>(solve((lower + upper) / 2.0));
+  return CalculateLength(sigma, std::sin(sigma), std::cos(sigma),
+                         cos_2sigma_m, cos_squared_alpha);
+}
+
+/**
+ * @brief Ellipsoidal distance in meters with Vincenty's inverse formula
+ * @details Falls back to CalculateByAzimuth when the iteration leaves
+ * [-pi, pi] or does not converge, which happens near the antipode.
+ */
+auto CalculateVincenty(const Point2D& from, const Point2D& to) -> double {
+  const auto latitude_from{from.GetY() * kRadianPerDegree};
+  const auto latitude_to{to.GetY() * kRadianPerDegree};
+  // Reduced latitudes on the auxiliary sphere.
+  const auto reduced_from{std::atan2((1.0 - kF) * std::sin(latitude_from),
+                                     std::cos(latitude_from))};
+  const auto reduced_to{std::atan2((1.0 - kF) * std::sin(latitude_to),
+                                   std::cos(latitude_to))};
+  const auto sin_u1{std::sin(reduced_from)};
+  const auto cos_u1{std::cos(reduced_from)};
+  const auto sin_u2{std::sin(reduced_to)};
+  const auto cos_u2{std::cos(reduced_to)};
+  const auto longitude{
+      std::remainder((to.GetX() - from.GetX()) * kRadianPerDegree,
+                     2.0 * kPi)};
+
+  auto lambda{longitude};
+  double sin_sigma{0.0};
+  double cos_sigma{0.0};
+  double sigma{0.0};
+  double cos_squared_alpha{0.0};
+  double cos_2sigma_m{0.0};
+  for (uint32_t iteration = 0;; ++iteration) {
+    if (iteration == kMaximumIterations || std::abs(lambda) > kPi) {
+      return CalculateByAzimuth(reduced_from, reduced_to, longitude);
+    }
+    const auto sin_lambda{std::sin(lambda)};
+    const auto cos_lambda{std::cos(lambda)};
+    const auto cross{cos_u1 * sin_u2 - sin_u1 * cos_u2 * cos_lambda};
+    sin_sigma = std::hypot(cos_u2 * sin_lambda, cross);
+    cos_sigma = sin_u1 * sin_u2 + cos_u1 * cos_u2 * cos_lambda;
+    if (sin_sigma == 0.0) {
+      // Equal points, or antipodal ones joined by many geodesics.
+      return cos_sigma > 0.0
+                 ? 0.0
+                 : CalculateByAzimuth(reduced_from, reduced_to, longitude);
+    }
+    sigma = std::atan2(sin_sigma, cos_sigma);
+    const auto sin_alpha{cos_u1 * cos_u2 * sin_lambda / sin_sigma};
+    cos_squared_alpha = 1.0 - sin_alpha * sin_alpha;
+    // Both points on the equator make cos_squared_alpha zero.
+    cos_2sigma_m = cos_squared_alpha != 0.0
+                       ? cos_sigma - 2.0 * sin_u1 * sin_u2 / cos_squared_alpha
+                       : 0.0;
+    const auto previous{lambda};
+    lambda = longitude + CalculateLongitudeOffset(sigma, sin_sigma, cos_sigma,
+                                                  cos_2sigma_m, sin_alpha,
+                                                  cos_squared_alpha);
+    if (std::abs(lambda - previous) <= kConvergence) {
+      break;
+    }
+  }
+  return CalculateLength(sigma, sin_sigma, cos_sigma, cos_2sigma_m,
+                         cos_squared_alpha);
+}
+
+/**
+ * @brief Distance in meters for the model, the point already validated
+ */
+auto Calculate(const Point2D& from, const Point2D& to,
+               programmers::geometry::GeodesicModel model) -> double {
+  return model == programmers::geometry::GeodesicModel::kSpherical
+             ? CalculateHaversine(from, to)
+             : CalculateVincenty(from, to);
+}
+
+/**
+ * @brief Unit vector of a longitude and latitude
+ */
+auto ToUnitVector(const Point2D& point) -> std::array<double, 3> {
+  const auto longitude{point.GetX() * kRadianPerDegree};
+  const auto latitude{point.GetY() * kRadianPerDegree};
+  const auto cos_latitude{std::cos(latitude)};
+  return {cos_latitude * std::cos(longitude),
+          cos_latitude * std::sin(longitude), std::sin(latitude)};
+}
+}  // namespace
+
+namespace programmers::geometry {
+auto CalculateGeodesicDistance(const Point2D& from, const Point2D& to,
+                               GeodesicModel model) -> Distance {
+  Validate(from);
+  Validate(to);
+  return Distance(Calculate(from, to, model), Distance::Type::kMeter,
+                  Rounding::kNearest);
+}
+
+GeodesicCloud::GeodesicCloud(const PointCloud2D& points)
+    : points_(points),
+      x_(points.Size()),
+      y_(points.Size()),
+      z_(points.Size()) {
+  ParallelFor(Size(), [&](std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      const auto point{points_.GetPoint(i)};
+      Validate(point);
+      const auto vector{ToUnitVector(point)};
+      x_[i] = vector[0];
+      y_[i] = vector[1];
+      z_[i] = vector[2];
+    }
+  });
+}
+
+auto GeodesicCloud::Size() const -> std::size_t { return points_.Size(); }
+
+auto GeodesicCloud::Empty() const -> bool { return points_.Empty(); }
+
+auto GeodesicCloud::GetPoint(std::size_t index) const -> Point2D {
+  return points_.GetPoint(index);
+}
+
+auto GeodesicCloud::CalculateDistances(const Point2D& target, double* output,
+                                       GeodesicModel model) const -> void {
+  Validate(target);
+  if (model == GeodesicModel::kEllipsoidal) {
+    ParallelFor(Size(), [&](std::size_t begin, std::size_t end) {
+      for (auto i = begin; i < end; ++i) {
+        output[i] = CalculateVincenty(points_.GetPoint(i), target);
+      }
+    });
+    return;
+  }
+  const auto vector{ToUnitVector(target)};
+  ParallelFor(Size(), [&](std::size_t begin, std::size_t end) {
+    kernels::CalculateDistances3D(x_.data() + begin, y_.data() + begin,
+                                  z_.data() + begin, end - begin,
+                                  vector.data(), output + begin);
+    for (auto i = begin; i < end; ++i) {
+      output[i] = 2.0 * geodesic::kMeanRadius *
+                  std::asin(std::min(1.0, output[i] / 2.0));
+    }
+  });
+}
+
+auto GeodesicCloud::CalculateDistances(const Point2D& target,
+                                       GeodesicModel model) const
+    -> DistanceArray {
+  std::vector<double> meters(Size());
+  CalculateDistances(target, meters.data(), model);
+  return DistanceArray(meters.data(), meters.size(), Distance::Type::kMeter,
+                       Rounding::kNearest);
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,140 @@
+/**
+ * @file geometry/grid_cells.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Uniform grid cells shared by the spatial searches
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__GRID_CELLS_HPP_
+#define PROGRAMMERS__GEOMETRY__GRID_CELLS_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/bounding_box2d.hpp"
+#include "geometry/point2d.hpp"
+#include "geometry/space_filling_curve.hpp"
+#include "geometry/thread_pool.hpp"
+
+namespace programmers::geometry::detail {
+constexpr std::size_t kBatchSize{4096U};       ///< Pairs per callback call
+constexpr double kMaximumCells{2147483648.0};  ///< Cells per axis, 2^31
+constexpr uint64_t kRow{uint64_t{1U} << 32U};  ///< Key step of one cell row
+
+/**
+ * @brief Get a key whose unsigned order is the order of finite value
+ */
+inline auto ToOrderedKey(double value) -> uint64_t {
+  uint64_t bits{0U};
+  std::memcpy(&bits, &value, sizeof(bits));
+  constexpr uint64_t kSign{uint64_t{1U} << 63U};
+  return bits ^ ((bits & kSign) != 0U ? ~uint64_t{0U} : kSign);
+}
+
+/**
+ * @brief Get the cell of value on an axis of count cells from origin
+ * @details Clamped to the cells and monotone in value, so the cell of the
+ * larger of two values is the larger of their cells.
+ */
+inline auto GetCell(double value, double origin, double size,
+                    std::size_t count) -> std::size_t {
+  const auto cell{std::floor((value - origin) / size)};
+  if (!(cell > 0.0)) {
+    return 0U;
+  }
+  return std::min(static_cast<std::size_t>(
+                      std::min(cell, static_cast<double>(count))),
+                  count - 1U);
+}
+
+/**
+ * @brief Get the side of square cells over box for pairs within radius
+ * @details Cells at least radius wide put every pair within radius in the
+ * same or adjacent cells. The padding absorbs rounding of the cell
+ * coordinates, and the extent bound keeps them below 2^31 per axis.
+ */
+inline auto GetCellSize(const BoundingBox2D& box, double radius) -> double {
+  const auto minimum{box.GetMinimum()};
+  const auto maximum{box.GetMaximum()};
+  const auto magnitude{std::max({std::abs(minimum.GetX()),
+                                 std::abs(minimum.GetY()),
+                                 std::abs(maximum.GetX()),
+                                 std::abs(maximum.GetY())})};
+  const auto padding{4.0 * std::numeric_limits<double>::epsilon() *
+                     magnitude};
+  const auto extent{std::max(box.GetWidth(), box.GetHeight())};
+  return std::max({radius + padding, extent / kMaximumCells,
+                   std::numeric_limits<double>::min()}) *
+         (1.0 + 1.0e-6);
+}
+
+/**
+ * @brief Points sorted by the grid cell key, with the first point of cells
+ * @details The key of a cell is its row times kRow plus its column.
+ */
+struct GridBuckets {
+  std::vector<uint32_t> order;           ///< Input index of sorted points
+  std::vector<double> xs;                ///< Sorted x coordinates
+  std::vector<double> ys;                ///< Sorted y coordinates
+  std::vector<uint64_t> cell_keys;       ///< Ascending keys of cells
+  std::vector<std::size_t> cell_begins;  ///< First point of each cell
+};
+
+/**
+ * @brief Sort points into square cells counted from minimum
+ * @param xs x coordinates of count points
+ * @param ys y coordinates of count points
+ * @param count The number of points, less than 2^32 - 1
+ * @param minimum The corner of cell (0, 0), at most every point
+ * @param cell The side of cells from GetCellSize
+ * @param error The message thrown for a non-finite point
+ * @return GridBuckets The points bucketed by cell
+ * @throw std::invalid_argument If a point is not finite
+ */
+inline auto BuildBuckets(const double* xs, const double* ys,
+                         std::size_t count, const Point2D& minimum,
+                         double cell, const char* error) -> GridBuckets {
+  std::vector<uint64_t> keys(count);
+  ParallelFor(count, [&](std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      if (!std::isfinite(xs[i]) || !std::isfinite(ys[i])) {
+        throw std::invalid_argument(error);
+      }
+      const auto cell_x{static_cast<uint64_t>((xs[i] - minimum.GetX()) / cell)};
+      const auto cell_y{static_cast<uint64_t>((ys[i] - minimum.GetY()) / cell)};
+      keys[i] = cell_y * kRow + cell_x;
+    }
+  });
+  GridBuckets buckets;
+  buckets.order = SortByKey(keys);
+  buckets.xs.resize(count);
+  buckets.ys.resize(count);
+  ParallelFor(count, [&](std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      buckets.xs[i] = xs[buckets.order[i]];
+      buckets.ys[i] = ys[buckets.order[i]];
+    }
+  });
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto key{keys[buckets.order[i]]};
+    if (buckets.cell_keys.empty() || buckets.cell_keys.back() != key) {
+      buckets.cell_keys.push_back(key);
+      buckets.cell_begins.push_back(i);
+    }
+  }
+  buckets.cell_begins.push_back(count);
+  return buckets;
+}
+}  // namespace programmers::geometry::detail
+
+#endif
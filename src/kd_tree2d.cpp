@@ -0,0 +1,273 @@
+/**
+ * @file geometry/kd_tree2d.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Static KD-tree spatial index developments over 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/kd_tree2d.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+#include "geometry/thread_pool.hpp"
+
+namespace {
+constexpr uint32_t kParallelBuildThreshold{1U << 16U};
+constexpr std::size_t kQueryGrain{64U};
+constexpr std::size_t kMaxStackDepth{64U};
+
+/**
+ * @brief Count the nodes of the subtree over count points, memoized
+ */
+auto CountNodes(uint32_t count,
+                std::unordered_map<uint32_t, uint32_t>& node_counts)
+    -> uint32_t {
+  const auto found{node_counts.find(count)};
+  if (found != node_counts.end()) {
+    return found->second;
+  }
+  uint32_t result{1U};
+  if (count > programmers::geometry::KdTree2D::kLeafSize) {
+    const auto left{count / 2U};
+    result += CountNodes(left, node_counts) +
+              CountNodes(count - left, node_counts);
+  }
+  node_counts.emplace(count, result);
+  return result;
+}
+}  // namespace
+
+namespace programmers::geometry {
+KdTree2D::KdTree2D(const PointCloud2D& points) { Build(points); }
+
+KdTree2D::KdTree2D(const std::vector<Point2D>& points) {
+  Build(PointCloud2D(points));
+}
+
+auto KdTree2D::Size() const -> std::size_t { return indices_.size(); }
+auto KdTree2D::Empty() const -> bool { return indices_.empty(); }
+
+auto KdTree2D::Build(const PointCloud2D& points) -> void {
+  if (points.Size() >= std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("KdTree2D supports less than 2^32 - 1 points");
+  }
+  nodes_.clear();
+  points_.Clear();
+  indices_.clear();
+  if (points.Empty()) {
+    return;
+  }
+
+  const auto count{static_cast<uint32_t>(points.Size())};
+  NodeCounts node_counts;
+  nodes_.resize(CountNodes(count, node_counts));
+  std::vector<uint32_t> order(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    order[i] = i;
+  }
+
+  BuildNode(points, order, node_counts, 0U, 0U, count);
+
+  points_.Resize(count);
+  indices_ = std::move(order);
+  for (uint32_t i = 0; i < count; ++i) {
+    points_.XData()[i] = points.GetX(indices_[i]);
+    points_.YData()[i] = points.GetY(indices_[i]);
+  }
+}
+
+auto KdTree2D::BuildNode(const PointCloud2D& points,
+                         std::vector<uint32_t>& order,
+                         const NodeCounts& node_counts, uint32_t node,
+                         uint32_t begin, uint32_t end) -> void {
+  auto& current{nodes_[node]};
+  current.begin = begin;
+  current.end = end;
+  if (end - begin <= kLeafSize) {
+    return;
+  }
+
+  auto min_x{std::numeric_limits<double>::infinity()};
+  auto min_y{std::numeric_limits<double>::infinity()};
+  auto max_x{-std::numeric_limits<double>::infinity()};
+  auto max_y{-std::numeric_limits<double>::infinity()};
+  for (auto i = begin; i < end; ++i) {
+    min_x = std::min(min_x, points.GetX(order[i]));
+    max_x = std::max(max_x, points.GetX(order[i]));
+    min_y = std::min(min_y, points.GetY(order[i]));
+    max_y = std::max(max_y, points.GetY(order[i]));
+  }
+  current.axis = (max_x - min_x >= max_y - min_y) ? 0U : 1U;
+  const auto* coordinates{current.axis == 0U ? points.XData()
+                                             : points.YData()};
+
+  const auto middle{begin + (end - begin) / 2U};
+  std::nth_element(order.begin() + begin, order.begin() + middle,
+                   order.begin() + end,
+                   [coordinates](uint32_t lhs, uint32_t rhs) {
+                     return coordinates[lhs] < coordinates[rhs];
+                   });
+  current.split = coordinates[order[middle]];
+  current.right = node + 1U + node_counts.at(middle - begin);
+
+  const auto right{current.right};
+  const auto build_left{[&]() {
+    BuildNode(points, order, node_counts, node + 1U, begin, middle);
+  }};
+  const auto build_right{
+      [&]() { BuildNode(points, order, node_counts, right, middle, end); }};
+  if (end - begin >= kParallelBuildThreshold) {
+    ParallelInvoke(build_left, build_right);
+  } else {
+    build_left();
+    build_right();
+  }
+}
+
+auto KdTree2D::FindNearest(const Point2D& query) const -> Neighbor {
+  const auto neighbors{FindNearest(query, 1U)};
+  if (neighbors.empty()) {
+    throw std::out_of_range("KdTree2D is empty");
+  }
+  return neighbors.front();
+}
+
+auto KdTree2D::FindNearest(const Point2D& query, std::size_t k) const
+    -> std::vector<Neighbor> {
+  std::vector<Neighbor> heap;
+  if (Empty() || k == 0U) {
+    return heap;
+  }
+  k = std::min(k, Size());
+  heap.reserve(k);
+  const auto farther{[](const Neighbor& lhs, const Neighbor& rhs) {
+    return lhs.squared_distance < rhs.squared_distance;
+  }};
+
+  const std::array<double, 2> target{query.GetX(), query.GetY()};
+  const auto* xs{points_.XData()};
+  const auto* ys{points_.YData()};
+  std::array<std::pair<uint32_t, double>, kMaxStackDepth> stack{};
+  std::size_t stack_size{0U};
+  stack[stack_size++] = {0U, 0.0};
+  while (stack_size > 0U) {
+    const auto [node_index, bound]{stack[--stack_size]};
+    if (heap.size() == k && bound > heap.front().squared_distance) {
+      continue;
+    }
+    const auto& node{nodes_[node_index]};
+    if (node.right == 0U) {
+      for (auto i = node.begin; i < node.end; ++i) {
+        const auto dx{xs[i] - target[0]};
+        const auto dy{ys[i] - target[1]};
+        const auto squared_distance{dx * dx + dy * dy};
+        if (heap.size() < k) {
+          heap.push_back({indices_[i], squared_distance});
+          std::push_heap(heap.begin(), heap.end(), farther);
+        } else if (squared_distance < heap.front().squared_distance) {
+          std::pop_heap(heap.begin(), heap.end(), farther);
+          heap.back() = {indices_[i], squared_distance};
+          std::push_heap(heap.begin(), heap.end(), farther);
+        }
+      }
+      continue;
+    }
+    const auto difference{target[node.axis] - node.split};
+    const auto near{difference < 0.0 ? node_index + 1U : node.right};
+    const auto far{difference < 0.0 ? node.right : node_index + 1U};
+    stack[stack_size++] = {far, std::max(bound, difference * difference)};
+    stack[stack_size++] = {near, bound};
+  }
+  std::sort_heap(heap.begin(), heap.end(), farther);
+  return heap;
+}
+
+auto KdTree2D::FindNearest(const PointCloud2D& queries, std::size_t k) const
+    -> std::vector<Neighbor> {
+  const auto row{std::min(k, Size())};
+  std::vector<Neighbor> neighbors(queries.Size() * row);
+  ParallelOptions options;
+  options.grain = kQueryGrain;
+  ParallelFor(
+      queries.Size(),
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          const auto found{FindNearest(queries.GetPoint(i), row)};
+          std::copy(found.begin(), found.end(), neighbors.begin() + i * row);
+        }
+      },
+      options);
+  return neighbors;
+}
+
+auto KdTree2D::FindWithinRadius(const Point2D& query, double radius) const
+    -> std::vector<Neighbor> {
+  std::vector<Neighbor> neighbors;
+  if (Empty() || radius < 0.0) {
+    return neighbors;
+  }
+  const auto squared_radius{radius * radius};
+
+  const std::array<double, 2> target{query.GetX(), query.GetY()};
+  const auto* xs{points_.XData()};
+  const auto* ys{points_.YData()};
+  std::array<std::pair<uint32_t, double>, kMaxStackDepth> stack{};
+  std::size_t stack_size{0U};
+  stack[stack_size++] = {0U, 0.0};
+  while (stack_size > 0U) {
+    const auto [node_index, bound]{stack[--stack_size]};
+    if (bound > squared_radius) {
+      continue;
+    }
+    const auto& node{nodes_[node_index]};
+    if (node.right == 0U) {
+      for (auto i = node.begin; i < node.end; ++i) {
+        const auto dx{xs[i] - target[0]};
+        const auto dy{ys[i] - target[1]};
+        const auto squared_distance{dx * dx + dy * dy};
+        if (squared_distance <= squared_radius) {
+          neighbors.push_back({indices_[i], squared_distance});
+        }
+      }
+      continue;
+    }
+    const auto difference{target[node.axis] - node.split};
+    const auto near{difference < 0.0 ? node_index + 1U : node.right};
+    const auto far{difference < 0.0 ? node.right : node_index + 1U};
+    stack[stack_size++] = {far, std::max(bound, difference * difference)};
+    stack[stack_size++] = {near, bound};
+  }
+  return neighbors;
+}
+
+auto KdTree2D::FindWithinRadius(const Point2D& query, const Distance& radius,
+                                Distance::Type unit) const
+    -> std::vector<Neighbor> {
+  return FindWithinRadius(query, radius.GetValue(unit));
+}
+
+auto KdTree2D::FindWithinRadius(const PointCloud2D& queries,
+                                double radius) const
+    -> std::vector<std::vector<Neighbor>> {
+  std::vector<std::vector<Neighbor>> neighbors(queries.Size());
+  ParallelOptions options;
+  options.grain = kQueryGrain;
+  ParallelFor(
+      queries.Size(),
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          neighbors[i] = FindWithinRadius(queries.GetPoint(i), radius);
+        }
+      },
+      options);
+  return neighbors;
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,87 @@
+/**
+ * @file geometry/kernels/curve_bits.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Bit tricks shared by the space-filling curve kernels
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__KERNELS__CURVE_BITS_HPP_
+#define PROGRAMMERS__GEOMETRY__KERNELS__CURVE_BITS_HPP_
+
+#include <cstdint>
+#include <utility>
+
+// Every function here is static so that each instruction set specific
+// translation unit keeps its own copy compiled with its own flags.
+namespace programmers::geometry::kernels {
+/**
+ * @brief Spread the bits of value to the even bits of the result
+ */
+static inline auto SpreadBits(uint32_t value) -> uint64_t {
+  uint64_t bits{value};
+  bits = (bits | (bits << 16U)) & 0x0000FFFF0000FFFFULL;
+  bits = (bits | (bits << 8U)) & 0x00FF00FF00FF00FFULL;
+  bits = (bits | (bits << 4U)) & 0x0F0F0F0F0F0F0F0FULL;
+  bits = (bits | (bits << 2U)) & 0x3333333333333333ULL;
+  bits = (bits | (bits << 1U)) & 0x5555555555555555ULL;
+  return bits;
+}
+
+/**
+ * @brief Gather the even bits of bits, the inverse of SpreadBits
+ */
+static inline auto CompactBits(uint64_t bits) -> uint32_t {
+  bits &= 0x5555555555555555ULL;
+  bits = (bits | (bits >> 1U)) & 0x3333333333333333ULL;
+  bits = (bits | (bits >> 2U)) & 0x0F0F0F0F0F0F0F0FULL;
+  bits = (bits | (bits >> 4U)) & 0x00FF00FF00FF00FFULL;
+  bits = (bits | (bits >> 8U)) & 0x0000FFFF0000FFFFULL;
+  bits = (bits | (bits >> 16U)) & 0x00000000FFFFFFFFULL;
+  return static_cast<uint32_t>(bits);
+}
+
+/**
+ * @brief Compute the per-level Hilbert index bits of cell (x, y)
+ * @details Branch-free prefix scan over the curve orientation of every
+ * level, so a whole 32-level key costs a fixed few dozen operations.
+ * Interleaving the returned bits as (first << 1) | second gives the key.
+ * @return std::pair<uint32_t, uint32_t> The high and low bit of every level
+ */
+static inline auto TransformHilbert(uint32_t x, uint32_t y)
+    -> std::pair<uint32_t, uint32_t> {
+  constexpr uint32_t kOnes{0xFFFFFFFFU};
+  uint32_t a{x ^ y};
+  uint32_t b{kOnes ^ a};
+  uint32_t c{kOnes ^ (x | y)};
+  uint32_t d{x & (y ^ kOnes)};
+
+  auto state_a{a | (b >> 1U)};
+  auto state_b{(a >> 1U) ^ a};
+  auto state_c{((c >> 1U) ^ (b & (d >> 1U))) ^ c};
+  auto state_d{((a & (c >> 1U)) ^ (d >> 1U)) ^ d};
+
+  for (const auto shift : {2U, 4U, 8U, 16U}) {
+    a = state_a;
+    b = state_b;
+    c = state_c;
+    d = state_d;
+    state_a = (a & (a >> shift)) ^ (b & (b >> shift));
+    state_b = (a & (b >> shift)) ^ (b & ((a ^ b) >> shift));
+    state_c ^= (a & (c >> shift)) ^ (b & (d >> shift));
+    state_d ^= (b & (c >> shift)) ^ ((a ^ b) & (d >> shift));
+  }
+
+  a = state_c ^ (state_c >> 1U);
+  b = state_d ^ (state_d >> 1U);
+  const auto low{x ^ y};
+  const auto high{b | (kOnes ^ (low | a))};
+  return {high, low};
+}
+}  // namespace programmers::geometry::kernels
+
+#endif
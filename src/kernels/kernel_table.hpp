@@ -0,0 +1,87 @@
+/**
+ * @file geometry/kernels/kernel_table.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Function table shared by the instruction set specific kernels
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__KERNELS__KERNEL_TABLE_HPP_
+#define PROGRAMMERS__GEOMETRY__KERNELS__KERNEL_TABLE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "geometry/kernels.hpp"
+
+namespace programmers::geometry::kernels {
+/**
+ * @brief Kernels compiled for one instruction set
+ * @details Every instruction set specific translation unit fills one table.
+ * Those units are compiled with their own architecture flags, so they must
+ * only include headers whose inline functions are never emitted by them.
+ */
+struct KernelTable {
+  Isa isa;  ///< Instruction set of the kernels
+  void (*calculate_distances)(const double*, const double*, std::size_t,
+                              double, double, double*);
+  void (*calculate_squared_distances)(const double*, const double*,
+                                      std::size_t, double, double, double*);
+  void (*calculate_pairwise_distances)(const double*, const double*,
+                                       const double*, const double*,
+                                       std::size_t, double*);
+  void (*calculate_distances3d)(const double*, const double*, const double*,
+                                std::size_t, const double*, double*);
+  void (*add)(const double*, const double*, const double*, const double*,
+              std::size_t, double*, double*);
+  void (*subtract)(const double*, const double*, const double*, const double*,
+                   std::size_t, double*, double*);
+  void (*scale)(const double*, const double*, std::size_t, double, double*,
+                double*);
+  void (*translate)(const double*, const double*, std::size_t, double, double,
+                    double*, double*);
+  void (*transform)(const double*, const double*, std::size_t, const double*,
+                    double*, double*);
+  void (*encode_morton)(const uint32_t*, const uint32_t*, std::size_t,
+                        uint64_t*);
+  void (*encode_hilbert)(const uint32_t*, const uint32_t*, std::size_t,
+                         uint64_t*);
+  void (*convert_to_double)(const int64_t*, std::size_t, double, double*);
+  bool (*convert_to_int64)(const double*, std::size_t, double, Rounding,
+                           int64_t*);
+  void (*calculate_bounds)(const double*, const double*, std::size_t,
+                           double*);
+  void (*filter_within_box)(const double*, const double*, std::size_t,
+                            const double*, uint64_t*);
+  void (*filter_intersecting_boxes)(const double*, const double*,
+                                    const double*, const double*,
+                                    std::size_t, const double*, uint64_t*);
+};
+
+/**
+ * @brief Get the portable reference kernels
+ * @return const KernelTable* Never null
+ */
+auto GetScalarKernelTable() -> const KernelTable*;
+/**
+ * @brief Get the SSE2 kernels
+ * @return const KernelTable* Null if the build has no SSE2 kernels
+ */
+auto GetSse2KernelTable() -> const KernelTable*;
+/**
+ * @brief Get the AVX2 kernels
+ * @return const KernelTable* Null if the build has no AVX2 kernels
+ */
+auto GetAvx2KernelTable() -> const KernelTable*;
+/**
+ * @brief Get the AVX-512 kernels
+ * @return const KernelTable* Null if the build has no AVX-512 kernels
+ */
+auto GetAvx512KernelTable() -> const KernelTable*;
+}  // namespace programmers::geometry::kernels
+
+#endif
@@ -0,0 +1,529 @@
+/**
+ * @file geometry/kernels/kernels.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Scalar reference kernels and runtime instruction set dispatch
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "curve_bits.hpp"
+#include "kernel_table.hpp"
+#include "rounding.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace {
+using programmers::geometry::kernels::Isa;
+using programmers::geometry::kernels::KernelTable;
+using programmers::geometry::Rounding;
+using programmers::geometry::kernels::kMaskBits;
+
+auto CalculateDistances(const double* xs, const double* ys, std::size_t count,
+                        double target_x, double target_y, double* output)
+    -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto dx{xs[i] - target_x};
+    const auto dy{ys[i] - target_y};
+    output[i] = std::sqrt(dx * dx + dy * dy);
+  }
+}
+
+auto CalculateSquaredDistances(const double* xs, const double* ys,
+                               std::size_t count, double target_x,
+                               double target_y, double* output) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto dx{xs[i] - target_x};
+    const auto dy{ys[i] - target_y};
+    output[i] = dx * dx + dy * dy;
+  }
+}
+
+auto CalculatePairwiseDistances(const double* lhs_xs, const double* lhs_ys,
+                                const double* rhs_xs, const double* rhs_ys,
+                                std::size_t count, double* output) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto dx{lhs_xs[i] - rhs_xs[i]};
+    const auto dy{lhs_ys[i] - rhs_ys[i]};
+    output[i] = std::sqrt(dx * dx + dy * dy);
+  }
+}
+
+auto CalculateDistances3D(const double* xs, const double* ys,
+                          const double* zs, std::size_t count,
+                          const double* target, double* output) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto dx{xs[i] - target[0]};
+    const auto dy{ys[i] - target[1]};
+    const auto dz{zs[i] - target[2]};
+    output[i] = std::sqrt(dx * dx + dy * dy + dz * dz);
+  }
+}
+
+auto Add(const double* lhs_xs, const double* lhs_ys, const double* rhs_xs,
+         const double* rhs_ys, std::size_t count, double* output_xs,
+         double* output_ys) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    output_xs[i] = lhs_xs[i] + rhs_xs[i];
+    output_ys[i] = lhs_ys[i] + rhs_ys[i];
+  }
+}
+
+auto Subtract(const double* lhs_xs, const double* lhs_ys,
+              const double* rhs_xs, const double* rhs_ys, std::size_t count,
+              double* output_xs, double* output_ys) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    output_xs[i] = lhs_xs[i] - rhs_xs[i];
+    output_ys[i] = lhs_ys[i] - rhs_ys[i];
+  }
+}
+
+auto Scale(const double* xs, const double* ys, std::size_t count,
+           double scalar, double* output_xs, double* output_ys) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    output_xs[i] = xs[i] * scalar;
+    output_ys[i] = ys[i] * scalar;
+  }
+}
+
+auto Translate(const double* xs, const double* ys, std::size_t count,
+               double offset_x, double offset_y, double* output_xs,
+               double* output_ys) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    output_xs[i] = xs[i] + offset_x;
+    output_ys[i] = ys[i] + offset_y;
+  }
+}
+
+auto Transform(const double* xs, const double* ys, std::size_t count,
+               const double* matrix, double* output_xs, double* output_ys)
+    -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto x{xs[i]};
+    const auto y{ys[i]};
+    output_xs[i] = matrix[0] * x + matrix[1] * y + matrix[2];
+    output_ys[i] = matrix[3] * x + matrix[4] * y + matrix[5];
+  }
+}
+
+auto EncodeMorton(const uint32_t* xs, const uint32_t* ys, std::size_t count,
+                  uint64_t* output) -> void {
+  using programmers::geometry::kernels::SpreadBits;
+  for (std::size_t i = 0; i < count; ++i) {
+    output[i] = (SpreadBits(ys[i]) << 1U) | SpreadBits(xs[i]);
+  }
+}
+
+auto EncodeHilbert(const uint32_t* xs, const uint32_t* ys, std::size_t count,
+                   uint64_t* output) -> void {
+  using programmers::geometry::kernels::SpreadBits;
+  using programmers::geometry::kernels::TransformHilbert;
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto [high, low]{TransformHilbert(xs[i], ys[i])};
+    output[i] = (SpreadBits(high) << 1U) | SpreadBits(low);
+  }
+}
+
+auto ConvertToDouble(const int64_t* values, std::size_t count, double scale,
+                     double* output) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    output[i] = static_cast<double>(values[i]) * scale;
+  }
+}
+
+auto ConvertToInt64(const double* values, std::size_t count, double scale,
+                    Rounding rounding, int64_t* output) -> bool {
+  using programmers::geometry::kernels::RoundToInt64;
+  bool is_number{true};
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto value{values[i] * scale};
+    is_number = is_number && !std::isnan(value);
+    output[i] = RoundToInt64(value, rounding);
+  }
+  return is_number;
+}
+
+auto CalculateBounds(const double* xs, const double* ys, std::size_t count,
+                     double* output) -> void {
+  // std::min and std::max keep the first argument when the second is NaN.
+  auto min_x{std::numeric_limits<double>::infinity()};
+  auto min_y{min_x};
+  auto max_x{-min_x};
+  auto max_y{-min_x};
+  for (std::size_t i = 0; i < count; ++i) {
+    min_x = std::min(min_x, xs[i]);
+    min_y = std::min(min_y, ys[i]);
+    max_x = std::max(max_x, xs[i]);
+    max_y = std::max(max_y, ys[i]);
+  }
+  output[0] = min_x;
+  output[1] = min_y;
+  output[2] = max_x;
+  output[3] = max_y;
+}
+
+auto FilterWithinBox(const double* xs, const double* ys, std::size_t count,
+                     const double* box, uint64_t* output) -> void {
+  for (std::size_t word = 0; word * kMaskBits < count; ++word) {
+    const auto begin{word * kMaskBits};
+    const auto end{std::min(count, begin + kMaskBits)};
+    uint64_t bits{0U};
+    for (auto i = begin; i < end; ++i) {
+      const bool inside{box[0] <= xs[i] && xs[i] <= box[2] &&
+                        box[1] <= ys[i] && ys[i] <= box[3]};
+      bits |= static_cast<uint64_t>(inside) << (i - begin);
+    }
+    output[word] = bits;
+  }
+}
+
+auto FilterIntersectingBoxes(const double* min_xs, const double* min_ys,
+                             const double* max_xs, const double* max_ys,
+                             std::size_t count, const double* box,
+                             uint64_t* output) -> void {
+  for (std::size_t word = 0; word * kMaskBits < count; ++word) {
+    const auto begin{word * kMaskBits};
+    const auto end{std::min(count, begin + kMaskBits)};
+    uint64_t bits{0U};
+    for (auto i = begin; i < end; ++i) {
+      const bool overlaps{min_xs[i] <= box[2] && box[0] <= max_xs[i] &&
+                          min_ys[i] <= box[3] && box[1] <= max_ys[i]};
+      bits |= static_cast<uint64_t>(overlaps) << (i - begin);
+    }
+    output[word] = bits;
+  }
+}
+
+constexpr KernelTable kScalarKernelTable{Isa::kScalar,
+                                        CalculateDistances,
+                                        CalculateSquaredDistances,
+                                        CalculatePairwiseDistances,
+                                        CalculateDistances3D,
+                                        Add,
+                                        Subtract,
+                                        Scale,
+                                        Translate,
+                                        Transform,
+                                        EncodeMorton,
+                                        EncodeHilbert,
+                                        ConvertToDouble,
+                                        ConvertToInt64,
+                                        CalculateBounds,
+                                        FilterWithinBox,
+                                        FilterIntersectingBoxes};
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || \
+    defined(__i386__)
+/**
+ * @brief Execute CPUID, returning eax, ebx, ecx and edx
+ */
+auto QueryCpuid(uint32_t leaf, uint32_t subleaf) -> std::array<uint32_t, 4> {
+  std::array<uint32_t, 4> registers{};
+#if defined(_MSC_VER)
+  std::array<int, 4> values{};
+  __cpuidex(values.data(), static_cast<int>(leaf), static_cast<int>(subleaf));
+  std::memcpy(registers.data(), values.data(), sizeof(values));
+#else
+  __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2],
+                registers[3]);
+#endif
+  return registers;
+}
+
+/**
+ * @brief Read the register state components enabled by the OS
+ */
+auto ReadXcr0() -> uint64_t {
+#if defined(_MSC_VER)
+  return static_cast<uint64_t>(_xgetbv(0));
+#else
+  uint32_t low{0U};
+  uint32_t high{0U};
+  __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0U));
+  return (static_cast<uint64_t>(high) << 32U) | low;
+#endif
+}
+#endif
+
+/**
+ * @brief Query the best instruction set the host CPU and OS can run
+ */
+auto DetectHostIsa() -> Isa {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || \
+    defined(__i386__)
+  constexpr uint32_t kSse2Bit{1U << 26U};      // leaf 1 edx
+  constexpr uint32_t kFmaBit{1U << 12U};       // leaf 1 ecx
+  constexpr uint32_t kOsxsaveBit{1U << 27U};   // leaf 1 ecx
+  constexpr uint32_t kAvxBit{1U << 28U};       // leaf 1 ecx
+  constexpr uint32_t kAvx2Bit{1U << 5U};       // leaf 7 ebx
+  constexpr uint32_t kBmi2Bit{1U << 8U};       // leaf 7 ebx
+  constexpr uint32_t kAvx512fBit{1U << 16U};   // leaf 7 ebx
+  constexpr uint32_t kAvx512dqBit{1U << 17U};  // leaf 7 ebx
+  constexpr uint64_t kYmmState{0x06U};         // XMM and YMM
+  constexpr uint64_t kZmmState{0xE6U};         // and opmask, ZMM
+
+  const auto max_leaf{QueryCpuid(0U, 0U)[0]};
+  if (max_leaf < 1U) {
+    return Isa::kScalar;
+  }
+  const auto leaf1{QueryCpuid(1U, 0U)};
+  if ((leaf1[3] & kSse2Bit) == 0U) {
+    return Isa::kScalar;
+  }
+  if ((leaf1[2] & kOsxsaveBit) == 0U || max_leaf < 7U) {
+    return Isa::kSse2;
+  }
+  const auto xcr0{ReadXcr0()};
+  const auto leaf7{QueryCpuid(7U, 0U)};
+  const bool has_avx2{(xcr0 & kYmmState) == kYmmState &&
+                      (leaf1[2] & kAvxBit) != 0U &&
+                      (leaf1[2] & kFmaBit) != 0U &&
+                      (leaf7[1] & kAvx2Bit) != 0U &&
+                      (leaf7[1] & kBmi2Bit) != 0U};
+  if (!has_avx2) {
+    return Isa::kSse2;
+  }
+  const bool has_avx512{(xcr0 & kZmmState) == kZmmState &&
+                        (leaf7[1] & kAvx512fBit) != 0U &&
+                        (leaf7[1] & kAvx512dqBit) != 0U};
+  return has_avx512 ? Isa::kAvx512 : Isa::kAvx2;
+#else
+  return Isa::kScalar;
+#endif
+}
+
+/**
+ * @brief Get the kernels of instruction set, null if not in the build
+ */
+auto GetKernelTable(Isa isa) -> const KernelTable* {
+  switch (isa) {
+    case Isa::kAvx512:
+      return programmers::geometry::kernels::GetAvx512KernelTable();
+    case Isa::kAvx2:
+      return programmers::geometry::kernels::GetAvx2KernelTable();
+    case Isa::kSse2:
+      return programmers::geometry::kernels::GetSse2KernelTable();
+    case Isa::kScalar:
+    default:
+      return &kScalarKernelTable;
+  }
+}
+
+/**
+ * @brief Get the best kernels not above isa that the host can run
+ */
+auto SelectKernelTable(Isa isa) -> const KernelTable* {
+  static const auto kHostIsa{DetectHostIsa()};
+  auto level{std::min(static_cast<int>(isa), static_cast<int>(kHostIsa))};
+  for (; level > 0; --level) {
+    const auto* table{GetKernelTable(static_cast<Isa>(level))};
+    if (table != nullptr) {
+      return table;
+    }
+  }
+  return &kScalarKernelTable;
+}
+
+/**
+ * @brief Select the startup kernels, honouring GEOMETRY_KERNEL_ISA
+ * @throw std::invalid_argument If GEOMETRY_KERNEL_ISA names no instruction
+ * set, ignoring case
+ */
+auto SelectDefaultKernelTable() -> const KernelTable* {
+  const char* requested{std::getenv("GEOMETRY_KERNEL_ISA")};
+  if (requested == nullptr) {
+    return SelectKernelTable(Isa::kAvx512);
+  }
+  std::string name{requested};
+  std::transform(name.begin(), name.end(), name.begin(), [](char letter) {
+    return static_cast<char>(
+        std::tolower(static_cast<unsigned char>(letter)));
+  });
+  for (const auto candidate :
+       {Isa::kScalar, Isa::kSse2, Isa::kAvx2, Isa::kAvx512}) {
+    if (name == programmers::geometry::kernels::GetIsaName(candidate)) {
+      return SelectKernelTable(candidate);
+    }
+  }
+  throw std::invalid_argument(
+      "GEOMETRY_KERNEL_ISA must be scalar, sse2, avx2 or avx512, not " +
+      std::string(requested));
+}
+
+auto GetDefaultKernelTable() -> const KernelTable* {
+  static const auto* kDefaultKernelTable{SelectDefaultKernelTable()};
+  return kDefaultKernelTable;
+}
+
+std::atomic<const KernelTable*> active_kernel_table{nullptr};
+
+auto GetActiveKernelTable() -> const KernelTable* {
+  const auto* table{active_kernel_table.load(std::memory_order_acquire)};
+  if (table == nullptr) {
+    // A SetActiveIsa racing with the first call wins; table is then what
+    // it installed.
+    const auto* default_table{GetDefaultKernelTable()};
+    table = nullptr;
+    if (active_kernel_table.compare_exchange_strong(
+            table, default_table, std::memory_order_acq_rel,
+            std::memory_order_acquire)) {
+      table = default_table;
+    }
+  }
+  return table;
+}
+}  // namespace
+
+namespace programmers::geometry::kernels {
+auto GetScalarKernelTable() -> const KernelTable* {
+  return &kScalarKernelTable;
+}
+
+auto GetSupportedIsa() -> Isa { return SelectKernelTable(Isa::kAvx512)->isa; }
+
+auto GetActiveIsa() -> Isa { return GetActiveKernelTable()->isa; }
+
+auto SetActiveIsa(Isa isa) -> Isa {
+  const auto* table{SelectKernelTable(isa)};
+  active_kernel_table.store(table, std::memory_order_release);
+  return table->isa;
+}
+
+auto ResetActiveIsa() -> void {
+  active_kernel_table.store(GetDefaultKernelTable(),
+                            std::memory_order_release);
+}
+
+auto GetIsaName(Isa isa) -> const char* {
+  switch (isa) {
+    case Isa::kSse2:
+      return "sse2";
+    case Isa::kAvx2:
+      return "avx2";
+    case Isa::kAvx512:
+      return "avx512";
+    case Isa::kScalar:
+    default:
+      return "scalar";
+  }
+}
+
+auto CalculateDistances(const double* xs, const double* ys, std::size_t count,
+                        double target_x, double target_y, double* output)
+    -> void {
+  GetActiveKernelTable()->calculate_distances(xs, ys, count, target_x,
+                                              target_y, output);
+}
+
+auto CalculateSquaredDistances(const double* xs, const double* ys,
+                               std::size_t count, double target_x,
+                               double target_y, double* output) -> void {
+  GetActiveKernelTable()->calculate_squared_distances(xs, ys, count, target_x,
+                                                      target_y, output);
+}
+
+auto CalculatePairwiseDistances(const double* lhs_xs, const double* lhs_ys,
+                                const double* rhs_xs, const double* rhs_ys,
+                                std::size_t count, double* output) -> void {
+  GetActiveKernelTable()->calculate_pairwise_distances(lhs_xs, lhs_ys, rhs_xs,
+                                                       rhs_ys, count, output);
+}
+
+auto CalculateDistances3D(const double* xs, const double* ys,
+                          const double* zs, std::size_t count,
+                          const double* target, double* output) -> void {
+  GetActiveKernelTable()->calculate_distances3d(xs, ys, zs, count, target,
+                                                output);
+}
+
+auto Add(const double* lhs_xs, const double* lhs_ys, const double* rhs_xs,
+         const double* rhs_ys, std::size_t count, double* output_xs,
+         double* output_ys) -> void {
+  GetActiveKernelTable()->add(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count, output_xs,
+                              output_ys);
+}
+
+auto Subtract(const double* lhs_xs, const double* lhs_ys, const double* rhs_xs,
+              const double* rhs_ys, std::size_t count, double* output_xs,
+              double* output_ys) -> void {
+  GetActiveKernelTable()->subtract(lhs_xs, lhs_ys, rhs_xs, rhs_ys, count,
+                                   output_xs, output_ys);
+}
+
+auto Scale(const double* xs, const double* ys, std::size_t count,
+           double scalar, double* output_xs, double* output_ys) -> void {
+  GetActiveKernelTable()->scale(xs, ys, count, scalar, output_xs, output_ys);
+}
+
+auto Translate(const double* xs, const double* ys, std::size_t count,
+               double offset_x, double offset_y, double* output_xs,
+               double* output_ys) -> void {
+  GetActiveKernelTable()->translate(xs, ys, count, offset_x, offset_y,
+                                    output_xs, output_ys);
+}
+
+auto Transform(const double* xs, const double* ys, std::size_t count,
+               const double* matrix, double* output_xs, double* output_ys)
+    -> void {
+  GetActiveKernelTable()->transform(xs, ys, count, matrix, output_xs,
+                                    output_ys);
+}
+
+auto EncodeMorton(const uint32_t* xs, const uint32_t* ys, std::size_t count,
+                  uint64_t* output) -> void {
+  GetActiveKernelTable()->encode_morton(xs, ys, count, output);
+}
+
+auto EncodeHilbert(const uint32_t* xs, const uint32_t* ys, std::size_t count,
+                   uint64_t* output) -> void {
+  GetActiveKernelTable()->encode_hilbert(xs, ys, count, output);
+}
+
+auto ConvertToDouble(const int64_t* values, std::size_t count, double scale,
+                     double* output) -> void {
+  GetActiveKernelTable()->convert_to_double(values, count, scale, output);
+}
+
+auto ConvertToInt64(const double* values, std::size_t count, double scale,
+                    Rounding rounding, int64_t* output) -> bool {
+  return GetActiveKernelTable()->convert_to_int64(values, count, scale,
+                                                  rounding, output);
+}
+
+auto CalculateBounds(const double* xs, const double* ys, std::size_t count,
+                     double* output) -> void {
+  GetActiveKernelTable()->calculate_bounds(xs, ys, count, output);
+}
+
+auto FilterWithinBox(const double* xs, const double* ys, std::size_t count,
+                     const double* box, uint64_t* output) -> void {
+  GetActiveKernelTable()->filter_within_box(xs, ys, count, box, output);
+}
+
+auto FilterIntersectingBoxes(const double* min_xs, const double* min_ys,
+                             const double* max_xs, const double* max_ys,
+                             std::size_t count, const double* box,
+                             uint64_t* output) -> void {
+  GetActiveKernelTable()->filter_intersecting_boxes(
+      min_xs, min_ys, max_xs, max_ys, count, box, output);
+}
+}  // namespace programmers::geometry::kernels
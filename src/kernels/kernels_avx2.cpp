@@ -0,0 +1,445 @@
+/**
+ * @file geometry/kernels/kernels_avx2.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Batch kernels with AVX2 instructions
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "kernel_table.hpp"
+
+#if defined(__AVX2__) && (defined(__BMI2__) || defined(_MSC_VER))
+#define PROGRAMMERS_GEOMETRY_KERNELS_AVX2
+#include <immintrin.h>
+
+#include <limits>
+
+#include "curve_bits.hpp"
+#include "rounding.hpp"
+#endif
+
+namespace {
+#if defined(PROGRAMMERS_GEOMETRY_KERNELS_AVX2)
+using programmers::geometry::kernels::GetScalarKernelTable;
+using programmers::geometry::kernels::Isa;
+using programmers::geometry::kernels::KernelTable;
+using programmers::geometry::Rounding;
+
+constexpr std::size_t kLanes{4U};
+constexpr double kInfinity{std::numeric_limits<double>::infinity()};
+using programmers::geometry::kernels::kMaskBits;
+
+/**
+ * @brief Smallest lane, no lane NaN
+ */
+inline auto ReduceMin(__m256d values) -> double {
+  const auto half{_mm_min_pd(_mm256_castpd256_pd128(values),
+                             _mm256_extractf128_pd(values, 1))};
+  return _mm_cvtsd_f64(_mm_min_pd(half, _mm_unpackhi_pd(half, half)));
+}
+
+/**
+ * @brief Largest lane, no lane NaN
+ */
+inline auto ReduceMax(__m256d values) -> double {
+  const auto half{_mm_max_pd(_mm256_castpd256_pd128(values),
+                             _mm256_extractf128_pd(values, 1))};
+  return _mm_cvtsd_f64(_mm_max_pd(half, _mm_unpackhi_pd(half, half)));
+}
+
+auto CalculateDistances(const double* xs, const double* ys, std::size_t count,
+                        double target_x, double target_y, double* output)
+    -> void {
+  const auto tx{_mm256_set1_pd(target_x)};
+  const auto ty{_mm256_set1_pd(target_y)};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto dx{_mm256_sub_pd(_mm256_loadu_pd(xs + i), tx)};
+    const auto dy{_mm256_sub_pd(_mm256_loadu_pd(ys + i), ty)};
+    const auto squared{
+        _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy))};
+    _mm256_storeu_pd(output + i, _mm256_sqrt_pd(squared));
+  }
+  GetScalarKernelTable()->calculate_distances(xs + i, ys + i, count - i,
+                                              target_x, target_y, output + i);
+}
+
+auto CalculateSquaredDistances(const double* xs, const double* ys,
+                               std::size_t count, double target_x,
+                               double target_y, double* output) -> void {
+  const auto tx{_mm256_set1_pd(target_x)};
+  const auto ty{_mm256_set1_pd(target_y)};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto dx{_mm256_sub_pd(_mm256_loadu_pd(xs + i), tx)};
+    const auto dy{_mm256_sub_pd(_mm256_loadu_pd(ys + i), ty)};
+    _mm256_storeu_pd(output + i, _mm256_add_pd(_mm256_mul_pd(dx, dx),
+                                               _mm256_mul_pd(dy, dy)));
+  }
+  GetScalarKernelTable()->calculate_squared_distances(
+      xs + i, ys + i, count - i, target_x, target_y, output + i);
+}
+
+auto CalculatePairwiseDistances(const double* lhs_xs, const double* lhs_ys,
+                                const double* rhs_xs, const double* rhs_ys,
+                                std::size_t count, double* output) -> void {
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto dx{_mm256_sub_pd(_mm256_loadu_pd(lhs_xs + i),
+                                _mm256_loadu_pd(rhs_xs + i))};
+    const auto dy{_mm256_sub_pd(_mm256_loadu_pd(lhs_ys + i),
+                                _mm256_loadu_pd(rhs_ys + i))};
+    const auto squared{
+        _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy))};
+    _mm256_storeu_pd(output + i, _mm256_sqrt_pd(squared));
+  }
+  GetScalarKernelTable()->calculate_pairwise_distances(
+      lhs_xs + i, lhs_ys + i, rhs_xs + i, rhs_ys + i, count - i, output + i);
+}
+
+auto CalculateDistances3D(const double* xs, const double* ys,
+                          const double* zs, std::size_t count,
+                          const double* target, double* output) -> void {
+  const auto tx{_mm256_set1_pd(target[0])};
+  const auto ty{_mm256_set1_pd(target[1])};
+  const auto tz{_mm256_set1_pd(target[2])};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto dx{_mm256_sub_pd(_mm256_loadu_pd(xs + i), tx)};
+    const auto dy{_mm256_sub_pd(_mm256_loadu_pd(ys + i), ty)};
+    const auto dz{_mm256_sub_pd(_mm256_loadu_pd(zs + i), tz)};
+    const auto squared{_mm256_add_pd(
+        _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)),
+        _mm256_mul_pd(dz, dz))};
+    _mm256_storeu_pd(output + i, _mm256_sqrt_pd(squared));
+  }
+  GetScalarKernelTable()->calculate_distances3d(
+      xs + i, ys + i, zs + i, count - i, target, output + i);
+}
+
+auto Add(const double* lhs_xs, const double* lhs_ys, const double* rhs_xs,
+         const double* rhs_ys, std::size_t count, double* output_xs,
+         double* output_ys) -> void {
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    _mm256_storeu_pd(output_xs + i,
+                     _mm256_add_pd(_mm256_loadu_pd(lhs_xs + i),
+                                   _mm256_loadu_pd(rhs_xs + i)));
+    _mm256_storeu_pd(output_ys + i,
+                     _mm256_add_pd(_mm256_loadu_pd(lhs_ys + i),
+                                   _mm256_loadu_pd(rhs_ys + i)));
+  }
+  GetScalarKernelTable()->add(lhs_xs + i, lhs_ys + i, rhs_xs + i, rhs_ys + i,
+                              count - i, output_xs + i, output_ys + i);
+}
+
+auto Subtract(const double* lhs_xs, const double* lhs_ys,
+              const double* rhs_xs, const double* rhs_ys, std::size_t count,
+              double* output_xs, double* output_ys) -> void {
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    _mm256_storeu_pd(output_xs + i,
+                     _mm256_sub_pd(_mm256_loadu_pd(lhs_xs + i),
+                                   _mm256_loadu_pd(rhs_xs + i)));
+    _mm256_storeu_pd(output_ys + i,
+                     _mm256_sub_pd(_mm256_loadu_pd(lhs_ys + i),
+                                   _mm256_loadu_pd(rhs_ys + i)));
+  }
+  GetScalarKernelTable()->subtract(lhs_xs + i, lhs_ys + i, rhs_xs + i,
+                                   rhs_ys + i, count - i, output_xs + i,
+                                   output_ys + i);
+}
+
+auto Scale(const double* xs, const double* ys, std::size_t count,
+           double scalar, double* output_xs, double* output_ys) -> void {
+  const auto factor{_mm256_set1_pd(scalar)};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    _mm256_storeu_pd(output_xs + i,
+                     _mm256_mul_pd(_mm256_loadu_pd(xs + i), factor));
+    _mm256_storeu_pd(output_ys + i,
+                     _mm256_mul_pd(_mm256_loadu_pd(ys + i), factor));
+  }
+  GetScalarKernelTable()->scale(xs + i, ys + i, count - i, scalar,
+                                output_xs + i, output_ys + i);
+}
+
+auto Translate(const double* xs, const double* ys, std::size_t count,
+               double offset_x, double offset_y, double* output_xs,
+               double* output_ys) -> void {
+  const auto ox{_mm256_set1_pd(offset_x)};
+  const auto oy{_mm256_set1_pd(offset_y)};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    _mm256_storeu_pd(output_xs + i,
+                     _mm256_add_pd(_mm256_loadu_pd(xs + i), ox));
+    _mm256_storeu_pd(output_ys + i,
+                     _mm256_add_pd(_mm256_loadu_pd(ys + i), oy));
+  }
+  GetScalarKernelTable()->translate(xs + i, ys + i, count - i, offset_x,
+                                    offset_y, output_xs + i, output_ys + i);
+}
+
+auto Transform(const double* xs, const double* ys, std::size_t count,
+               const double* matrix, double* output_xs, double* output_ys)
+    -> void {
+  const auto m00{_mm256_set1_pd(matrix[0])};
+  const auto m01{_mm256_set1_pd(matrix[1])};
+  const auto m02{_mm256_set1_pd(matrix[2])};
+  const auto m10{_mm256_set1_pd(matrix[3])};
+  const auto m11{_mm256_set1_pd(matrix[4])};
+  const auto m12{_mm256_set1_pd(matrix[5])};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto x{_mm256_loadu_pd(xs + i)};
+    const auto y{_mm256_loadu_pd(ys + i)};
+    _mm256_storeu_pd(output_xs + i,
+                     _mm256_fmadd_pd(m00, x, _mm256_fmadd_pd(m01, y, m02)));
+    _mm256_storeu_pd(output_ys + i,
+                     _mm256_fmadd_pd(m10, x, _mm256_fmadd_pd(m11, y, m12)));
+  }
+  GetScalarKernelTable()->transform(xs + i, ys + i, count - i, matrix,
+                                    output_xs + i, output_ys + i);
+}
+
+constexpr uint64_t kEvenBits{0x5555555555555555ULL};
+constexpr uint64_t kOddBits{0xAAAAAAAAAAAAAAAAULL};
+
+auto EncodeMorton(const uint32_t* xs, const uint32_t* ys, std::size_t count,
+                  uint64_t* output) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    output[i] = _pdep_u64(xs[i], kEvenBits) | _pdep_u64(ys[i], kOddBits);
+  }
+}
+
+auto EncodeHilbert(const uint32_t* xs, const uint32_t* ys, std::size_t count,
+                   uint64_t* output) -> void {
+  using programmers::geometry::kernels::TransformHilbert;
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto [high, low]{TransformHilbert(xs[i], ys[i])};
+    output[i] = _pdep_u64(low, kEvenBits) | _pdep_u64(high, kOddBits);
+  }
+}
+
+/**
+ * @brief Convert every int64_t lane to the nearest double
+ * @details AVX2 has no such conversion. The upper 32 bits go through the
+ * exponent of 2^84 + 2^63 and the lower 32 bits through the exponent of
+ * 2^52, so the only rounding is in the final addition.
+ */
+inline auto ConvertInt64ToDouble(__m256i values) -> __m256d {
+  const auto low{_mm256_blend_epi32(
+      _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.0)), values, 0x55)};
+  const auto high{_mm256_xor_si256(_mm256_srli_epi64(values, 32),
+                                    _mm256_set1_epi64x(0x4530000080000000LL))};
+  const auto high_value{_mm256_sub_pd(
+      _mm256_castsi256_pd(high),
+      _mm256_set1_pd(19342822341709703277445120.0))};  // 2^84 + 2^63 + 2^52
+  return _mm256_add_pd(high_value, _mm256_castsi256_pd(low));
+}
+
+/**
+ * @brief Convert every integral double lane in [-2^63, 2^63) to int64_t
+ * @details The value is split into a signed upper half and an unsigned lower
+ * half, both exact, converted separately and joined.
+ */
+inline auto ConvertIntegralToInt64(__m256d values) -> __m256i {
+  const auto two_to_32{_mm256_set1_pd(4294967296.0)};
+  const auto high{_mm256_floor_pd(
+      _mm256_mul_pd(values, _mm256_set1_pd(1.0 / 4294967296.0)))};
+  const auto low{_mm256_sub_pd(values, _mm256_mul_pd(high, two_to_32))};
+  const auto high_bits{
+      _mm256_slli_epi64(_mm256_cvtepi32_epi64(_mm256_cvttpd_epi32(high)), 32)};
+  const auto low_bits{_mm256_and_si256(
+      _mm256_castpd_si256(
+          _mm256_add_pd(low, _mm256_set1_pd(4503599627370496.0))),
+      _mm256_set1_epi64x(0xFFFFFFFFLL))};
+  return _mm256_add_epi64(high_bits, low_bits);
+}
+
+/**
+ * @brief Round every lane to an integer
+ */
+inline auto RoundLanes(__m256d values, Rounding rounding) -> __m256d {
+  switch (rounding) {
+    case Rounding::kDown:
+      return _mm256_round_pd(values, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    case Rounding::kUp:
+      return _mm256_round_pd(values, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+    case Rounding::kNearestEven:
+      return _mm256_round_pd(values,
+                             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    case Rounding::kNearest: {
+      // Truncate, then step away from zero when the fraction is at least
+      // one half. Both steps are exact.
+      const auto truncated{
+          _mm256_round_pd(values, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)};
+      const auto sign{_mm256_and_pd(values, _mm256_set1_pd(-0.0))};
+      const auto fraction{
+          _mm256_andnot_pd(sign, _mm256_sub_pd(values, truncated))};
+      const auto away{
+          _mm256_cmp_pd(fraction, _mm256_set1_pd(0.5), _CMP_GE_OQ)};
+      return _mm256_add_pd(
+          truncated,
+          _mm256_and_pd(away, _mm256_or_pd(sign, _mm256_set1_pd(1.0))));
+    }
+    case Rounding::kTowardZero:
+    default:
+      return _mm256_round_pd(values, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+  }
+}
+
+auto ConvertToDouble(const int64_t* values, std::size_t count, double scale,
+                     double* output) -> void {
+  const auto factor{_mm256_set1_pd(scale)};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto integers{_mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(values + i))};
+    _mm256_storeu_pd(output + i,
+                     _mm256_mul_pd(ConvertInt64ToDouble(integers), factor));
+  }
+  GetScalarKernelTable()->convert_to_double(values + i, count - i, scale,
+                                            output + i);
+}
+
+auto ConvertToInt64(const double* values, std::size_t count, double scale,
+                    Rounding rounding, int64_t* output) -> bool {
+  using programmers::geometry::kernels::kInt64Limit;
+  const auto factor{_mm256_set1_pd(scale)};
+  const auto lowest{_mm256_set1_pd(-kInt64Limit)};
+  const auto limit{_mm256_set1_pd(kInt64Limit)};
+  const auto maximum{_mm256_set1_epi64x(INT64_MAX)};
+  auto not_number{_mm256_setzero_pd()};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto scaled{_mm256_mul_pd(_mm256_loadu_pd(values + i), factor)};
+    const auto invalid{_mm256_cmp_pd(scaled, scaled, _CMP_UNORD_Q)};
+    not_number = _mm256_or_pd(not_number, invalid);
+    const auto rounded{RoundLanes(scaled, rounding)};
+    const auto too_large{_mm256_cmp_pd(rounded, limit, _CMP_GE_OQ)};
+    // Clamp into the range so the split conversion stays exact, not a
+    // number becomes 0 and values above the range are patched afterwards.
+    const auto clamped{_mm256_andnot_pd(
+        _mm256_or_pd(invalid, too_large), _mm256_max_pd(rounded, lowest))};
+    const auto integers{_mm256_blendv_epi8(
+        ConvertIntegralToInt64(clamped), maximum,
+        _mm256_castpd_si256(too_large))};
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), integers);
+  }
+  const auto tail_is_number{GetScalarKernelTable()->convert_to_int64(
+      values + i, count - i, scale, rounding, output + i)};
+  return tail_is_number && _mm256_movemask_pd(not_number) == 0;
+}
+
+auto CalculateBounds(const double* xs, const double* ys, std::size_t count,
+                     double* output) -> void {
+  auto min_x{_mm256_set1_pd(kInfinity)};
+  auto min_y{min_x};
+  auto max_x{_mm256_set1_pd(-kInfinity)};
+  auto max_y{max_x};
+  std::size_t i{0U};
+  // The second operand is returned for NaN, so NaN lanes are skipped.
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto x{_mm256_loadu_pd(xs + i)};
+    const auto y{_mm256_loadu_pd(ys + i)};
+    min_x = _mm256_min_pd(x, min_x);
+    min_y = _mm256_min_pd(y, min_y);
+    max_x = _mm256_max_pd(x, max_x);
+    max_y = _mm256_max_pd(y, max_y);
+  }
+  GetScalarKernelTable()->calculate_bounds(xs + i, ys + i, count - i, output);
+  output[0] = ReduceMin(_mm256_min_pd(_mm256_set1_pd(output[0]), min_x));
+  output[1] = ReduceMin(_mm256_min_pd(_mm256_set1_pd(output[1]), min_y));
+  output[2] = ReduceMax(_mm256_max_pd(_mm256_set1_pd(output[2]), max_x));
+  output[3] = ReduceMax(_mm256_max_pd(_mm256_set1_pd(output[3]), max_y));
+}
+
+auto FilterWithinBox(const double* xs, const double* ys, std::size_t count,
+                     const double* box, uint64_t* output) -> void {
+  const auto min_x{_mm256_set1_pd(box[0])};
+  const auto min_y{_mm256_set1_pd(box[1])};
+  const auto max_x{_mm256_set1_pd(box[2])};
+  const auto max_y{_mm256_set1_pd(box[3])};
+  std::size_t i{0U};
+  for (; i + kMaskBits <= count; i += kMaskBits) {
+    uint64_t bits{0U};
+    for (std::size_t lane = 0; lane < kMaskBits; lane += kLanes) {
+      const auto x{_mm256_loadu_pd(xs + i + lane)};
+      const auto y{_mm256_loadu_pd(ys + i + lane)};
+      const auto inside{_mm256_and_pd(
+          _mm256_and_pd(_mm256_cmp_pd(min_x, x, _CMP_LE_OQ),
+                        _mm256_cmp_pd(x, max_x, _CMP_LE_OQ)),
+          _mm256_and_pd(_mm256_cmp_pd(min_y, y, _CMP_LE_OQ),
+                        _mm256_cmp_pd(y, max_y, _CMP_LE_OQ)))};
+      bits |= static_cast<uint64_t>(_mm256_movemask_pd(inside)) << lane;
+    }
+    output[i / kMaskBits] = bits;
+  }
+  GetScalarKernelTable()->filter_within_box(xs + i, ys + i, count - i, box,
+                                            output + i / kMaskBits);
+}
+
+auto FilterIntersectingBoxes(const double* min_xs, const double* min_ys,
+                             const double* max_xs, const double* max_ys,
+                             std::size_t count, const double* box,
+                             uint64_t* output) -> void {
+  const auto min_x{_mm256_set1_pd(box[0])};
+  const auto min_y{_mm256_set1_pd(box[1])};
+  const auto max_x{_mm256_set1_pd(box[2])};
+  const auto max_y{_mm256_set1_pd(box[3])};
+  std::size_t i{0U};
+  for (; i + kMaskBits <= count; i += kMaskBits) {
+    uint64_t bits{0U};
+    for (std::size_t lane = 0; lane < kMaskBits; lane += kLanes) {
+      const auto j{i + lane};
+      const auto overlaps{_mm256_and_pd(
+          _mm256_and_pd(
+              _mm256_cmp_pd(_mm256_loadu_pd(min_xs + j), max_x, _CMP_LE_OQ),
+              _mm256_cmp_pd(min_x, _mm256_loadu_pd(max_xs + j), _CMP_LE_OQ)),
+          _mm256_and_pd(
+              _mm256_cmp_pd(_mm256_loadu_pd(min_ys + j), max_y, _CMP_LE_OQ),
+              _mm256_cmp_pd(min_y, _mm256_loadu_pd(max_ys + j),
+                            _CMP_LE_OQ)))};
+      bits |= static_cast<uint64_t>(_mm256_movemask_pd(overlaps)) << lane;
+    }
+    output[i / kMaskBits] = bits;
+  }
+  GetScalarKernelTable()->filter_intersecting_boxes(
+      min_xs + i, min_ys + i, max_xs + i, max_ys + i, count - i, box,
+      output + i / kMaskBits);
+}
+
+constexpr KernelTable kAvx2KernelTable{Isa::kAvx2,
+                                       CalculateDistances,
+                                       CalculateSquaredDistances,
+                                       CalculatePairwiseDistances,
+                                       CalculateDistances3D,
+                                       Add,
+                                       Subtract,
+                                       Scale,
+                                       Translate,
+                                       Transform,
+                                       EncodeMorton,
+                                       EncodeHilbert,
+                                       ConvertToDouble,
+                                       ConvertToInt64,
+                                       CalculateBounds,
+                                       FilterWithinBox,
+                                       FilterIntersectingBoxes};
+#endif
+}  // namespace
+
+namespace programmers::geometry::kernels {
+auto GetAvx2KernelTable() -> const KernelTable* {
+#if defined(PROGRAMMERS_GEOMETRY_KERNELS_AVX2)
+  return &kAvx2KernelTable;
+#else
+  return nullptr;
+#endif
+}
+}  // namespace programmers::geometry::kernels
@@ -0,0 +1,415 @@
+/**
+ * @file geometry/kernels/kernels_avx512.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Batch kernels with AVX-512 instructions
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "kernel_table.hpp"
+
+#if defined(__AVX512F__) && defined(__AVX512DQ__) && \
+    (defined(__BMI2__) || defined(_MSC_VER))
+#define PROGRAMMERS_GEOMETRY_KERNELS_AVX512
+#include <immintrin.h>
+
+#include <limits>
+
+#include "curve_bits.hpp"
+#include "rounding.hpp"
+#endif
+
+namespace {
+#if defined(PROGRAMMERS_GEOMETRY_KERNELS_AVX512)
+using programmers::geometry::kernels::Isa;
+using programmers::geometry::kernels::KernelTable;
+using programmers::geometry::Rounding;
+
+constexpr std::size_t kLanes{8U};
+constexpr double kInfinity{std::numeric_limits<double>::infinity()};
+using programmers::geometry::kernels::kMaskBits;
+
+/**
+ * @brief Mask of the lanes from index to count, at most kLanes
+ */
+inline auto MaskRemaining(std::size_t index, std::size_t count) -> __mmask8 {
+  const auto remaining{count - index};
+  return remaining >= kLanes
+             ? static_cast<__mmask8>(0xFFU)
+             : static_cast<__mmask8>((1U << remaining) - 1U);
+}
+
+auto CalculateDistances(const double* xs, const double* ys, std::size_t count,
+                        double target_x, double target_y, double* output)
+    -> void {
+  const auto tx{_mm512_set1_pd(target_x)};
+  const auto ty{_mm512_set1_pd(target_y)};
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    const auto dx{_mm512_sub_pd(_mm512_maskz_loadu_pd(mask, xs + i), tx)};
+    const auto dy{_mm512_sub_pd(_mm512_maskz_loadu_pd(mask, ys + i), ty)};
+    const auto squared{
+        _mm512_add_pd(_mm512_mul_pd(dx, dx), _mm512_mul_pd(dy, dy))};
+    _mm512_mask_storeu_pd(output + i, mask,
+                          _mm512_maskz_sqrt_pd(mask, squared));
+  }
+}
+
+auto CalculateSquaredDistances(const double* xs, const double* ys,
+                               std::size_t count, double target_x,
+                               double target_y, double* output) -> void {
+  const auto tx{_mm512_set1_pd(target_x)};
+  const auto ty{_mm512_set1_pd(target_y)};
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    const auto dx{_mm512_sub_pd(_mm512_maskz_loadu_pd(mask, xs + i), tx)};
+    const auto dy{_mm512_sub_pd(_mm512_maskz_loadu_pd(mask, ys + i), ty)};
+    _mm512_mask_storeu_pd(
+        output + i, mask,
+        _mm512_add_pd(_mm512_mul_pd(dx, dx), _mm512_mul_pd(dy, dy)));
+  }
+}
+
+auto CalculatePairwiseDistances(const double* lhs_xs, const double* lhs_ys,
+                                const double* rhs_xs, const double* rhs_ys,
+                                std::size_t count, double* output) -> void {
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    const auto dx{_mm512_sub_pd(_mm512_maskz_loadu_pd(mask, lhs_xs + i),
+                                _mm512_maskz_loadu_pd(mask, rhs_xs + i))};
+    const auto dy{_mm512_sub_pd(_mm512_maskz_loadu_pd(mask, lhs_ys + i),
+                                _mm512_maskz_loadu_pd(mask, rhs_ys + i))};
+    const auto squared{
+        _mm512_add_pd(_mm512_mul_pd(dx, dx), _mm512_mul_pd(dy, dy))};
+    _mm512_mask_storeu_pd(output + i, mask,
+                          _mm512_maskz_sqrt_pd(mask, squared));
+  }
+}
+
+auto CalculateDistances3D(const double* xs, const double* ys,
+                          const double* zs, std::size_t count,
+                          const double* target, double* output) -> void {
+  const auto tx{_mm512_set1_pd(target[0])};
+  const auto ty{_mm512_set1_pd(target[1])};
+  const auto tz{_mm512_set1_pd(target[2])};
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    const auto dx{_mm512_sub_pd(_mm512_maskz_loadu_pd(mask, xs + i), tx)};
+    const auto dy{_mm512_sub_pd(_mm512_maskz_loadu_pd(mask, ys + i), ty)};
+    const auto dz{_mm512_sub_pd(_mm512_maskz_loadu_pd(mask, zs + i), tz)};
+    const auto squared{_mm512_add_pd(
+        _mm512_add_pd(_mm512_mul_pd(dx, dx), _mm512_mul_pd(dy, dy)),
+        _mm512_mul_pd(dz, dz))};
+    _mm512_mask_storeu_pd(output + i, mask,
+                          _mm512_maskz_sqrt_pd(mask, squared));
+  }
+}
+
+auto Add(const double* lhs_xs, const double* lhs_ys, const double* rhs_xs,
+         const double* rhs_ys, std::size_t count, double* output_xs,
+         double* output_ys) -> void {
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    _mm512_mask_storeu_pd(
+        output_xs + i, mask,
+        _mm512_add_pd(_mm512_maskz_loadu_pd(mask, lhs_xs + i),
+                      _mm512_maskz_loadu_pd(mask, rhs_xs + i)));
+    _mm512_mask_storeu_pd(
+        output_ys + i, mask,
+        _mm512_add_pd(_mm512_maskz_loadu_pd(mask, lhs_ys + i),
+                      _mm512_maskz_loadu_pd(mask, rhs_ys + i)));
+  }
+}
+
+auto Subtract(const double* lhs_xs, const double* lhs_ys,
+              const double* rhs_xs, const double* rhs_ys, std::size_t count,
+              double* output_xs, double* output_ys) -> void {
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    _mm512_mask_storeu_pd(
+        output_xs + i, mask,
+        _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, lhs_xs + i),
+                      _mm512_maskz_loadu_pd(mask, rhs_xs + i)));
+    _mm512_mask_storeu_pd(
+        output_ys + i, mask,
+        _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, lhs_ys + i),
+                      _mm512_maskz_loadu_pd(mask, rhs_ys + i)));
+  }
+}
+
+auto Scale(const double* xs, const double* ys, std::size_t count,
+           double scalar, double* output_xs, double* output_ys) -> void {
+  const auto factor{_mm512_set1_pd(scalar)};
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    _mm512_mask_storeu_pd(
+        output_xs + i, mask,
+        _mm512_mul_pd(_mm512_maskz_loadu_pd(mask, xs + i), factor));
+    _mm512_mask_storeu_pd(
+        output_ys + i, mask,
+        _mm512_mul_pd(_mm512_maskz_loadu_pd(mask, ys + i), factor));
+  }
+}
+
+auto Translate(const double* xs, const double* ys, std::size_t count,
+               double offset_x, double offset_y, double* output_xs,
+               double* output_ys) -> void {
+  const auto ox{_mm512_set1_pd(offset_x)};
+  const auto oy{_mm512_set1_pd(offset_y)};
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    _mm512_mask_storeu_pd(
+        output_xs + i, mask,
+        _mm512_add_pd(_mm512_maskz_loadu_pd(mask, xs + i), ox));
+    _mm512_mask_storeu_pd(
+        output_ys + i, mask,
+        _mm512_add_pd(_mm512_maskz_loadu_pd(mask, ys + i), oy));
+  }
+}
+
+auto Transform(const double* xs, const double* ys, std::size_t count,
+               const double* matrix, double* output_xs, double* output_ys)
+    -> void {
+  const auto m00{_mm512_set1_pd(matrix[0])};
+  const auto m01{_mm512_set1_pd(matrix[1])};
+  const auto m02{_mm512_set1_pd(matrix[2])};
+  const auto m10{_mm512_set1_pd(matrix[3])};
+  const auto m11{_mm512_set1_pd(matrix[4])};
+  const auto m12{_mm512_set1_pd(matrix[5])};
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    const auto x{_mm512_maskz_loadu_pd(mask, xs + i)};
+    const auto y{_mm512_maskz_loadu_pd(mask, ys + i)};
+    _mm512_mask_storeu_pd(
+        output_xs + i, mask,
+        _mm512_fmadd_pd(m00, x, _mm512_fmadd_pd(m01, y, m02)));
+    _mm512_mask_storeu_pd(
+        output_ys + i, mask,
+        _mm512_fmadd_pd(m10, x, _mm512_fmadd_pd(m11, y, m12)));
+  }
+}
+
+constexpr uint64_t kEvenBits{0x5555555555555555ULL};
+constexpr uint64_t kOddBits{0xAAAAAAAAAAAAAAAAULL};
+
+auto EncodeMorton(const uint32_t* xs, const uint32_t* ys, std::size_t count,
+                  uint64_t* output) -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    output[i] = _pdep_u64(xs[i], kEvenBits) | _pdep_u64(ys[i], kOddBits);
+  }
+}
+
+auto EncodeHilbert(const uint32_t* xs, const uint32_t* ys, std::size_t count,
+                   uint64_t* output) -> void {
+  using programmers::geometry::kernels::TransformHilbert;
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto [high, low]{TransformHilbert(xs[i], ys[i])};
+    output[i] = _pdep_u64(low, kEvenBits) | _pdep_u64(high, kOddBits);
+  }
+}
+
+/**
+ * @brief Round every lane with the rounding mode of kImmediate
+ * @details The masked form passes values through as the source, which keeps
+ * GCC from reporting the undefined source of _mm512_roundscale_pd as used
+ * uninitialized in optimized builds.
+ */
+template <int kImmediate>
+inline auto RoundScale(__m512d values) -> __m512d {
+  return _mm512_mask_roundscale_pd(values, static_cast<__mmask8>(0xFFU),
+                                   values, kImmediate | _MM_FROUND_NO_EXC);
+}
+
+/**
+ * @brief Round every lane to an integer
+ */
+inline auto RoundLanes(__m512d values, Rounding rounding) -> __m512d {
+  switch (rounding) {
+    case Rounding::kDown:
+      return RoundScale<_MM_FROUND_TO_NEG_INF>(values);
+    case Rounding::kUp:
+      return RoundScale<_MM_FROUND_TO_POS_INF>(values);
+    case Rounding::kNearestEven:
+      return RoundScale<_MM_FROUND_TO_NEAREST_INT>(values);
+    case Rounding::kNearest: {
+      // Truncate, then step away from zero when the fraction is at least
+      // one half. Both steps are exact.
+      const auto truncated{RoundScale<_MM_FROUND_TO_ZERO>(values)};
+      const auto fraction{_mm512_abs_pd(_mm512_sub_pd(values, truncated))};
+      const auto away{
+          _mm512_cmp_pd_mask(fraction, _mm512_set1_pd(0.5), _CMP_GE_OQ)};
+      const auto step{_mm512_or_pd(
+          _mm512_and_pd(values, _mm512_set1_pd(-0.0)), _mm512_set1_pd(1.0))};
+      return _mm512_mask_add_pd(truncated, away, truncated, step);
+    }
+    case Rounding::kTowardZero:
+    default:
+      return RoundScale<_MM_FROUND_TO_ZERO>(values);
+  }
+}
+
+auto ConvertToDouble(const int64_t* values, std::size_t count, double scale,
+                     double* output) -> void {
+  const auto factor{_mm512_set1_pd(scale)};
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    const auto integers{_mm512_maskz_loadu_epi64(mask, values + i)};
+    _mm512_mask_storeu_pd(output + i, mask,
+                          _mm512_mul_pd(_mm512_cvtepi64_pd(integers), factor));
+  }
+}
+
+auto ConvertToInt64(const double* values, std::size_t count, double scale,
+                    Rounding rounding, int64_t* output) -> bool {
+  using programmers::geometry::kernels::kInt64Limit;
+  const auto factor{_mm512_set1_pd(scale)};
+  const auto limit{_mm512_set1_pd(kInt64Limit)};
+  const auto maximum{_mm512_set1_epi64(INT64_MAX)};
+  __mmask8 not_number{0U};
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    const auto scaled{
+        _mm512_mul_pd(_mm512_maskz_loadu_pd(mask, values + i), factor)};
+    const auto is_number{_mm512_cmp_pd_mask(scaled, scaled, _CMP_ORD_Q)};
+    not_number |= static_cast<__mmask8>(mask & ~is_number);
+    const auto rounded{RoundLanes(scaled, rounding)};
+    const auto too_large{_mm512_cmp_pd_mask(rounded, limit, _CMP_GE_OQ)};
+    // Out of range lanes convert to INT64_MIN, which is already right for
+    // values below the range.
+    const auto integers{_mm512_mask_mov_epi64(
+        _mm512_maskz_cvttpd_epi64(is_number, rounded), too_large, maximum)};
+    _mm512_mask_storeu_epi64(output + i, mask, integers);
+  }
+  return not_number == 0U;
+}
+
+/**
+ * @brief Smallest lane, no lane NaN
+ * @details Both halves are extracted in the zero masked form; GCC reports
+ * the undefined source of the unmasked forms and casts, which
+ * _mm512_reduce_min_pd uses, as used uninitialized in optimized builds.
+ */
+inline auto ReduceMin(__m512d values) -> double {
+  const auto half{_mm256_min_pd(_mm512_maskz_extractf64x4_pd(0x0F, values, 0),
+                                _mm512_maskz_extractf64x4_pd(0x0F, values, 1))};
+  const auto quarter{_mm_min_pd(_mm256_castpd256_pd128(half),
+                                _mm256_extractf128_pd(half, 1))};
+  return _mm_cvtsd_f64(_mm_min_pd(quarter, _mm_unpackhi_pd(quarter, quarter)));
+}
+
+/**
+ * @brief Largest lane, no lane NaN
+ */
+inline auto ReduceMax(__m512d values) -> double {
+  const auto half{_mm256_max_pd(_mm512_maskz_extractf64x4_pd(0x0F, values, 0),
+                                _mm512_maskz_extractf64x4_pd(0x0F, values, 1))};
+  const auto quarter{_mm_max_pd(_mm256_castpd256_pd128(half),
+                                _mm256_extractf128_pd(half, 1))};
+  return _mm_cvtsd_f64(_mm_max_pd(quarter, _mm_unpackhi_pd(quarter, quarter)));
+}
+
+auto CalculateBounds(const double* xs, const double* ys, std::size_t count,
+                     double* output) -> void {
+  auto min_x{_mm512_set1_pd(kInfinity)};
+  auto min_y{min_x};
+  auto max_x{_mm512_set1_pd(-kInfinity)};
+  auto max_y{max_x};
+  // Masked lanes keep the accumulator, and so do NaN lanes.
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    const auto x{_mm512_maskz_loadu_pd(mask, xs + i)};
+    const auto y{_mm512_maskz_loadu_pd(mask, ys + i)};
+    min_x = _mm512_mask_min_pd(min_x, mask, x, min_x);
+    min_y = _mm512_mask_min_pd(min_y, mask, y, min_y);
+    max_x = _mm512_mask_max_pd(max_x, mask, x, max_x);
+    max_y = _mm512_mask_max_pd(max_y, mask, y, max_y);
+  }
+  output[0] = ReduceMin(min_x);
+  output[1] = ReduceMin(min_y);
+  output[2] = ReduceMax(max_x);
+  output[3] = ReduceMax(max_y);
+}
+
+auto FilterWithinBox(const double* xs, const double* ys, std::size_t count,
+                     const double* box, uint64_t* output) -> void {
+  const auto min_x{_mm512_set1_pd(box[0])};
+  const auto min_y{_mm512_set1_pd(box[1])};
+  const auto max_x{_mm512_set1_pd(box[2])};
+  const auto max_y{_mm512_set1_pd(box[3])};
+  uint64_t bits{0U};
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    const auto x{_mm512_maskz_loadu_pd(mask, xs + i)};
+    const auto y{_mm512_maskz_loadu_pd(mask, ys + i)};
+    auto inside{_mm512_mask_cmp_pd_mask(mask, min_x, x, _CMP_LE_OQ)};
+    inside = _mm512_mask_cmp_pd_mask(inside, x, max_x, _CMP_LE_OQ);
+    inside = _mm512_mask_cmp_pd_mask(inside, min_y, y, _CMP_LE_OQ);
+    inside = _mm512_mask_cmp_pd_mask(inside, y, max_y, _CMP_LE_OQ);
+    bits |= static_cast<uint64_t>(inside) << (i % kMaskBits);
+    if ((i + kLanes) % kMaskBits == 0U || i + kLanes >= count) {
+      output[i / kMaskBits] = bits;
+      bits = 0U;
+    }
+  }
+}
+
+auto FilterIntersectingBoxes(const double* min_xs, const double* min_ys,
+                             const double* max_xs, const double* max_ys,
+                             std::size_t count, const double* box,
+                             uint64_t* output) -> void {
+  const auto min_x{_mm512_set1_pd(box[0])};
+  const auto min_y{_mm512_set1_pd(box[1])};
+  const auto max_x{_mm512_set1_pd(box[2])};
+  const auto max_y{_mm512_set1_pd(box[3])};
+  uint64_t bits{0U};
+  for (std::size_t i = 0; i < count; i += kLanes) {
+    const auto mask{MaskRemaining(i, count)};
+    auto overlaps{_mm512_mask_cmp_pd_mask(
+        mask, _mm512_maskz_loadu_pd(mask, min_xs + i), max_x, _CMP_LE_OQ)};
+    overlaps = _mm512_mask_cmp_pd_mask(
+        overlaps, min_x, _mm512_maskz_loadu_pd(mask, max_xs + i), _CMP_LE_OQ);
+    overlaps = _mm512_mask_cmp_pd_mask(
+        overlaps, _mm512_maskz_loadu_pd(mask, min_ys + i), max_y, _CMP_LE_OQ);
+    overlaps = _mm512_mask_cmp_pd_mask(
+        overlaps, min_y, _mm512_maskz_loadu_pd(mask, max_ys + i), _CMP_LE_OQ);
+    bits |= static_cast<uint64_t>(overlaps) << (i % kMaskBits);
+    if ((i + kLanes) % kMaskBits == 0U || i + kLanes >= count) {
+      output[i / kMaskBits] = bits;
+      bits = 0U;
+    }
+  }
+}
+
+constexpr KernelTable kAvx512KernelTable{Isa::kAvx512,
+                                         CalculateDistances,
+                                         CalculateSquaredDistances,
+                                         CalculatePairwiseDistances,
+                                         CalculateDistances3D,
+                                         Add,
+                                         Subtract,
+                                         Scale,
+                                         Translate,
+                                         Transform,
+                                         EncodeMorton,
+                                         EncodeHilbert,
+                                         ConvertToDouble,
+                                         ConvertToInt64,
+                                         CalculateBounds,
+                                         FilterWithinBox,
+                                         FilterIntersectingBoxes};
+#endif
+}  // namespace
+
+namespace programmers::geometry::kernels {
+auto GetAvx512KernelTable() -> const KernelTable* {
+#if defined(PROGRAMMERS_GEOMETRY_KERNELS_AVX512)
+  return &kAvx512KernelTable;
+#else
+  return nullptr;
+#endif
+}
+}  // namespace programmers::geometry::kernels
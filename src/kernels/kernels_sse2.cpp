@@ -0,0 +1,321 @@
+/**
+ * @file geometry/kernels/kernels_sse2.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Batch kernels with SSE2 instructions
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "kernel_table.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PROGRAMMERS_GEOMETRY_KERNELS_SSE2
+#include <emmintrin.h>
+
+#include <limits>
+#endif
+
+namespace {
+#if defined(PROGRAMMERS_GEOMETRY_KERNELS_SSE2)
+using programmers::geometry::kernels::GetScalarKernelTable;
+using programmers::geometry::kernels::Isa;
+using programmers::geometry::kernels::KernelTable;
+
+constexpr std::size_t kLanes{2U};
+constexpr double kInfinity{std::numeric_limits<double>::infinity()};
+using programmers::geometry::kernels::kMaskBits;
+
+/**
+ * @brief Smallest lane, neither lane NaN
+ */
+inline auto ReduceMin(__m128d values) -> double {
+  return _mm_cvtsd_f64(_mm_min_pd(values, _mm_unpackhi_pd(values, values)));
+}
+
+/**
+ * @brief Largest lane, neither lane NaN
+ */
+inline auto ReduceMax(__m128d values) -> double {
+  return _mm_cvtsd_f64(_mm_max_pd(values, _mm_unpackhi_pd(values, values)));
+}
+
+auto CalculateDistances(const double* xs, const double* ys, std::size_t count,
+                        double target_x, double target_y, double* output)
+    -> void {
+  const auto tx{_mm_set1_pd(target_x)};
+  const auto ty{_mm_set1_pd(target_y)};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto dx{_mm_sub_pd(_mm_loadu_pd(xs + i), tx)};
+    const auto dy{_mm_sub_pd(_mm_loadu_pd(ys + i), ty)};
+    _mm_storeu_pd(output + i, _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx),
+                                                     _mm_mul_pd(dy, dy))));
+  }
+  GetScalarKernelTable()->calculate_distances(xs + i, ys + i, count - i,
+                                              target_x, target_y, output + i);
+}
+
+auto CalculateSquaredDistances(const double* xs, const double* ys,
+                               std::size_t count, double target_x,
+                               double target_y, double* output) -> void {
+  const auto tx{_mm_set1_pd(target_x)};
+  const auto ty{_mm_set1_pd(target_y)};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto dx{_mm_sub_pd(_mm_loadu_pd(xs + i), tx)};
+    const auto dy{_mm_sub_pd(_mm_loadu_pd(ys + i), ty)};
+    _mm_storeu_pd(output + i,
+                  _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)));
+  }
+  GetScalarKernelTable()->calculate_squared_distances(
+      xs + i, ys + i, count - i, target_x, target_y, output + i);
+}
+
+auto CalculatePairwiseDistances(const double* lhs_xs, const double* lhs_ys,
+                                const double* rhs_xs, const double* rhs_ys,
+                                std::size_t count, double* output) -> void {
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto dx{
+        _mm_sub_pd(_mm_loadu_pd(lhs_xs + i), _mm_loadu_pd(rhs_xs + i))};
+    const auto dy{
+        _mm_sub_pd(_mm_loadu_pd(lhs_ys + i), _mm_loadu_pd(rhs_ys + i))};
+    _mm_storeu_pd(output + i, _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx),
+                                                     _mm_mul_pd(dy, dy))));
+  }
+  GetScalarKernelTable()->calculate_pairwise_distances(
+      lhs_xs + i, lhs_ys + i, rhs_xs + i, rhs_ys + i, count - i, output + i);
+}
+
+auto CalculateDistances3D(const double* xs, const double* ys,
+                          const double* zs, std::size_t count,
+                          const double* target, double* output) -> void {
+  const auto tx{_mm_set1_pd(target[0])};
+  const auto ty{_mm_set1_pd(target[1])};
+  const auto tz{_mm_set1_pd(target[2])};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto dx{_mm_sub_pd(_mm_loadu_pd(xs + i), tx)};
+    const auto dy{_mm_sub_pd(_mm_loadu_pd(ys + i), ty)};
+    const auto dz{_mm_sub_pd(_mm_loadu_pd(zs + i), tz)};
+    const auto squared{_mm_add_pd(
+        _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)),
+        _mm_mul_pd(dz, dz))};
+    _mm_storeu_pd(output + i, _mm_sqrt_pd(squared));
+  }
+  GetScalarKernelTable()->calculate_distances3d(
+      xs + i, ys + i, zs + i, count - i, target, output + i);
+}
+
+auto Add(const double* lhs_xs, const double* lhs_ys, const double* rhs_xs,
+         const double* rhs_ys, std::size_t count, double* output_xs,
+         double* output_ys) -> void {
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    _mm_storeu_pd(output_xs + i, _mm_add_pd(_mm_loadu_pd(lhs_xs + i),
+                                            _mm_loadu_pd(rhs_xs + i)));
+    _mm_storeu_pd(output_ys + i, _mm_add_pd(_mm_loadu_pd(lhs_ys + i),
+                                            _mm_loadu_pd(rhs_ys + i)));
+  }
+  GetScalarKernelTable()->add(lhs_xs + i, lhs_ys + i, rhs_xs + i, rhs_ys + i,
+                              count - i, output_xs + i, output_ys + i);
+}
+
+auto Subtract(const double* lhs_xs, const double* lhs_ys,
+              const double* rhs_xs, const double* rhs_ys, std::size_t count,
+              double* output_xs, double* output_ys) -> void {
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    _mm_storeu_pd(output_xs + i, _mm_sub_pd(_mm_loadu_pd(lhs_xs + i),
+                                            _mm_loadu_pd(rhs_xs + i)));
+    _mm_storeu_pd(output_ys + i, _mm_sub_pd(_mm_loadu_pd(lhs_ys + i),
+                                            _mm_loadu_pd(rhs_ys + i)));
+  }
+  GetScalarKernelTable()->subtract(lhs_xs + i, lhs_ys + i, rhs_xs + i,
+                                   rhs_ys + i, count - i, output_xs + i,
+                                   output_ys + i);
+}
+
+auto Scale(const double* xs, const double* ys, std::size_t count,
+           double scalar, double* output_xs, double* output_ys) -> void {
+  const auto factor{_mm_set1_pd(scalar)};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    _mm_storeu_pd(output_xs + i, _mm_mul_pd(_mm_loadu_pd(xs + i), factor));
+    _mm_storeu_pd(output_ys + i, _mm_mul_pd(_mm_loadu_pd(ys + i), factor));
+  }
+  GetScalarKernelTable()->scale(xs + i, ys + i, count - i, scalar,
+                                output_xs + i, output_ys + i);
+}
+
+auto Translate(const double* xs, const double* ys, std::size_t count,
+               double offset_x, double offset_y, double* output_xs,
+               double* output_ys) -> void {
+  const auto ox{_mm_set1_pd(offset_x)};
+  const auto oy{_mm_set1_pd(offset_y)};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    _mm_storeu_pd(output_xs + i, _mm_add_pd(_mm_loadu_pd(xs + i), ox));
+    _mm_storeu_pd(output_ys + i, _mm_add_pd(_mm_loadu_pd(ys + i), oy));
+  }
+  GetScalarKernelTable()->translate(xs + i, ys + i, count - i, offset_x,
+                                    offset_y, output_xs + i, output_ys + i);
+}
+
+auto Transform(const double* xs, const double* ys, std::size_t count,
+               const double* matrix, double* output_xs, double* output_ys)
+    -> void {
+  const auto m00{_mm_set1_pd(matrix[0])};
+  const auto m01{_mm_set1_pd(matrix[1])};
+  const auto m02{_mm_set1_pd(matrix[2])};
+  const auto m10{_mm_set1_pd(matrix[3])};
+  const auto m11{_mm_set1_pd(matrix[4])};
+  const auto m12{_mm_set1_pd(matrix[5])};
+  std::size_t i{0U};
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto x{_mm_loadu_pd(xs + i)};
+    const auto y{_mm_loadu_pd(ys + i)};
+    _mm_storeu_pd(output_xs + i,
+                  _mm_add_pd(_mm_add_pd(_mm_mul_pd(m00, x),
+                                        _mm_mul_pd(m01, y)),
+                             m02));
+    _mm_storeu_pd(output_ys + i,
+                  _mm_add_pd(_mm_add_pd(_mm_mul_pd(m10, x),
+                                        _mm_mul_pd(m11, y)),
+                             m12));
+  }
+  GetScalarKernelTable()->transform(xs + i, ys + i, count - i, matrix,
+                                    output_xs + i, output_ys + i);
+}
+
+// SSE2 has no bit deposit, the curve kernels are the scalar ones.
+auto EncodeMorton(const uint32_t* xs, const uint32_t* ys, std::size_t count,
+                  uint64_t* output) -> void {
+  GetScalarKernelTable()->encode_morton(xs, ys, count, output);
+}
+
+auto EncodeHilbert(const uint32_t* xs, const uint32_t* ys, std::size_t count,
+                   uint64_t* output) -> void {
+  GetScalarKernelTable()->encode_hilbert(xs, ys, count, output);
+}
+
+auto ConvertToDouble(const int64_t* values, std::size_t count, double scale,
+                     double* output) -> void {
+  GetScalarKernelTable()->convert_to_double(values, count, scale, output);
+}
+
+auto ConvertToInt64(const double* values, std::size_t count, double scale,
+                    programmers::geometry::Rounding rounding, int64_t* output)
+    -> bool {
+  return GetScalarKernelTable()->convert_to_int64(values, count, scale,
+                                                  rounding, output);
+}
+
+auto CalculateBounds(const double* xs, const double* ys, std::size_t count,
+                     double* output) -> void {
+  auto min_x{_mm_set1_pd(kInfinity)};
+  auto min_y{min_x};
+  auto max_x{_mm_set1_pd(-kInfinity)};
+  auto max_y{max_x};
+  std::size_t i{0U};
+  // The second operand is returned for NaN, so NaN lanes are skipped.
+  for (; i + kLanes <= count; i += kLanes) {
+    const auto x{_mm_loadu_pd(xs + i)};
+    const auto y{_mm_loadu_pd(ys + i)};
+    min_x = _mm_min_pd(x, min_x);
+    min_y = _mm_min_pd(y, min_y);
+    max_x = _mm_max_pd(x, max_x);
+    max_y = _mm_max_pd(y, max_y);
+  }
+  GetScalarKernelTable()->calculate_bounds(xs + i, ys + i, count - i, output);
+  output[0] = ReduceMin(_mm_min_pd(_mm_set1_pd(output[0]), min_x));
+  output[1] = ReduceMin(_mm_min_pd(_mm_set1_pd(output[1]), min_y));
+  output[2] = ReduceMax(_mm_max_pd(_mm_set1_pd(output[2]), max_x));
+  output[3] = ReduceMax(_mm_max_pd(_mm_set1_pd(output[3]), max_y));
+}
+
+auto FilterWithinBox(const double* xs, const double* ys, std::size_t count,
+                     const double* box, uint64_t* output) -> void {
+  const auto min_x{_mm_set1_pd(box[0])};
+  const auto min_y{_mm_set1_pd(box[1])};
+  const auto max_x{_mm_set1_pd(box[2])};
+  const auto max_y{_mm_set1_pd(box[3])};
+  std::size_t i{0U};
+  for (; i + kMaskBits <= count; i += kMaskBits) {
+    uint64_t bits{0U};
+    for (std::size_t lane = 0; lane < kMaskBits; lane += kLanes) {
+      const auto x{_mm_loadu_pd(xs + i + lane)};
+      const auto y{_mm_loadu_pd(ys + i + lane)};
+      const auto inside{
+          _mm_and_pd(_mm_and_pd(_mm_cmple_pd(min_x, x), _mm_cmple_pd(x, max_x)),
+                     _mm_and_pd(_mm_cmple_pd(min_y, y),
+                                _mm_cmple_pd(y, max_y)))};
+      bits |= static_cast<uint64_t>(_mm_movemask_pd(inside)) << lane;
+    }
+    output[i / kMaskBits] = bits;
+  }
+  GetScalarKernelTable()->filter_within_box(xs + i, ys + i, count - i, box,
+                                            output + i / kMaskBits);
+}
+
+auto FilterIntersectingBoxes(const double* min_xs, const double* min_ys,
+                             const double* max_xs, const double* max_ys,
+                             std::size_t count, const double* box,
+                             uint64_t* output) -> void {
+  const auto min_x{_mm_set1_pd(box[0])};
+  const auto min_y{_mm_set1_pd(box[1])};
+  const auto max_x{_mm_set1_pd(box[2])};
+  const auto max_y{_mm_set1_pd(box[3])};
+  std::size_t i{0U};
+  for (; i + kMaskBits <= count; i += kMaskBits) {
+    uint64_t bits{0U};
+    for (std::size_t lane = 0; lane < kMaskBits; lane += kLanes) {
+      const auto j{i + lane};
+      const auto overlaps{_mm_and_pd(
+          _mm_and_pd(_mm_cmple_pd(_mm_loadu_pd(min_xs + j), max_x),
+                     _mm_cmple_pd(min_x, _mm_loadu_pd(max_xs + j))),
+          _mm_and_pd(_mm_cmple_pd(_mm_loadu_pd(min_ys + j), max_y),
+                     _mm_cmple_pd(min_y, _mm_loadu_pd(max_ys + j))))};
+      bits |= static_cast<uint64_t>(_mm_movemask_pd(overlaps)) << lane;
+    }
+    output[i / kMaskBits] = bits;
+  }
+  GetScalarKernelTable()->filter_intersecting_boxes(
+      min_xs + i, min_ys + i, max_xs + i, max_ys + i, count - i, box,
+      output + i / kMaskBits);
+}
+
+constexpr KernelTable kSse2KernelTable{Isa::kSse2,
+                                       CalculateDistances,
+                                       CalculateSquaredDistances,
+                                       CalculatePairwiseDistances,
+                                       CalculateDistances3D,
+                                       Add,
+                                       Subtract,
+                                       Scale,
+                                       Translate,
+                                       Transform,
+                                       EncodeMorton,
+                                       EncodeHilbert,
+                                       ConvertToDouble,
+                                       ConvertToInt64,
+                                       CalculateBounds,
+                                       FilterWithinBox,
+                                       FilterIntersectingBoxes};
+#endif
+}  // namespace
+
+namespace programmers::geometry::kernels {
+auto GetSse2KernelTable() -> const KernelTable* {
+#if defined(PROGRAMMERS_GEOMETRY_KERNELS_SSE2)
+  return &kSse2KernelTable;
+#else
+  return nullptr;
+#endif
+}
+}  // namespace programmers::geometry::kernels
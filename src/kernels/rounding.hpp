@@ -0,0 +1,63 @@
+/**
+ * @file geometry/kernels/rounding.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Double to int64_t rounding shared by Distance and the kernels
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__KERNELS__ROUNDING_HPP_
+#define PROGRAMMERS__GEOMETRY__KERNELS__ROUNDING_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "geometry/exact_arithmetic.hpp"
+
+// Every function here is static so that each instruction set specific
+// translation unit keeps its own copy compiled with its own flags.
+namespace programmers::geometry::kernels {
+/**
+ * @brief 2^63, the first double above the int64_t range
+ */
+static constexpr double kInt64Limit{9223372036854775808.0};
+
+/**
+ * @brief Round value to an integer, saturating to the int64_t range
+ * @details Not a number becomes 0, callers check for it themselves.
+ */
+static inline auto RoundToInt64(double value, Rounding rounding) -> int64_t {
+  auto rounded{std::trunc(value)};
+  if (rounding == Rounding::kDown) {
+    rounded = std::floor(value);
+  } else if (rounding == Rounding::kUp) {
+    rounded = std::ceil(value);
+  } else if (rounding == Rounding::kNearest) {
+    rounded = std::round(value);
+  } else if (rounding == Rounding::kNearestEven) {
+    const auto floor{std::floor(value)};
+    const auto fraction{value - floor};
+    rounded = fraction > 0.5 || (fraction == 0.5 &&
+                                 std::fmod(floor, 2.0) != 0.0)
+                  ? floor + 1.0
+                  : floor;
+  }
+  if (std::isnan(rounded)) {
+    return 0;
+  }
+  if (!(rounded < kInt64Limit)) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  if (!(rounded >= -kInt64Limit)) {
+    return std::numeric_limits<int64_t>::min();
+  }
+  return static_cast<int64_t>(rounded);
+}
+}  // namespace programmers::geometry::kernels
+
+#endif
@@ -0,0 +1,25 @@
+/**
+ * @file geometry/neighbor.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Neighbor search result developments shared by spatial indices
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/neighbor.hpp"
+
+#include <cmath>
+
+namespace programmers::geometry {
+auto Neighbor::GetDistance() const -> double {
+  return std::sqrt(squared_distance);
+}
+
+auto Neighbor::ToDistance(Distance::Type unit) const -> Distance {
+  return Distance{GetDistance(), unit};
+}
+}  // namespace programmers::geometry
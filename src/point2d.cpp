@@ -15,50 +15,142 @@
 #include <cmath>
 
 namespace programmers::geometry {
-Point2D::Point2D(double input_x, double input_y) : x_(input_x), y_(input_y) {}
+template <typename T>
+BasicPoint2D<T>::BasicPoint2D(T input_x, T input_y)
+    : x_(input_x), y_(input_y) {}
 
-auto Point2D::CalculateDistance(const Point2D& target) const -> double {
-  return Point2D::CalculateDistance(*this, target);
+template <typename T>
+auto BasicPoint2D<T>::CalculateDistance(const BasicPoint2D& target) const
+    -> T {
+  return BasicPoint2D::CalculateDistance(*this, target);
 }
 
-auto Point2D::CalculateDistance(const Point2D& lhs,
-                                const Point2D& rhs) -> double {
-  return std::sqrt(std::pow((lhs.x_ - rhs.x_), 2) +
-                   std::pow((lhs.y_ - rhs.y_), 2));
+template <typename T>
+auto BasicPoint2D<T>::CalculateDistance(const BasicPoint2D& lhs,
+                                        const BasicPoint2D& rhs) -> T {
+  const auto dx{lhs.x_ - rhs.x_};
+  const auto dy{lhs.y_ - rhs.y_};
+  return std::sqrt(dx * dx + dy * dy);
 }
 
-auto Point2D::GetX() const -> double { return x_; }
-auto Point2D::GetY() const -> double { return y_; }
+template <typename T>
+auto BasicPoint2D<T>::CalculateSquaredDistance(
+    const BasicPoint2D& target) const -> T {
+  return BasicPoint2D::CalculateSquaredDistance(*this, target);
+}
+
+template <typename T>
+auto BasicPoint2D<T>::CalculateSquaredDistance(const BasicPoint2D& lhs,
+                                               const BasicPoint2D& rhs) -> T {
+  const auto dx{lhs.x_ - rhs.x_};
+  const auto dy{lhs.y_ - rhs.y_};
+  return dx * dx + dy * dy;
+}
+
+template <typename T>
+auto BasicPoint2D<T>::IsCloser(const BasicPoint2D& origin,
+                               const BasicPoint2D& lhs,
+                               const BasicPoint2D& rhs) -> bool {
+  return CalculateSquaredDistance(origin, lhs) <
+         CalculateSquaredDistance(origin, rhs);
+}
 
-auto Point2D::SetX(double input_x) -> void { x_ = input_x; }
-auto Point2D::SetY(double input_y) -> void { y_ = input_y; }
+template <typename T>
+auto BasicPoint2D<T>::IsWithinRadius(const BasicPoint2D& target,
+                                     T radius) const -> bool {
+  return (radius >= T{0}) &&
+         (CalculateSquaredDistance(target) <= radius * radius);
+}
+
+template <typename T>
+auto BasicPoint2D<T>::IsWithinRadius(const BasicPoint2D& target,
+                                     const Distance& radius,
+                                     Distance::Type unit) const -> bool {
+  return IsWithinRadius(target, static_cast<T>(radius.GetValue(unit)));
+}
+
+template <typename T>
+auto BasicPoint2D<T>::FilterWithinRadius(
+    const std::vector<BasicPoint2D>& points, const BasicPoint2D& center,
+    T radius) -> std::vector<std::size_t> {
+  std::vector<std::size_t> indices;
+  if (radius < T{0}) {
+    return indices;
+  }
+  const auto squared_radius{radius * radius};
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    if (CalculateSquaredDistance(points[i], center) <= squared_radius) {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
 
-auto Point2D::operator+(const Point2D& other) const -> Point2D {
+template <typename T>
+auto BasicPoint2D<T>::FilterWithinRadius(
+    const std::vector<BasicPoint2D>& points, const BasicPoint2D& center,
+    const Distance& radius, Distance::Type unit) -> std::vector<std::size_t> {
+  return FilterWithinRadius(points, center,
+                            static_cast<T>(radius.GetValue(unit)));
+}
+
+template <typename T>
+auto BasicPoint2D<T>::GetX() const -> T {
+  return x_;
+}
+template <typename T>
+auto BasicPoint2D<T>::GetY() const -> T {
+  return y_;
+}
+
+template <typename T>
+auto BasicPoint2D<T>::SetX(T input_x) -> void {
+  x_ = input_x;
+}
+template <typename T>
+auto BasicPoint2D<T>::SetY(T input_y) -> void {
+  y_ = input_y;
+}
+
+template <typename T>
+auto BasicPoint2D<T>::operator+(const BasicPoint2D& other) const
+    -> BasicPoint2D {
   return {x_ + other.x_, y_ + other.y_};
 }
-auto Point2D::operator-(const Point2D& other) const -> Point2D {
+template <typename T>
+auto BasicPoint2D<T>::operator-(const BasicPoint2D& other) const
+    -> BasicPoint2D {
   return {x_ - other.x_, y_ - other.y_};
 }
-auto Point2D::operator+=(const Point2D& other) -> Point2D& {
+template <typename T>
+auto BasicPoint2D<T>::operator+=(const BasicPoint2D& other) -> BasicPoint2D& {
   x_ += other.x_;
   y_ += other.y_;
   return *this;
 }
-auto Point2D::operator-=(const Point2D& other) -> Point2D& {
+template <typename T>
+auto BasicPoint2D<T>::operator-=(const BasicPoint2D& other) -> BasicPoint2D& {
   x_ -= other.x_;
   y_ -= other.y_;
   return *this;
 }
-auto Point2D::operator*(double scalar) const -> Point2D {
+template <typename T>
+auto BasicPoint2D<T>::operator*(T scalar) const -> BasicPoint2D {
   return {x_ * scalar, y_ * scalar};
 }
-auto Point2D::operator/(double scalar) const -> Point2D {
+template <typename T>
+auto BasicPoint2D<T>::operator/(T scalar) const -> BasicPoint2D {
   return {x_ / scalar, y_ / scalar};
 }
-auto Point2D::operator==(const Point2D& other) const -> bool {
+template <typename T>
+auto BasicPoint2D<T>::operator==(const BasicPoint2D& other) const -> bool {
   return (x_ == other.x_) && (y_ == other.y_);
 }
-auto Point2D::operator!=(const Point2D& other) const -> bool {
+template <typename T>
+auto BasicPoint2D<T>::operator!=(const BasicPoint2D& other) const -> bool {
   return !(*this == other);
 }
+
+template class BasicPoint2D<float>;
+template class BasicPoint2D<double>;
 }  // namespace programmers::geometry
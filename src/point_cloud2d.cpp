@@ -0,0 +1,236 @@
+/**
+ * @file geometry/point_cloud2d.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Structure-of-arrays container developments of 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/point_cloud2d.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+#include "geometry/kernels.hpp"
+#include "geometry/thread_pool.hpp"
+
+namespace {
+constexpr std::size_t kFilterBlockSize{256U};
+}  // namespace
+
+namespace programmers::geometry {
+PointCloud2D::PointCloud2D(std::size_t count) : x_(count), y_(count) {}
+
+PointCloud2D::PointCloud2D(const std::vector<Point2D>& points) {
+  Reserve(points.size());
+  for (const auto& point : points) {
+    PushBack(point);
+  }
+}
+
+auto PointCloud2D::Size() const -> std::size_t { return x_.size(); }
+auto PointCloud2D::Empty() const -> bool { return x_.empty(); }
+
+auto PointCloud2D::Reserve(std::size_t count) -> void {
+  x_.reserve(count);
+  y_.reserve(count);
+}
+auto PointCloud2D::Resize(std::size_t count) -> void {
+  x_.resize(count);
+  y_.resize(count);
+}
+auto PointCloud2D::Clear() -> void {
+  x_.clear();
+  y_.clear();
+}
+
+auto PointCloud2D::PushBack(const Point2D& point) -> void {
+  PushBack(point.GetX(), point.GetY());
+}
+auto PointCloud2D::PushBack(double input_x, double input_y) -> void {
+  x_.push_back(input_x);
+  y_.push_back(input_y);
+}
+
+auto PointCloud2D::GetPoint(std::size_t index) const -> Point2D {
+  return {x_[index], y_[index]};
+}
+auto PointCloud2D::SetPoint(std::size_t index, const Point2D& point) -> void {
+  x_[index] = point.GetX();
+  y_[index] = point.GetY();
+}
+auto PointCloud2D::GetX(std::size_t index) const -> double {
+  return x_[index];
+}
+auto PointCloud2D::GetY(std::size_t index) const -> double {
+  return y_[index];
+}
+
+auto PointCloud2D::XData() const -> const double* { return x_.data(); }
+auto PointCloud2D::YData() const -> const double* { return y_.data(); }
+auto PointCloud2D::XData() -> double* { return x_.data(); }
+auto PointCloud2D::YData() -> double* { return y_.data(); }
+
+auto PointCloud2D::ToPoints() const -> std::vector<Point2D> {
+  std::vector<Point2D> points;
+  points.reserve(Size());
+  for (std::size_t i = 0; i < Size(); ++i) {
+    points.emplace_back(x_[i], y_[i]);
+  }
+  return points;
+}
+
+auto PointCloud2D::CalculateDistances(const Point2D& target) const
+    -> std::vector<double> {
+  std::vector<double> output(Size());
+  CalculateDistances(target, output.data());
+  return output;
+}
+
+auto PointCloud2D::CalculateDistances(const Point2D& target,
+                                      double* output) const -> void {
+  ParallelFor(Size(), [&](std::size_t begin, std::size_t end) {
+    kernels::CalculateDistances(x_.data() + begin, y_.data() + begin,
+                                end - begin, target.GetX(), target.GetY(),
+                                output + begin);
+  });
+}
+
+auto PointCloud2D::CalculateSquaredDistances(const Point2D& target) const
+    -> std::vector<double> {
+  std::vector<double> output(Size());
+  CalculateSquaredDistances(target, output.data());
+  return output;
+}
+
+auto PointCloud2D::CalculateSquaredDistances(const Point2D& target,
+                                             double* output) const -> void {
+  ParallelFor(Size(), [&](std::size_t begin, std::size_t end) {
+    kernels::CalculateSquaredDistances(x_.data() + begin, y_.data() + begin,
+                                       end - begin, target.GetX(),
+                                       target.GetY(), output + begin);
+  });
+}
+
+auto PointCloud2D::FilterWithinRadius(const Point2D& center,
+                                      double radius) const
+    -> std::vector<std::size_t> {
+  std::vector<std::size_t> indices;
+  if (radius < 0.0) {
+    return indices;
+  }
+  const auto squared_radius{radius * radius};
+  // Chunks are joined in order, so the indices stay ascending.
+  return ParallelReduce(
+      Size(), indices,
+      [&](std::size_t first, std::size_t last) {
+        std::vector<std::size_t> found;
+        std::array<double, kFilterBlockSize> squared_distances{};
+        for (auto begin = first; begin < last; begin += kFilterBlockSize) {
+          const auto count{std::min(kFilterBlockSize, last - begin)};
+          kernels::CalculateSquaredDistances(
+              x_.data() + begin, y_.data() + begin, count, center.GetX(),
+              center.GetY(), squared_distances.data());
+          for (std::size_t i = 0; i < count; ++i) {
+            if (squared_distances[i] <= squared_radius) {
+              found.push_back(begin + i);
+            }
+          }
+        }
+        return found;
+      },
+      [](std::vector<std::size_t> lhs, std::vector<std::size_t> rhs) {
+        if (lhs.empty()) {
+          return rhs;
+        }
+        lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+        return lhs;
+      });
+}
+
+auto PointCloud2D::FilterWithinRadius(const Point2D& center,
+                                      const Distance& radius,
+                                      Distance::Type unit) const
+    -> std::vector<std::size_t> {
+  return FilterWithinRadius(center, radius.GetValue(unit));
+}
+
+auto PointCloud2D::CalculatePairwiseDistances(const PointCloud2D& other) const
+    -> std::vector<double> {
+  if (other.Size() != Size()) {
+    throw std::invalid_argument("PointCloud2D sizes differ");
+  }
+  std::vector<double> output(Size());
+  ParallelFor(Size(), [&](std::size_t begin, std::size_t end) {
+    kernels::CalculatePairwiseDistances(
+        x_.data() + begin, y_.data() + begin, other.x_.data() + begin,
+        other.y_.data() + begin, end - begin, output.data() + begin);
+  });
+  return output;
+}
+
+auto PointCloud2D::CalculateDistanceMatrix(const PointCloud2D& targets) const
+    -> std::vector<double> {
+  std::vector<double> output(Size() * targets.Size());
+  // Split by rows, each row worth targets.Size() items.
+  ParallelOptions options;
+  options.grain = std::max<std::size_t>(
+      1U, ParallelOptions::kDefaultGrain / std::max<std::size_t>(
+                                               1U, targets.Size()));
+  ParallelFor(
+      Size(),
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          kernels::CalculateDistances(targets.x_.data(), targets.y_.data(),
+                                      targets.Size(), x_[i], y_[i],
+                                      output.data() + i * targets.Size());
+        }
+      },
+      options);
+  return output;
+}
+
+auto PointCloud2D::Translate(const Point2D& offset) -> void {
+  ParallelFor(Size(), [&](std::size_t begin, std::size_t end) {
+    kernels::Translate(x_.data() + begin, y_.data() + begin, end - begin,
+                       offset.GetX(), offset.GetY(), x_.data() + begin,
+                       y_.data() + begin);
+  });
+}
+
+auto PointCloud2D::Scale(double scalar) -> void {
+  ParallelFor(Size(), [&](std::size_t begin, std::size_t end) {
+    kernels::Scale(x_.data() + begin, y_.data() + begin, end - begin, scalar,
+                   x_.data() + begin, y_.data() + begin);
+  });
+}
+
+auto PointCloud2D::operator+=(const PointCloud2D& other) -> PointCloud2D& {
+  if (other.Size() != Size()) {
+    throw std::invalid_argument("PointCloud2D sizes differ");
+  }
+  ParallelFor(Size(), [&](std::size_t begin, std::size_t end) {
+    kernels::Add(x_.data() + begin, y_.data() + begin, other.x_.data() + begin,
+                 other.y_.data() + begin, end - begin, x_.data() + begin,
+                 y_.data() + begin);
+  });
+  return *this;
+}
+
+auto PointCloud2D::operator-=(const PointCloud2D& other) -> PointCloud2D& {
+  if (other.Size() != Size()) {
+    throw std::invalid_argument("PointCloud2D sizes differ");
+  }
+  ParallelFor(Size(), [&](std::size_t begin, std::size_t end) {
+    kernels::Subtract(x_.data() + begin, y_.data() + begin,
+                      other.x_.data() + begin, other.y_.data() + begin,
+                      end - begin, x_.data() + begin, y_.data() + begin);
+  });
+  return *this;
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,367 @@
+/**
+ * @file geometry/point_file.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Memory mapped binary columnar point file developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/point_file.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include "geometry/kernels.hpp"
+#include "unique_file.hpp"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+namespace point_file = programmers::geometry::point_file;
+
+/**
+ * @brief Fixed header at the start of a point file
+ */
+struct Header {
+  char magic[8];                ///< point_file::kMagic
+  uint32_t version;             ///< point_file::kVersion
+  uint32_t byte_order;          ///< point_file::kByteOrder
+  uint64_t count;               ///< The number of points
+  uint32_t attribute_count;     ///< The number of attribute columns
+  uint32_t reserved;            ///< Zero
+  uint64_t x_offset;            ///< Byte offset of the x column
+  uint64_t y_offset;            ///< Byte offset of the y column
+  uint64_t file_size;           ///< Total bytes
+  uint64_t padding;             ///< Zero
+};
+static_assert(sizeof(Header) == point_file::kHeaderSize);
+
+/**
+ * @brief Attribute directory entry following the header
+ */
+struct AttributeEntry {
+  char name[point_file::kMaximumNameSize + 1U];  ///< '\0' padded name
+  uint64_t offset;                               ///< Byte offset of column
+};
+static_assert(sizeof(AttributeEntry) == point_file::kAttributeEntrySize);
+
+auto AlignUp(uint64_t offset) -> uint64_t {
+  return (offset + point_file::kAlignment - 1U) / point_file::kAlignment *
+         point_file::kAlignment;
+}
+
+auto ThrowSystemError(const std::string& message) -> void {
+  throw std::system_error(errno, std::generic_category(), message);
+}
+
+/**
+ * @brief Check that a column of count 8 byte values lies inside the file
+ */
+auto CheckColumn(uint64_t offset, uint64_t count, uint64_t size) -> void {
+  if (offset % point_file::kAlignment != 0U || offset > size ||
+      count > (size - offset) / 8U) {
+    throw std::runtime_error("Point file column is out of the file");
+  }
+}
+}  // namespace
+
+namespace programmers::geometry {
+auto WritePointFile(const std::string& path, const PointCloud2D& points,
+                    const std::vector<PointFileAttribute>& attributes)
+    -> void {
+  const auto count{static_cast<uint64_t>(points.Size())};
+  std::vector<AttributeEntry> entries(attributes.size());
+  for (std::size_t i = 0; i < attributes.size(); ++i) {
+    const auto& attribute{attributes[i]};
+    if (attribute.values == nullptr || attribute.values->Size() != count) {
+      throw std::invalid_argument("Point file attribute size differs");
+    }
+    if (attribute.name.empty() ||
+        attribute.name.size() > point_file::kMaximumNameSize ||
+        attribute.name.find('\0') != std::string::npos) {
+      throw std::invalid_argument("Point file attribute name is invalid");
+    }
+    for (std::size_t j = 0; j < i; ++j) {
+      if (attributes[j].name == attribute.name) {
+        throw std::invalid_argument("Point file attribute name is repeated");
+      }
+    }
+    std::memset(&entries[i], 0, sizeof(AttributeEntry));
+    std::memcpy(entries[i].name, attribute.name.data(),
+                attribute.name.size());
+  }
+
+  Header header{};
+  std::memcpy(header.magic, point_file::kMagic, sizeof(header.magic));
+  header.version = point_file::kVersion;
+  header.byte_order = point_file::kByteOrder;
+  header.count = count;
+  header.attribute_count = static_cast<uint32_t>(attributes.size());
+  const auto column_size{count * 8U};
+  header.x_offset = AlignUp(
+      point_file::kHeaderSize +
+      attributes.size() * point_file::kAttributeEntrySize);
+  header.y_offset = AlignUp(header.x_offset + column_size);
+  auto offset{AlignUp(header.y_offset + column_size)};
+  for (auto& entry : entries) {
+    entry.offset = offset;
+    offset = AlignUp(offset + column_size);
+  }
+  header.file_size = offset;
+
+  const detail::UniqueFile file(std::fopen(path.c_str(), "wb"));
+  if (!file) {
+    ThrowSystemError("Cannot create point file " + path);
+  }
+  uint64_t written{0U};
+  const auto write{[&](const void* data, uint64_t size) {
+    if (size != 0U && std::fwrite(data, 1U, size, file.get()) != size) {
+      ThrowSystemError("Cannot write point file " + path);
+    }
+    written += size;
+  }};
+  const auto pad{[&](uint64_t target) {
+    static constexpr unsigned char kZeros[point_file::kAlignment]{};
+    write(kZeros, target - written);
+  }};
+  write(&header, sizeof(header));
+  write(entries.data(), entries.size() * sizeof(AttributeEntry));
+  pad(header.x_offset);
+  write(points.XData(), column_size);
+  pad(header.y_offset);
+  write(points.YData(), column_size);
+  for (std::size_t i = 0; i < attributes.size(); ++i) {
+    pad(entries[i].offset);
+    write(attributes[i].values->Data(), column_size);
+  }
+  pad(header.file_size);
+  if (std::fflush(file.get()) != 0) {
+    ThrowSystemError("Cannot write point file " + path);
+  }
+}
+
+PointFileReader::PointFileReader(const std::string& path) {
+#if defined(_WIN32)
+  const auto handle{CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, nullptr)};
+  if (handle == INVALID_HANDLE_VALUE) {
+    throw std::system_error(static_cast<int>(GetLastError()),
+                            std::system_category(),
+                            "Cannot open point file " + path);
+  }
+  LARGE_INTEGER file_size{};
+  const auto mapping{GetFileSizeEx(handle, &file_size)
+                         ? CreateFileMappingA(handle, nullptr, PAGE_READONLY,
+                                              0, 0, nullptr)
+                         : nullptr};
+  // The view keeps the mapping alive once both handles are closed.
+  const auto* view{mapping != nullptr
+                       ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)
+                       : nullptr};
+  const auto error{GetLastError()};
+  if (mapping != nullptr) {
+    CloseHandle(mapping);
+  }
+  CloseHandle(handle);
+  if (view == nullptr) {
+    throw std::system_error(static_cast<int>(error), std::system_category(),
+                            "Cannot map point file " + path);
+  }
+  data_ = static_cast<const unsigned char*>(view);
+  size_ = static_cast<std::size_t>(file_size.QuadPart);
+#else
+  const auto descriptor{::open(path.c_str(), O_RDONLY)};
+  if (descriptor < 0) {
+    ThrowSystemError("Cannot open point file " + path);
+  }
+  struct stat status {};
+  if (::fstat(descriptor, &status) != 0) {
+    const auto error{errno};
+    ::close(descriptor);
+    throw std::system_error(error, std::generic_category(),
+                            "Cannot stat point file " + path);
+  }
+  size_ = static_cast<std::size_t>(status.st_size);
+  if (size_ < point_file::kHeaderSize) {
+    ::close(descriptor);
+    throw std::runtime_error("Point file is truncated: " + path);
+  }
+  auto* mapping{
+      ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0)};
+  const auto error{errno};
+  ::close(descriptor);
+  if (mapping == MAP_FAILED) {
+    throw std::system_error(error, std::generic_category(),
+                            "Cannot map point file " + path);
+  }
+  data_ = static_cast<const unsigned char*>(mapping);
+#endif
+
+  try {
+    if (size_ < point_file::kHeaderSize) {
+      throw std::runtime_error("Point file is truncated: " + path);
+    }
+    Header header{};
+    std::memcpy(&header, data_, sizeof(header));
+    if (std::memcmp(header.magic, point_file::kMagic,
+                    sizeof(header.magic)) != 0) {
+      throw std::runtime_error("Not a point file: " + path);
+    }
+    if (header.byte_order != point_file::kByteOrder) {
+      throw std::runtime_error("Point file has another byte order: " + path);
+    }
+    if (header.version != point_file::kVersion) {
+      throw std::runtime_error("Point file version is unsupported: " + path);
+    }
+    if (header.file_size != size_) {
+      throw std::runtime_error("Point file is truncated: " + path);
+    }
+    const uint64_t directory_end{
+        point_file::kHeaderSize +
+        uint64_t{header.attribute_count} * point_file::kAttributeEntrySize};
+    if (directory_end > size_) {
+      throw std::runtime_error("Point file is truncated: " + path);
+    }
+    CheckColumn(header.x_offset, header.count, size_);
+    CheckColumn(header.y_offset, header.count, size_);
+    count_ = static_cast<std::size_t>(header.count);
+    xs_ = reinterpret_cast<const double*>(data_ + header.x_offset);
+    ys_ = reinterpret_cast<const double*>(data_ + header.y_offset);
+    attributes_.reserve(header.attribute_count);
+    for (uint32_t i = 0; i < header.attribute_count; ++i) {
+      AttributeEntry entry{};
+      std::memcpy(&entry,
+                  data_ + point_file::kHeaderSize +
+                      i * point_file::kAttributeEntrySize,
+                  sizeof(entry));
+      if (entry.name[point_file::kMaximumNameSize] != '\0') {
+        throw std::runtime_error("Point file attribute name is invalid");
+      }
+      CheckColumn(entry.offset, header.count, size_);
+      attributes_.push_back(
+          reinterpret_cast<const int64_t*>(data_ + entry.offset));
+    }
+  } catch (...) {
+    Close();
+    throw;
+  }
+}
+
+PointFileReader::PointFileReader(PointFileReader&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0U)),
+      count_(std::exchange(other.count_, 0U)),
+      xs_(std::exchange(other.xs_, nullptr)),
+      ys_(std::exchange(other.ys_, nullptr)),
+      attributes_(std::move(other.attributes_)) {
+  other.attributes_.clear();
+}
+
+auto PointFileReader::operator=(PointFileReader&& other) noexcept
+    -> PointFileReader& {
+  if (this != &other) {
+    Close();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0U);
+    count_ = std::exchange(other.count_, 0U);
+    xs_ = std::exchange(other.xs_, nullptr);
+    ys_ = std::exchange(other.ys_, nullptr);
+    attributes_ = std::move(other.attributes_);
+    other.attributes_.clear();
+  }
+  return *this;
+}
+
+PointFileReader::~PointFileReader() { Close(); }
+
+auto PointFileReader::IsOpen() const -> bool { return data_ != nullptr; }
+
+auto PointFileReader::Size() const -> std::size_t { return count_; }
+
+auto PointFileReader::GetPoint(std::size_t index) const -> Point2D {
+  return {xs_[index], ys_[index]};
+}
+
+auto PointFileReader::XData() const -> const double* { return xs_; }
+
+auto PointFileReader::YData() const -> const double* { return ys_; }
+
+auto PointFileReader::ToPointCloud() const -> PointCloud2D {
+  PointCloud2D points(count_);
+  std::copy_n(xs_, count_, points.XData());
+  std::copy_n(ys_, count_, points.YData());
+  return points;
+}
+
+auto PointFileReader::GetAttributeCount() const -> std::size_t {
+  return attributes_.size();
+}
+
+auto PointFileReader::GetAttributeName(std::size_t attribute) const
+    -> std::string {
+  const auto* name{reinterpret_cast<const char*>(
+      data_ + point_file::kHeaderSize +
+      attribute * point_file::kAttributeEntrySize)};
+  return {name, std::find(name, name + point_file::kMaximumNameSize, '\0')};
+}
+
+auto PointFileReader::FindAttribute(const std::string& name) const
+    -> std::size_t {
+  for (std::size_t i = 0; i < attributes_.size(); ++i) {
+    if (GetAttributeName(i) == name) {
+      return i;
+    }
+  }
+  throw std::out_of_range("Point file has no attribute " + name);
+}
+
+auto PointFileReader::AttributeData(std::size_t attribute) const
+    -> const int64_t* {
+  return attributes_[attribute];
+}
+
+auto PointFileReader::GetDistance(std::size_t attribute,
+                                  std::size_t index) const -> Distance {
+  return Distance::FromNanometer(attributes_[attribute][index]);
+}
+
+auto PointFileReader::CalculateDistances(const Point2D& target,
+                                         double* output) const -> void {
+  kernels::CalculateDistances(xs_, ys_, count_, target.GetX(), target.GetY(),
+                              output);
+}
+
+auto PointFileReader::Close() noexcept -> void {
+  if (data_ != nullptr) {
+#if defined(_WIN32)
+    UnmapViewOfFile(data_);
+#else
+    ::munmap(const_cast<unsigned char*>(data_), size_);
+#endif
+  }
+  data_ = nullptr;
+  size_ = 0U;
+  count_ = 0U;
+  xs_ = nullptr;
+  ys_ = nullptr;
+  attributes_.clear();
+}
+}  // namespace programmers::geometry
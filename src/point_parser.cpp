@@ -0,0 +1,376 @@
+/**
+ * @file geometry/point_parser.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief CSV and WKT point text parser developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/point_parser.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#include "geometry/thread_pool.hpp"
+#include "unique_file.hpp"
+
+namespace {
+using programmers::geometry::PointCloud2D;
+using programmers::geometry::ThreadPool;
+using programmers::geometry::WktType;
+
+constexpr std::size_t kParallelGrain{1U << 20U};
+
+/**
+ * @brief Malformed line, thrown inside a chunk and turned into ParseError
+ */
+struct LineFailure {
+  const char* position;  ///< Offending character
+  const char* message;   ///< What was expected
+};
+
+/**
+ * @brief Reading position in one line
+ */
+class Cursor {
+ public:
+  Cursor(const char* begin, const char* end) : current_(begin), end_(end) {}
+
+  auto SkipSpace() -> void {
+    while (current_ != end_ && (*current_ == ' ' || *current_ == '\t')) {
+      ++current_;
+    }
+  }
+  [[nodiscard]] auto AtEnd() const -> bool { return current_ == end_; }
+  [[nodiscard]] auto Position() const -> const char* { return current_; }
+  [[nodiscard]] auto End() const -> const char* { return end_; }
+
+  auto Consume(char character) -> bool {
+    SkipSpace();
+    if (current_ != end_ && *current_ == character) {
+      ++current_;
+      return true;
+    }
+    return false;
+  }
+  auto Expect(char character, const char* message) -> void {
+    if (!Consume(character)) {
+      Fail(message);
+    }
+  }
+  /**
+   * @brief Consume an ASCII keyword in any case, not followed by a letter
+   */
+  auto ConsumeKeyword(std::string_view keyword) -> bool {
+    SkipSpace();
+    if (static_cast<std::size_t>(end_ - current_) < keyword.size()) {
+      return false;
+    }
+    for (std::size_t i = 0; i < keyword.size(); ++i) {
+      if ((current_[i] & ~0x20) != keyword[i]) {
+        return false;
+      }
+    }
+    const auto* next{current_ + keyword.size()};
+    if (next != end_ && ((*next & ~0x20) >= 'A' && (*next & ~0x20) <= 'Z')) {
+      return false;
+    }
+    current_ = next;
+    return true;
+  }
+  auto ParseNumber() -> double {
+    SkipSpace();
+    if (current_ != end_ && *current_ == '+') {
+      ++current_;
+    }
+    double value{0.0};
+    const auto [next, error]{std::from_chars(current_, end_, value)};
+    if (error == std::errc::result_out_of_range) {
+      Fail("number is out of range");
+    }
+    if (error != std::errc()) {
+      Fail("expected a number");
+    }
+    current_ = next;
+    return value;
+  }
+  [[noreturn]] auto Fail(const char* message) const -> void {
+    throw LineFailure{current_, message};
+  }
+
+ private:
+  const char* current_;  ///< Next character
+  const char* end_;      ///< End of the line, without the line break
+};
+
+/**
+ * @brief Output and first error of one chunk of lines
+ */
+struct Chunk {
+  std::string_view text;           ///< Whole lines
+  std::vector<double> xs;          ///< Parsed x coordinates
+  std::vector<double> ys;          ///< Parsed y coordinates
+  std::vector<std::size_t> sizes;  ///< Vertices of every WKT geometry
+  std::vector<WktType> types;      ///< Type of every WKT geometry
+  std::size_t lines{0U};           ///< Lines read so far
+  bool failed{false};              ///< Whether a line is malformed
+  std::size_t error_column{0U};    ///< 1 based column of the error
+  const char* message{nullptr};    ///< What was expected
+};
+
+/**
+ * @brief Parse every line of a chunk, stopping at the first malformed one
+ */
+template <typename LineParser>
+auto ParseLines(Chunk& chunk, const LineParser& parse_line) -> void {
+  const auto* current{chunk.text.data()};
+  const auto* end{current + chunk.text.size()};
+  while (current != end) {
+    const auto* newline{static_cast<const char*>(
+        std::memchr(current, '\n', static_cast<std::size_t>(end - current)))};
+    auto line_end{newline != nullptr ? newline : end};
+    ++chunk.lines;
+    if (line_end != current && line_end[-1] == '\r') {
+      --line_end;
+    }
+    try {
+      Cursor cursor(current, line_end);
+      cursor.SkipSpace();
+      if (!cursor.AtEnd()) {
+        parse_line(cursor, chunk);
+      }
+    } catch (const LineFailure& failure) {
+      chunk.failed = true;
+      chunk.error_column = static_cast<std::size_t>(failure.position -
+                                                    current) +
+                           1U;
+      chunk.message = failure.message;
+      return;
+    }
+    current = newline != nullptr ? newline + 1 : end;
+  }
+}
+
+/**
+ * @brief Split text into chunks of whole lines, one per thread
+ */
+auto SplitLines(std::string_view text) -> std::vector<Chunk> {
+  const auto thread_count{std::clamp<std::size_t>(
+      std::min<std::size_t>(ThreadPool::GetDefault().GetThreadCount(),
+                            text.size() / kParallelGrain),
+      1U, 64U)};
+  std::vector<Chunk> chunks;
+  std::size_t begin{0U};
+  for (std::size_t i = 1; i <= thread_count && begin < text.size(); ++i) {
+    auto end{text.size()};
+    if (i < thread_count) {
+      end = text.find('\n', std::max(begin, text.size() * i / thread_count));
+      end = end == std::string_view::npos ? text.size() : end + 1U;
+    }
+    chunks.emplace_back();
+    chunks.back().text = text.substr(begin, end - begin);
+    begin = end;
+  }
+  return chunks;
+}
+
+/**
+ * @brief Parse text in parallel chunks, throwing the first error in order
+ * @param first_line 1 based line number of the first line of text
+ */
+template <typename LineParser>
+auto ParseChunks(std::string_view text, std::size_t first_line,
+                 const LineParser& parse_line) -> std::vector<Chunk> {
+  auto chunks{SplitLines(text)};
+  ThreadPool::GetDefault().Run(
+      chunks.size(), [&](std::size_t i) { ParseLines(chunks[i], parse_line); });
+  auto line{first_line};
+  for (const auto& chunk : chunks) {
+    if (chunk.failed) {
+      throw programmers::geometry::ParseError(
+          line + chunk.lines - 1U, chunk.error_column, chunk.message);
+    }
+    line += chunk.lines;
+  }
+  return chunks;
+}
+
+/**
+ * @brief Concatenate the coordinates of every chunk into a point cloud
+ */
+auto MergePoints(const std::vector<Chunk>& chunks) -> PointCloud2D {
+  std::vector<std::size_t> offsets(chunks.size() + 1U, 0U);
+  for (std::size_t i = 0; i < chunks.size(); ++i) {
+    offsets[i + 1U] = offsets[i] + chunks[i].xs.size();
+  }
+  PointCloud2D points(offsets.back());
+  ThreadPool::GetDefault().Run(chunks.size(), [&](std::size_t i) {
+    std::copy(chunks[i].xs.begin(), chunks[i].xs.end(),
+              points.XData() + offsets[i]);
+    std::copy(chunks[i].ys.begin(), chunks[i].ys.end(),
+              points.YData() + offsets[i]);
+  });
+  return points;
+}
+
+auto ParseCsvField(const char* begin, const char* end) -> double {
+  Cursor cursor(begin, end);
+  const auto value{cursor.ParseNumber()};
+  cursor.SkipSpace();
+  if (!cursor.AtEnd()) {
+    cursor.Fail("unexpected character after number");
+  }
+  return value;
+}
+
+auto ReadFile(const std::string& path) -> std::string {
+  const programmers::geometry::detail::UniqueFile file(
+      std::fopen(path.c_str(), "rb"));
+  if (!file) {
+    throw std::system_error(errno, std::generic_category(),
+                            "Cannot open " + path);
+  }
+  // One allocation of the file size, so a large file is neither
+  // reallocated while it grows nor held twice; reads past it still append
+  // in case the file grew meanwhile.
+  std::error_code error;
+  const auto size{std::filesystem::file_size(path, error)};
+  std::string text(error ? 0U : static_cast<std::size_t>(size), '\0');
+  std::size_t length{0U};
+  std::size_t read{0U};
+  while (length < text.size() &&
+         (read = std::fread(text.data() + length, 1U, text.size() - length,
+                            file.get())) > 0U) {
+    length += read;
+  }
+  text.resize(length);
+  char buffer[1U << 16U];
+  while ((read = std::fread(buffer, 1U, sizeof(buffer), file.get())) > 0U) {
+    text.append(buffer, read);
+  }
+  if (std::ferror(file.get()) != 0) {
+    throw std::system_error(errno, std::generic_category(),
+                            "Cannot read " + path);
+  }
+  return text;
+}
+}  // namespace
+
+namespace programmers::geometry {
+ParseError::ParseError(std::size_t line, std::size_t column,
+                       const std::string& message)
+    : std::runtime_error("line " + std::to_string(line) + ", column " +
+                         std::to_string(column) + ": " + message),
+      line_(line),
+      column_(column) {}
+
+auto ParseError::GetLine() const -> std::size_t { return line_; }
+
+auto ParseError::GetColumn() const -> std::size_t { return column_; }
+
+auto ParseCsvPoints(std::string_view text, const CsvFormat& format)
+    -> PointCloud2D {
+  if (format.x_field == format.y_field) {
+    throw std::invalid_argument("CsvFormat reads x and y from one field");
+  }
+  std::size_t first_line{1U};
+  if (format.has_header) {
+    const auto header_end{text.find('\n')};
+    text.remove_prefix(header_end == std::string_view::npos ? text.size()
+                                                            : header_end + 1U);
+    ++first_line;
+  }
+  const auto last_field{std::max(format.x_field, format.y_field)};
+  const auto chunks{
+      ParseChunks(text, first_line, [&](Cursor& cursor, Chunk& chunk) {
+        double x{0.0};
+        double y{0.0};
+        const auto* field_begin{cursor.Position()};
+        for (std::size_t field = 0; field <= last_field; ++field) {
+          const auto* field_end{
+              std::find(field_begin, cursor.End(), format.delimiter)};
+          if (field == format.x_field) {
+            x = ParseCsvField(field_begin, field_end);
+          } else if (field == format.y_field) {
+            y = ParseCsvField(field_begin, field_end);
+          }
+          if (field_end == cursor.End() && field < last_field) {
+            throw LineFailure{field_end, "expected more fields"};
+          }
+          field_begin = field_end + 1;
+        }
+        chunk.xs.push_back(x);
+        chunk.ys.push_back(y);
+      })};
+  return MergePoints(chunks);
+}
+
+auto ReadCsvPoints(const std::string& path, const CsvFormat& format)
+    -> PointCloud2D {
+  return ParseCsvPoints(ReadFile(path), format);
+}
+
+auto ParseWkt(std::string_view text) -> WktCollection {
+  const auto chunks{
+      ParseChunks(text, 1U, [](Cursor& cursor, Chunk& chunk) {
+        const auto* geometry{cursor.Position()};
+        WktType type{WktType::kPoint};
+        if (cursor.ConsumeKeyword("LINESTRING")) {
+          type = WktType::kLineString;
+        } else if (!cursor.ConsumeKeyword("POINT")) {
+          cursor.Fail("expected POINT or LINESTRING");
+        }
+        std::size_t count{0U};
+        if (!cursor.ConsumeKeyword("EMPTY")) {
+          cursor.Expect('(', "expected '(' or EMPTY");
+          do {
+            chunk.xs.push_back(cursor.ParseNumber());
+            if (cursor.AtEnd() ||
+                (*cursor.Position() != ' ' && *cursor.Position() != '\t')) {
+              cursor.Fail("expected a space between coordinates");
+            }
+            chunk.ys.push_back(cursor.ParseNumber());
+            ++count;
+          } while (type == WktType::kLineString && cursor.Consume(','));
+          cursor.Expect(')', type == WktType::kLineString
+                                 ? "expected ',' or ')'"
+                                 : "expected ')'");
+        }
+        cursor.SkipSpace();
+        if (!cursor.AtEnd()) {
+          cursor.Fail("unexpected character after geometry");
+        }
+        if (type == WktType::kLineString && count == 1U) {
+          throw LineFailure{geometry, "LINESTRING needs two points or EMPTY"};
+        }
+        chunk.sizes.push_back(count);
+        chunk.types.push_back(type);
+      })};
+
+  WktCollection collection;
+  collection.points = MergePoints(chunks);
+  collection.offsets.push_back(0U);
+  for (const auto& chunk : chunks) {
+    for (const auto size : chunk.sizes) {
+      collection.offsets.push_back(collection.offsets.back() + size);
+    }
+    collection.types.insert(collection.types.end(), chunk.types.begin(),
+                            chunk.types.end());
+  }
+  return collection;
+}
+
+auto ReadWkt(const std::string& path) -> WktCollection {
+  return ParseWkt(ReadFile(path));
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,124 @@
+/**
+ * @file geometry/polygon2d.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Polygon class with holes developments with 2-dimension
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/polygon2d.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "geometry/predicates.hpp"
+
+namespace {
+using programmers::geometry::Point2D;
+using Ring = programmers::geometry::Polygon2D::Ring;
+
+/**
+ * @brief Drop the closing vertex and check the ring
+ */
+auto NormalizeRing(Ring& ring) -> void {
+  if (ring.size() > 1U && ring.front() == ring.back()) {
+    ring.pop_back();
+  }
+  if (ring.size() < 3U) {
+    throw std::invalid_argument("Polygon ring needs at least 3 vertices");
+  }
+  for (const auto& vertex : ring) {
+    if (!std::isfinite(vertex.GetX()) || !std::isfinite(vertex.GetY())) {
+      throw std::invalid_argument("Polygon vertex is not finite");
+    }
+  }
+}
+
+/**
+ * @brief Calculate the signed area of a ring, positive if counter clockwise
+ */
+auto CalculateSignedArea(const Ring& ring) -> double {
+  double twice_area{0.0};
+  for (std::size_t i = 0; i < ring.size(); ++i) {
+    const auto& from{ring[i]};
+    const auto& to{ring[i + 1U == ring.size() ? 0U : i + 1U]};
+    twice_area += from.GetX() * to.GetY() - to.GetX() * from.GetY();
+  }
+  return twice_area / 2.0;
+}
+
+/**
+ * @brief Count the ring edges crossed by the ray from point, modulo 2
+ */
+auto CrossesOddly(const Ring& ring, const Point2D& point) -> bool {
+  using programmers::geometry::Orientation;
+  bool inside{false};
+  for (std::size_t i = 0; i < ring.size(); ++i) {
+    const auto& from{ring[i]};
+    const auto& to{ring[i + 1U == ring.size() ? 0U : i + 1U]};
+    if ((from.GetY() > point.GetY()) == (to.GetY() > point.GetY())) {
+      continue;
+    }
+    const auto& lower{from.GetY() < to.GetY() ? from : to};
+    const auto& upper{from.GetY() < to.GetY() ? to : from};
+    if (CalculateOrientation(lower, upper, point) ==
+        Orientation::kCounterClockwise) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+}  // namespace
+
+namespace programmers::geometry {
+Polygon2D::Polygon2D(Ring exterior, std::vector<Ring> holes)
+    : exterior_(std::move(exterior)), holes_(std::move(holes)) {
+  NormalizeRing(exterior_);
+  for (auto& hole : holes_) {
+    NormalizeRing(hole);
+  }
+}
+
+auto Polygon2D::GetExterior() const -> const Ring& { return exterior_; }
+
+auto Polygon2D::GetHoles() const -> const std::vector<Ring>& {
+  return holes_;
+}
+
+auto Polygon2D::GetVertexCount() const -> std::size_t {
+  auto count{exterior_.size()};
+  for (const auto& hole : holes_) {
+    count += hole.size();
+  }
+  return count;
+}
+
+auto Polygon2D::GetBoundingBox() const -> BoundingBox2D {
+  BoundingBox2D box;
+  for (const auto& vertex : exterior_) {
+    box.Extend(vertex);
+  }
+  return box;
+}
+
+auto Polygon2D::CalculateArea() const -> double {
+  auto area{std::abs(CalculateSignedArea(exterior_))};
+  for (const auto& hole : holes_) {
+    area -= std::abs(CalculateSignedArea(hole));
+  }
+  return area;
+}
+
+auto Polygon2D::Contains(const Point2D& point) const -> bool {
+  auto inside{CrossesOddly(exterior_, point)};
+  for (const auto& hole : holes_) {
+    inside = inside != CrossesOddly(hole, point);
+  }
+  return inside;
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,278 @@
+/**
+ * @file geometry/polygon_index.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Point in polygon index over many polygons developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/polygon_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "geometry/predicates.hpp"
+#include "geometry/thread_pool.hpp"
+#include "grid_cells.hpp"
+
+namespace {
+constexpr std::size_t kCellsPerPolygon{4U};     ///< Grid cells per polygon
+constexpr std::size_t kBandEntriesPerEdge{8U};  ///< Band copies per edge
+}  // namespace
+
+namespace programmers::geometry {
+PolygonIndex::PolygonIndex(std::vector<Polygon2D> polygons)
+    : polygons_(std::move(polygons)) {
+  if (polygons_.size() > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("Too many polygons for PolygonIndex");
+  }
+  boxes_.reserve(polygons_.size());
+  bands_.reserve(polygons_.size());
+  for (const auto& polygon : polygons_) {
+    boxes_.push_back(polygon.GetBoundingBox());
+    BuildBands(polygon);
+  }
+  BuildGrid();
+}
+
+auto PolygonIndex::Size() const -> std::size_t { return polygons_.size(); }
+
+auto PolygonIndex::GetPolygon(std::size_t index) const -> const Polygon2D& {
+  return polygons_[index];
+}
+
+auto PolygonIndex::FindContaining(const Point2D& point) const
+    -> std::size_t {
+  // NaN fails the box test.
+  if (!grid_box_.Contains(point)) {
+    return kNotFound;
+  }
+  const auto minimum{grid_box_.GetMinimum()};
+  const auto cell{GetCell(point.GetY(), minimum.GetY(), rows_) * columns_ +
+                  GetCell(point.GetX(), minimum.GetX(), columns_)};
+  for (auto entry = cell_begins_[cell]; entry < cell_begins_[cell + 1U];
+       ++entry) {
+    const auto polygon{cell_polygons_[entry]};
+    if (boxes_[polygon].Contains(point) &&
+        Contains(polygon, point.GetX(), point.GetY())) {
+      return polygon;
+    }
+  }
+  return kNotFound;
+}
+
+auto PolygonIndex::FindContaining(const PointCloud2D& points) const
+    -> std::vector<std::size_t> {
+  std::vector<std::size_t> output(points.Size());
+  FindContaining(points.XData(), points.YData(), points.Size(),
+                 output.data());
+  return output;
+}
+
+auto PolygonIndex::FindContaining(const double* xs, const double* ys,
+                                  std::size_t count,
+                                  std::size_t* output) const -> void {
+  ParallelOptions options;
+  options.grain = 1024U;
+  ParallelFor(
+      count,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          output[i] = FindContaining(Point2D(xs[i], ys[i]));
+        }
+      },
+      options);
+}
+
+auto PolygonIndex::BuildBands(const Polygon2D& polygon) -> void {
+  // Horizontal edges never cross a half-open ray, so they are left out.
+  struct Edge {
+    Point2D lower;
+    Point2D upper;
+  };
+  std::vector<Edge> edges;
+  edges.reserve(polygon.GetVertexCount());
+  const auto add_ring{[&](const Polygon2D::Ring& ring) {
+    for (std::size_t i = 0; i < ring.size(); ++i) {
+      const auto& from{ring[i]};
+      const auto& to{ring[i + 1U == ring.size() ? 0U : i + 1U]};
+      if (from.GetY() < to.GetY()) {
+        edges.push_back({from, to});
+      } else if (to.GetY() < from.GetY()) {
+        edges.push_back({to, from});
+      }
+    }
+  }};
+  add_ring(polygon.GetExterior());
+  for (const auto& hole : polygon.GetHoles()) {
+    add_ring(hole);
+  }
+
+  const auto& box{boxes_.back()};
+  Bands bands;
+  bands.first = band_begins_.size();
+  bands.min_y = box.IsEmpty() ? 0.0 : box.GetMinimum().GetY();
+  const auto set_count{[&](std::size_t count) {
+    bands.count = count;
+    bands.height = box.GetHeight() > 0.0
+                       ? box.GetHeight() / static_cast<double>(count)
+                       : 1.0;
+  }};
+  set_count(std::max<std::size_t>(edges.size(), 1U));
+  // An edge goes to every band between those of its ends; the band of a
+  // point between them is between them too, as detail::GetCell is monotone.
+  const auto get_band{[&](double y) {
+    return detail::GetCell(y, bands.min_y, bands.height, bands.count);
+  }};
+  // Long edges of combs, stars and spikes span most bands, so halve the
+  // bands until the copies are linear in the edges; one band always is.
+  const auto count_entries{[&]() {
+    std::size_t entries{0U};
+    for (const auto& edge : edges) {
+      entries += get_band(edge.upper.GetY()) - get_band(edge.lower.GetY()) + 1U;
+    }
+    return entries;
+  }};
+  while (bands.count > 1U &&
+         count_entries() > kBandEntriesPerEdge * edges.size()) {
+    set_count((bands.count + 1U) / 2U);
+  }
+  std::vector<std::size_t> begins(bands.count + 1U, 0U);
+  for (const auto& edge : edges) {
+    for (auto band = get_band(edge.lower.GetY());
+         band <= get_band(edge.upper.GetY()); ++band) {
+      ++begins[band + 1U];
+    }
+  }
+  const auto base{lower_xs_.size()};
+  for (std::size_t band = 0; band < bands.count; ++band) {
+    begins[band + 1U] += begins[band];
+  }
+  for (const auto begin : begins) {
+    band_begins_.push_back(base + begin);
+  }
+  const auto size{base + begins.back()};
+  lower_xs_.resize(size);
+  lower_ys_.resize(size);
+  upper_xs_.resize(size);
+  upper_ys_.resize(size);
+  for (const auto& edge : edges) {
+    for (auto band = get_band(edge.lower.GetY());
+         band <= get_band(edge.upper.GetY()); ++band) {
+      const auto slot{base + begins[band]++};
+      lower_xs_[slot] = edge.lower.GetX();
+      lower_ys_[slot] = edge.lower.GetY();
+      upper_xs_[slot] = edge.upper.GetX();
+      upper_ys_[slot] = edge.upper.GetY();
+    }
+  }
+  bands_.push_back(bands);
+}
+
+auto PolygonIndex::BuildGrid() -> void {
+  for (const auto& box : boxes_) {
+    grid_box_ = grid_box_.Union(box);
+  }
+  if (grid_box_.IsEmpty()) {
+    cell_begins_.assign(1U, 0U);
+    return;
+  }
+  // Square cells, about kCellsPerPolygon per polygon even when the boxes
+  // are long and thin.
+  const auto width{grid_box_.GetWidth()};
+  const auto height{grid_box_.GetHeight()};
+  const auto target{static_cast<double>(kCellsPerPolygon * polygons_.size())};
+  cell_size_ = std::max(std::sqrt(width * height / target),
+                        std::max(width, height) / target);
+  if (!(cell_size_ > 0.0)) {
+    cell_size_ = 1.0;
+  }
+  columns_ = static_cast<std::size_t>(width / cell_size_) + 1U;
+  rows_ = static_cast<std::size_t>(height / cell_size_) + 1U;
+
+  const auto minimum{grid_box_.GetMinimum()};
+  const auto for_each_cell{[&](const BoundingBox2D& box, const auto& task) {
+    if (box.IsEmpty()) {
+      return;
+    }
+    const auto first_column{
+        GetCell(box.GetMinimum().GetX(), minimum.GetX(), columns_)};
+    const auto last_column{
+        GetCell(box.GetMaximum().GetX(), minimum.GetX(), columns_)};
+    for (auto row = GetCell(box.GetMinimum().GetY(), minimum.GetY(), rows_);
+         row <= GetCell(box.GetMaximum().GetY(), minimum.GetY(), rows_);
+         ++row) {
+      for (auto column = first_column; column <= last_column; ++column) {
+        task(row * columns_ + column);
+      }
+    }
+  }};
+  cell_begins_.assign(columns_ * rows_ + 1U, 0U);
+  for (const auto& box : boxes_) {
+    for_each_cell(box, [&](std::size_t cell) { ++cell_begins_[cell + 1U]; });
+  }
+  for (std::size_t cell = 0; cell < columns_ * rows_; ++cell) {
+    cell_begins_[cell + 1U] += cell_begins_[cell];
+  }
+  cell_polygons_.resize(cell_begins_.back());
+  auto cursors{cell_begins_};
+  for (std::size_t polygon = 0; polygon < boxes_.size(); ++polygon) {
+    for_each_cell(boxes_[polygon], [&](std::size_t cell) {
+      cell_polygons_[cursors[cell]++] = static_cast<uint32_t>(polygon);
+    });
+  }
+}
+
+auto PolygonIndex::GetCell(double value, double origin,
+                           std::size_t count) const -> std::size_t {
+  return detail::GetCell(value, origin, cell_size_, count);
+}
+
+auto PolygonIndex::Contains(std::size_t polygon, double x, double y) const
+    -> bool {
+  const auto& bands{bands_[polygon]};
+  const auto band{bands.first +
+                  detail::GetCell(y, bands.min_y, bands.height, bands.count)};
+  const auto begin{band_begins_[band]};
+  const auto end{band_begins_[band + 1U]};
+  const auto* lower_xs{lower_xs_.data()};
+  const auto* lower_ys{lower_ys_.data()};
+  const auto* upper_xs{upper_xs_.data()};
+  const auto* upper_ys{upper_ys_.data()};
+
+  // Count edges crossing the ray of y that are certainly right of the
+  // point, and those too close to tell, without branches.
+  std::size_t crossings{0U};
+  std::size_t uncertain{0U};
+  for (auto k = begin; k < end; ++k) {
+    const auto spans{(lower_ys[k] <= y) & (y < upper_ys[k])};
+    const auto left{(lower_xs[k] - x) * (upper_ys[k] - y)};
+    const auto right{(lower_ys[k] - y) * (upper_xs[k] - x)};
+    const auto determinant{left - right};
+    const auto bound{predicates::kOrientationErrorBound *
+                     (std::abs(left) + std::abs(right))};
+    const auto is_left{determinant > bound};
+    const auto is_right{-determinant > bound};
+    crossings += static_cast<std::size_t>(spans & is_left);
+    uncertain += static_cast<std::size_t>(spans & !is_left & !is_right);
+  }
+  if (uncertain != 0U) {
+    crossings = 0U;
+    for (auto k = begin; k < end; ++k) {
+      if (lower_ys[k] <= y && y < upper_ys[k] &&
+          CalculateOrientation(lower_xs[k], lower_ys[k], upper_xs[k],
+                               upper_ys[k], x, y) ==
+              Orientation::kCounterClockwise) {
+        ++crossings;
+      }
+    }
+  }
+  return crossings % 2U == 1U;
+}
+}  // namespace programmers::geometry
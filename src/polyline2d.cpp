@@ -0,0 +1,291 @@
+/**
+ * @file geometry/polyline2d.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Polyline class developments with arc length prefix sums
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/polyline2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+/**
+ * @brief Get the squared distance from a point to an axis aligned box
+ */
+template <typename Box>
+auto GetSquaredBoxDistance(const Box& box, double x, double y) -> double {
+  const auto dx{std::max({box.min_x - x, 0.0, x - box.max_x})};
+  const auto dy{std::max({box.min_y - y, 0.0, y - box.max_y})};
+  return dx * dx + dy * dy;
+}
+
+/**
+ * @brief Get the smallest box holding both boxes
+ */
+template <typename Box>
+auto Merge(const Box& lhs, const Box& rhs) -> Box {
+  return {std::min(lhs.min_x, rhs.min_x), std::min(lhs.min_y, rhs.min_y),
+          std::max(lhs.max_x, rhs.max_x), std::max(lhs.max_y, rhs.max_y)};
+}
+}  // namespace
+
+namespace programmers::geometry {
+Polyline2D::Polyline2D(Distance::Type unit) : unit_(unit) {}
+
+Polyline2D::Polyline2D(const std::vector<Point2D>& points,
+                       Distance::Type unit)
+    : unit_(unit) {
+  Reserve(points.size());
+  for (const auto& point : points) {
+    Append(point);
+  }
+}
+
+auto Polyline2D::Size() const -> std::size_t { return points_.Size(); }
+
+auto Polyline2D::Empty() const -> bool { return points_.Empty(); }
+
+auto Polyline2D::Reserve(std::size_t count) -> void {
+  points_.Reserve(count);
+  lengths_.Reserve(count);
+}
+
+auto Polyline2D::Clear() -> void {
+  points_.Clear();
+  lengths_.Clear();
+  levels_.clear();
+}
+
+auto Polyline2D::Append(const Point2D& point) -> void {
+  if (Empty()) {
+    points_.PushBack(point);
+    lengths_.PushBack(Distance{});
+    return;
+  }
+  const auto last{points_.GetPoint(Size() - 1U)};
+  // Compute everything that can throw before changing any member.
+  const auto length{GetLength().Add(
+      Distance(last.CalculateDistance(point), unit_, Rounding::kNearest))};
+  const Box box{std::min(last.GetX(), point.GetX()),
+                std::min(last.GetY(), point.GetY()),
+                std::max(last.GetX(), point.GetX()),
+                std::max(last.GetY(), point.GetY())};
+  points_.PushBack(point);
+  lengths_.PushBack(length);
+
+  const auto segment{Size() - 2U};
+  if (levels_.empty()) {
+    levels_.emplace_back();
+  }
+  for (std::size_t level = 0; level < levels_.size(); ++level) {
+    auto& boxes{levels_[level]};
+    const auto index{segment >> level};
+    if (index == boxes.size()) {
+      boxes.push_back(box);
+    } else {
+      boxes[index] = Merge(boxes[index], box);
+    }
+  }
+  // Keep a single root box on the top level.
+  while (levels_.back().size() > 1U) {
+    const auto& top{levels_.back()};
+    levels_.push_back({Merge(top[0], top[1])});
+  }
+}
+
+auto Polyline2D::GetUnit() const -> Distance::Type { return unit_; }
+
+auto Polyline2D::GetPoint(std::size_t index) const -> Point2D {
+  return points_.GetPoint(index);
+}
+
+auto Polyline2D::GetPoints() const -> const PointCloud2D& { return points_; }
+
+auto Polyline2D::GetLength() const -> Distance {
+  return Empty() ? Distance{} : lengths_.GetDistance(Size() - 1U);
+}
+
+auto Polyline2D::GetLength(std::size_t index) const -> Distance {
+  return lengths_.GetDistance(index);
+}
+
+auto Polyline2D::GetLengths() const -> const DistanceArray& {
+  return lengths_;
+}
+
+auto Polyline2D::FindSegment(const Distance& along) const -> std::size_t {
+  if (Size() < 2U) {
+    throw std::out_of_range("Polyline2D has no segment");
+  }
+  const auto* begin{lengths_.Data()};
+  const auto* end{begin + Size()};
+  // The last vertex at or before along starts a segment of positive length
+  // unless along is past the end.
+  const auto found{std::upper_bound(begin, end, along.GetNanometer())};
+  const auto vertex{found == begin ? std::size_t{0U}
+                                   : static_cast<std::size_t>(found - begin) -
+                                         1U};
+  return std::min(vertex, Size() - 2U);
+}
+
+auto Polyline2D::Interpolate(const Distance& along) const -> Point2D {
+  if (Empty()) {
+    throw std::out_of_range("Polyline2D is empty");
+  }
+  if (Size() == 1U) {
+    return points_.GetPoint(0U);
+  }
+  return InterpolateSegment(FindSegment(along), along.GetNanometer());
+}
+
+auto Polyline2D::Interpolate(const DistanceArray& alongs) const
+    -> PointCloud2D {
+  if (Empty()) {
+    throw std::out_of_range("Polyline2D is empty");
+  }
+  PointCloud2D result(alongs.Size());
+  if (Size() == 1U) {
+    std::fill_n(result.XData(), result.Size(), points_.GetX(0U));
+    std::fill_n(result.YData(), result.Size(), points_.GetY(0U));
+    return result;
+  }
+  const auto* lengths{lengths_.Data()};
+  const auto last_segment{Size() - 2U};
+  std::size_t segment{0U};
+  for (std::size_t i = 0; i < alongs.Size(); ++i) {
+    const auto along{alongs.GetNanometer(i)};
+    if (along < lengths[segment]) {
+      segment = FindSegment(Distance::FromNanometer(along));
+    } else {
+      // Gallop forward from the previous segment, then bisect the bracket.
+      std::size_t step{1U};
+      auto low{segment};
+      while (low + step <= last_segment && lengths[low + step] <= along) {
+        low += step;
+        step *= 2U;
+      }
+      const auto high{std::min(low + step, last_segment + 1U)};
+      const auto found{
+          std::upper_bound(lengths + low, lengths + high + 1U, along)};
+      segment = std::min(static_cast<std::size_t>(found - lengths) - 1U,
+                         last_segment);
+    }
+    const auto point{InterpolateSegment(segment, along)};
+    result.XData()[i] = point.GetX();
+    result.YData()[i] = point.GetY();
+  }
+  return result;
+}
+
+auto Polyline2D::FindNearest(const Point2D& query) const
+    -> PolylineProjection {
+  if (Empty()) {
+    throw std::out_of_range("Polyline2D is empty");
+  }
+  const auto query_x{query.GetX()};
+  const auto query_y{query.GetY()};
+  if (Size() == 1U) {
+    const auto vertex{points_.GetPoint(0U)};
+    return {vertex, Distance{}, 0U,
+            Point2D::CalculateSquaredDistance(vertex, query)};
+  }
+
+  // Depth first from the root box, nearer child first, pruning boxes that
+  // cannot beat the best segment so far.
+  PolylineProjection best;
+  best.squared_distance = std::numeric_limits<double>::infinity();
+  std::vector<std::pair<std::size_t, std::size_t>> stack;
+  stack.reserve(2U * levels_.size());
+  stack.emplace_back(levels_.size() - 1U, 0U);
+  while (!stack.empty()) {
+    const auto [level, index]{stack.back()};
+    stack.pop_back();
+    if (GetSquaredBoxDistance(levels_[level][index], query_x, query_y) >=
+        best.squared_distance) {
+      continue;
+    }
+    if (level == 0U) {
+      const auto projection{ProjectSegment(index, query_x, query_y)};
+      if (projection.squared_distance < best.squared_distance) {
+        best = projection;
+      }
+      continue;
+    }
+    const auto& children{levels_[level - 1U]};
+    const auto left{2U * index};
+    if (left + 1U >= children.size()) {
+      stack.emplace_back(level - 1U, left);
+      continue;
+    }
+    const auto left_distance{
+        GetSquaredBoxDistance(children[left], query_x, query_y)};
+    const auto right_distance{
+        GetSquaredBoxDistance(children[left + 1U], query_x, query_y)};
+    if (left_distance <= right_distance) {
+      stack.emplace_back(level - 1U, left + 1U);
+      stack.emplace_back(level - 1U, left);
+    } else {
+      stack.emplace_back(level - 1U, left);
+      stack.emplace_back(level - 1U, left + 1U);
+    }
+  }
+  return best;
+}
+
+auto Polyline2D::FindNearest(const PointCloud2D& queries) const
+    -> std::vector<PolylineProjection> {
+  std::vector<PolylineProjection> projections;
+  projections.reserve(queries.Size());
+  for (std::size_t i = 0; i < queries.Size(); ++i) {
+    projections.push_back(FindNearest(queries.GetPoint(i)));
+  }
+  return projections;
+}
+
+auto Polyline2D::InterpolateSegment(std::size_t segment, int64_t along) const
+    -> Point2D {
+  const auto* lengths{lengths_.Data()};
+  const auto start{lengths[segment]};
+  const auto length{lengths[segment + 1U] - start};
+  const auto clamped{std::clamp(along, start, lengths[segment + 1U])};
+  const auto ratio{length == 0 ? 0.0
+                               : static_cast<double>(clamped - start) /
+                                     static_cast<double>(length)};
+  const auto x{points_.GetX(segment)};
+  const auto y{points_.GetY(segment)};
+  return {x + (points_.GetX(segment + 1U) - x) * ratio,
+          y + (points_.GetY(segment + 1U) - y) * ratio};
+}
+
+auto Polyline2D::ProjectSegment(std::size_t segment, double query_x,
+                                double query_y) const -> PolylineProjection {
+  const auto x{points_.GetX(segment)};
+  const auto y{points_.GetY(segment)};
+  const auto dx{points_.GetX(segment + 1U) - x};
+  const auto dy{points_.GetY(segment + 1U) - y};
+  const auto squared_length{dx * dx + dy * dy};
+  const auto ratio{
+      squared_length > 0.0
+          ? std::clamp(((query_x - x) * dx + (query_y - y) * dy) /
+                           squared_length,
+                       0.0, 1.0)
+          : 0.0};
+  const Point2D point(x + dx * ratio, y + dy * ratio);
+  const auto start{lengths_.GetNanometer(segment)};
+  const auto length{lengths_.GetNanometer(segment + 1U) - start};
+  const auto along{start + static_cast<int64_t>(std::llround(
+                               static_cast<double>(length) * ratio))};
+  return {point, Distance::FromNanometer(along), segment,
+          Point2D::CalculateSquaredDistance(point, Point2D(query_x, query_y))};
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,104 @@
+/**
+ * @file geometry/predicates.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Robust geometric predicates developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/predicates.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace {
+using programmers::geometry::Orientation;
+
+constexpr std::size_t kTermCount{12U};  ///< Exact terms of the determinant
+
+/**
+ * @brief Floating point expansion, nonoverlapping components by magnitude
+ */
+struct Expansion {
+  std::array<double, kTermCount> components{};
+  std::size_t size{0U};
+
+  /**
+   * @brief Add value exactly (Shewchuk's Grow-Expansion)
+   */
+  auto Add(double value) -> void {
+    for (std::size_t i = 0; i < size; ++i) {
+      // Two-Sum: sum + error == value + components[i] exactly.
+      const auto sum{value + components[i]};
+      const auto virtual_value{sum - components[i]};
+      const auto virtual_component{sum - virtual_value};
+      const auto error{(value - virtual_value) +
+                       (components[i] - virtual_component)};
+      components[i] = error;
+      value = sum;
+    }
+    components[size++] = value;
+  }
+
+  /**
+   * @brief Get the sign of the exact sum, that of the largest nonzero term
+   */
+  [[nodiscard]] auto GetSign() const -> Orientation {
+    for (auto i = size; i > 0U; --i) {
+      if (components[i - 1U] != 0.0) {
+        return components[i - 1U] > 0.0 ? Orientation::kCounterClockwise
+                                        : Orientation::kClockwise;
+      }
+    }
+    return Orientation::kCollinear;
+  }
+};
+
+/**
+ * @brief Add lhs * rhs exactly as a product and its rounding error
+ */
+auto AddProduct(Expansion& expansion, double lhs, double rhs) -> void {
+  const auto product{lhs * rhs};
+  expansion.Add(std::fma(lhs, rhs, -product));
+  expansion.Add(product);
+}
+}  // namespace
+
+namespace programmers::geometry {
+auto CalculateOrientation(const Point2D& a, const Point2D& b,
+                          const Point2D& c) -> Orientation {
+  return CalculateOrientation(a.GetX(), a.GetY(), b.GetX(), b.GetY(),
+                              c.GetX(), c.GetY());
+}
+
+auto CalculateOrientation(double ax, double ay, double bx, double by,
+                          double cx, double cy) -> Orientation {
+  const auto left{(ax - cx) * (by - cy)};
+  const auto right{(ay - cy) * (bx - cx)};
+  const auto determinant{left - right};
+  const auto bound{predicates::kOrientationErrorBound *
+                   (std::abs(left) + std::abs(right))};
+  if (determinant > bound) {
+    return Orientation::kCounterClockwise;
+  }
+  if (-determinant > bound) {
+    return Orientation::kClockwise;
+  }
+
+  // The expanded determinant has six products of input coordinates, each
+  // exact as a rounded product plus its error.
+  Expansion expansion;
+  AddProduct(expansion, ax, by);
+  AddProduct(expansion, -ax, cy);
+  AddProduct(expansion, -cx, by);
+  AddProduct(expansion, -ay, bx);
+  AddProduct(expansion, ay, cx);
+  AddProduct(expansion, cy, bx);
+  return expansion.GetSign();
+}
+}  // namespace programmers::geometry
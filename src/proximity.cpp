@@ -0,0 +1,300 @@
+/**
+ * @file geometry/proximity.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Closest pair and distance self-join developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/proximity.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "geometry/bounding_box2d.hpp"
+#include "geometry/kernels.hpp"
+#include "geometry/space_filling_curve.hpp"
+#include "geometry/thread_pool.hpp"
+#include "grid_cells.hpp"
+
+namespace {
+using programmers::geometry::PointPair;
+
+using programmers::geometry::detail::kBatchSize;
+using programmers::geometry::detail::kRow;
+using programmers::geometry::detail::ToOrderedKey;
+
+constexpr std::size_t kSerialCount{1U << 15U};  ///< Closest pair recursion
+
+/**
+ * @brief Point of the closest pair recursion with its original index
+ */
+struct Item {
+  double x{0.0};
+  double y{0.0};
+  uint32_t index{0U};
+};
+
+/**
+ * @brief Check that the points fit 32-bit indices of SortByKey
+ */
+auto CheckSize(std::size_t count) -> void {
+  if (count >= std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("Too many points for proximity search");
+  }
+}
+
+/**
+ * @brief Make the pair of two items, smaller index first
+ */
+auto MakePair(const Item& lhs, const Item& rhs) -> PointPair {
+  const auto dx{lhs.x - rhs.x};
+  const auto dy{lhs.y - rhs.y};
+  return {std::min(lhs.index, rhs.index), std::max(lhs.index, rhs.index),
+          dx * dx + dy * dy};
+}
+
+/**
+ * @brief Order pairs by distance, then indices, so ties are deterministic
+ */
+auto IsCloser(const PointPair& lhs, const PointPair& rhs) -> bool {
+  return std::tie(lhs.squared_distance, lhs.first, lhs.second) <
+         std::tie(rhs.squared_distance, rhs.first, rhs.second);
+}
+
+/**
+ * @brief Find the closest pair of items sorted by x, leaving them sorted by y
+ * @param items Items of the range, sorted by x
+ * @param scratch Scratch of the same range
+ * @param count The number of items, at least 2
+ */
+auto SolveClosestPair(Item* items, Item* scratch, std::size_t count)
+    -> PointPair {
+  const auto by_y{
+      [](const Item& lhs, const Item& rhs) { return lhs.y < rhs.y; }};
+  if (count <= 3U) {
+    auto best{MakePair(items[0], items[1])};
+    for (std::size_t i = 0; i < count; ++i) {
+      for (auto j = i + 1U; j < count; ++j) {
+        const auto pair{MakePair(items[i], items[j])};
+        best = IsCloser(pair, best) ? pair : best;
+      }
+    }
+    std::sort(items, items + count, by_y);
+    return best;
+  }
+
+  const auto half{count / 2U};
+  const auto middle_x{items[half].x};
+  PointPair left;
+  PointPair right;
+  const auto solve_left{
+      [&]() { left = SolveClosestPair(items, scratch, half); }};
+  const auto solve_right{[&]() {
+    right = SolveClosestPair(items + half, scratch + half, count - half);
+  }};
+  if (count > kSerialCount) {
+    programmers::geometry::ParallelInvoke(solve_left, solve_right);
+  } else {
+    solve_left();
+    solve_right();
+  }
+  auto best{IsCloser(left, right) ? left : right};
+
+  std::merge(items, items + half, items + half, items + count, scratch, by_y);
+  std::copy(scratch, scratch + count, items);
+  // Only a strictly closer pair can cross the middle, and every such point
+  // lies in the strip; the scratch range is free again to hold it.
+  std::size_t strip{0U};
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto dx{items[i].x - middle_x};
+    if (dx * dx < best.squared_distance) {
+      scratch[strip++] = items[i];
+    }
+  }
+  for (std::size_t i = 0; i < strip; ++i) {
+    for (auto j = i + 1U; j < strip; ++j) {
+      const auto dy{scratch[j].y - scratch[i].y};
+      if (dy * dy >= best.squared_distance) {
+        break;
+      }
+      const auto pair{MakePair(scratch[i], scratch[j])};
+      best = IsCloser(pair, best) ? pair : best;
+    }
+  }
+  return best;
+}
+
+/**
+ * @brief Check that radius of a self-join is a finite non-negative number
+ */
+auto CheckRadius(double radius) -> void {
+  if (!(radius >= 0.0) || !std::isfinite(radius)) {
+    throw std::invalid_argument("Radius must be finite and not negative");
+  }
+}
+}  // namespace
+
+namespace programmers::geometry {
+auto PointPair::GetDistance() const -> double {
+  return std::sqrt(squared_distance);
+}
+
+auto PointPair::ToDistance(Distance::Type unit) const -> Distance {
+  return Distance{GetDistance(), unit};
+}
+
+auto FindClosestPair(const PointCloud2D& points) -> PointPair {
+  const auto count{points.Size()};
+  if (count < 2U) {
+    throw std::invalid_argument("Closest pair needs at least 2 points");
+  }
+  CheckSize(count);
+  const auto* xs{points.XData()};
+  const auto* ys{points.YData()};
+
+  std::vector<uint64_t> keys(count);
+  ParallelFor(count, [&](std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      if (!std::isfinite(xs[i]) || !std::isfinite(ys[i])) {
+        throw std::invalid_argument("Closest pair of non-finite point");
+      }
+      keys[i] = ToOrderedKey(xs[i]);
+    }
+  });
+  const auto order{SortByKey(keys)};
+
+  std::vector<Item> items(count);
+  ParallelFor(count, [&](std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      items[i] = {xs[order[i]], ys[order[i]], order[i]};
+    }
+  });
+  std::vector<Item> scratch(count);
+  return SolveClosestPair(items.data(), scratch.data(), count);
+}
+
+auto FindPairsWithin(const PointCloud2D& points, double radius,
+                     const PairCallback& callback) -> std::size_t {
+  CheckRadius(radius);
+  const auto count{points.Size()};
+  if (count < 2U) {
+    return 0U;
+  }
+  CheckSize(count);
+  const auto* xs{points.XData()};
+  const auto* ys{points.YData()};
+
+  const auto box{BoundingBox2D::FromPoints(points)};
+  const auto buckets{detail::BuildBuckets(
+      xs, ys, count, box.GetMinimum(), detail::GetCellSize(box, radius),
+      "Pairs within radius of non-finite point")};
+  const auto& order{buckets.order};
+  const auto& sorted_xs{buckets.xs};
+  const auto& sorted_ys{buckets.ys};
+  const auto& cell_keys{buckets.cell_keys};
+  const auto& cell_begins{buckets.cell_begins};
+
+  const auto squared_radius{radius * radius};
+  std::mutex callback_mutex;
+  std::atomic<std::size_t> total{0U};
+  ParallelOptions options;
+  options.grain = 64U;
+  ParallelFor(
+      cell_keys.size(),
+      [&](std::size_t begin, std::size_t end) {
+        std::vector<PointPair> batch;
+        batch.reserve(kBatchSize);
+        std::vector<double> distances;
+        std::size_t found{0U};
+        const auto flush{[&]() {
+          const std::lock_guard<std::mutex> lock(callback_mutex);
+          callback(batch.data(), batch.size());
+          batch.clear();
+        }};
+        // Pair point i with the points of [other, other_end).
+        const auto join{[&](std::size_t i, std::size_t other,
+                            std::size_t other_end) {
+          const auto size{other_end - other};
+          distances.resize(std::max(distances.size(), size));
+          kernels::CalculateSquaredDistances(
+              sorted_xs.data() + other, sorted_ys.data() + other, size,
+              sorted_xs[i], sorted_ys[i], distances.data());
+          for (std::size_t k = 0; k < size; ++k) {
+            if (distances[k] <= squared_radius) {
+              const std::size_t lhs{order[i]};
+              const std::size_t rhs{order[other + k]};
+              batch.push_back({std::min(lhs, rhs), std::max(lhs, rhs),
+                               distances[k]});
+              ++found;
+              if (batch.size() == kBatchSize) {
+                flush();
+              }
+            }
+          }
+        }};
+
+        for (auto cell_index = begin; cell_index < end; ++cell_index) {
+          const auto key{cell_keys[cell_index]};
+          // Only forward neighbors, so every pair of cells is joined once.
+          // Below cell x 0 the key wraps to cell x 2^32 - 1, never used.
+          const std::array<uint64_t, 4> neighbors{key + 1U, key + kRow - 1U,
+                                                  key + kRow, key + kRow + 1U};
+          const auto cell_begin{cell_begins[cell_index]};
+          const auto cell_end{cell_begins[cell_index + 1U]};
+          for (auto i = cell_begin; i < cell_end; ++i) {
+            join(i, i + 1U, cell_end);
+          }
+          for (const auto neighbor : neighbors) {
+            const auto found_cell{std::lower_bound(
+                cell_keys.begin() + cell_index + 1, cell_keys.end(),
+                neighbor)};
+            if (found_cell == cell_keys.end() || *found_cell != neighbor) {
+              continue;
+            }
+            const auto other{static_cast<std::size_t>(
+                found_cell - cell_keys.begin())};
+            for (auto i = cell_begin; i < cell_end; ++i) {
+              join(i, cell_begins[other], cell_begins[other + 1U]);
+            }
+          }
+        }
+        if (!batch.empty()) {
+          flush();
+        }
+        total.fetch_add(found);
+      },
+      options);
+  return total.load();
+}
+
+auto FindPairsWithin(const PointCloud2D& points, const Distance& radius,
+                     const PairCallback& callback, Distance::Type unit)
+    -> std::size_t {
+  return FindPairsWithin(points, radius.GetValue(unit), callback);
+}
+
+auto FindPairsWithin(const PointCloud2D& points, double radius,
+                     PointPair* output, std::size_t capacity) -> std::size_t {
+  // Calls are serialized, so a plain counter is enough.
+  std::size_t written{0U};
+  return FindPairsWithin(
+      points, radius, [&](const PointPair* pairs, std::size_t size) {
+        const auto copied{std::min(size, capacity - written)};
+        std::copy(pairs, pairs + copied, output + written);
+        written += copied;
+      });
+}
+}  // namespace programmers::geometry
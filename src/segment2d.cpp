@@ -0,0 +1,80 @@
+/**
+ * @file geometry/segment2d.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Line segment class developments with 2-dimension
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/segment2d.hpp"
+
+#include <algorithm>
+
+#include "geometry/predicates.hpp"
+
+namespace {
+using programmers::geometry::Point2D;
+
+/**
+ * @brief Check if point lies in the box of a segment it is collinear with
+ */
+auto IsWithin(const Point2D& start, const Point2D& end, const Point2D& point)
+    -> bool {
+  return std::min(start.GetX(), end.GetX()) <= point.GetX() &&
+         point.GetX() <= std::max(start.GetX(), end.GetX()) &&
+         std::min(start.GetY(), end.GetY()) <= point.GetY() &&
+         point.GetY() <= std::max(start.GetY(), end.GetY());
+}
+}  // namespace
+
+namespace programmers::geometry {
+Segment2D::Segment2D(const Point2D& start, const Point2D& end)
+    : start_(start), end_(end) {}
+
+auto Segment2D::GetStart() const -> Point2D { return start_; }
+
+auto Segment2D::GetEnd() const -> Point2D { return end_; }
+
+auto Segment2D::GetBoundingBox() const -> BoundingBox2D {
+  return {{std::min(start_.GetX(), end_.GetX()),
+           std::min(start_.GetY(), end_.GetY())},
+          {std::max(start_.GetX(), end_.GetX()),
+           std::max(start_.GetY(), end_.GetY())}};
+}
+
+auto Segment2D::CalculateLength() const -> double {
+  return start_.CalculateDistance(end_);
+}
+
+auto Segment2D::Intersects(const Segment2D& other) const -> bool {
+  const auto first{CalculateOrientation(start_, end_, other.start_)};
+  const auto second{CalculateOrientation(start_, end_, other.end_)};
+  const auto third{CalculateOrientation(other.start_, other.end_, start_)};
+  const auto fourth{CalculateOrientation(other.start_, other.end_, end_)};
+  // Each segment has the ends of the other on both sides of its line.
+  if (first != second && third != fourth) {
+    return true;
+  }
+  // Otherwise they can only meet at an end lying on the other segment.
+  return (first == Orientation::kCollinear &&
+          IsWithin(start_, end_, other.start_)) ||
+         (second == Orientation::kCollinear &&
+          IsWithin(start_, end_, other.end_)) ||
+         (third == Orientation::kCollinear &&
+          IsWithin(other.start_, other.end_, start_)) ||
+         (fourth == Orientation::kCollinear &&
+          IsWithin(other.start_, other.end_, end_));
+}
+
+auto Segment2D::operator==(const Segment2D& other) const -> bool {
+  return start_ == other.start_ && end_ == other.end_;
+}
+
+auto Segment2D::operator!=(const Segment2D& other) const -> bool {
+  return !(*this == other);
+}
+}  // namespace programmers::geometry
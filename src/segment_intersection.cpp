@@ -0,0 +1,448 @@
+/**
+ * @file geometry/segment_intersection.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Intersections within large segment sets developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/segment_intersection.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "geometry/bounding_box2d.hpp"
+#include "geometry/predicates.hpp"
+#include "geometry/space_filling_curve.hpp"
+#include "geometry/thread_pool.hpp"
+#include "grid_cells.hpp"
+
+namespace {
+using programmers::geometry::Point2D;
+using programmers::geometry::Segment2D;
+
+using programmers::geometry::detail::kBatchSize;
+using programmers::geometry::detail::ToOrderedKey;
+
+constexpr double kMaximumCells{65536.0};  ///< Cells per axis
+constexpr std::size_t kCellGrain{64U};    ///< Cells per parallel task
+
+/**
+ * @brief Check if to and other lie strictly on the same side of from, all
+ * three being on one line
+ */
+auto IsSameDirection(const Point2D& from, const Point2D& to,
+                     const Point2D& other) -> bool {
+  const auto sign{[](double value, double origin) {
+    return static_cast<int>(origin < value) - static_cast<int>(value < origin);
+  }};
+  const auto x_sign{sign(to.GetX(), from.GetX())};
+  if (x_sign != 0 || sign(other.GetX(), from.GetX()) != 0) {
+    return x_sign * sign(other.GetX(), from.GetX()) > 0;
+  }
+  return sign(to.GetY(), from.GetY()) * sign(other.GetY(), from.GetY()) > 0;
+}
+
+/**
+ * @brief Check if two intersecting segments meet only at an end both have
+ */
+auto MeetsAtSharedEndOnly(const Segment2D& lhs, const Segment2D& rhs)
+    -> bool {
+  using programmers::geometry::Orientation;
+  const Point2D lhs_ends[]{lhs.GetStart(), lhs.GetEnd()};
+  const Point2D rhs_ends[]{rhs.GetStart(), rhs.GetEnd()};
+  for (std::size_t i = 0; i < 2U; ++i) {
+    for (std::size_t j = 0; j < 2U; ++j) {
+      if (lhs_ends[i] != rhs_ends[j]) {
+        continue;
+      }
+      const auto& shared{lhs_ends[i]};
+      const auto& lhs_other{lhs_ends[1U - i]};
+      const auto& rhs_other{rhs_ends[1U - j]};
+      // Two lines through the shared end meet nowhere else; on one line
+      // the segments overlap beyond it when they leave the same way.
+      return CalculateOrientation(shared, lhs_other, rhs_other) !=
+                 Orientation::kCollinear ||
+             !IsSameDirection(shared, lhs_other, rhs_other);
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Uniform grid listing the segments that cross each cell
+ * @details A segment is listed in the cells its own path crosses, not in
+ * those of its box, so a long diagonal costs about rows plus columns
+ * entries rather than the whole grid.
+ */
+class SegmentGrid {
+ public:
+  /**
+   * @brief Construct a new SegmentGrid object
+   * @param segments The segments, outliving the grid
+   * @throw std::invalid_argument If a coordinate is not finite
+   * @throw std::length_error If there are more than 2^32 - 2 segments
+   */
+  explicit SegmentGrid(const std::vector<Segment2D>& segments);
+
+  /**
+   * @brief Get the number of cells
+   */
+  [[nodiscard]] auto Size() const -> std::size_t;
+  /**
+   * @brief Call visit(i, j) for every candidate pair of segments whose
+   * boxes overlap and whose first shared cell is cell, stopping when it
+   * returns false
+   * @return false If visit stopped the sweep
+   */
+  template <typename Visit>
+  auto Sweep(std::size_t cell, const Visit& visit) const -> bool;
+
+ protected:
+ private:
+  /**
+   * @brief Get the cell of value on an axis of count cells from origin
+   */
+  [[nodiscard]] auto GetCell(double value, double origin,
+                             std::size_t count) const -> std::size_t;
+  /**
+   * @brief Get the first and last column of the cells segment crosses in
+   * row, padded so that every point of segment in row is covered
+   */
+  [[nodiscard]] auto GetColumns(std::size_t segment, std::size_t row) const
+      -> std::pair<std::size_t, std::size_t>;
+  /**
+   * @brief Get a row below every cell that two segments, both several rows
+   * tall, share, or 0 for segments that are close from their bottom
+   */
+  [[nodiscard]] auto GetCloseRow(std::size_t lhs, std::size_t rhs) const
+      -> std::size_t;
+  /**
+   * @brief Check if the cell at row and column is the first cell, in cell
+   * order, that both segments cross
+   */
+  [[nodiscard]] auto IsFirstSharedCell(std::size_t lhs, std::size_t rhs,
+                                       std::size_t row,
+                                       std::size_t column) const -> bool;
+
+  std::vector<double> min_xs_;            ///< Box left of each segment
+  std::vector<double> min_ys_;            ///< Box bottom of each segment
+  std::vector<double> max_xs_;            ///< Box right of each segment
+  std::vector<double> max_ys_;            ///< Box top of each segment
+  std::vector<double> lower_xs_;          ///< x of the lower end
+  std::vector<double> upper_xs_;          ///< x of the upper end
+  std::vector<uint32_t> first_rows_;      ///< Cell row of box bottom
+  std::vector<uint32_t> last_rows_;       ///< Cell row of box top
+  Point2D origin_;                        ///< Corner of cell (0, 0)
+  double padding_{0.0};                   ///< Rounding slack of spans
+  double cell_size_{1.0};                 ///< Side of one cell
+  std::size_t columns_{0U};               ///< The number of cell columns
+  std::size_t rows_{0U};                  ///< The number of cell rows
+  std::vector<std::size_t> cell_begins_;  ///< First entry of every cell
+  std::vector<uint32_t> cell_segments_;   ///< Segments of the cells
+};
+
+SegmentGrid::SegmentGrid(const std::vector<Segment2D>& segments) {
+  const auto count{segments.size()};
+  if (count >= std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("Too many segments for intersection search");
+  }
+  min_xs_.resize(count);
+  min_ys_.resize(count);
+  max_xs_.resize(count);
+  max_ys_.resize(count);
+  lower_xs_.resize(count);
+  upper_xs_.resize(count);
+  programmers::geometry::ParallelFor(
+      count, [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          const auto start{segments[i].GetStart()};
+          const auto stop{segments[i].GetEnd()};
+          if (!std::isfinite(start.GetX()) || !std::isfinite(start.GetY()) ||
+              !std::isfinite(stop.GetX()) || !std::isfinite(stop.GetY())) {
+            throw std::invalid_argument(
+                "Intersection search of non-finite segment");
+          }
+          min_xs_[i] = std::min(start.GetX(), stop.GetX());
+          min_ys_[i] = std::min(start.GetY(), stop.GetY());
+          max_xs_[i] = std::max(start.GetX(), stop.GetX());
+          max_ys_[i] = std::max(start.GetY(), stop.GetY());
+          const auto start_is_lower{start.GetY() <= stop.GetY()};
+          lower_xs_[i] = start_is_lower ? start.GetX() : stop.GetX();
+          upper_xs_[i] = start_is_lower ? stop.GetX() : start.GetX();
+        }
+      });
+  if (count == 0U) {
+    cell_begins_.assign(1U, 0U);
+    return;
+  }
+
+  // Cells about as wide as an average segment, and at least one segment
+  // per cell on average, so a segment overlaps a few cells and a cell
+  // holds a few segments.
+  using programmers::geometry::BoundingBox2D;
+  const auto box{
+      BoundingBox2D::FromPoints(min_xs_.data(), min_ys_.data(), count)
+          .Union(BoundingBox2D::FromPoints(max_xs_.data(), max_ys_.data(),
+                                           count))};
+  const auto width{box.GetWidth()};
+  const auto height{box.GetHeight()};
+  const auto total_side{programmers::geometry::ParallelReduce(
+      count, 0.0,
+      [&](std::size_t begin, std::size_t end) {
+        double sum{0.0};
+        for (auto i = begin; i < end; ++i) {
+          sum += std::max(max_xs_[i] - min_xs_[i], max_ys_[i] - min_ys_[i]);
+        }
+        return sum;
+      },
+      [](double lhs, double rhs) { return lhs + rhs; })};
+  cell_size_ = std::max({total_side / static_cast<double>(count),
+                         std::sqrt(width * height / static_cast<double>(count)),
+                         std::max(width, height) / kMaximumCells});
+  if (!(cell_size_ > 0.0)) {
+    cell_size_ = 1.0;
+  }
+  columns_ = static_cast<std::size_t>(width / cell_size_) + 1U;
+  rows_ = static_cast<std::size_t>(height / cell_size_) + 1U;
+
+  origin_ = box.GetMinimum();
+  const auto maximum{box.GetMaximum()};
+  // Rounding of band edges and of the interpolated x stays well below
+  // this, so a span never misses a point of its segment.
+  padding_ = 8.0 * std::numeric_limits<double>::epsilon() *
+             (std::max({std::abs(origin_.GetX()), std::abs(origin_.GetY()),
+                        std::abs(maximum.GetX()), std::abs(maximum.GetY())}) +
+              cell_size_);
+  first_rows_.resize(count);
+  last_rows_.resize(count);
+  std::vector<uint64_t> keys(count);
+  programmers::geometry::ParallelFor(
+      count, [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          first_rows_[i] = static_cast<uint32_t>(
+              GetCell(min_ys_[i], origin_.GetY(), rows_));
+          last_rows_[i] = static_cast<uint32_t>(
+              GetCell(max_ys_[i], origin_.GetY(), rows_));
+          keys[i] = ToOrderedKey(min_xs_[i]);
+        }
+      });
+  const auto for_each_cell{[&](std::size_t segment, const auto& task) {
+    for (std::size_t row = first_rows_[segment]; row <= last_rows_[segment];
+         ++row) {
+      const auto [first, last]{GetColumns(segment, row)};
+      for (auto column = first; column <= last; ++column) {
+        task(row * columns_ + column);
+      }
+    }
+  }};
+  cell_begins_.assign(columns_ * rows_ + 1U, 0U);
+  for (std::size_t segment = 0; segment < count; ++segment) {
+    for_each_cell(segment,
+                  [&](std::size_t cell) { ++cell_begins_[cell + 1U]; });
+  }
+  for (std::size_t cell = 0; cell < columns_ * rows_; ++cell) {
+    cell_begins_[cell + 1U] += cell_begins_[cell];
+  }
+  // Filled in order of box left, so every cell is sorted for the sweep.
+  cell_segments_.resize(cell_begins_.back());
+  auto cursors{cell_begins_};
+  for (const auto segment : programmers::geometry::SortByKey(keys)) {
+    for_each_cell(segment, [&](std::size_t cell) {
+      cell_segments_[cursors[cell]++] = segment;
+    });
+  }
+}
+
+auto SegmentGrid::Size() const -> std::size_t { return columns_ * rows_; }
+
+template <typename Visit>
+auto SegmentGrid::Sweep(std::size_t cell, const Visit& visit) const -> bool {
+  const auto column{cell % columns_};
+  const auto row{cell / columns_};
+  const auto end{cell_begins_[cell + 1U]};
+  for (auto k = cell_begins_[cell]; k < end; ++k) {
+    const auto i{cell_segments_[k]};
+    for (auto l = k + 1U; l < end; ++l) {
+      const auto j{cell_segments_[l]};
+      if (min_xs_[j] > max_xs_[i]) {
+        break;
+      }
+      if (min_ys_[j] > max_ys_[i] || min_ys_[i] > max_ys_[j] ||
+          !IsFirstSharedCell(i, j, row, column)) {
+        continue;
+      }
+      if (!visit(i, j)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+auto SegmentGrid::GetCell(double value, double origin,
+                          std::size_t count) const -> std::size_t {
+  return programmers::geometry::detail::GetCell(value, origin, cell_size_,
+                                                count);
+}
+
+auto SegmentGrid::GetColumns(std::size_t segment, std::size_t row) const
+    -> std::pair<std::size_t, std::size_t> {
+  const auto lower_y{min_ys_[segment]};
+  const auto upper_y{max_ys_[segment]};
+  const auto get_x{[&](double y) {
+    if (!(y > lower_y)) {
+      return lower_xs_[segment];
+    }
+    if (!(y < upper_y)) {
+      return upper_xs_[segment];
+    }
+    return lower_xs_[segment] + (y - lower_y) / (upper_y - lower_y) *
+                                    (upper_xs_[segment] - lower_xs_[segment]);
+  }};
+  // The part of the segment in the padded band of row; a horizontal one
+  // gives both of its ends.
+  const auto bottom{origin_.GetY() + static_cast<double>(row) * cell_size_ -
+                    padding_};
+  const auto bottom_x{get_x(bottom)};
+  const auto top_x{get_x(bottom + cell_size_ + 2.0 * padding_)};
+  return {GetCell(std::min(bottom_x, top_x) - padding_, origin_.GetX(),
+                  columns_),
+          GetCell(std::max(bottom_x, top_x) + padding_, origin_.GetX(),
+                  columns_)};
+}
+
+auto SegmentGrid::GetCloseRow(std::size_t lhs, std::size_t rhs) const
+    -> std::size_t {
+  constexpr double kTallRows{4.0};
+  const auto lhs_height{max_ys_[lhs] - min_ys_[lhs]};
+  const auto rhs_height{max_ys_[rhs] - min_ys_[rhs]};
+  if (!(std::min(lhs_height, rhs_height) > kTallRows * cell_size_)) {
+    return 0U;
+  }
+  // The x gap of the segments is linear in y over their common rows. A
+  // span is at most its slope plus two cells wide, so segments whose gap
+  // exceeds twice both spans share no cell in that row.
+  const auto lhs_slope{(upper_xs_[lhs] - lower_xs_[lhs]) / lhs_height};
+  const auto rhs_slope{(upper_xs_[rhs] - lower_xs_[rhs]) / rhs_height};
+  const auto bottom{std::max(min_ys_[lhs], min_ys_[rhs])};
+  const auto gap{(lower_xs_[lhs] + (bottom - min_ys_[lhs]) * lhs_slope) -
+                 (lower_xs_[rhs] + (bottom - min_ys_[rhs]) * rhs_slope)};
+  const auto reach{2.0 * (std::abs(lhs_slope) + std::abs(rhs_slope) + 2.0) *
+                   cell_size_};
+  const auto closing{gap > 0.0 ? rhs_slope - lhs_slope
+                               : lhs_slope - rhs_slope};
+  if (!(std::abs(gap) > reach) || !(closing > 0.0)) {
+    return 0U;
+  }
+  const auto close_row{
+      GetCell(bottom + (std::abs(gap) - reach) / closing, origin_.GetY(),
+              rows_)};
+  return close_row > 0U ? close_row - 1U : 0U;
+}
+
+auto SegmentGrid::IsFirstSharedCell(std::size_t lhs, std::size_t rhs,
+                                    std::size_t row,
+                                    std::size_t column) const -> bool {
+  // Cells are in row order, so the first shared cell is the leftmost one
+  // of the first row where the column ranges overlap.
+  for (std::size_t first_row = std::max<std::size_t>(
+           {first_rows_[lhs], first_rows_[rhs], GetCloseRow(lhs, rhs)});
+       first_row <= row; ++first_row) {
+    const auto lhs_columns{GetColumns(lhs, first_row)};
+    const auto rhs_columns{GetColumns(rhs, first_row)};
+    const auto first{std::max(lhs_columns.first, rhs_columns.first)};
+    if (first <= std::min(lhs_columns.second, rhs_columns.second)) {
+      return first_row == row && first == column;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Check if a candidate pair is an intersection to report
+ */
+auto IsReported(const Segment2D& lhs, const Segment2D& rhs,
+                const programmers::geometry::SegmentIntersectionOptions&
+                    options) -> bool {
+  return lhs.Intersects(rhs) &&
+         !(options.ignore_shared_ends && MeetsAtSharedEndOnly(lhs, rhs));
+}
+}  // namespace
+
+namespace programmers::geometry {
+auto FindIntersections(const std::vector<Segment2D>& segments,
+                       const SegmentPairCallback& callback,
+                       const SegmentIntersectionOptions& options)
+    -> std::size_t {
+  const SegmentGrid grid(segments);
+  std::mutex callback_mutex;
+  std::atomic<std::size_t> total{0U};
+  ParallelOptions parallel;
+  parallel.grain = kCellGrain;
+  ParallelFor(
+      grid.Size(),
+      [&](std::size_t begin, std::size_t end) {
+        std::vector<SegmentPair> batch;
+        batch.reserve(kBatchSize);
+        std::size_t found{0U};
+        const auto flush{[&]() {
+          const std::lock_guard<std::mutex> lock(callback_mutex);
+          callback(batch.data(), batch.size());
+          batch.clear();
+        }};
+        for (auto cell = begin; cell < end; ++cell) {
+          grid.Sweep(cell, [&](std::size_t i, std::size_t j) {
+            if (IsReported(segments[i], segments[j], options)) {
+              batch.push_back({std::min(i, j), std::max(i, j)});
+              ++found;
+              if (batch.size() == kBatchSize) {
+                flush();
+              }
+            }
+            return true;
+          });
+        }
+        if (!batch.empty()) {
+          flush();
+        }
+        total.fetch_add(found);
+      },
+      parallel);
+  return total.load();
+}
+
+auto HasIntersection(const std::vector<Segment2D>& segments,
+                     const SegmentIntersectionOptions& options) -> bool {
+  const SegmentGrid grid(segments);
+  std::atomic<bool> found{false};
+  ParallelOptions parallel;
+  parallel.grain = kCellGrain;
+  ParallelFor(
+      grid.Size(),
+      [&](std::size_t begin, std::size_t end) {
+        for (auto cell = begin;
+             cell < end && !found.load(std::memory_order_relaxed); ++cell) {
+          grid.Sweep(cell, [&](std::size_t i, std::size_t j) {
+            if (IsReported(segments[i], segments[j], options)) {
+              found.store(true, std::memory_order_relaxed);
+            }
+            // Stop as soon as any thread found one.
+            return !found.load(std::memory_order_relaxed);
+          });
+        }
+      },
+      parallel);
+  return found.load();
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,276 @@
+/**
+ * @file geometry/simplification.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Polyline simplification developments, offline and streaming
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/simplification.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+#include "geometry/thread_pool.hpp"
+
+namespace {
+using programmers::geometry::Distance;
+using programmers::geometry::Point2D;
+
+constexpr std::size_t kParallelThreshold{1U << 14U};
+
+auto GetSquaredTolerance(const Distance& tolerance, Distance::Type unit)
+    -> double {
+  if (tolerance.GetNanometer() < 0) {
+    throw std::invalid_argument("Simplification tolerance is negative");
+  }
+  const auto value{tolerance.GetValue(unit)};
+  return value * value;
+}
+
+/**
+ * @brief Get the squared distance from point to the segment from start to
+ * end
+ */
+auto GetSquaredSegmentDistance(const Point2D& point, const Point2D& start,
+                               const Point2D& end) -> double {
+  const auto dx{end.GetX() - start.GetX()};
+  const auto dy{end.GetY() - start.GetY()};
+  const auto squared_length{dx * dx + dy * dy};
+  if (squared_length == 0.0) {
+    return Point2D::CalculateSquaredDistance(point, start);
+  }
+  const auto ratio{std::clamp(((point.GetX() - start.GetX()) * dx +
+                               (point.GetY() - start.GetY()) * dy) /
+                                  squared_length,
+                              0.0, 1.0)};
+  return Point2D::CalculateSquaredDistance(
+      point, Point2D(start.GetX() + dx * ratio, start.GetY() + dy * ratio));
+}
+
+/**
+ * @brief Mark the vertices kept by Douglas-Peucker in (first, last)
+ * @details Ranges are processed from an explicit stack, so a long trace
+ * does not recurse deeply. The two sides of a large split may run on two
+ * threads; they never share a vertex.
+ */
+auto MarkDouglasPeucker(const std::vector<Point2D>& points, std::size_t first,
+                        std::size_t last, double squared_tolerance,
+                        uint8_t* keep) -> void {
+  std::vector<std::pair<std::size_t, std::size_t>> ranges{{first, last}};
+  while (!ranges.empty()) {
+    const auto [begin, end]{ranges.back()};
+    ranges.pop_back();
+    if (end - begin < 2U) {
+      continue;
+    }
+    auto farthest{begin};
+    auto farthest_distance{-1.0};
+    for (auto i = begin + 1U; i < end; ++i) {
+      const auto squared_distance{
+          GetSquaredSegmentDistance(points[i], points[begin], points[end])};
+      if (squared_distance > farthest_distance) {
+        farthest = i;
+        farthest_distance = squared_distance;
+      }
+    }
+    if (farthest_distance <= squared_tolerance) {
+      continue;
+    }
+    keep[farthest] = 1U;
+    if (end - begin >= kParallelThreshold) {
+      programmers::geometry::ParallelInvoke(
+          [&, begin = begin, farthest = farthest]() {
+            MarkDouglasPeucker(points, begin, farthest, squared_tolerance,
+                               keep);
+          },
+          [&, end = end, farthest = farthest]() {
+            MarkDouglasPeucker(points, farthest, end, squared_tolerance, keep);
+          });
+      continue;
+    }
+    ranges.emplace_back(farthest, end);
+    ranges.emplace_back(begin, farthest);
+  }
+}
+
+/**
+ * @brief Get twice the area of the triangle of three vertices
+ */
+auto GetDoubleArea(const Point2D& lhs, const Point2D& middle,
+                   const Point2D& rhs) -> double {
+  return std::abs((lhs.GetX() - rhs.GetX()) * (middle.GetY() - lhs.GetY()) -
+                  (lhs.GetX() - middle.GetX()) * (rhs.GetY() - lhs.GetY()));
+}
+
+auto CollectPoints(const std::vector<Point2D>& points,
+                   const std::vector<std::size_t>& indices)
+    -> std::vector<Point2D> {
+  std::vector<Point2D> result;
+  result.reserve(indices.size());
+  for (const auto index : indices) {
+    result.push_back(points[index]);
+  }
+  return result;
+}
+}  // namespace
+
+namespace programmers::geometry {
+auto ComputeDouglasPeucker(const std::vector<Point2D>& points,
+                           const Distance& tolerance, Distance::Type unit)
+    -> std::vector<std::size_t> {
+  const auto squared_tolerance{GetSquaredTolerance(tolerance, unit)};
+  const auto count{points.size()};
+  if (count < 3U) {
+    std::vector<std::size_t> indices(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      indices[i] = i;
+    }
+    return indices;
+  }
+
+  std::vector<uint8_t> keep(count, 0U);
+  keep.front() = 1U;
+  keep.back() = 1U;
+  MarkDouglasPeucker(points, 0U, count - 1U, squared_tolerance, keep.data());
+
+  std::vector<std::size_t> indices;
+  for (std::size_t i = 0; i < count; ++i) {
+    if (keep[i] != 0U) {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
+
+auto SimplifyDouglasPeucker(const std::vector<Point2D>& points,
+                            const Distance& tolerance, Distance::Type unit)
+    -> std::vector<Point2D> {
+  return CollectPoints(points, ComputeDouglasPeucker(points, tolerance, unit));
+}
+
+auto ComputeVisvalingamWhyatt(const std::vector<Point2D>& points,
+                              const Distance& tolerance, Distance::Type unit)
+    -> std::vector<std::size_t> {
+  // Compare doubled areas to avoid halving every triangle.
+  const auto threshold{2.0 * GetSquaredTolerance(tolerance, unit)};
+  const auto count{points.size()};
+  std::vector<std::size_t> previous(count);
+  std::vector<std::size_t> next(count);
+  std::vector<double> areas(count, 0.0);
+  for (std::size_t i = 0; i < count; ++i) {
+    previous[i] = i - 1U;
+    next[i] = i + 1U;
+  }
+
+  // Min heap of (area, vertex); entries whose area changed since are stale.
+  using Entry = std::pair<double, std::size_t>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<>> heap;
+  for (std::size_t i = 1; i + 1U < count; ++i) {
+    areas[i] = GetDoubleArea(points[i - 1U], points[i], points[i + 1U]);
+    heap.emplace(areas[i], i);
+  }
+  std::vector<uint8_t> removed(count, 0U);
+  while (!heap.empty()) {
+    const auto [area, vertex]{heap.top()};
+    if (area >= threshold) {
+      break;
+    }
+    heap.pop();
+    if (removed[vertex] != 0U || area != areas[vertex]) {
+      continue;
+    }
+    removed[vertex] = 1U;
+    const auto before{previous[vertex]};
+    const auto after{next[vertex]};
+    next[before] = after;
+    previous[after] = before;
+    // A neighbour never gets a smaller area than the vertex just removed,
+    // which keeps the removal order monotonic.
+    for (const auto neighbour : {before, after}) {
+      if (neighbour == 0U || neighbour + 1U == count) {
+        continue;
+      }
+      areas[neighbour] = std::max(
+          area, GetDoubleArea(points[previous[neighbour]], points[neighbour],
+                              points[next[neighbour]]));
+      heap.emplace(areas[neighbour], neighbour);
+    }
+  }
+
+  std::vector<std::size_t> indices;
+  for (std::size_t i = 0; i < count; ++i) {
+    if (removed[i] == 0U) {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
+
+auto SimplifyVisvalingamWhyatt(const std::vector<Point2D>& points,
+                               const Distance& tolerance, Distance::Type unit)
+    -> std::vector<Point2D> {
+  return CollectPoints(points,
+                       ComputeVisvalingamWhyatt(points, tolerance, unit));
+}
+
+StreamingSimplifier::StreamingSimplifier(const Distance& tolerance,
+                                         Distance::Type unit,
+                                         std::size_t window)
+    : squared_tolerance_(GetSquaredTolerance(tolerance, unit)),
+      window_(window) {
+  if (window_ == 0U) {
+    throw std::invalid_argument("StreamingSimplifier window is 0");
+  }
+  pending_.reserve(window_);
+}
+
+auto StreamingSimplifier::Push(const Point2D& point,
+                               std::vector<Point2D>& output) -> void {
+  if (!started_) {
+    started_ = true;
+    anchor_ = point;
+    output.push_back(point);
+    return;
+  }
+  if (pending_.empty() ||
+      (pending_.size() < window_ && Covers(point))) {
+    pending_.push_back(point);
+    return;
+  }
+  anchor_ = pending_.back();
+  output.push_back(anchor_);
+  pending_.clear();
+  pending_.push_back(point);
+}
+
+auto StreamingSimplifier::Flush(std::vector<Point2D>& output) -> void {
+  if (!pending_.empty()) {
+    output.push_back(pending_.back());
+  }
+  pending_.clear();
+  started_ = false;
+}
+
+auto StreamingSimplifier::GetPendingCount() const -> std::size_t {
+  return pending_.size();
+}
+
+auto StreamingSimplifier::Covers(const Point2D& point) const -> bool {
+  return std::all_of(pending_.begin(), pending_.end(),
+                     [&](const Point2D& pending) {
+                       return GetSquaredSegmentDistance(pending, anchor_,
+                                                        point) <=
+                              squared_tolerance_;
+                     });
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,254 @@
+/**
+ * @file geometry/space_filling_curve.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Morton and Hilbert curve keys and curve order developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/space_filling_curve.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "geometry/kernels.hpp"
+#include "geometry/thread_pool.hpp"
+#include "kernels/curve_bits.hpp"
+
+namespace {
+constexpr double kCellLimit{4294967295.0};
+constexpr std::size_t kEncodeBlockSize{256U};
+constexpr std::size_t kParallelGrain{1U << 15U};
+constexpr uint32_t kRadixBits{8U};
+constexpr std::size_t kRadix{1U << kRadixBits};
+constexpr uint64_t kRadixMask{kRadix - 1U};
+
+/**
+ * @brief Get the options splitting count items into chunks worth a thread
+ */
+auto GetParallelOptions() -> programmers::geometry::ParallelOptions {
+  programmers::geometry::ParallelOptions options;
+  options.grain = kParallelGrain;
+  return options;
+}
+
+auto QuantizeValue(double value, double minimum, double scale) -> uint32_t {
+  const auto cell{(value - minimum) * scale};
+  if (!(cell > 0.0)) {
+    return 0U;
+  }
+  return cell < kCellLimit ? static_cast<uint32_t>(cell)
+                           : std::numeric_limits<uint32_t>::max();
+}
+}  // namespace
+
+namespace programmers::geometry {
+CurveQuantizer::CurveQuantizer(const Point2D& minimum, const Point2D& maximum)
+    : minimum_x_(minimum.GetX()), minimum_y_(minimum.GetY()) {
+  const auto extent_x{maximum.GetX() - minimum.GetX()};
+  const auto extent_y{maximum.GetY() - minimum.GetY()};
+  if (!std::isfinite(extent_x) || !std::isfinite(extent_y) ||
+      extent_x < 0.0 || extent_y < 0.0) {
+    throw std::invalid_argument("CurveQuantizer needs a finite rectangle");
+  }
+  const auto extent{std::max(extent_x, extent_y)};
+  scale_ = extent > 0.0 ? kCellLimit / extent : 0.0;
+}
+
+CurveQuantizer::CurveQuantizer(const PointCloud2D& points) {
+  auto minimum_x{std::numeric_limits<double>::infinity()};
+  auto minimum_y{minimum_x};
+  auto maximum_x{-minimum_x};
+  auto maximum_y{-minimum_x};
+  for (std::size_t i = 0; i < points.Size(); ++i) {
+    const auto x{points.GetX(i)};
+    const auto y{points.GetY(i)};
+    if (std::isfinite(x) && std::isfinite(y)) {
+      minimum_x = std::min(minimum_x, x);
+      minimum_y = std::min(minimum_y, y);
+      maximum_x = std::max(maximum_x, x);
+      maximum_y = std::max(maximum_y, y);
+    }
+  }
+  if (minimum_x <= maximum_x &&
+      std::isfinite(std::max(maximum_x - minimum_x, maximum_y - minimum_y))) {
+    *this = CurveQuantizer(Point2D(minimum_x, minimum_y),
+                           Point2D(maximum_x, maximum_y));
+  }
+}
+
+auto CurveQuantizer::Quantize(const Point2D& point) const
+    -> std::pair<uint32_t, uint32_t> {
+  return {QuantizeValue(point.GetX(), minimum_x_, scale_),
+          QuantizeValue(point.GetY(), minimum_y_, scale_)};
+}
+
+auto CurveQuantizer::Quantize(const double* xs, const double* ys,
+                              std::size_t count, uint32_t* cell_xs,
+                              uint32_t* cell_ys) const -> void {
+  for (std::size_t i = 0; i < count; ++i) {
+    cell_xs[i] = QuantizeValue(xs[i], minimum_x_, scale_);
+    cell_ys[i] = QuantizeValue(ys[i], minimum_y_, scale_);
+  }
+}
+
+auto EncodeMorton(uint32_t x, uint32_t y) -> uint64_t {
+  uint64_t key{0U};
+  kernels::EncodeMorton(&x, &y, 1U, &key);
+  return key;
+}
+
+auto DecodeMorton(uint64_t key) -> std::pair<uint32_t, uint32_t> {
+  return {kernels::CompactBits(key), kernels::CompactBits(key >> 1U)};
+}
+
+auto EncodeHilbert(uint32_t x, uint32_t y) -> uint64_t {
+  uint64_t key{0U};
+  kernels::EncodeHilbert(&x, &y, 1U, &key);
+  return key;
+}
+
+auto ComputeCurveKeys(const PointCloud2D& points,
+                      const CurveQuantizer& quantizer, SpaceFillingCurve curve)
+    -> std::vector<uint64_t> {
+  std::vector<uint64_t> keys(points.Size());
+  const auto encode{curve == SpaceFillingCurve::kMorton
+                        ? kernels::EncodeMorton
+                        : kernels::EncodeHilbert};
+  ParallelFor(
+      points.Size(),
+      [&](std::size_t begin, std::size_t end) {
+        std::array<uint32_t, kEncodeBlockSize> cell_xs{};
+        std::array<uint32_t, kEncodeBlockSize> cell_ys{};
+        for (auto block = begin; block < end; block += kEncodeBlockSize) {
+          const auto count{std::min(kEncodeBlockSize, end - block)};
+          quantizer.Quantize(points.XData() + block, points.YData() + block,
+                             count, cell_xs.data(), cell_ys.data());
+          encode(cell_xs.data(), cell_ys.data(), count, keys.data() + block);
+        }
+      },
+      GetParallelOptions());
+  return keys;
+}
+
+auto SortByKey(const std::vector<uint64_t>& keys) -> std::vector<uint32_t> {
+  if (keys.size() >= std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("SortByKey supports less than 2^32 - 1 keys");
+  }
+  const auto count{keys.size()};
+  std::vector<uint32_t> order(count);
+  std::iota(order.begin(), order.end(), 0U);
+  if (count < 2U) {
+    return order;
+  }
+
+  // Digits where every key agrees would be a plain copy, skip them.
+  const auto options{GetParallelOptions()};
+  const auto [any_bits, all_bits]{ParallelReduce(
+      count, std::pair<uint64_t, uint64_t>{0U, ~uint64_t{0U}},
+      [&](std::size_t begin, std::size_t end) {
+        std::pair<uint64_t, uint64_t> bits{0U, ~uint64_t{0U}};
+        for (auto i = begin; i < end; ++i) {
+          bits.first |= keys[i];
+          bits.second &= keys[i];
+        }
+        return bits;
+      },
+      [](const std::pair<uint64_t, uint64_t>& lhs,
+         const std::pair<uint64_t, uint64_t>& rhs) {
+        return std::pair<uint64_t, uint64_t>{lhs.first | rhs.first,
+                                             lhs.second & rhs.second};
+      },
+      options)};
+  const auto varying_bits{any_bits ^ all_bits};
+
+  // Least significant digit first. Every chunk counts its digits, so the
+  // prefix sum over (digit, chunk) gives each chunk its own output ranges
+  // and the scatter stays stable without synchronization.
+  const Partition partition(count, options);
+  auto& pool{GetPool(options)};
+  std::vector<std::array<std::size_t, kRadix>> offsets(partition.Size());
+  std::vector<uint64_t> sorted_keys(keys);
+  std::vector<uint64_t> scratch_keys(count);
+  std::vector<uint32_t> scratch_order(count);
+  for (uint32_t shift = 0; shift < 64U; shift += kRadixBits) {
+    if (((varying_bits >> shift) & kRadixMask) == 0U) {
+      continue;
+    }
+    for (auto& histogram : offsets) {
+      histogram.fill(0U);
+    }
+    pool.Run(partition.Size(), [&](std::size_t chunk) {
+      auto& histogram{offsets[chunk]};
+      for (auto i = partition.GetBegin(chunk);
+           i < partition.GetBegin(chunk + 1U); ++i) {
+        ++histogram[(sorted_keys[i] >> shift) & kRadixMask];
+      }
+    });
+    std::size_t total{0U};
+    for (std::size_t digit = 0; digit < kRadix; ++digit) {
+      for (auto& offset : offsets) {
+        const auto digit_count{offset[digit]};
+        offset[digit] = total;
+        total += digit_count;
+      }
+    }
+    pool.Run(partition.Size(), [&](std::size_t chunk) {
+      auto& offset{offsets[chunk]};
+      for (auto i = partition.GetBegin(chunk);
+           i < partition.GetBegin(chunk + 1U); ++i) {
+        const auto target{offset[(sorted_keys[i] >> shift) & kRadixMask]++};
+        scratch_keys[target] = sorted_keys[i];
+        scratch_order[target] = order[i];
+      }
+    });
+    sorted_keys.swap(scratch_keys);
+    order.swap(scratch_order);
+  }
+  return order;
+}
+
+auto ComputeCurveOrder(const PointCloud2D& points, SpaceFillingCurve curve)
+    -> std::vector<uint32_t> {
+  return SortByKey(ComputeCurveKeys(points, CurveQuantizer(points), curve));
+}
+
+auto ApplyOrder(PointCloud2D& points, const std::vector<uint32_t>& order)
+    -> void {
+  if (points.Size() != order.size()) {
+    throw std::invalid_argument("ApplyOrder sizes differ");
+  }
+  PointCloud2D reordered(points.Size());
+  ParallelFor(
+      order.size(),
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          reordered.XData()[i] = points.GetX(order[i]);
+          reordered.YData()[i] = points.GetY(order[i]);
+        }
+      },
+      GetParallelOptions());
+  points = std::move(reordered);
+}
+
+auto ReorderAlongCurve(PointCloud2D& points, SpaceFillingCurve curve)
+    -> std::vector<uint32_t> {
+  auto order{ComputeCurveOrder(points, curve)};
+  ApplyOrder(points, order);
+  return order;
+}
+
+auto ReorderAlongCurve(std::vector<Point2D>& points, SpaceFillingCurve curve)
+    -> std::vector<uint32_t> {
+  auto order{ComputeCurveOrder(PointCloud2D(points), curve)};
+  ApplyOrder(points, order);
+  return order;
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,397 @@
+/**
+ * @file geometry/spatial_hash_grid2d.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Dynamic uniform grid spatial hash developments of 2-dimension points
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/spatial_hash_grid2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+constexpr std::size_t kMinimumCellCapacity{64U};
+constexpr double kMaximumCellCoordinate{4.0e+18};
+
+/**
+ * @brief Mix the integer coordinates of a cell into a table position
+ */
+auto HashCell(int64_t cell_x, int64_t cell_y) -> uint64_t {
+  auto hash{static_cast<uint64_t>(cell_x) * 0x9E3779B97F4A7C15ULL ^
+            static_cast<uint64_t>(cell_y)};
+  hash = (hash ^ (hash >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+  hash = (hash ^ (hash >> 27U)) * 0x94D049BB133111EBULL;
+  return hash ^ (hash >> 31U);
+}
+
+auto IsFinite(const programmers::geometry::Point2D& point) -> bool {
+  return std::isfinite(point.GetX()) && std::isfinite(point.GetY());
+}
+
+auto CheckFinite(const programmers::geometry::Point2D& point) -> void {
+  if (!IsFinite(point)) {
+    throw std::invalid_argument("SpatialHashGrid2D needs finite coordinates");
+  }
+}
+
+auto FarthestFirst(const programmers::geometry::Neighbor& lhs,
+                   const programmers::geometry::Neighbor& rhs) -> bool {
+  return lhs.squared_distance < rhs.squared_distance;
+}
+}  // namespace
+
+namespace programmers::geometry {
+SpatialHashGrid2D::SpatialHashGrid2D(const Distance& cell_size,
+                                     Distance::Type unit)
+    : cell_size_(cell_size.GetValue(unit)) {
+  if (!(cell_size_ > 0.0) || !std::isfinite(cell_size_)) {
+    throw std::invalid_argument("SpatialHashGrid2D cell size must be positive");
+  }
+  inverse_cell_size_ = 1.0 / cell_size_;
+}
+
+auto SpatialHashGrid2D::GetCellSize() const -> double { return cell_size_; }
+auto SpatialHashGrid2D::Size() const -> std::size_t { return size_; }
+auto SpatialHashGrid2D::Empty() const -> bool { return size_ == 0U; }
+
+auto SpatialHashGrid2D::Reserve(std::size_t count) -> void {
+  nodes_.reserve(count);
+  auto capacity{std::max(kMinimumCellCapacity, cells_.size())};
+  while (capacity < count * 2U) {
+    capacity *= 2U;
+  }
+  if (capacity > cells_.size()) {
+    RehashCells(capacity);
+  }
+}
+
+auto SpatialHashGrid2D::Clear() -> void {
+  nodes_.clear();
+  free_head_ = kInvalidHandle;
+  size_ = 0U;
+  std::fill(cells_.begin(), cells_.end(), Cell{});
+  used_cells_ = 0U;
+  occupied_cells_ = 0U;
+}
+
+auto SpatialHashGrid2D::Insert(const Point2D& point) -> Handle {
+  CheckFinite(point);
+  Handle handle{free_head_};
+  if (handle != kInvalidHandle) {
+    free_head_ = nodes_[handle].next;
+  } else {
+    if (nodes_.size() >= kInvalidHandle) {
+      throw std::length_error("SpatialHashGrid2D handles are exhausted");
+    }
+    handle = static_cast<Handle>(nodes_.size());
+    nodes_.emplace_back();
+  }
+  auto& node{nodes_[handle]};
+  node.x = point.GetX();
+  node.y = point.GetY();
+  node.alive = true;
+  LinkNode(handle, AcquireCell(ToCellCoordinate(node.x),
+                               ToCellCoordinate(node.y)));
+  ++size_;
+  return handle;
+}
+
+auto SpatialHashGrid2D::Move(Handle handle, const Point2D& point) -> void {
+  if (!Contains(handle)) {
+    throw std::out_of_range("SpatialHashGrid2D handle refers to no point");
+  }
+  CheckFinite(point);
+  auto& node{nodes_[handle]};
+  node.x = point.GetX();
+  node.y = point.GetY();
+  const auto cell_x{ToCellCoordinate(node.x)};
+  const auto cell_y{ToCellCoordinate(node.y)};
+  const auto& cell{cells_[node.cell]};
+  if (cell.x == cell_x && cell.y == cell_y) {
+    return;
+  }
+  UnlinkNode(handle);
+  LinkNode(handle, AcquireCell(cell_x, cell_y));
+}
+
+auto SpatialHashGrid2D::Remove(Handle handle) -> void {
+  if (!Contains(handle)) {
+    throw std::out_of_range("SpatialHashGrid2D handle refers to no point");
+  }
+  UnlinkNode(handle);
+  auto& node{nodes_[handle]};
+  node.alive = false;
+  node.next = free_head_;
+  free_head_ = handle;
+  --size_;
+}
+
+auto SpatialHashGrid2D::Contains(Handle handle) const -> bool {
+  return handle < nodes_.size() && nodes_[handle].alive;
+}
+
+auto SpatialHashGrid2D::GetPoint(Handle handle) const -> Point2D {
+  if (!Contains(handle)) {
+    throw std::out_of_range("SpatialHashGrid2D handle refers to no point");
+  }
+  return {nodes_[handle].x, nodes_[handle].y};
+}
+
+auto SpatialHashGrid2D::FindWithinRadius(const Point2D& query,
+                                         double radius) const
+    -> std::vector<Neighbor> {
+  std::vector<Neighbor> output;
+  FindWithinRadius(query, radius, output);
+  return output;
+}
+
+auto SpatialHashGrid2D::FindWithinRadius(const Point2D& query,
+                                         const Distance& radius,
+                                         Distance::Type unit) const
+    -> std::vector<Neighbor> {
+  return FindWithinRadius(query, radius.GetValue(unit));
+}
+
+auto SpatialHashGrid2D::FindWithinRadius(const Point2D& query, double radius,
+                                         std::vector<Neighbor>& output) const
+    -> void {
+  output.clear();
+  // A non-finite query has no cell and is at no finite distance.
+  if (Empty() || !(radius >= 0.0) || !IsFinite(query)) {
+    return;
+  }
+  const auto squared_radius{radius * radius};
+  const auto min_x{ToCellCoordinate(query.GetX() - radius)};
+  const auto max_x{ToCellCoordinate(query.GetX() + radius)};
+  const auto min_y{ToCellCoordinate(query.GetY() - radius)};
+  const auto max_y{ToCellCoordinate(query.GetY() + radius)};
+  const auto covered_cells{(static_cast<double>(max_x - min_x) + 1.0) *
+                           (static_cast<double>(max_y - min_y) + 1.0)};
+
+  if (covered_cells > static_cast<double>(occupied_cells_)) {
+    for (uint32_t slot = 0; slot < cells_.size(); ++slot) {
+      CollectCell(slot, query.GetX(), query.GetY(), squared_radius, output);
+    }
+    return;
+  }
+  for (auto cell_y = min_y; cell_y <= max_y; ++cell_y) {
+    for (auto cell_x = min_x; cell_x <= max_x; ++cell_x) {
+      const auto slot{FindCell(cell_x, cell_y)};
+      if (slot < cells_.size()) {
+        CollectCell(slot, query.GetX(), query.GetY(), squared_radius, output);
+      }
+    }
+  }
+}
+
+auto SpatialHashGrid2D::FindNearest(const Point2D& query, std::size_t k) const
+    -> std::vector<Neighbor> {
+  std::vector<Neighbor> output;
+  FindNearest(query, k, output);
+  return output;
+}
+
+auto SpatialHashGrid2D::FindNearest(const Point2D& query, std::size_t k,
+                                    std::vector<Neighbor>& output) const
+    -> void {
+  output.clear();
+  if (Empty() || k == 0U || !IsFinite(query)) {
+    return;
+  }
+  k = std::min(k, size_);
+  const auto visit_cell{[&](uint32_t slot) {
+    for (auto handle = cells_[slot].head; handle != kInvalidHandle;
+         handle = nodes_[handle].next) {
+      const auto dx{nodes_[handle].x - query.GetX()};
+      const auto dy{nodes_[handle].y - query.GetY()};
+      const auto squared_distance{dx * dx + dy * dy};
+      if (output.size() < k) {
+        output.push_back({handle, squared_distance});
+        std::push_heap(output.begin(), output.end(), FarthestFirst);
+      } else if (squared_distance < output.front().squared_distance) {
+        std::pop_heap(output.begin(), output.end(), FarthestFirst);
+        output.back() = {handle, squared_distance};
+        std::push_heap(output.begin(), output.end(), FarthestFirst);
+      }
+    }
+  }};
+  const auto visit{[&](int64_t cell_x, int64_t cell_y) {
+    const auto slot{FindCell(cell_x, cell_y)};
+    if (slot < cells_.size()) {
+      visit_cell(slot);
+    }
+  }};
+
+  // Rings of cells around the query cell, the points of ring r + 1 are at
+  // least r cells away. Once a ring covers more cells than are occupied,
+  // scanning the occupied cells directly is cheaper.
+  const auto center_x{ToCellCoordinate(query.GetX())};
+  const auto center_y{ToCellCoordinate(query.GetY())};
+  for (int64_t ring = 0;; ++ring) {
+    const auto side{static_cast<double>(2 * ring + 1)};
+    if (side * side > static_cast<double>(4U * occupied_cells_ + 16U)) {
+      output.clear();
+      for (uint32_t slot = 0; slot < cells_.size(); ++slot) {
+        visit_cell(slot);
+      }
+      break;
+    }
+    if (ring == 0) {
+      visit(center_x, center_y);
+    } else {
+      for (auto cell_x = center_x - ring; cell_x <= center_x + ring;
+           ++cell_x) {
+        visit(cell_x, center_y - ring);
+        visit(cell_x, center_y + ring);
+      }
+      for (auto cell_y = center_y - ring + 1; cell_y < center_y + ring;
+           ++cell_y) {
+        visit(center_x - ring, cell_y);
+        visit(center_x + ring, cell_y);
+      }
+    }
+    const auto bound{static_cast<double>(ring) * cell_size_};
+    if (output.size() == k &&
+        bound * bound >= output.front().squared_distance) {
+      break;
+    }
+  }
+  std::sort_heap(output.begin(), output.end(), FarthestFirst);
+}
+
+auto SpatialHashGrid2D::ToCellCoordinate(double value) const -> int64_t {
+  return static_cast<int64_t>(
+      std::clamp(std::floor(value * inverse_cell_size_),
+                 -kMaximumCellCoordinate, kMaximumCellCoordinate));
+}
+
+auto SpatialHashGrid2D::FindCell(int64_t cell_x, int64_t cell_y) const
+    -> uint32_t {
+  const auto table_size{static_cast<uint32_t>(cells_.size())};
+  if (table_size == 0U) {
+    return table_size;
+  }
+  const auto mask{cells_.size() - 1U};
+  for (auto slot = HashCell(cell_x, cell_y) & mask;;
+       slot = (slot + 1U) & mask) {
+    const auto& cell{cells_[slot]};
+    if (!cell.used) {
+      return table_size;
+    }
+    if (cell.x == cell_x && cell.y == cell_y && cell.count > 0U) {
+      return static_cast<uint32_t>(slot);
+    }
+  }
+}
+
+auto SpatialHashGrid2D::AcquireCell(int64_t cell_x, int64_t cell_y)
+    -> uint32_t {
+  if ((used_cells_ + 1U) * 2U > cells_.size()) {
+    RehashCells(std::max({kMinimumCellCapacity, cells_.size(),
+                          occupied_cells_ * 4U}));
+  }
+  const auto mask{cells_.size() - 1U};
+  auto reusable{cells_.size()};
+  auto slot{HashCell(cell_x, cell_y) & mask};
+  for (; cells_[slot].used; slot = (slot + 1U) & mask) {
+    auto& cell{cells_[slot]};
+    if (cell.x == cell_x && cell.y == cell_y) {
+      return static_cast<uint32_t>(slot);
+    }
+    if (cell.count == 0U && reusable == cells_.size()) {
+      reusable = slot;
+    }
+  }
+  if (reusable != cells_.size()) {
+    slot = reusable;
+  } else {
+    ++used_cells_;
+  }
+  auto& cell{cells_[slot]};
+  cell.x = cell_x;
+  cell.y = cell_y;
+  cell.head = kInvalidHandle;
+  cell.count = 0U;
+  cell.used = true;
+  return static_cast<uint32_t>(slot);
+}
+
+auto SpatialHashGrid2D::RehashCells(std::size_t capacity) -> void {
+  auto table_size{kMinimumCellCapacity};
+  while (table_size < capacity) {
+    table_size *= 2U;
+  }
+  std::vector<Cell> previous(table_size);
+  previous.swap(cells_);
+  used_cells_ = 0U;
+  const auto mask{cells_.size() - 1U};
+  for (const auto& cell : previous) {
+    if (!cell.used || cell.count == 0U) {
+      continue;
+    }
+    auto slot{HashCell(cell.x, cell.y) & mask};
+    while (cells_[slot].used) {
+      slot = (slot + 1U) & mask;
+    }
+    cells_[slot] = cell;
+    ++used_cells_;
+    for (auto handle = cell.head; handle != kInvalidHandle;
+         handle = nodes_[handle].next) {
+      nodes_[handle].cell = static_cast<uint32_t>(slot);
+    }
+  }
+}
+
+auto SpatialHashGrid2D::LinkNode(Handle handle, uint32_t cell) -> void {
+  auto& node{nodes_[handle]};
+  auto& target{cells_[cell]};
+  node.cell = cell;
+  node.previous = kInvalidHandle;
+  node.next = target.head;
+  if (target.head != kInvalidHandle) {
+    nodes_[target.head].previous = handle;
+  }
+  target.head = handle;
+  if (target.count++ == 0U) {
+    ++occupied_cells_;
+  }
+}
+
+auto SpatialHashGrid2D::UnlinkNode(Handle handle) -> void {
+  auto& node{nodes_[handle]};
+  auto& cell{cells_[node.cell]};
+  if (node.previous != kInvalidHandle) {
+    nodes_[node.previous].next = node.next;
+  } else {
+    cell.head = node.next;
+  }
+  if (node.next != kInvalidHandle) {
+    nodes_[node.next].previous = node.previous;
+  }
+  if (--cell.count == 0U) {
+    --occupied_cells_;
+  }
+}
+
+auto SpatialHashGrid2D::CollectCell(uint32_t cell, double query_x,
+                                    double query_y, double squared_radius,
+                                    std::vector<Neighbor>& output) const
+    -> void {
+  for (auto handle = cells_[cell].head; handle != kInvalidHandle;
+       handle = nodes_[handle].next) {
+    const auto dx{nodes_[handle].x - query_x};
+    const auto dy{nodes_[handle].y - query_y};
+    const auto squared_distance{dx * dx + dy * dy};
+    if (squared_distance <= squared_radius) {
+      output.push_back({handle, squared_distance});
+    }
+  }
+}
+}  // namespace programmers::geometry
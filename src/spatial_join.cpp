@@ -0,0 +1,577 @@
+/**
+ * @file geometry/spatial_join.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Partitioned spatial join of two point sets developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/spatial_join.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "geometry/bounding_box2d.hpp"
+#include "geometry/kd_tree2d.hpp"
+#include "geometry/kernels.hpp"
+#include "geometry/space_filling_curve.hpp"
+#include "geometry/thread_pool.hpp"
+#include "grid_cells.hpp"
+#include "unique_file.hpp"
+
+namespace {
+using programmers::geometry::PairCallback;
+using programmers::geometry::PointColumns;
+using programmers::geometry::PointCloud2D;
+using programmers::geometry::PointPair;
+
+using programmers::geometry::detail::kBatchSize;
+using programmers::geometry::detail::kRow;
+
+constexpr std::size_t kStripBins{4096U};     ///< Histogram of strips
+constexpr std::size_t kMaximumStrips{128U};  ///< Bounds open spill files
+constexpr std::size_t kSpillBuffer{4096U};   ///< Records per spill write
+
+/**
+ * @brief Point written to a spill file with its index in the input
+ */
+struct SpillRecord {
+  double x{0.0};
+  double y{0.0};
+  uint64_t index{0U};
+};
+
+using RecordVisitor = std::function<void(const SpillRecord&)>;
+
+/**
+ * @brief Visits every record of a point set each time it is called
+ */
+using RecordSource = std::function<void(const RecordVisitor&)>;
+
+/**
+ * @brief Axis along which strips are cut
+ */
+enum class Axis : uint8_t { kX, kY };
+
+/**
+ * @brief Anonymous temporary file of records, removed when closed
+ * @details The file is created once kSpillBuffer records are appended, so
+ * fewer records stay in memory. Records are read back after the last Append.
+ */
+class SpillFile {
+ public:
+  auto Append(const SpillRecord& record) -> void {
+    buffer_.push_back(record);
+    if (buffer_.size() == kSpillBuffer) {
+      Flush();
+    }
+  }
+
+  /**
+   * @brief Read every record back, the file stays readable once more
+   */
+  auto ReadAll() -> std::vector<SpillRecord> {
+    if (!file_) {
+      return buffer_;
+    }
+    Flush();
+    std::vector<SpillRecord> records(count_);
+    std::rewind(file_.get());
+    if (std::fread(records.data(), sizeof(SpillRecord), count_,
+                   file_.get()) != count_) {
+      throw std::system_error(errno, std::generic_category(),
+                              "Cannot read spill file");
+    }
+    return records;
+  }
+
+  /**
+   * @brief Visit every record in order, reading kSpillBuffer at a time
+   */
+  auto ForEach(const RecordVisitor& visitor) -> void {
+    if (!file_) {
+      std::for_each(buffer_.begin(), buffer_.end(), visitor);
+      return;
+    }
+    Flush();
+    std::rewind(file_.get());
+    std::vector<SpillRecord> records(kSpillBuffer);
+    for (std::size_t begin = 0; begin < count_; begin += kSpillBuffer) {
+      const auto size{std::min(kSpillBuffer, count_ - begin)};
+      if (std::fread(records.data(), sizeof(SpillRecord), size,
+                     file_.get()) != size) {
+        throw std::system_error(errno, std::generic_category(),
+                                "Cannot read spill file");
+      }
+      std::for_each(records.begin(),
+                    records.begin() + static_cast<std::ptrdiff_t>(size),
+                    visitor);
+    }
+  }
+
+  [[nodiscard]] auto GetSize() const -> std::size_t {
+    return count_ + buffer_.size();
+  }
+
+  /**
+   * @brief Close and remove the file
+   */
+  auto Close() -> void {
+    file_.reset();
+    buffer_ = {};
+  }
+
+ private:
+  auto Flush() -> void {
+    if (buffer_.empty()) {
+      return;
+    }
+    if (!file_) {
+      file_.reset(std::tmpfile());
+      if (!file_) {
+        throw std::system_error(errno, std::generic_category(),
+                                "Cannot create spill file");
+      }
+    }
+    if (std::fwrite(buffer_.data(), sizeof(SpillRecord), buffer_.size(),
+                    file_.get()) != buffer_.size()) {
+      throw std::system_error(errno, std::generic_category(),
+                              "Cannot write spill file");
+    }
+    count_ += buffer_.size();
+    buffer_.clear();
+  }
+
+  programmers::geometry::detail::UniqueFile file_;
+  std::vector<SpillRecord> buffer_;
+  std::size_t count_{0U};
+};
+
+auto CheckSize(std::size_t count) -> void {
+  if (count >= std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("Too many points for spatial join");
+  }
+}
+
+auto CheckFinite(double x, double y) -> void {
+  if (!std::isfinite(x) || !std::isfinite(y)) {
+    throw std::invalid_argument("Spatial join of non-finite point");
+  }
+}
+
+auto GetBox(const PointColumns& points)
+    -> programmers::geometry::BoundingBox2D {
+  return programmers::geometry::BoundingBox2D::FromPoints(
+      points.xs, points.ys, points.count);
+}
+
+/**
+ * @brief Batches of pairs handed to callback one call at a time
+ */
+class PairSink {
+ public:
+  explicit PairSink(PairCallback callback) : callback_(std::move(callback)) {}
+
+  /**
+   * @brief Hand pairs to callback and count them
+   */
+  auto Emit(std::vector<PointPair>& batch) -> void {
+    total_.fetch_add(batch.size());
+    const std::lock_guard<std::mutex> lock(mutex_);
+    callback_(batch.data(), batch.size());
+    batch.clear();
+  }
+
+  [[nodiscard]] auto GetTotal() const -> std::size_t { return total_.load(); }
+
+ private:
+  PairCallback callback_;
+  std::mutex mutex_;
+  std::atomic<std::size_t> total_{0U};
+};
+
+/**
+ * @brief Join two sets that fit the memory limit
+ */
+auto JoinWithinInMemory(const PointColumns& left, const PointColumns& right,
+                        double radius, PairSink& sink) -> void {
+  using programmers::geometry::ParallelFor;
+  using programmers::geometry::ParallelOptions;
+  if (left.count == 0U || right.count == 0U) {
+    return;
+  }
+  CheckSize(left.count);
+  CheckSize(right.count);
+
+  const auto box{GetBox(left).Union(GetBox(right))};
+  const auto cell{programmers::geometry::detail::GetCellSize(box, radius)};
+  const auto bucket{[&](const PointColumns& points) {
+    return programmers::geometry::detail::BuildBuckets(
+        points.xs, points.ys, points.count, box.GetMinimum(), cell,
+        "Spatial join of non-finite point");
+  }};
+  const auto lefts{bucket(left)};
+  const auto rights{bucket(right)};
+  const auto squared_radius{radius * radius};
+  ParallelOptions options;
+  options.grain = 64U;
+  ParallelFor(
+      lefts.cell_keys.size(),
+      [&](std::size_t begin, std::size_t end) {
+        std::vector<PointPair> batch;
+        batch.reserve(kBatchSize);
+        std::vector<double> distances;
+        for (auto cell_index = begin; cell_index < end; ++cell_index) {
+          const auto key{lefts.cell_keys[cell_index]};
+          // The three right cells of a row are contiguous in key order; the
+          // row below row 0 wraps to a row that never exists.
+          for (const auto row_key : {key - kRow, key, key + kRow}) {
+            const auto first_key{row_key % kRow == 0U ? row_key
+                                                      : row_key - 1U};
+            const auto first_cell{std::lower_bound(
+                rights.cell_keys.begin(), rights.cell_keys.end(),
+                first_key)};
+            const auto last_cell{std::upper_bound(
+                first_cell, rights.cell_keys.end(), row_key + 1U)};
+            const auto other{rights.cell_begins[static_cast<std::size_t>(
+                first_cell - rights.cell_keys.begin())]};
+            const auto size{rights.cell_begins[static_cast<std::size_t>(
+                                last_cell - rights.cell_keys.begin())] -
+                            other};
+            if (size == 0U) {
+              continue;
+            }
+            distances.resize(std::max(distances.size(), size));
+            for (auto i = lefts.cell_begins[cell_index];
+                 i < lefts.cell_begins[cell_index + 1U]; ++i) {
+              programmers::geometry::kernels::CalculateSquaredDistances(
+                  rights.xs.data() + other, rights.ys.data() + other, size,
+                  lefts.xs[i], lefts.ys[i], distances.data());
+              for (std::size_t k = 0; k < size; ++k) {
+                if (distances[k] <= squared_radius) {
+                  batch.push_back({lefts.order[i], rights.order[other + k],
+                                   distances[k]});
+                  if (batch.size() == kBatchSize) {
+                    sink.Emit(batch);
+                  }
+                }
+              }
+            }
+          }
+        }
+        if (!batch.empty()) {
+          sink.Emit(batch);
+        }
+      },
+      options);
+}
+
+/**
+ * @brief Join records loaded into memory, pairs mapped to record indices
+ */
+auto JoinRecords(const std::vector<SpillRecord>& left,
+                 const std::vector<SpillRecord>& right, double radius,
+                 PairSink& sink) -> void {
+  const auto load{[](const std::vector<SpillRecord>& records) {
+    PointCloud2D points(records.size());
+    for (std::size_t i = 0; i < records.size(); ++i) {
+      points.XData()[i] = records[i].x;
+      points.YData()[i] = records[i].y;
+    }
+    return points;
+  }};
+  const auto left_points{load(left)};
+  const auto right_points{load(right)};
+
+  // The records sink is serialized, so one mapped batch is enough.
+  std::vector<PointPair> mapped;
+  PairSink records_sink([&](const PointPair* pairs, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+      mapped.push_back({left[pairs[i].first].index,
+                        right[pairs[i].second].index,
+                        pairs[i].squared_distance});
+    }
+    sink.Emit(mapped);
+  });
+  JoinWithinInMemory(left_points, right_points, radius, records_sink);
+}
+
+/**
+ * @brief Join sets that cannot be split, one pair of blocks at a time
+ * @details Every left block of block records is joined with every right
+ * block in turn, so memory stays bounded even when all points coincide.
+ */
+auto JoinBlocks(const RecordSource& left, const RecordSource& right,
+                double radius, std::size_t block, PairSink& sink) -> void {
+  std::vector<SpillRecord> lefts;
+  std::vector<SpillRecord> rights;
+  const auto join_rights{[&]() {
+    right([&](const SpillRecord& record) {
+      rights.push_back(record);
+      if (rights.size() == block) {
+        JoinRecords(lefts, rights, radius, sink);
+        rights.clear();
+      }
+    });
+    if (!rights.empty()) {
+      JoinRecords(lefts, rights, radius, sink);
+      rights.clear();
+    }
+    lefts.clear();
+  }};
+  left([&](const SpillRecord& record) {
+    lefts.push_back(record);
+    if (lefts.size() == block) {
+      join_rights();
+    }
+  });
+  if (!lefts.empty()) {
+    join_rights();
+  }
+}
+
+/**
+ * @brief Join sets over the memory limit strip by strip through spill files
+ * @details Strips are ranges of a histogram along axis holding about half
+ * of max_points points. Every left point goes to its strip and every right
+ * point to all strips within radius, so each pair is found in exactly one
+ * strip. A strip still over max_points, from a dense bin or from right
+ * points copied into many strips, is split again along y, and one that
+ * splitting along y cannot shrink is joined block by block.
+ */
+auto JoinWithinPartitioned(const RecordSource& left,
+                           const RecordSource& right, double radius,
+                           std::size_t max_points, Axis axis,
+                           PairSink& sink) -> void {
+  const auto get_value{[axis](const SpillRecord& record) {
+    return axis == Axis::kX ? record.x : record.y;
+  }};
+  auto minimum{std::numeric_limits<double>::infinity()};
+  auto maximum{-std::numeric_limits<double>::infinity()};
+  std::size_t count{0U};
+  const auto extend{[&](const SpillRecord& record) {
+    CheckFinite(record.x, record.y);
+    minimum = std::min(minimum, get_value(record));
+    maximum = std::max(maximum, get_value(record));
+    ++count;
+  }};
+  left(extend);
+  right(extend);
+  const auto width{maximum - minimum};
+  if (!std::isfinite(width)) {
+    throw std::invalid_argument("Spatial join of non-finite point");
+  }
+  const auto bin_width{width > 0.0 ? width / kStripBins : 1.0};
+  const auto get_bin{[&](double value) {
+    const auto bin{std::floor((value - minimum) / bin_width)};
+    return bin <= 0.0 ? std::size_t{0U}
+                      : std::min(static_cast<std::size_t>(bin),
+                                 kStripBins - 1U);
+  }};
+  std::vector<std::size_t> bins(kStripBins, 0U);
+  const auto count_bin{
+      [&](const SpillRecord& record) { ++bins[get_bin(get_value(record))]; }};
+  left(count_bin);
+  right(count_bin);
+
+  // Two adjacent greedy strips hold more than strip_points, so this bounds
+  // the strips and open spill files of each axis by about kMaximumStrips.
+  const auto strip_points{std::max<std::size_t>(
+      {max_points / 2U, 2U * count / kMaximumStrips, 1U})};
+  std::vector<std::size_t> strip_of_bin(kStripBins, 0U);
+  std::size_t strip_count{1U};
+  std::size_t points{0U};
+  for (std::size_t bin = 0; bin < kStripBins; ++bin) {
+    if (points > 0U && points + bins[bin] > strip_points) {
+      ++strip_count;
+      points = 0U;
+    }
+    points += bins[bin];
+    strip_of_bin[bin] = strip_count - 1U;
+  }
+  const auto split{[&](const RecordSource& strip_left,
+                       const RecordSource& strip_right) {
+    if (axis == Axis::kX) {
+      JoinWithinPartitioned(strip_left, strip_right, radius, max_points,
+                            Axis::kY, sink);
+    } else {
+      JoinBlocks(strip_left, strip_right, radius,
+                 std::max<std::size_t>(max_points / 2U, 1U), sink);
+    }
+  }};
+  if (strip_count == 1U) {
+    // Every point is in one bin, so strips along this axis cannot help.
+    split(left, right);
+    return;
+  }
+
+  std::vector<SpillFile> left_files(strip_count);
+  std::vector<SpillFile> right_files(strip_count);
+  left([&](const SpillRecord& record) {
+    left_files[strip_of_bin[get_bin(get_value(record))]].Append(record);
+  });
+  right([&](const SpillRecord& record) {
+    // One bin of slack on both sides absorbs rounding of value +- radius.
+    const auto first_bin{get_bin(get_value(record) - radius)};
+    const auto last_bin{get_bin(get_value(record) + radius)};
+    const auto first{strip_of_bin[first_bin > 0U ? first_bin - 1U : 0U]};
+    const auto last{
+        strip_of_bin[std::min(last_bin + 1U, kStripBins - 1U)]};
+    for (auto strip = first; strip <= last; ++strip) {
+      right_files[strip].Append(record);
+    }
+  });
+
+  for (std::size_t strip = 0; strip < strip_count; ++strip) {
+    auto& left_file{left_files[strip]};
+    auto& right_file{right_files[strip]};
+    const auto size{left_file.GetSize() + right_file.GetSize()};
+    if (left_file.GetSize() == 0U || right_file.GetSize() == 0U) {
+      // No pairs in this strip.
+    } else if (size <= max_points) {
+      JoinRecords(left_file.ReadAll(), right_file.ReadAll(), radius, sink);
+    } else {
+      split([&](const RecordVisitor& visitor) { left_file.ForEach(visitor); },
+            [&](const RecordVisitor& visitor) {
+              right_file.ForEach(visitor);
+            });
+    }
+    left_file.Close();
+    right_file.Close();
+  }
+}
+
+/**
+ * @brief Records of points in columns, indexed by their position
+ */
+auto GetRecords(const PointColumns& points) -> RecordSource {
+  return [&points](const RecordVisitor& visitor) {
+    for (std::size_t i = 0; i < points.count; ++i) {
+      visitor({points.xs[i], points.ys[i], i});
+    }
+  };
+}
+}  // namespace
+
+namespace programmers::geometry {
+PointColumns::PointColumns(const PointCloud2D& points)
+    : xs(points.XData()), ys(points.YData()), count(points.Size()) {}
+
+PointColumns::PointColumns(const PointFileReader& reader)
+    : xs(reader.XData()), ys(reader.YData()), count(reader.Size()) {}
+
+PointColumns::PointColumns(const double* xs, const double* ys,
+                           std::size_t count)
+    : xs(xs), ys(ys), count(count) {}
+
+auto JoinWithin(const PointColumns& left, const PointColumns& right,
+                double radius, const PairCallback& callback,
+                const SpatialJoinOptions& options) -> std::size_t {
+  if (!(radius >= 0.0) || !std::isfinite(radius)) {
+    throw std::invalid_argument("Radius must be finite and not negative");
+  }
+  PairSink sink(callback);
+  const auto max_points{options.memory_limit /
+                        SpatialJoinOptions::kBytesPerPoint};
+  if (options.memory_limit == 0U || left.count + right.count <= max_points) {
+    JoinWithinInMemory(left, right, radius, sink);
+  } else {
+    JoinWithinPartitioned(GetRecords(left), GetRecords(right), radius,
+                          max_points, Axis::kX, sink);
+  }
+  return sink.GetTotal();
+}
+
+auto JoinWithin(const PointColumns& left, const PointColumns& right,
+                const Distance& radius, const PairCallback& callback,
+                Distance::Type unit, const SpatialJoinOptions& options)
+    -> std::size_t {
+  return JoinWithin(left, right, radius.GetValue(unit), callback, options);
+}
+
+auto JoinNearest(const PointColumns& left, const PointColumns& right,
+                 std::size_t k, const PairCallback& callback,
+                 const SpatialJoinOptions& options) -> std::size_t {
+  CheckSize(left.count);
+  CheckSize(right.count);
+  PointCloud2D right_points(right.count);
+  for (std::size_t i = 0; i < right.count; ++i) {
+    CheckFinite(right.xs[i], right.ys[i]);
+    right_points.XData()[i] = right.xs[i];
+    right_points.YData()[i] = right.ys[i];
+  }
+  const KdTree2D tree(right_points);
+  const auto row{std::min(k, tree.Size())};
+  if (left.count == 0U || row == 0U) {
+    return 0U;
+  }
+
+  const auto box{GetBox(left)};
+  const auto max_points{options.memory_limit /
+                        SpatialJoinOptions::kBytesPerPoint};
+  const auto block_size{options.memory_limit == 0U
+                            ? left.count
+                            : std::max<std::size_t>(max_points, 1U)};
+  PairSink sink(callback);
+  std::vector<uint32_t> cell_xs;
+  std::vector<uint32_t> cell_ys;
+  std::vector<uint64_t> keys;
+  for (std::size_t block = 0; block < left.count; block += block_size) {
+    const auto count{std::min(block_size, left.count - block)};
+    const auto* xs{left.xs + block};
+    const auto* ys{left.ys + block};
+    for (std::size_t i = 0; i < count; ++i) {
+      CheckFinite(xs[i], ys[i]);
+    }
+    const CurveQuantizer quantizer(box.GetMinimum(), box.GetMaximum());
+    cell_xs.resize(count);
+    cell_ys.resize(count);
+    keys.resize(count);
+    quantizer.Quantize(xs, ys, count, cell_xs.data(), cell_ys.data());
+    kernels::EncodeHilbert(cell_xs.data(), cell_ys.data(), count,
+                           keys.data());
+    const auto order{SortByKey(keys)};
+
+    ParallelOptions parallel_options;
+    parallel_options.grain = 256U;
+    ParallelFor(
+        count,
+        [&](std::size_t begin, std::size_t end) {
+          std::vector<PointPair> batch;
+          batch.reserve(kBatchSize + row);
+          for (auto i = begin; i < end; ++i) {
+            const auto index{order[i]};
+            for (const auto& neighbor :
+                 tree.FindNearest(Point2D(xs[index], ys[index]), row)) {
+              batch.push_back({block + index, neighbor.index,
+                               neighbor.squared_distance});
+            }
+            if (batch.size() >= kBatchSize) {
+              sink.Emit(batch);
+            }
+          }
+          if (!batch.empty()) {
+            sink.Emit(batch);
+          }
+        },
+        parallel_options);
+  }
+  return sink.GetTotal();
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,218 @@
+/**
+ * @file geometry/thread_pool.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Work stealing thread pool and parallel loop developments
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/thread_pool.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace {
+/**
+ * @brief Pool whose worker is the current thread, nullptr for other threads
+ */
+thread_local const programmers::geometry::ThreadPool* current_pool{nullptr};
+/**
+ * @brief Queue of the current worker thread in current_pool
+ */
+thread_local std::size_t current_queue{0U};
+}  // namespace
+
+namespace programmers::geometry {
+/**
+ * @brief Tasks of one Run call, living on the caller's stack
+ */
+struct ThreadPool::Job {
+  const std::function<void(std::size_t)>* task{nullptr};  ///< The task
+  std::atomic<std::size_t> remaining{0U};  ///< Tasks not finished yet
+  std::atomic<bool> failed{false};         ///< Whether a task threw
+  std::mutex mutex;                        ///< Guards error
+  std::exception_ptr error;                ///< First exception of a task
+};
+
+ThreadPool::ThreadPool(std::size_t thread_count) {
+  if (thread_count == 0U) {
+    thread_count = std::max(1U, std::thread::hardware_concurrency());
+  }
+  // One queue per worker, then one shared by threads outside the pool.
+  for (std::size_t i = 0; i < thread_count; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  workers_.reserve(thread_count - 1U);
+  for (std::size_t i = 0; i + 1U < thread_count; ++i) {
+    workers_.emplace_back([this, i]() { Work(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    const std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+auto ThreadPool::GetDefault() -> ThreadPool& {
+  static ThreadPool pool;
+  return pool;
+}
+
+auto ThreadPool::GetThreadCount() const -> std::size_t {
+  return workers_.size() + 1U;
+}
+
+auto ThreadPool::Run(std::size_t task_count,
+                     const std::function<void(std::size_t)>& task,
+                     Affinity affinity) -> void {
+  if (workers_.empty()) {
+    for (std::size_t i = 0; i < task_count; ++i) {
+      task(i);
+    }
+    return;
+  }
+  if (task_count == 0U) {
+    return;
+  }
+
+  Job job;
+  job.task = &task;
+  job.remaining.store(task_count);
+  const auto caller{GetCallerQueue()};
+  queued_.fetch_add(task_count);
+  if (affinity == Affinity::kStable) {
+    const auto queue_count{queues_.size()};
+    for (std::size_t queue = 0; queue < queue_count; ++queue) {
+      auto& target{*queues_[queue]};
+      const std::lock_guard<std::mutex> lock(target.mutex);
+      for (auto i = task_count * queue / queue_count;
+           i < task_count * (queue + 1U) / queue_count; ++i) {
+        target.tasks.push_back({&job, i});
+      }
+    }
+  } else {
+    auto& target{*queues_[caller]};
+    const std::lock_guard<std::mutex> lock(target.mutex);
+    // The caller pops the back, so it starts from the first task.
+    for (auto i = task_count; i > 0U; --i) {
+      target.tasks.push_back({&job, i - 1U});
+    }
+  }
+  {
+    const std::lock_guard<std::mutex> lock(sleep_mutex_);
+  }
+  wake_.notify_all();
+
+  // Help until the job is done; tasks of other jobs may run meanwhile.
+  while (job.remaining.load(std::memory_order_acquire) > 0U) {
+    if (!RunOne(caller)) {
+      std::this_thread::yield();
+    }
+  }
+  if (job.error) {
+    std::rethrow_exception(job.error);
+  }
+}
+
+auto ThreadPool::RunOne(std::size_t queue) -> bool {
+  Task task;
+  bool found{false};
+  {
+    auto& own{*queues_[queue]};
+    const std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.tasks.empty()) {
+      task = own.tasks.back();
+      own.tasks.pop_back();
+      found = true;
+    }
+  }
+  for (std::size_t k = 1; k < queues_.size() && !found; ++k) {
+    auto& victim{*queues_[(queue + k) % queues_.size()]};
+    const std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = victim.tasks.front();
+      victim.tasks.pop_front();
+      found = true;
+    }
+  }
+  if (!found) {
+    return false;
+  }
+  queued_.fetch_sub(1U);
+
+  auto& job{*task.job};
+  if (!job.failed.load(std::memory_order_relaxed)) {
+    try {
+      (*job.task)(task.index);
+    } catch (...) {
+      const std::lock_guard<std::mutex> lock(job.mutex);
+      if (!job.error) {
+        job.error = std::current_exception();
+      }
+      job.failed.store(true, std::memory_order_relaxed);
+    }
+  }
+  // The caller may destroy the job once this reaches zero.
+  job.remaining.fetch_sub(1U, std::memory_order_acq_rel);
+  return true;
+}
+
+auto ThreadPool::Work(std::size_t queue) -> void {
+  current_pool = this;
+  current_queue = queue;
+  while (true) {
+    if (RunOne(queue)) {
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    wake_.wait(lock, [this]() { return stop_ || queued_.load() > 0U; });
+    if (stop_ && queued_.load() == 0U) {
+      return;
+    }
+  }
+}
+
+auto ThreadPool::GetCallerQueue() const -> std::size_t {
+  return current_pool == this ? current_queue : queues_.size() - 1U;
+}
+
+Partition::Partition(std::size_t count, const ParallelOptions& options)
+    : count_(count), chunk_count_(0U), grain_(0U) {
+  const auto grain{std::max<std::size_t>(options.grain, 1U)};
+  const auto chunk_count{count / grain + (count % grain != 0U ? 1U : 0U)};
+  if (options.chunking == Chunking::kFixed) {
+    chunk_count_ = chunk_count;
+    grain_ = grain;
+    return;
+  }
+  const auto thread_count{GetPool(options).GetThreadCount()};
+  chunk_count_ = std::min(chunk_count,
+                          thread_count == 1U ? std::size_t{1U}
+                                             : 4U * thread_count);
+}
+
+auto Partition::Size() const -> std::size_t { return chunk_count_; }
+
+auto Partition::GetBegin(std::size_t chunk) const -> std::size_t {
+  if (grain_ != 0U) {
+    return std::min(count_, chunk * grain_);
+  }
+  return chunk_count_ == 0U ? 0U : count_ / chunk_count_ * chunk +
+                                       count_ % chunk_count_ * chunk /
+                                           chunk_count_;
+}
+
+auto GetPool(const ParallelOptions& options) -> ThreadPool& {
+  return options.pool != nullptr ? *options.pool : ThreadPool::GetDefault();
+}
+}  // namespace programmers::geometry
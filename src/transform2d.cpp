@@ -0,0 +1,121 @@
+/**
+ * @file geometry/transform2d.cpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief Affine transform class developments with 2-dimension
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/transform2d.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "geometry/kernels.hpp"
+#include "geometry/thread_pool.hpp"
+
+namespace programmers::geometry {
+Transform2D::Transform2D() : matrix_{1.0, 0.0, 0.0, 0.0, 1.0, 0.0} {}
+
+Transform2D::Transform2D(double a, double b, double tx, double c, double d,
+                         double ty)
+    : matrix_{a, b, tx, c, d, ty} {}
+
+auto Transform2D::Identity() -> Transform2D { return {}; }
+
+auto Transform2D::Translation(const Point2D& offset) -> Transform2D {
+  return {1.0, 0.0, offset.GetX(), 0.0, 1.0, offset.GetY()};
+}
+
+auto Transform2D::Rotation(double radians) -> Transform2D {
+  const auto cosine{std::cos(radians)};
+  const auto sine{std::sin(radians)};
+  return {cosine, -sine, 0.0, sine, cosine, 0.0};
+}
+
+auto Transform2D::Rotation(double radians, const Point2D& center)
+    -> Transform2D {
+  return Translation(center) * Rotation(radians) *
+         Translation(Point2D(-center.GetX(), -center.GetY()));
+}
+
+auto Transform2D::Scaling(double scale_x, double scale_y) -> Transform2D {
+  return {scale_x, 0.0, 0.0, 0.0, scale_y, 0.0};
+}
+
+auto Transform2D::Shearing(double shear_x, double shear_y) -> Transform2D {
+  return {1.0, shear_x, 0.0, shear_y, 1.0, 0.0};
+}
+
+auto Transform2D::GetMatrix() const -> const std::array<double, 6>& {
+  return matrix_;
+}
+
+auto Transform2D::GetDeterminant() const -> double {
+  return matrix_[0] * matrix_[4] - matrix_[1] * matrix_[3];
+}
+
+auto Transform2D::Inverse() const -> Transform2D {
+  const auto determinant{GetDeterminant()};
+  if (determinant == 0.0 || !std::isfinite(determinant)) {
+    throw std::invalid_argument("Transform2D is not invertible");
+  }
+  const auto [a, b, tx, c, d, ty]{matrix_};
+  const auto inverse_a{d / determinant};
+  const auto inverse_b{-b / determinant};
+  const auto inverse_c{-c / determinant};
+  const auto inverse_d{a / determinant};
+  return {inverse_a, inverse_b, -(inverse_a * tx + inverse_b * ty),
+          inverse_c, inverse_d, -(inverse_c * tx + inverse_d * ty)};
+}
+
+auto Transform2D::Then(const Transform2D& next) const -> Transform2D {
+  return next * *this;
+}
+
+auto Transform2D::Apply(const Point2D& point) const -> Point2D {
+  const auto x{point.GetX()};
+  const auto y{point.GetY()};
+  return {matrix_[0] * x + matrix_[1] * y + matrix_[2],
+          matrix_[3] * x + matrix_[4] * y + matrix_[5]};
+}
+
+auto Transform2D::Apply(const PointCloud2D& cloud) const -> PointCloud2D {
+  PointCloud2D output(cloud.Size());
+  Apply(cloud.XData(), cloud.YData(), cloud.Size(), output.XData(),
+        output.YData());
+  return output;
+}
+
+auto Transform2D::ApplyInPlace(PointCloud2D& cloud) const -> void {
+  Apply(cloud.XData(), cloud.YData(), cloud.Size(), cloud.XData(),
+        cloud.YData());
+}
+
+auto Transform2D::Apply(const double* xs, const double* ys, std::size_t count,
+                        double* output_xs, double* output_ys) const -> void {
+  ParallelFor(count, [&](std::size_t begin, std::size_t end) {
+    kernels::Transform(xs + begin, ys + begin, end - begin, matrix_.data(),
+                       output_xs + begin, output_ys + begin);
+  });
+}
+
+auto Transform2D::operator*(const Transform2D& other) const -> Transform2D {
+  const auto [a, b, tx, c, d, ty]{matrix_};
+  const auto [e, f, ux, g, h, uy]{other.matrix_};
+  return {a * e + b * g, a * f + b * h, a * ux + b * uy + tx,
+          c * e + d * g, c * f + d * h, c * ux + d * uy + ty};
+}
+
+auto Transform2D::operator==(const Transform2D& other) const -> bool {
+  return matrix_ == other.matrix_;
+}
+
+auto Transform2D::operator!=(const Transform2D& other) const -> bool {
+  return !(*this == other);
+}
+}  // namespace programmers::geometry
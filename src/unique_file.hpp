@@ -0,0 +1,30 @@
+/**
+ * @file geometry/unique_file.hpp
+ * @author woong137 (woong137137@gmail.com)
+ * @brief C file handle closed by its owner
+ * @version 1.0.0
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2024 Programmers, All Rights Reserved.
+ */
+
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#ifndef PROGRAMMERS__GEOMETRY__UNIQUE_FILE_HPP_
+#define PROGRAMMERS__GEOMETRY__UNIQUE_FILE_HPP_
+
+#include <cstdio>
+#include <memory>
+
+namespace programmers::geometry::detail {
+struct FileCloser {
+  auto operator()(std::FILE* file) const -> void { std::fclose(file); }
+};
+
+/**
+ * @brief File closed when the handle is reset or destroyed
+ */
+using UniqueFile = std::unique_ptr<std::FILE, FileCloser>;
+}  // namespace programmers::geometry::detail
+
+#endif
@@ -0,0 +1,162 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/bounding_box2d.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/kernels.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+auto CreateRandomValue() -> double {
+  return static_cast<double>(std::rand()) / RAND_MAX * 200.0 - 100.0;
+}
+
+auto IsSet(const std::vector<uint64_t>& mask, std::size_t index) -> bool {
+  return ((mask[index / 64U] >> (index % 64U)) & 1U) != 0U;
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryBoundingBox2D, Construct) {
+  const BoundingBox2D empty;
+  EXPECT_TRUE(empty.IsEmpty());
+  EXPECT_EQ(0.0, empty.GetWidth());
+  EXPECT_FALSE(empty.Contains(Point2D(0.0, 0.0)));
+
+  const BoundingBox2D box(Point2D(-1.0, 2.0), Point2D(3.0, 5.0));
+  EXPECT_FALSE(box.IsEmpty());
+  EXPECT_EQ(Point2D(-1.0, 2.0), box.GetMinimum());
+  EXPECT_EQ(Point2D(3.0, 5.0), box.GetMaximum());
+  EXPECT_EQ(4.0, box.GetWidth());
+  EXPECT_EQ(3.0, box.GetHeight());
+  EXPECT_FALSE(BoundingBox2D(Point2D(1.0, 1.0), Point2D(1.0, 1.0)).IsEmpty());
+
+  EXPECT_THROW(BoundingBox2D(Point2D(1.0, 0.0), Point2D(0.0, 1.0)),
+               std::invalid_argument);
+  EXPECT_THROW(BoundingBox2D(Point2D(NAN, 0.0), Point2D(0.0, 1.0)),
+               std::invalid_argument);
+}
+
+TEST(GeometryBoundingBox2D, Operations) {
+  const BoundingBox2D box(Point2D(0.0, 0.0), Point2D(4.0, 4.0));
+  const BoundingBox2D other(Point2D(2.0, 3.0), Point2D(6.0, 8.0));
+  const BoundingBox2D far(Point2D(10.0, 10.0), Point2D(11.0, 11.0));
+  const BoundingBox2D empty;
+
+  EXPECT_TRUE(box.Contains(Point2D(0.0, 4.0)));
+  EXPECT_FALSE(box.Contains(Point2D(4.5, 2.0)));
+  EXPECT_FALSE(box.Contains(Point2D(NAN, 2.0)));
+  EXPECT_TRUE(box.Contains(BoundingBox2D(Point2D(1.0, 1.0),
+                                         Point2D(4.0, 2.0))));
+  EXPECT_FALSE(box.Contains(other));
+  EXPECT_TRUE(box.Contains(empty));
+
+  EXPECT_TRUE(box.Intersects(other));
+  EXPECT_TRUE(box.Intersects(
+      BoundingBox2D(Point2D(4.0, 4.0), Point2D(5.0, 5.0))));
+  EXPECT_FALSE(box.Intersects(far));
+  EXPECT_FALSE(box.Intersects(empty));
+  EXPECT_FALSE(empty.Intersects(empty));
+
+  EXPECT_EQ(BoundingBox2D(Point2D(0.0, 0.0), Point2D(6.0, 8.0)),
+            box.Union(other));
+  EXPECT_EQ(box, box.Union(empty));
+  EXPECT_EQ(box, empty.Union(box));
+  EXPECT_EQ(BoundingBox2D(Point2D(2.0, 3.0), Point2D(4.0, 4.0)),
+            box.Intersection(other));
+  EXPECT_EQ(empty, box.Intersection(far));
+  EXPECT_TRUE(box.Intersection(empty).IsEmpty());
+  EXPECT_NE(box, other);
+
+  auto grown{empty};
+  grown.Extend(Point2D(1.0, -1.0));
+  grown.Extend(Point2D(NAN, 3.0));
+  grown.Extend(Point2D(-2.0, 0.0));
+  EXPECT_EQ(BoundingBox2D(Point2D(-2.0, -1.0), Point2D(1.0, 3.0)), grown);
+}
+
+TEST(GeometryBoundingBox2D, FromPoints) {
+  EXPECT_TRUE(BoundingBox2D::FromPoints(PointCloud2D()).IsEmpty());
+
+  PointCloud2D points;
+  auto expected{BoundingBox2D()};
+  for (uint32_t i = 0; i < kTestCount * 10U + 5U; ++i) {
+    const Point2D point(CreateRandomValue(), CreateRandomValue());
+    points.PushBack(point);
+    expected.Extend(point);
+  }
+  points.PushBack(NAN, 0.0);
+  points.PushBack(0.0, NAN);
+  for (const auto isa :
+       {kernels::Isa::kScalar, kernels::Isa::kSse2, kernels::Isa::kAvx2,
+        kernels::Isa::kAvx512}) {
+    kernels::SetActiveIsa(isa);
+    EXPECT_EQ(expected, BoundingBox2D::FromPoints(points));
+    for (std::size_t count = 0; count < 20U; ++count) {
+      auto prefix{BoundingBox2D()};
+      for (std::size_t i = 0; i < count; ++i) {
+        prefix.Extend(points.GetPoint(i));
+      }
+      EXPECT_EQ(prefix, BoundingBox2D::FromPoints(points.XData(),
+                                                  points.YData(), count));
+    }
+  }
+  kernels::ResetActiveIsa();
+}
+
+TEST(GeometryBoundingBox2D, Filter) {
+  const BoundingBox2D query(Point2D(-30.0, -50.0), Point2D(40.0, 20.0));
+  PointCloud2D points;
+  std::vector<BoundingBox2D> boxes;
+  for (uint32_t i = 0; i < kTestCount + 13U; ++i) {
+    points.PushBack(CreateRandomValue(), CreateRandomValue());
+    const Point2D corner(CreateRandomValue(), CreateRandomValue());
+    boxes.emplace_back(corner, corner + Point2D(std::abs(CreateRandomValue()),
+                                                std::abs(CreateRandomValue())));
+  }
+  points.PushBack(NAN, 0.0);
+  boxes.emplace_back();
+  std::vector<double> min_xs;
+  std::vector<double> min_ys;
+  std::vector<double> max_xs;
+  std::vector<double> max_ys;
+  for (const auto& box : boxes) {
+    min_xs.push_back(box.GetMinimum().GetX());
+    min_ys.push_back(box.GetMinimum().GetY());
+    max_xs.push_back(box.GetMaximum().GetX());
+    max_ys.push_back(box.GetMaximum().GetY());
+  }
+
+  for (const auto isa :
+       {kernels::Isa::kScalar, kernels::Isa::kSse2, kernels::Isa::kAvx2,
+        kernels::Isa::kAvx512}) {
+    kernels::SetActiveIsa(isa);
+    const auto within{query.FilterWithin(points)};
+    ASSERT_EQ((points.Size() + 63U) / 64U, within.size());
+    for (std::size_t i = 0; i < points.Size(); ++i) {
+      EXPECT_EQ(query.Contains(points.GetPoint(i)), IsSet(within, i));
+    }
+    // Bits past the last point are cleared.
+    EXPECT_EQ(0U, within.back() >> (points.Size() % 64U));
+
+    const auto intersecting{query.FilterIntersecting(boxes)};
+    std::vector<uint64_t> arrays(intersecting.size(), ~uint64_t{0U});
+    query.FilterIntersecting(min_xs.data(), min_ys.data(), max_xs.data(),
+                             max_ys.data(), boxes.size(), arrays.data());
+    EXPECT_EQ(intersecting, arrays);
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+      EXPECT_EQ(query.Intersects(boxes[i]), IsSet(intersecting, i));
+    }
+    EXPECT_FALSE(IsSet(intersecting, boxes.size() - 1U));
+  }
+  kernels::ResetActiveIsa();
+}
+}  // namespace programmers::geometry
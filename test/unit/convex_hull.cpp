@@ -0,0 +1,171 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/convex_hull.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/predicates.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+using programmers::geometry::PointCloud2D;
+
+auto CreateRandomCloud(std::size_t count) -> PointCloud2D {
+  PointCloud2D cloud;
+  for (std::size_t i = 0; i < count; ++i) {
+    // A disk, so that many points are near the hull.
+    const auto angle{static_cast<double>(std::rand()) / RAND_MAX * 6.28};
+    const auto radius{std::sqrt(static_cast<double>(std::rand()) / RAND_MAX)};
+    cloud.PushBack({radius * std::cos(angle), radius * std::sin(angle)});
+  }
+  return cloud;
+}
+
+/**
+ * @brief Create integer points in a square of side range - 1, half of them
+ * on its sides, so that many are collinear with hull edges or duplicates
+ */
+auto CreateSquareCloud(std::size_t count, int range) -> PointCloud2D {
+  PointCloud2D cloud;
+  for (std::size_t i = 0; i < count; ++i) {
+    auto x{std::rand() % range};
+    auto y{std::rand() % range};
+    if (std::rand() % 2 == 0) {
+      (std::rand() % 2 == 0 ? x : y) = std::rand() % 2 == 0 ? 0 : range - 1;
+    }
+    cloud.PushBack({static_cast<double>(x), static_cast<double>(y)});
+  }
+  return cloud;
+}
+
+/**
+ * @brief Check the hull is strictly convex, holds every point and starts
+ * from the smallest point, with the smallest index of duplicates
+ */
+auto ExpectHull(const PointCloud2D& cloud,
+                const std::vector<std::size_t>& hull) -> void {
+  using programmers::geometry::Orientation;
+  ASSERT_LE(3U, hull.size());
+  for (std::size_t i = 0; i < hull.size(); ++i) {
+    const auto a{cloud.GetPoint(hull[i])};
+    const auto b{cloud.GetPoint(hull[(i + 1U) % hull.size()])};
+    const auto c{cloud.GetPoint(hull[(i + 2U) % hull.size()])};
+    EXPECT_EQ(Orientation::kCounterClockwise, CalculateOrientation(a, b, c));
+    for (std::size_t j = 0; j < cloud.Size(); ++j) {
+      EXPECT_NE(Orientation::kClockwise,
+                CalculateOrientation(a, b, cloud.GetPoint(j)));
+      if (cloud.GetPoint(j) == a) {
+        EXPECT_LE(hull[i], j);
+      }
+    }
+  }
+  for (std::size_t j = 0; j < cloud.Size(); ++j) {
+    const auto first{cloud.GetPoint(hull.front())};
+    EXPECT_TRUE(first.GetX() < cloud.GetX(j) ||
+                (first.GetX() == cloud.GetX(j) &&
+                 first.GetY() <= cloud.GetY(j)));
+  }
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryConvexHull, ComputeConvexHull) {
+  for (const auto& cloud : {CreateRandomCloud(kTestCount),
+                            CreateSquareCloud(kTestCount, 30)}) {
+    ExpectHull(cloud, ComputeConvexHull(cloud));
+  }
+
+  // Collinear points on the edges and duplicate corners are not reported.
+  PointCloud2D grid;
+  for (int y = 0; y < 10; ++y) {
+    for (int x = 0; x < 10; ++x) {
+      grid.PushBack({static_cast<double>(x), static_cast<double>(y)});
+    }
+  }
+  grid.PushBack({9.0, 9.0});
+  EXPECT_EQ(std::vector<std::size_t>({0U, 9U, 99U, 90U}),
+            ComputeConvexHull(grid));
+
+  EXPECT_EQ(std::vector<std::size_t>(), ComputeConvexHull(PointCloud2D()));
+  EXPECT_EQ(std::vector<std::size_t>({0U}),
+            ComputeConvexHull(PointCloud2D({{1.0, 1.0}, {1.0, 1.0}})));
+  EXPECT_EQ(std::vector<std::size_t>({2U, 1U}),
+            ComputeConvexHull(
+                PointCloud2D({{1.0, 1.0}, {3.0, 3.0}, {0.0, 0.0}})));
+  EXPECT_THROW(static_cast<void>(ComputeConvexHull(
+                   PointCloud2D({{1.0, 1.0}, {NAN, 3.0}}))),
+               std::invalid_argument);
+}
+
+TEST(GeometryConvexHull, Parallel) {
+  // Large enough for several chunks; the prefilter drops most points.
+  const auto cloud{CreateRandomCloud(kTestCount * 100U)};
+  const auto hull{ComputeConvexHull(cloud)};
+  ASSERT_LE(3U, hull.size());
+  PointCloud2D shuffled;
+  for (auto i = cloud.Size(); i > 0U; --i) {
+    shuffled.PushBack(cloud.GetPoint(i - 1U));
+  }
+  const auto reversed{ComputeConvexHull(shuffled)};
+  ASSERT_EQ(hull.size(), reversed.size());
+  for (std::size_t i = 0; i < hull.size(); ++i) {
+    EXPECT_EQ(cloud.Size() - 1U - hull[i], reversed[i]);
+  }
+}
+
+TEST(GeometryConvexHull, Incremental) {
+  for (const auto& cloud : {CreateRandomCloud(kTestCount),
+                            CreateSquareCloud(kTestCount, 20)}) {
+    IncrementalConvexHull incremental;
+    PointCloud2D prefix;
+    for (std::size_t i = 0; i < cloud.Size(); ++i) {
+      const auto before{incremental.GetIndices()};
+      const auto changed{incremental.Append(cloud.GetPoint(i))};
+      prefix.PushBack(cloud.GetPoint(i));
+      EXPECT_EQ(changed, before != incremental.GetIndices());
+      if (i % 50U == 0U || i + 1U == cloud.Size()) {
+        EXPECT_EQ(ComputeConvexHull(prefix), incremental.GetIndices());
+      }
+      EXPECT_TRUE(incremental.Contains(cloud.GetPoint(i)));
+    }
+    EXPECT_EQ(cloud.Size(), incremental.Size());
+    EXPECT_EQ(incremental.GetIndices().size(), incremental.GetVertexCount());
+    EXPECT_EQ(cloud.GetPoint(incremental.GetIndices().front()),
+              incremental.GetVertices().front());
+
+    // Batches give the same hull as single points.
+    IncrementalConvexHull batched;
+    PointCloud2D first;
+    PointCloud2D second;
+    for (std::size_t i = 0; i < cloud.Size(); ++i) {
+      (i < cloud.Size() / 3U ? first : second).PushBack(cloud.GetPoint(i));
+    }
+    EXPECT_TRUE(batched.Append(first));
+    batched.Append(second);
+    EXPECT_EQ(incremental.GetIndices(), batched.GetIndices());
+    EXPECT_FALSE(batched.Append(first));
+  }
+
+  IncrementalConvexHull hull;
+  EXPECT_FALSE(hull.Contains(Point2D(0.0, 0.0)));
+  EXPECT_TRUE(hull.Append(Point2D(0.0, 0.0)));
+  EXPECT_FALSE(hull.Append(Point2D(0.0, 0.0)));
+  EXPECT_TRUE(hull.Append(Point2D(2.0, 0.0)));
+  EXPECT_TRUE(hull.Contains(Point2D(1.0, 0.0)));
+  EXPECT_FALSE(hull.Append(Point2D(1.0, 0.0)));
+  EXPECT_TRUE(hull.Append(Point2D(4.0, 0.0)));
+  EXPECT_EQ(std::vector<std::size_t>({0U, 4U}), hull.GetIndices());
+  EXPECT_TRUE(hull.Append(Point2D(4.0, 4.0)));
+  EXPECT_TRUE(hull.Append(Point2D(8.0, 8.0)));
+  EXPECT_EQ(std::vector<std::size_t>({0U, 4U, 6U}), hull.GetIndices());
+  EXPECT_THROW(hull.Append(Point2D(INFINITY, 0.0)), std::invalid_argument);
+  EXPECT_EQ(7U, hull.Size());
+}
+}  // namespace programmers::geometry
@@ -3,10 +3,33 @@
 
 #include "geometry/distance.hpp"
 
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
 #include "gtest/gtest.h"
 
 namespace {
 constexpr uint32_t kTestCount = 1000U;
+constexpr int64_t kInt64Max{std::numeric_limits<int64_t>::max()};
+constexpr int64_t kInt64Min{std::numeric_limits<int64_t>::min()};
+constexpr std::array<programmers::geometry::Rounding, 5> kRoundings{
+    programmers::geometry::Rounding::kTowardZero,
+    programmers::geometry::Rounding::kDown,
+    programmers::geometry::Rounding::kUp,
+    programmers::geometry::Rounding::kNearest,
+    programmers::geometry::Rounding::kNearestEven};
+/// Expected results of 2.5 and -2.5 in the order of kRoundings
+constexpr std::array<int64_t, 5> kPositiveHalf{2, 2, 3, 3, 2};
+constexpr std::array<int64_t, 5> kNegativeHalf{-2, -3, -2, -3, -2};
+
+auto CreateRandomNanometer() -> int64_t {
+  return static_cast<int64_t>((static_cast<uint64_t>(std::rand()) << 31U) ^
+                              static_cast<uint64_t>(std::rand())) -
+         (int64_t{1} << 61);
+}
 }
 namespace programmers::geometry {
 TEST(GeometryDistance, Constructor) {
@@ -309,4 +332,163 @@ TEST(GeometryDistance, OperatorSubtractAssignment) {
   EXPECT_DOUBLE_EQ(distance1.GetValue(Distance::Type::kMeter),
                    KInputValue * 998);
 }
+
+TEST(GeometryDistance, ConstructorWithRounding) {
+  for (std::size_t i = 0; i < kRoundings.size(); ++i) {
+    EXPECT_EQ(kPositiveHalf[i],
+              Distance(2.5, Distance::Type::kNanometer, kRoundings[i])
+                  .GetNanometer());
+    EXPECT_EQ(kNegativeHalf[i],
+              Distance(-2.5, Distance::Type::kNanometer, kRoundings[i])
+                  .GetNanometer());
+  }
+  EXPECT_EQ(2, Distance(2.5, Distance::Type::kNanometer).GetNanometer());
+  EXPECT_EQ(1500, Distance(1.5, Distance::Type::kMicrometer).GetNanometer());
+
+  Distance distance;
+  distance.SetValue(-1.5, Distance::Type::kNanometer, Rounding::kDown);
+  EXPECT_EQ(-2, distance.GetNanometer());
+
+  EXPECT_THROW(Distance(std::nan(""), Distance::Type::kMeter),
+               std::invalid_argument);
+  EXPECT_EQ(kInt64Max,
+            Distance(1.0e+10, Distance::Type::kKilometer).GetNanometer());
+  EXPECT_EQ(kInt64Min,
+            Distance(-1.0e+10, Distance::Type::kKilometer).GetNanometer());
+}
+
+TEST(GeometryDistance, FromNanometer) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto nanometer{CreateRandomNanometer()};
+    EXPECT_EQ(nanometer, Distance::FromNanometer(nanometer).GetNanometer());
+  }
+}
+
+TEST(GeometryDistance, AddExact) {
+  // Above 2^53 nanometers a double round trip would drop the last digit.
+  const auto large{Distance::FromNanometer((int64_t{1} << 60) + 1)};
+  EXPECT_EQ((int64_t{1} << 61) + 2, (large + large).GetNanometer());
+  EXPECT_EQ(0, (large - large).GetNanometer());
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto lhs{Distance::FromNanometer(CreateRandomNanometer())};
+    const auto rhs{Distance::FromNanometer(CreateRandomNanometer())};
+    EXPECT_EQ(lhs, lhs + rhs - rhs);
+    EXPECT_EQ(lhs.GetNanometer() + rhs.GetNanometer(),
+              (lhs + rhs).GetNanometer());
+  }
+}
+
+TEST(GeometryDistance, AddOverflow) {
+  const auto maximum{Distance::FromNanometer(kInt64Max)};
+  const auto minimum{Distance::FromNanometer(kInt64Min)};
+  const auto one{Distance::FromNanometer(1)};
+
+  EXPECT_THROW(static_cast<void>(maximum + one), std::overflow_error);
+  EXPECT_THROW(static_cast<void>(minimum - one), std::overflow_error);
+  EXPECT_THROW(static_cast<void>(one - minimum), std::overflow_error);
+  EXPECT_EQ(maximum, maximum.Add(one, OverflowPolicy::kSaturate));
+  EXPECT_EQ(minimum, minimum.Subtract(one, OverflowPolicy::kSaturate));
+  EXPECT_EQ(maximum, one.Subtract(minimum, OverflowPolicy::kSaturate));
+  EXPECT_EQ(Distance::FromNanometer(-1), minimum + maximum);
+
+  auto distance{maximum};
+  EXPECT_THROW(distance += one, std::overflow_error);
+  EXPECT_EQ(maximum, distance);
+}
+
+TEST(GeometryDistance, MultiplyByInteger) {
+  const auto distance{Distance::FromNanometer(3000000000000001)};
+  EXPECT_EQ(9000000000000003, (distance * 3).GetNanometer());
+  EXPECT_EQ(-9000000000000003, (distance * -3).GetNanometer());
+  EXPECT_EQ(9000000000000003, (distance * 3U).GetNanometer());
+
+  EXPECT_THROW(static_cast<void>(distance * 4000), std::overflow_error);
+  EXPECT_EQ(kInt64Max,
+            distance.Multiply(4000, OverflowPolicy::kSaturate).GetNanometer());
+  EXPECT_EQ(kInt64Min, distance.Multiply(-4000, OverflowPolicy::kSaturate)
+                           .GetNanometer());
+}
+
+TEST(GeometryDistance, MultiplyWithRounding) {
+  const auto positive{Distance::FromNanometer(10)};
+  const auto negative{Distance::FromNanometer(-10)};
+  for (std::size_t i = 0; i < kRoundings.size(); ++i) {
+    EXPECT_EQ(kPositiveHalf[i],
+              positive.Multiply(0.25, kRoundings[i]).GetNanometer());
+    EXPECT_EQ(kNegativeHalf[i],
+              negative.Multiply(0.25, kRoundings[i]).GetNanometer());
+    EXPECT_EQ(kNegativeHalf[i],
+              positive.Multiply(-0.25, kRoundings[i]).GetNanometer());
+  }
+
+  // The product is exact before rounding, even far above 2^53.
+  const auto large{Distance::FromNanometer((int64_t{1} << 60) + 3)};
+  EXPECT_EQ((int64_t{1} << 59) + 2, (large * 0.5).GetNanometer());
+  EXPECT_EQ((int64_t{1} << 59) + 1,
+            large.Multiply(0.5, Rounding::kDown).GetNanometer());
+  EXPECT_EQ(kInt64Min, Distance::FromNanometer(-1)
+                           .Multiply(std::ldexp(1.0, 63))
+                           .GetNanometer());
+
+  EXPECT_THROW(static_cast<void>(Distance::FromNanometer(1) *
+                                 std::ldexp(1.0, 63)),
+               std::overflow_error);
+  EXPECT_EQ(kInt64Max, Distance::FromNanometer(3)
+                           .Multiply(1.0e+300, Rounding::kNearest,
+                                     OverflowPolicy::kSaturate)
+                           .GetNanometer());
+  EXPECT_THROW(static_cast<void>(positive *
+                                 std::numeric_limits<double>::infinity()),
+               std::overflow_error);
+  EXPECT_THROW(static_cast<void>(Distance() *
+                                 std::numeric_limits<double>::infinity()),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(positive * std::nan("")),
+               std::invalid_argument);
+  EXPECT_EQ(0, (positive * 1.0e-300).GetNanometer());
+}
+
+TEST(GeometryDistance, DivideWithRounding) {
+  const auto positive{Distance::FromNanometer(5)};
+  const auto negative{Distance::FromNanometer(-5)};
+  for (std::size_t i = 0; i < kRoundings.size(); ++i) {
+    EXPECT_EQ(kPositiveHalf[i],
+              positive.Divide(int64_t{2}, kRoundings[i]).GetNanometer());
+    EXPECT_EQ(kNegativeHalf[i],
+              negative.Divide(int64_t{2}, kRoundings[i]).GetNanometer());
+    EXPECT_EQ(kPositiveHalf[i],
+              positive.Divide(2.0, kRoundings[i]).GetNanometer());
+    EXPECT_EQ(kNegativeHalf[i],
+              positive.Divide(-2.0, kRoundings[i]).GetNanometer());
+  }
+
+  // 0.1 is slightly above one tenth, so the exact quotient is below 10.
+  const auto one{Distance::FromNanometer(1)};
+  EXPECT_EQ(10, (one / 0.1).GetNanometer());
+  EXPECT_EQ(9, one.Divide(0.1, Rounding::kTowardZero).GetNanometer());
+  EXPECT_EQ(10, one.Divide(0.1, Rounding::kUp).GetNanometer());
+  EXPECT_EQ(4, (one / 0.25).GetNanometer());
+  EXPECT_EQ(2, (Distance::FromNanometer(7) / 3).GetNanometer());
+
+  EXPECT_EQ(0, (one / 1.0e+300).GetNanometer());
+  EXPECT_EQ(1, one.Divide(1.0e+300, Rounding::kUp).GetNanometer());
+  EXPECT_EQ(-1, one.Divide(-1.0e+300, Rounding::kDown).GetNanometer());
+  EXPECT_EQ(0, (one / std::numeric_limits<double>::infinity()).GetNanometer());
+
+  EXPECT_THROW(static_cast<void>(one / 1.0e-300), std::overflow_error);
+  EXPECT_EQ(kInt64Min, Distance::FromNanometer(-1)
+                           .Divide(1.0e-300, Rounding::kNearest,
+                                   OverflowPolicy::kSaturate)
+                           .GetNanometer());
+  EXPECT_THROW(static_cast<void>(Distance::FromNanometer(kInt64Min) / -1),
+               std::overflow_error);
+  EXPECT_EQ(kInt64Max, Distance::FromNanometer(kInt64Min)
+                           .Divide(int64_t{-1}, Rounding::kNearest,
+                                   OverflowPolicy::kSaturate)
+                           .GetNanometer());
+  EXPECT_THROW(static_cast<void>(one / 0), std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(one / 0.0), std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(one / std::nan("")), std::invalid_argument);
+}
 }  // namespace programmers::geometry
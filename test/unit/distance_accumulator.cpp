@@ -0,0 +1,123 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/distance_accumulator.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+constexpr int64_t kInt64Max{std::numeric_limits<int64_t>::max()};
+constexpr int64_t kInt64Min{std::numeric_limits<int64_t>::min()};
+
+auto CreateRandomDistances(uint32_t count)
+    -> std::vector<programmers::geometry::Distance> {
+  std::vector<programmers::geometry::Distance> distances;
+  for (uint32_t i = 0; i < count; ++i) {
+    distances.push_back(programmers::geometry::Distance::FromNanometer(
+        static_cast<int64_t>(std::rand()) - RAND_MAX / 2));
+  }
+  return distances;
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryDistanceAccumulator, Add) {
+  const auto distances{CreateRandomDistances(kTestCount)};
+  DistanceAccumulator accumulator;
+  DistanceAccumulator batch_accumulator;
+  Distance sum;
+  for (const auto& distance : distances) {
+    accumulator += distance;
+    sum += distance;
+  }
+  batch_accumulator.Add(distances);
+
+  EXPECT_EQ(kTestCount, accumulator.GetCount());
+  EXPECT_EQ(sum, accumulator.GetSum());
+  EXPECT_EQ(Int128(sum.GetNanometer()), batch_accumulator.GetNanometer());
+  EXPECT_EQ(kTestCount, batch_accumulator.GetCount());
+
+  accumulator.Clear();
+  EXPECT_EQ(0U, accumulator.GetCount());
+  EXPECT_EQ(Distance(), accumulator.GetSum());
+}
+
+TEST(GeometryDistanceAccumulator, AddBeyondDistance) {
+  const std::vector<Distance> distances(4U, Distance::FromNanometer(kInt64Max));
+  DistanceAccumulator accumulator;
+  accumulator.Add(distances);
+  EXPECT_EQ(Int128::Multiply(kInt64Max, 4), accumulator.GetNanometer());
+  EXPECT_THROW(static_cast<void>(accumulator.GetSum()), std::overflow_error);
+  EXPECT_EQ(Distance::FromNanometer(kInt64Max),
+            accumulator.GetSum(OverflowPolicy::kSaturate));
+  EXPECT_DOUBLE_EQ(4.0 * static_cast<double>(kInt64Max) * 1.0e-9,
+                   accumulator.GetValue(Distance::Type::kMeter));
+  EXPECT_EQ(Distance::FromNanometer(kInt64Max), accumulator.GetMean());
+
+  // Crossing zero borrows back out of the upper half.
+  const std::vector<Distance> negatives(5U,
+                                        Distance::FromNanometer(kInt64Min));
+  accumulator.Add(negatives.data(), 3U);
+  EXPECT_EQ(Distance::FromNanometer(kInt64Max - 3), accumulator.GetSum());
+  accumulator.Add(negatives.data(), 2U);
+  EXPECT_EQ(Int128::Multiply(kInt64Max, 4) + Int128::Multiply(kInt64Min, 5),
+            accumulator.GetNanometer());
+  EXPECT_EQ(Distance::FromNanometer(kInt64Min),
+            accumulator.GetSum(OverflowPolicy::kSaturate));
+}
+
+TEST(GeometryDistanceAccumulator, Merge) {
+  const auto distances{CreateRandomDistances(kTestCount)};
+  DistanceAccumulator total;
+  total.Add(distances);
+
+  DistanceAccumulator front;
+  DistanceAccumulator back;
+  front.Add(distances.data(), kTestCount / 2U);
+  back.Add(distances.data() + kTestCount / 2U, kTestCount - kTestCount / 2U);
+  front += back;
+
+  EXPECT_EQ(total.GetNanometer(), front.GetNanometer());
+  EXPECT_EQ(total.GetCount(), front.GetCount());
+}
+
+TEST(GeometryDistanceAccumulator, GetMean) {
+  DistanceAccumulator accumulator;
+  EXPECT_THROW(static_cast<void>(accumulator.GetMean()), std::out_of_range);
+
+  accumulator += Distance::FromNanometer(2);
+  accumulator += Distance::FromNanometer(3);
+  EXPECT_EQ(3, accumulator.GetMean().GetNanometer());
+  EXPECT_EQ(2, accumulator.GetMean(Rounding::kNearestEven).GetNanometer());
+  EXPECT_EQ(2, accumulator.GetMean(Rounding::kDown).GetNanometer());
+
+  accumulator.Clear();
+  accumulator += Distance::FromNanometer(-7);
+  accumulator += Distance::FromNanometer(0);
+  EXPECT_EQ(-4, accumulator.GetMean().GetNanometer());
+  EXPECT_EQ(-3, accumulator.GetMean(Rounding::kUp).GetNanometer());
+}
+
+TEST(GeometryDistanceAccumulator, GetValue) {
+  DistanceAccumulator accumulator;
+  accumulator += Distance(2038.0, Distance::Type::kKilometer);
+  accumulator += Distance(2038.0, Distance::Type::kKilometer);
+  EXPECT_DOUBLE_EQ(4076.0, accumulator.GetValue(Distance::Type::kKilometer));
+  EXPECT_DOUBLE_EQ(4076.0e+3, accumulator.GetValue(Distance::Type::kMeter));
+  EXPECT_DOUBLE_EQ(4076.0e+5,
+                   accumulator.GetValue(Distance::Type::kCentimeter));
+  EXPECT_DOUBLE_EQ(4076.0e+6,
+                   accumulator.GetValue(Distance::Type::kMillimeter));
+  EXPECT_DOUBLE_EQ(4076.0e+9,
+                   accumulator.GetValue(Distance::Type::kMicrometer));
+  EXPECT_DOUBLE_EQ(4076.0e+12,
+                   accumulator.GetValue(Distance::Type::kNanometer));
+}
+}  // namespace programmers::geometry
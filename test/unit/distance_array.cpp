@@ -0,0 +1,144 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/distance_array.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "geometry/kernels.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+auto CreateRandomValues(uint32_t count) -> std::vector<double> {
+  std::vector<double> values;
+  for (uint32_t i = 0; i < count; ++i) {
+    values.push_back(static_cast<double>(std::rand()) / 64.0 -
+                     static_cast<double>(RAND_MAX) / 128.0);
+  }
+  return values;
+}
+
+const std::array<programmers::geometry::Distance::Type, 6> kTypes{
+    programmers::geometry::Distance::Type::kKilometer,
+    programmers::geometry::Distance::Type::kMeter,
+    programmers::geometry::Distance::Type::kCentimeter,
+    programmers::geometry::Distance::Type::kMillimeter,
+    programmers::geometry::Distance::Type::kMicrometer,
+    programmers::geometry::Distance::Type::kNanometer};
+
+const std::array<programmers::geometry::kernels::Isa, 4> kIsas{
+    programmers::geometry::kernels::Isa::kScalar,
+    programmers::geometry::kernels::Isa::kSse2,
+    programmers::geometry::kernels::Isa::kAvx2,
+    programmers::geometry::kernels::Isa::kAvx512};
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryDistanceArray, Constructor) {
+  const DistanceArray empty;
+  EXPECT_TRUE(empty.Empty());
+
+  const DistanceArray zeros(3U);
+  EXPECT_EQ(3U, zeros.Size());
+  EXPECT_EQ(Distance(), zeros.GetDistance(2U));
+  EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(zeros.Data()) %
+                    DistanceArray::kAlignment);
+
+  const std::vector<Distance> distances{Distance(1.0), Distance(2.5),
+                                        Distance(-3.0)};
+  const DistanceArray array(distances);
+  EXPECT_EQ(distances, array.ToDistances());
+  EXPECT_EQ(2500000000, array.GetNanometer(1U));
+
+  const std::vector<double> values{1.0, 2.5, -3.0};
+  const DistanceArray from_values(values.data(), values.size(),
+                                  Distance::Type::kMeter);
+  EXPECT_EQ(distances, from_values.ToDistances());
+}
+
+TEST(GeometryDistanceArray, Modify) {
+  DistanceArray array;
+  array.Reserve(2U);
+  array.PushBack(Distance(1.0, Distance::Type::kKilometer));
+  array.PushBack(Distance(2.0, Distance::Type::kKilometer));
+  array.SetDistance(0U, Distance(3.0, Distance::Type::kKilometer));
+  EXPECT_EQ(Distance(3.0, Distance::Type::kKilometer), array.GetDistance(0U));
+  array.Data()[1] = 7;
+  EXPECT_EQ(Distance::FromNanometer(7), array.GetDistance(1U));
+  array.Resize(3U);
+  EXPECT_EQ(0, array.GetNanometer(2U));
+  array.Clear();
+  EXPECT_TRUE(array.Empty());
+}
+
+TEST(GeometryDistanceArray, GetValues) {
+  const auto values{CreateRandomValues(kTestCount)};
+  std::vector<Distance> distances;
+  for (const auto value : values) {
+    distances.emplace_back(value, Distance::Type::kKilometer);
+  }
+  const DistanceArray array(distances);
+
+  for (const auto isa : kIsas) {
+    kernels::SetActiveIsa(isa);
+    for (const auto type : kTypes) {
+      const auto converted{array.GetValues(type)};
+      for (uint32_t i = 0; i < kTestCount; ++i) {
+        EXPECT_EQ(distances[i].GetValue(type), converted[i]);
+      }
+    }
+  }
+  kernels::ResetActiveIsa();
+}
+
+TEST(GeometryDistanceArray, SetValues) {
+  auto values{CreateRandomValues(kTestCount)};
+  values[0] = 1.0e+300;
+  values[1] = -1.0e+300;
+  const std::array<Rounding, 5> kRoundings{
+      Rounding::kTowardZero, Rounding::kDown, Rounding::kUp,
+      Rounding::kNearest, Rounding::kNearestEven};
+
+  for (const auto isa : kIsas) {
+    kernels::SetActiveIsa(isa);
+    for (const auto type : kTypes) {
+      for (const auto rounding : kRoundings) {
+        DistanceArray array;
+        array.SetValues(values.data(), values.size(), type, rounding);
+        ASSERT_EQ(kTestCount, array.Size());
+        for (uint32_t i = 0; i < kTestCount; ++i) {
+          EXPECT_EQ(Distance(values[i], type, rounding), array.GetDistance(i));
+        }
+      }
+    }
+  }
+  kernels::ResetActiveIsa();
+}
+
+TEST(GeometryDistanceArray, SetValuesNotNumber) {
+  auto values{CreateRandomValues(kTestCount)};
+  values[kTestCount - 1U] = std::nan("");
+  std::vector<int64_t> nanometers(kTestCount);
+  EXPECT_THROW(ConvertToNanometer(values.data(), values.size(),
+                                  Distance::Type::kMeter, nanometers.data()),
+               std::invalid_argument);
+  EXPECT_EQ(Distance(values[0]).GetNanometer(), nanometers[0]);
+  EXPECT_EQ(0, nanometers[kTestCount - 1U]);
+
+  // A failed SetValues keeps the previous distances.
+  DistanceArray array(values.data(), 2U, Distance::Type::kMeter);
+  EXPECT_THROW(array.SetValues(values.data(), values.size(),
+                               Distance::Type::kMeter),
+               std::invalid_argument);
+  ASSERT_EQ(2U, array.Size());
+  EXPECT_EQ(Distance(values[0]), array.GetDistance(0U));
+  EXPECT_EQ(Distance(values[1]), array.GetDistance(1U));
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,229 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/exact_arithmetic.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+constexpr int64_t kInt64Max{std::numeric_limits<int64_t>::max()};
+constexpr int64_t kInt64Min{std::numeric_limits<int64_t>::min()};
+constexpr uint64_t kUint64Max{std::numeric_limits<uint64_t>::max()};
+
+auto CreateRandomInt64() -> int64_t {
+  const auto bits{(static_cast<uint64_t>(std::rand()) << 33U) ^
+                  (static_cast<uint64_t>(std::rand()) << 16U) ^
+                  static_cast<uint64_t>(std::rand())};
+  return static_cast<int64_t>(bits);
+}
+
+/**
+ * @brief Exact quotient and the expected result of every rounding mode, in
+ * the order of programmers::geometry::Rounding
+ */
+struct RoundingCase {
+  int64_t dividend;
+  uint32_t shift;
+  std::array<int64_t, 5> expected;
+};
+
+constexpr std::array<RoundingCase, 8> kRoundingCases{{
+    {5, 1U, {2, 2, 3, 3, 2}},         // 2.5
+    {-5, 1U, {-2, -3, -2, -3, -2}},   // -2.5
+    {6, 2U, {1, 1, 2, 2, 2}},         // 1.5
+    {-6, 2U, {-1, -2, -1, -2, -2}},   // -1.5
+    {7, 2U, {1, 1, 2, 2, 2}},         // 1.75
+    {-7, 2U, {-1, -2, -1, -2, -2}},   // -1.75
+    {9, 2U, {2, 2, 3, 2, 2}},         // 2.25
+    {8, 2U, {2, 2, 2, 2, 2}},         // 2
+}};
+constexpr std::array<programmers::geometry::Rounding, 5> kRoundings{
+    programmers::geometry::Rounding::kTowardZero,
+    programmers::geometry::Rounding::kDown,
+    programmers::geometry::Rounding::kUp,
+    programmers::geometry::Rounding::kNearest,
+    programmers::geometry::Rounding::kNearestEven};
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryExactArithmetic, Multiply) {
+  const auto maximum_square{Int128::Multiply(kInt64Max, kInt64Max)};
+  EXPECT_EQ(0x3FFFFFFFFFFFFFFF, maximum_square.GetHigh());
+  EXPECT_EQ(1U, maximum_square.GetLow());
+
+  const auto minimum_square{Int128::Multiply(kInt64Min, kInt64Min)};
+  EXPECT_EQ(0x4000000000000000, minimum_square.GetHigh());
+  EXPECT_EQ(0U, minimum_square.GetLow());
+
+  EXPECT_EQ(Int128(0, uint64_t{1U} << 63U), Int128::Multiply(kInt64Min, -1));
+  EXPECT_EQ(Int128(-15), Int128::Multiply(-3, 5));
+  EXPECT_EQ(Int128(0), Int128::Multiply(kInt64Min, 0));
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto lhs{static_cast<int64_t>(std::rand()) - RAND_MAX / 2};
+    const auto rhs{static_cast<int64_t>(std::rand()) - RAND_MAX / 2};
+    EXPECT_EQ(Int128(lhs * rhs), Int128::Multiply(lhs, rhs));
+  }
+}
+
+TEST(GeometryExactArithmetic, MultiplyInt128) {
+  EXPECT_EQ(Int128::Multiply(kInt64Max, kInt64Max),
+            Int128(kInt64Max) * Int128(kInt64Max));
+  EXPECT_EQ(Int128(-1, 0U), Int128(0, uint64_t{1U} << 32U) *
+                                Int128(-1, kUint64Max - 0xFFFFFFFFU));
+  EXPECT_EQ(Int128(0), Int128(1, 0U) * Int128(1, 0U));
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto lhs{CreateRandomInt64()};
+    const auto rhs{CreateRandomInt64()};
+    EXPECT_EQ(Int128::Multiply(lhs, rhs), Int128(lhs) * Int128(rhs));
+  }
+}
+
+TEST(GeometryExactArithmetic, SquareRoot) {
+  EXPECT_EQ(Int128(0), Int128(0).SquareRoot(Rounding::kUp));
+  EXPECT_EQ(Int128(1), Int128(2).SquareRoot(Rounding::kNearest));
+  EXPECT_EQ(Int128(2), Int128(3).SquareRoot(Rounding::kNearest));
+  EXPECT_EQ(Int128(2), Int128(3).SquareRoot(Rounding::kUp));
+  EXPECT_EQ(Int128(1), Int128(3).SquareRoot(Rounding::kDown));
+  EXPECT_EQ(Int128(kInt64Max),
+            Int128::Multiply(kInt64Max, kInt64Max).SquareRoot(Rounding::kUp));
+  EXPECT_EQ(Int128(0, uint64_t{1U} << 63U),
+            (Int128::Multiply(kInt64Min, kInt64Min) + Int128(kInt64Max))
+                .SquareRoot(Rounding::kDown));
+  EXPECT_EQ(Int128(0, 0xB504F333F9DE6484U),
+            Int128(0x7FFFFFFFFFFFFFFF, kUint64Max)
+                .SquareRoot(Rounding::kDown));
+  EXPECT_THROW(static_cast<void>(Int128(-1).SquareRoot(Rounding::kDown)),
+               std::invalid_argument);
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto root{(CreateRandomInt64() & kInt64Max) | 2};
+    const auto offset{static_cast<int64_t>(std::rand() % 3) - 1};
+    // value is root^2 - 1, root^2 + 1 or root^2 + root.
+    const auto value{Int128::Multiply(root, root) +
+                     Int128(offset == 0 ? root : offset)};
+    const auto expected_down{offset < 0 ? root - 1 : root};
+    EXPECT_EQ(Int128(expected_down), value.SquareRoot(Rounding::kDown));
+    EXPECT_EQ(Int128(expected_down), value.SquareRoot(Rounding::kTowardZero));
+    EXPECT_EQ(Int128(expected_down) + Int128(1),
+              value.SquareRoot(Rounding::kUp));
+    EXPECT_EQ(Int128(root), value.SquareRoot(Rounding::kNearest));
+    EXPECT_EQ(Int128(root), value.SquareRoot(Rounding::kNearestEven));
+  }
+}
+
+TEST(GeometryExactArithmetic, Divide) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto value{CreateRandomInt64()};
+    auto divisor{CreateRandomInt64()};
+    // 1 / divisor must stay below one half for the nearest check.
+    divisor = divisor > -3 && divisor < 3 ? 3 : divisor;
+    const auto product{Int128::Multiply(value, divisor)};
+    EXPECT_EQ(Int128(value), product.Divide(divisor, Rounding::kTowardZero));
+    EXPECT_EQ(Int128(value),
+              (product + Int128(1)).Divide(divisor, Rounding::kNearest));
+  }
+
+  for (const auto& test_case : kRoundingCases) {
+    for (std::size_t i = 0; i < kRoundings.size(); ++i) {
+      EXPECT_EQ(Int128(test_case.expected[i]),
+                Int128(test_case.dividend)
+                    .Divide(Int128(int64_t{1} << test_case.shift),
+                            kRoundings[i]))
+          << test_case.dividend << " / " << (1U << test_case.shift);
+      EXPECT_EQ(Int128(test_case.expected[i]),
+                Int128::Multiply(test_case.dividend, -kInt64Max)
+                    .Divide(Int128::Multiply(int64_t{1} << test_case.shift,
+                                             -kInt64Max),
+                            kRoundings[i]));
+    }
+  }
+
+  EXPECT_THROW(static_cast<void>(Int128(1).Divide(0, Rounding::kNearest)),
+               std::invalid_argument);
+}
+
+TEST(GeometryExactArithmetic, ShiftRight) {
+  for (const auto& test_case : kRoundingCases) {
+    for (std::size_t i = 0; i < kRoundings.size(); ++i) {
+      EXPECT_EQ(Int128(test_case.expected[i]),
+                Int128(test_case.dividend)
+                    .ShiftRight(test_case.shift, kRoundings[i]))
+          << test_case.dividend << " >> " << test_case.shift;
+    }
+  }
+
+  EXPECT_EQ(Int128(1), Int128(1).ShiftRight(200U, Rounding::kUp));
+  EXPECT_EQ(Int128(0), Int128(1).ShiftRight(200U, Rounding::kDown));
+  EXPECT_EQ(Int128(-1), Int128(-1).ShiftRight(200U, Rounding::kDown));
+  EXPECT_EQ(Int128(0), Int128(-1).ShiftRight(200U, Rounding::kNearest));
+  EXPECT_EQ(Int128(kInt64Max), Int128::Multiply(kInt64Max, 1 << 20)
+                                   .ShiftRight(20U, Rounding::kTowardZero));
+}
+
+TEST(GeometryExactArithmetic, ShiftLeft) {
+  EXPECT_EQ(Int128(1, 0U), Int128(1).ShiftLeft(64U));
+  EXPECT_EQ(Int128(-1, 0U), Int128(-1).ShiftLeft(64U));
+  EXPECT_EQ(Int128(0, 0xFF00U), Int128(0xFF).ShiftLeft(8U));
+  EXPECT_EQ(Int128(0x7F, 0x8000000000000000U), Int128(0xFF).ShiftLeft(63U));
+}
+
+TEST(GeometryExactArithmetic, ToInt64) {
+  EXPECT_EQ(kInt64Max, Int128(kInt64Max).ToInt64());
+  EXPECT_EQ(kInt64Min, Int128(kInt64Min).ToInt64());
+  EXPECT_TRUE(Int128(kInt64Min).FitsInt64());
+
+  const auto too_large{Int128(kInt64Max) + Int128(1)};
+  const auto too_small{Int128(kInt64Min) - Int128(1)};
+  EXPECT_FALSE(too_large.FitsInt64());
+  EXPECT_FALSE(too_small.FitsInt64());
+  EXPECT_THROW(static_cast<void>(too_large.ToInt64()), std::overflow_error);
+  EXPECT_THROW(static_cast<void>(too_small.ToInt64()), std::overflow_error);
+  EXPECT_EQ(kInt64Max, too_large.ToInt64(OverflowPolicy::kSaturate));
+  EXPECT_EQ(kInt64Min, too_small.ToInt64(OverflowPolicy::kSaturate));
+}
+
+TEST(GeometryExactArithmetic, ToDouble) {
+  EXPECT_DOUBLE_EQ(-15.0, Int128(-15).ToDouble());
+  EXPECT_DOUBLE_EQ(std::ldexp(1.0, 80),
+                   Int128::Multiply(int64_t{1} << 40, int64_t{1} << 40)
+                       .ToDouble());
+  EXPECT_DOUBLE_EQ(-std::ldexp(1.0, 125),
+                   Int128::Multiply(kInt64Min, -(kInt64Min / 2)).ToDouble());
+}
+
+TEST(GeometryExactArithmetic, Operator) {
+  EXPECT_EQ(Int128(1, 0U), Int128(0, kUint64Max) + Int128(1));
+  EXPECT_EQ(Int128(0, kUint64Max), Int128(1, 0U) - Int128(1));
+  EXPECT_EQ(Int128(-1, kUint64Max), -Int128(1));
+  EXPECT_EQ(Int128(0), Int128(-1) + Int128(1));
+
+  EXPECT_TRUE(Int128(-1) < Int128(0));
+  EXPECT_TRUE(Int128(0, kUint64Max) < Int128(1, 0U));
+  EXPECT_TRUE(Int128(-1, 0U) < Int128(-1, 1U));
+  EXPECT_TRUE(Int128(3) <= Int128(3));
+  EXPECT_TRUE(Int128(4) > Int128(3));
+  EXPECT_TRUE(Int128(3) >= Int128(3));
+  EXPECT_TRUE(Int128(3) != Int128(4));
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto lhs{CreateRandomInt64()};
+    const auto rhs{CreateRandomInt64()};
+    auto sum{Int128(lhs)};
+    sum += Int128(rhs);
+    EXPECT_EQ(lhs < rhs, Int128(lhs) < Int128(rhs));
+    EXPECT_EQ(Int128(lhs), sum - Int128(rhs));
+    sum -= Int128(lhs);
+    EXPECT_EQ(Int128(rhs), sum);
+  }
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,207 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/fixed_point2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+constexpr int64_t kInt64Max{std::numeric_limits<int64_t>::max()};
+constexpr int64_t kInt64Min{std::numeric_limits<int64_t>::min()};
+
+auto CreateRandomCoordinate() -> int64_t {
+  return static_cast<int64_t>(std::rand()) - RAND_MAX / 2;
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryFixedPoint2D, Constructor) {
+  constexpr FixedPoint2D origin;
+  constexpr FixedPoint2D point(3, -4);
+  static_assert(origin.GetX() == 0 && origin.GetY() == 0);
+  static_assert(point.GetX() == 3 && point.GetY() == -4);
+  EXPECT_EQ(Distance::FromNanometer(1), FixedPoint2D::GetResolution());
+  EXPECT_EQ(Distance(1.0, Distance::Type::kMillimeter),
+            BasicFixedPoint2D<1000000>::GetResolution());
+}
+
+TEST(GeometryFixedPoint2D, ConvertPoint2D) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2D point(static_cast<double>(std::rand()) / 7.0,
+                        -static_cast<double>(std::rand()) / 3.0);
+    const auto fixed{FixedPoint2D::FromPoint2D(point, Distance::Type::kMeter,
+                                               Rounding::kTowardZero)};
+    EXPECT_EQ(Distance(point.GetX()).GetNanometer(), fixed.GetX());
+    EXPECT_EQ(Distance(point.GetY()).GetNanometer(), fixed.GetY());
+    EXPECT_EQ(Distance::FromNanometer(fixed.GetX()).GetValue(
+                  Distance::Type::kMillimeter),
+              fixed.ToPoint2D(Distance::Type::kMillimeter).GetX());
+  }
+
+  const auto millimeter{BasicFixedPoint2D<1000000>::FromPoint2D(
+      Point2D(0.0125, -0.0125))};
+  EXPECT_EQ(13, millimeter.GetX());
+  EXPECT_EQ(-13, millimeter.GetY());
+  EXPECT_DOUBLE_EQ(0.013, millimeter.ToPoint2D().GetX());
+  EXPECT_DOUBLE_EQ(-0.013, millimeter.ToPoint2D().GetY());
+
+  const auto saturated{FixedPoint2D::FromPoint2D(Point2D(1.0e+300, -1.0e+300))};
+  EXPECT_EQ(kInt64Max, saturated.GetX());
+  EXPECT_EQ(kInt64Min, saturated.GetY());
+  EXPECT_THROW(static_cast<void>(
+                   FixedPoint2D::FromPoint2D(Point2D(std::nan(""), 0.0))),
+               std::invalid_argument);
+}
+
+TEST(GeometryFixedPoint2D, ConvertPoints) {
+  std::vector<Point2D> points;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    points.emplace_back(static_cast<double>(std::rand()) / 7.0,
+                        -static_cast<double>(std::rand()) / 3.0);
+  }
+  const PointCloud2D cloud(points);
+  const auto fixed{BasicFixedPoint2D<10>::FromPoints(
+      cloud, Distance::Type::kMillimeter, Rounding::kNearestEven)};
+  ASSERT_EQ(points.size(), fixed.size());
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_EQ(BasicFixedPoint2D<10>::FromPoint2D(
+                  points[i], Distance::Type::kMillimeter,
+                  Rounding::kNearestEven),
+              fixed[i]);
+  }
+  const auto converted{BasicFixedPoint2D<10>::ToPoints(fixed)};
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_EQ(fixed[i].ToPoint2D(), converted.GetPoint(i));
+  }
+
+  PointCloud2D invalid(cloud);
+  invalid.YData()[kTestCount - 1U] = std::nan("");
+  EXPECT_THROW(static_cast<void>(FixedPoint2D::FromPoints(invalid)),
+               std::invalid_argument);
+}
+
+TEST(GeometryFixedPoint2D, CalculateDistance) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const FixedPoint2D source(CreateRandomCoordinate(),
+                              CreateRandomCoordinate());
+    const FixedPoint2D target(CreateRandomCoordinate(),
+                              CreateRandomCoordinate());
+    const auto dx{source.GetX() - target.GetX()};
+    const auto dy{source.GetY() - target.GetY()};
+    EXPECT_EQ(Int128(dx * dx + dy * dy),
+              source.CalculateSquaredDistance(target));
+    EXPECT_EQ(std::llround(std::sqrt(static_cast<double>(dx * dx + dy * dy))),
+              source.CalculateDistance(target).GetNanometer());
+  }
+
+  EXPECT_EQ(Distance::FromNanometer(5),
+            FixedPoint2D(0, 0).CalculateDistance(FixedPoint2D(3, 4)));
+  EXPECT_EQ(Distance::FromNanometer(2),
+            FixedPoint2D::CalculateDistance(FixedPoint2D(0, 0),
+                                            FixedPoint2D(1, 1),
+                                            Rounding::kUp));
+  EXPECT_EQ(Distance(5.0, Distance::Type::kMillimeter),
+            BasicFixedPoint2D<1000000>(0, 0).CalculateDistance(
+                BasicFixedPoint2D<1000000>(3, 4)));
+  // sqrt(2) mm, rounded once at nanometers rather than at millimeters.
+  EXPECT_EQ(Distance::FromNanometer(1414214),
+            BasicFixedPoint2D<1000000>(0, 0).CalculateDistance(
+                BasicFixedPoint2D<1000000>(1, 1)));
+
+  const FixedPoint2D far(kInt64Max / 2, kInt64Max / 2);
+  EXPECT_EQ(Int128::Multiply(kInt64Max / 2, kInt64Max / 2) +
+                Int128::Multiply(kInt64Max / 2, kInt64Max / 2),
+            far.CalculateSquaredDistance(FixedPoint2D(0, 0)));
+  EXPECT_EQ(Distance::FromNanometer(6521908912666391105),
+            far.CalculateDistance(FixedPoint2D(0, 0)));
+  const FixedPoint2D corner(kInt64Max, kInt64Max);
+  EXPECT_THROW(static_cast<void>(corner.CalculateDistance(FixedPoint2D())),
+               std::overflow_error);
+  EXPECT_EQ(Distance::FromNanometer(kInt64Max),
+            corner.CalculateDistance(FixedPoint2D(), Rounding::kNearest,
+                                     OverflowPolicy::kSaturate));
+  EXPECT_THROW(static_cast<void>(FixedPoint2D(kInt64Max, 0)
+                                     .CalculateSquaredDistance(
+                                         FixedPoint2D(-1, 0))),
+               std::overflow_error);
+  EXPECT_EQ(Distance::FromNanometer(kInt64Max),
+            BasicFixedPoint2D<1000>(kInt64Max / 2, 0)
+                .CalculateDistance(BasicFixedPoint2D<1000>(),
+                                   Rounding::kNearest,
+                                   OverflowPolicy::kSaturate));
+}
+
+TEST(GeometryFixedPoint2D, IsWithinRadius) {
+  const FixedPoint2D origin;
+  EXPECT_TRUE(origin.IsWithinRadius(FixedPoint2D(3, 4),
+                                    Distance::FromNanometer(5)));
+  EXPECT_FALSE(origin.IsWithinRadius(FixedPoint2D(3, 4),
+                                     Distance::FromNanometer(4)));
+  EXPECT_FALSE(origin.IsWithinRadius(origin, Distance::FromNanometer(-1)));
+
+  // sqrt(2) mm is within 1414214 nm but not within 1414213 nm.
+  const BasicFixedPoint2D<1000000> millimeter(1, 1);
+  EXPECT_TRUE(BasicFixedPoint2D<1000000>().IsWithinRadius(
+      millimeter, Distance::FromNanometer(1414214)));
+  EXPECT_FALSE(BasicFixedPoint2D<1000000>().IsWithinRadius(
+      millimeter, Distance::FromNanometer(1414213)));
+
+  EXPECT_TRUE(FixedPoint2D::IsCloser(origin, FixedPoint2D(3, 3),
+                                     FixedPoint2D(0, 5)));
+  EXPECT_FALSE(FixedPoint2D::IsCloser(origin, FixedPoint2D(3, 4),
+                                      FixedPoint2D(0, 5)));
+}
+
+TEST(GeometryFixedPoint2D, Operator) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const FixedPoint2D lhs(CreateRandomCoordinate(), CreateRandomCoordinate());
+    const FixedPoint2D rhs(CreateRandomCoordinate(), CreateRandomCoordinate());
+    auto sum{lhs};
+    sum += rhs;
+    EXPECT_EQ(FixedPoint2D(lhs.GetX() + rhs.GetX(), lhs.GetY() + rhs.GetY()),
+              lhs + rhs);
+    EXPECT_EQ(lhs + rhs, sum);
+    sum -= rhs;
+    EXPECT_EQ(lhs, sum);
+    EXPECT_EQ(lhs, lhs + rhs - rhs);
+  }
+  EXPECT_THROW(static_cast<void>(FixedPoint2D(kInt64Max, 0) +
+                                 FixedPoint2D(1, 0)),
+               std::overflow_error);
+  EXPECT_THROW(static_cast<void>(FixedPoint2D(0, kInt64Min) -
+                                 FixedPoint2D(0, 1)),
+               std::overflow_error);
+  EXPECT_EQ(FixedPoint2D(0, kInt64Min),
+            FixedPoint2D(0, -1) - FixedPoint2D(0, kInt64Max));
+  EXPECT_TRUE(FixedPoint2D(1, 5) < FixedPoint2D(2, 0));
+  EXPECT_TRUE(FixedPoint2D(1, 0) < FixedPoint2D(1, 5));
+  EXPECT_TRUE(FixedPoint2D(1, 0) != FixedPoint2D(1, 5));
+}
+
+TEST(GeometryFixedPoint2D, Deduplicate) {
+  // 0.1 + 0.2 != 0.3 in double, but both snap to the same grid point.
+  const auto sum{FixedPoint2D::FromPoint2D(Point2D(0.1, 0.0)) +
+                 FixedPoint2D::FromPoint2D(Point2D(0.2, 0.0))};
+  EXPECT_EQ(FixedPoint2D::FromPoint2D(Point2D(0.3, 0.0)), sum);
+
+  std::vector<FixedPoint2D> points;
+  std::unordered_set<FixedPoint2D> unique;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    points.emplace_back(std::rand() % 10, std::rand() % 10);
+    unique.insert(points.back());
+  }
+  std::sort(points.begin(), points.end());
+  points.erase(std::unique(points.begin(), points.end()), points.end());
+  EXPECT_EQ(points.size(), unique.size());
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,160 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/geodesic.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+constexpr double kPi = 3.14159265358979323846;
+
+auto CreateRandomCoordinate() -> programmers::geometry::Point2D {
+  return {static_cast<double>(std::rand()) / RAND_MAX * 360.0 - 180.0,
+          static_cast<double>(std::rand()) / RAND_MAX * 180.0 - 90.0};
+}
+
+auto GetMeter(const programmers::geometry::Distance& distance) -> double {
+  return distance.GetValue(programmers::geometry::Distance::Type::kMeter);
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryGeodesic, Spherical) {
+  const Point2D origin(0.0, 0.0);
+  EXPECT_NEAR(geodesic::kMeanRadius * kPi / 180.0,
+              GetMeter(CalculateGeodesicDistance(origin, Point2D(1.0, 0.0))),
+              1.0e-6);
+  EXPECT_NEAR(geodesic::kMeanRadius * kPi,
+              GetMeter(CalculateGeodesicDistance(Point2D(10.0, 90.0),
+                                                 Point2D(-40.0, -90.0))),
+              1.0e-6);
+  // London to Paris.
+  EXPECT_NEAR(343556.535,
+              GetMeter(CalculateGeodesicDistance(Point2D(-0.1278, 51.5074),
+                                                 Point2D(2.3522, 48.8566))),
+              1.0e-3);
+  EXPECT_EQ(Distance(), CalculateGeodesicDistance(origin, origin));
+  EXPECT_EQ(
+      CalculateGeodesicDistance(Point2D(179.5, 0.0), Point2D(-179.5, 0.0)),
+      CalculateGeodesicDistance(origin, Point2D(1.0, 0.0)));
+
+  EXPECT_THROW(static_cast<void>(
+                   CalculateGeodesicDistance(origin, Point2D(0.0, 90.5))),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(
+                   CalculateGeodesicDistance(Point2D(NAN, 0.0), origin)),
+               std::invalid_argument);
+}
+
+TEST(GeometryGeodesic, Ellipsoidal) {
+  constexpr auto kModel{GeodesicModel::kEllipsoidal};
+  // Flinders Peak to Buninyong, the example of Vincenty's paper.
+  EXPECT_NEAR(54972.271,
+              GetMeter(CalculateGeodesicDistance(
+                  Point2D(144.0 + 25.0 / 60.0 + 29.52440 / 3600.0,
+                          -(37.0 + 57.0 / 60.0 + 3.72030 / 3600.0)),
+                  Point2D(143.0 + 55.0 / 60.0 + 35.38390 / 3600.0,
+                          -(37.0 + 39.0 / 60.0 + 10.15610 / 3600.0)),
+                  kModel)),
+              1.0e-3);
+  EXPECT_NEAR(geodesic::kSemiMajorAxis * kPi / 180.0,
+              GetMeter(CalculateGeodesicDistance(
+                  Point2D(0.0, 0.0), Point2D(1.0, 0.0), kModel)),
+              1.0e-6);
+  EXPECT_NEAR(20003931.459,
+              GetMeter(CalculateGeodesicDistance(
+                  Point2D(0.0, 90.0), Point2D(0.0, -90.0), kModel)),
+              1.0e-3);
+  EXPECT_EQ(Distance(), CalculateGeodesicDistance(Point2D(12.0, 34.0),
+                                                  Point2D(12.0, 34.0), kModel));
+  // Nearly antipodal points where Vincenty's iteration does not converge.
+  EXPECT_NEAR(20003931.459,
+              GetMeter(CalculateGeodesicDistance(
+                  Point2D(0.0, 0.0), Point2D(180.0, 0.0), kModel)),
+              1.0e-3);
+  EXPECT_NEAR(20003931.459,
+              GetMeter(CalculateGeodesicDistance(
+                  Point2D(0.0, 10.0), Point2D(180.0, -10.0), kModel)),
+              1.0e-3);
+  EXPECT_NEAR(19936288.579,
+              GetMeter(CalculateGeodesicDistance(
+                  Point2D(0.0, 0.0), Point2D(179.5, 0.5), kModel)),
+              1.0e-3);
+
+  // The sphere is within 0.5 % of the ellipsoid, and no geodesic is longer
+  // than half a meridian.
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto from{CreateRandomCoordinate()};
+    auto to{CreateRandomCoordinate()};
+    if (i % 2U == 0U) {
+      // Within a degree of the antipode of from.
+      to = Point2D(from.GetX() + 180.0 + to.GetX() / 180.0,
+                   std::clamp(to.GetY() / 90.0 - from.GetY(), -90.0, 90.0));
+    }
+    const auto ellipsoidal{
+        GetMeter(CalculateGeodesicDistance(from, to, kModel))};
+    EXPECT_NEAR(ellipsoidal, GetMeter(CalculateGeodesicDistance(from, to)),
+                ellipsoidal * 0.005 + 1.0e-6);
+    EXPECT_GE(20003931.459, ellipsoidal);
+  }
+}
+
+TEST(GeometryGeodesic, Cloud) {
+  PointCloud2D points;
+  // Eastern longitudes only, far from the antipode of the target.
+  for (uint32_t i = 0; i < kTestCount + 3U; ++i) {
+    const auto point{CreateRandomCoordinate()};
+    points.PushBack(std::abs(point.GetX()), point.GetY());
+  }
+  // A close pair keeps its precision through the chord.
+  points.PushBack(126.9780, 37.5665);
+  points.PushBack(126.9780, 37.5665 + 1.0e-8);
+  const GeodesicCloud cloud(points);
+  ASSERT_EQ(points.Size(), cloud.Size());
+  EXPECT_FALSE(cloud.Empty());
+  EXPECT_TRUE(GeodesicCloud().Empty());
+  EXPECT_EQ(points.GetPoint(7U), cloud.GetPoint(7U));
+
+  for (const auto model :
+       {GeodesicModel::kSpherical, GeodesicModel::kEllipsoidal}) {
+    const auto target{points.GetPoint(points.Size() - 1U)};
+    std::vector<double> meters(cloud.Size());
+    cloud.CalculateDistances(target, meters.data(), model);
+    const auto distances{cloud.CalculateDistances(target, model)};
+    ASSERT_EQ(cloud.Size(), distances.Size());
+    for (std::size_t i = 0; i < cloud.Size(); ++i) {
+      const auto expected{
+          GetMeter(CalculateGeodesicDistance(points.GetPoint(i), target,
+                                             model))};
+      EXPECT_NEAR(expected, meters[i], 1.0e-6);
+      EXPECT_NEAR(expected, GetMeter(distances.GetDistance(i)), 1.0e-6);
+    }
+    EXPECT_NEAR(0.0, meters.back(), 1.0e-9);
+    EXPECT_LT(1.0e-3, meters[meters.size() - 2U]);
+  }
+
+  // A point at the antipode of the target does not fail the batch.
+  const Point2D antipode(points.GetX(0U) - 180.0, -points.GetY(0U));
+  const auto distances{
+      cloud.CalculateDistances(antipode, GeodesicModel::kEllipsoidal)};
+  EXPECT_NEAR(20003931.459, GetMeter(distances.GetDistance(0U)), 1.0e-3);
+  for (std::size_t i = 1; i < cloud.Size(); i += 97U) {
+    EXPECT_EQ(CalculateGeodesicDistance(points.GetPoint(i), antipode,
+                                        GeodesicModel::kEllipsoidal),
+              distances.GetDistance(i));
+  }
+
+  points.PushBack(0.0, -91.0);
+  EXPECT_THROW(GeodesicCloud{points}, std::invalid_argument);
+  EXPECT_THROW(cloud.CalculateDistances(Point2D(INFINITY, 0.0)),
+               std::invalid_argument);
+}
+}  // namespace programmers::geometry
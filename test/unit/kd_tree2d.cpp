@@ -0,0 +1,154 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/kd_tree2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 5000U;
+constexpr uint32_t kQueryCount = 100U;
+
+auto CreateRandomPoints(uint32_t count)
+    -> std::vector<programmers::geometry::Point2D> {
+  std::vector<programmers::geometry::Point2D> points;
+  for (uint32_t i = 0; i < count; ++i) {
+    points.emplace_back(static_cast<double>(std::rand() % 10000),
+                        static_cast<double>(std::rand() % 10000));
+  }
+  return points;
+}
+
+auto SortSquaredDistances(
+    const std::vector<programmers::geometry::Point2D>& points,
+    const programmers::geometry::Point2D& query) -> std::vector<double> {
+  std::vector<double> squared_distances;
+  for (const auto& point : points) {
+    squared_distances.push_back(point.CalculateSquaredDistance(query));
+  }
+  std::sort(squared_distances.begin(), squared_distances.end());
+  return squared_distances;
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryKdTree2D, Constructor) {
+  KdTree2D tree1;
+  EXPECT_TRUE(tree1.Empty());
+  EXPECT_THROW(static_cast<void>(tree1.FindNearest(Point2D())),
+               std::out_of_range);
+
+  const auto points = CreateRandomPoints(kTestCount);
+  KdTree2D tree2(points);
+  KdTree2D tree3(PointCloud2D{points});
+  KdTree2D tree4(points.begin(), points.end());
+  EXPECT_EQ(points.size(), tree2.Size());
+  EXPECT_EQ(points.size(), tree3.Size());
+  EXPECT_EQ(points.size(), tree4.Size());
+}
+
+TEST(GeometryKdTree2D, FindNearest) {
+  const auto points = CreateRandomPoints(kTestCount);
+  const KdTree2D tree(points);
+
+  for (const auto& query : CreateRandomPoints(kQueryCount)) {
+    const auto nearest = tree.FindNearest(query);
+    const auto expected = SortSquaredDistances(points, query);
+
+    EXPECT_DOUBLE_EQ(expected.front(), nearest.squared_distance);
+    EXPECT_DOUBLE_EQ(points[nearest.index].CalculateDistance(query),
+                     nearest.GetDistance());
+    EXPECT_EQ(Distance(nearest.GetDistance()), nearest.ToDistance());
+  }
+}
+
+TEST(GeometryKdTree2D, FindKNearest) {
+  constexpr std::size_t kNeighborCount = 10U;
+  const auto points = CreateRandomPoints(kTestCount);
+  const KdTree2D tree(points);
+
+  for (const auto& query : CreateRandomPoints(kQueryCount)) {
+    const auto neighbors = tree.FindNearest(query, kNeighborCount);
+    const auto expected = SortSquaredDistances(points, query);
+
+    ASSERT_EQ(kNeighborCount, neighbors.size());
+    for (std::size_t i = 0; i < kNeighborCount; ++i) {
+      EXPECT_DOUBLE_EQ(expected[i], neighbors[i].squared_distance);
+      EXPECT_DOUBLE_EQ(points[neighbors[i].index].CalculateSquaredDistance(
+                           query),
+                       neighbors[i].squared_distance);
+    }
+  }
+  EXPECT_EQ(points.size(), tree.FindNearest(Point2D(), kTestCount * 2U).size());
+}
+
+TEST(GeometryKdTree2D, FindWithinRadius) {
+  constexpr double kRadius = 300.0;
+  const auto points = CreateRandomPoints(kTestCount);
+  const KdTree2D tree(points);
+
+  for (const auto& query : CreateRandomPoints(kQueryCount)) {
+    auto neighbors = tree.FindWithinRadius(query, kRadius);
+    std::vector<std::size_t> indices;
+    for (const auto& neighbor : neighbors) {
+      indices.push_back(neighbor.index);
+    }
+    std::sort(indices.begin(), indices.end());
+
+    EXPECT_EQ(Point2D::FilterWithinRadius(points, query, kRadius), indices);
+    EXPECT_EQ(neighbors.size(),
+              tree.FindWithinRadius(query, Distance(kRadius * 1.0e-3,
+                                                    Distance::Type::kKilometer))
+                  .size());
+  }
+}
+
+TEST(GeometryKdTree2D, BatchQueries) {
+  constexpr std::size_t kNeighborCount = 4U;
+  constexpr double kRadius = 200.0;
+  const auto points = CreateRandomPoints(kTestCount);
+  const KdTree2D tree(points);
+  const PointCloud2D queries(CreateRandomPoints(kQueryCount));
+
+  const auto nearest = tree.FindNearest(queries, kNeighborCount);
+  const auto within = tree.FindWithinRadius(queries, kRadius);
+
+  ASSERT_EQ(queries.Size() * kNeighborCount, nearest.size());
+  ASSERT_EQ(queries.Size(), within.size());
+  for (std::size_t i = 0; i < queries.Size(); ++i) {
+    const auto expected = tree.FindNearest(queries.GetPoint(i), kNeighborCount);
+    for (std::size_t j = 0; j < kNeighborCount; ++j) {
+      EXPECT_DOUBLE_EQ(expected[j].squared_distance,
+                       nearest[i * kNeighborCount + j].squared_distance);
+    }
+    EXPECT_EQ(tree.FindWithinRadius(queries.GetPoint(i), kRadius).size(),
+              within[i].size());
+  }
+}
+
+TEST(GeometryKdTree2D, DuplicatePoints) {
+  const std::vector<Point2D> points(kTestCount, Point2D(1.0, 2.0));
+  const KdTree2D tree(points);
+
+  EXPECT_EQ(points.size(),
+            tree.FindWithinRadius(Point2D(1.0, 2.0), 0.0).size());
+  EXPECT_DOUBLE_EQ(0.0, tree.FindNearest(Point2D(1.0, 2.0)).squared_distance);
+}
+
+TEST(GeometryKdTree2D, LargeTree) {
+  const auto points = CreateRandomPoints(kTestCount * 40U);
+  const KdTree2D tree(points);
+
+  for (const auto& query : CreateRandomPoints(kQueryCount / 10U)) {
+    EXPECT_DOUBLE_EQ(SortSquaredDistances(points, query).front(),
+                     tree.FindNearest(query).squared_distance);
+  }
+}
+}  // namespace programmers::geometry
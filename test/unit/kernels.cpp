@@ -0,0 +1,282 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/kernels.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1003U;
+constexpr double kScalar = 0.75;
+constexpr double kOffsetX = -12.5;
+constexpr double kOffsetY = 31.25;
+
+auto CreateRandomValues(uint32_t count) -> std::vector<double> {
+  std::vector<double> values;
+  for (uint32_t i = 0; i < count; ++i) {
+    values.push_back(static_cast<double>(std::rand()) /
+                     static_cast<double>(RAND_MAX) * 2000.0 - 1000.0);
+  }
+  return values;
+}
+
+auto CreateRandomInt64s(uint32_t count) -> std::vector<int64_t> {
+  std::vector<int64_t> values;
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto bits{(static_cast<uint64_t>(std::rand()) << 42U) ^
+                    (static_cast<uint64_t>(std::rand()) << 21U) ^
+                    static_cast<uint64_t>(std::rand())};
+    // Shift by a random amount so both small and huge magnitudes show up.
+    values.push_back(static_cast<int64_t>(bits) >> (i % 64U));
+  }
+  return values;
+}
+
+/**
+ * @brief Round value like the kernels, saturating and mapping NaN to 0
+ */
+auto RoundReference(double value, programmers::geometry::Rounding rounding)
+    -> int64_t {
+  using programmers::geometry::Rounding;
+  if (std::isnan(value)) {
+    return 0;
+  }
+  auto rounded{std::trunc(value)};
+  if (rounding == Rounding::kDown) {
+    rounded = std::floor(value);
+  } else if (rounding == Rounding::kUp) {
+    rounded = std::ceil(value);
+  } else if (rounding == Rounding::kNearest) {
+    rounded = std::round(value);
+  } else if (rounding == Rounding::kNearestEven) {
+    rounded = std::nearbyint(value);
+  }
+  if (rounded >= 9223372036854775808.0) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  if (rounded < -9223372036854775808.0) {
+    return std::numeric_limits<int64_t>::min();
+  }
+  return static_cast<int64_t>(rounded);
+}
+
+const std::vector<programmers::geometry::kernels::Isa> kIsas{
+    programmers::geometry::kernels::Isa::kScalar,
+    programmers::geometry::kernels::Isa::kSse2,
+    programmers::geometry::kernels::Isa::kAvx2,
+    programmers::geometry::kernels::Isa::kAvx512};
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryKernels, SetActiveIsa) {
+  const auto supported = kernels::GetSupportedIsa();
+
+  EXPECT_EQ(kernels::Isa::kScalar,
+            kernels::SetActiveIsa(kernels::Isa::kScalar));
+  EXPECT_EQ(kernels::Isa::kScalar, kernels::GetActiveIsa());
+  EXPECT_EQ(supported, kernels::SetActiveIsa(kernels::Isa::kAvx512));
+  EXPECT_EQ(supported, kernels::GetActiveIsa());
+  EXPECT_STREQ("scalar", kernels::GetIsaName(kernels::Isa::kScalar));
+
+  kernels::ResetActiveIsa();
+}
+
+TEST(GeometryKernels, DistancesMatchScalarReference) {
+  const auto xs = CreateRandomValues(kTestCount);
+  const auto ys = CreateRandomValues(kTestCount);
+  const auto target_x = static_cast<double>(std::rand());
+  const auto target_y = static_cast<double>(std::rand());
+
+  for (const auto isa : kIsas) {
+    kernels::SetActiveIsa(isa);
+    std::vector<double> distances(kTestCount);
+    std::vector<double> squared_distances(kTestCount);
+    std::vector<double> pairwise_distances(kTestCount);
+    kernels::CalculateDistances(xs.data(), ys.data(), kTestCount, target_x,
+                                target_y, distances.data());
+    kernels::CalculateSquaredDistances(xs.data(), ys.data(), kTestCount,
+                                       target_x, target_y,
+                                       squared_distances.data());
+    kernels::CalculatePairwiseDistances(xs.data(), ys.data(), ys.data(),
+                                        xs.data(), kTestCount,
+                                        pairwise_distances.data());
+
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      const auto dx = xs[i] - target_x;
+      const auto dy = ys[i] - target_y;
+      EXPECT_DOUBLE_EQ(std::sqrt(dx * dx + dy * dy), distances[i]);
+      EXPECT_DOUBLE_EQ(dx * dx + dy * dy, squared_distances[i]);
+      EXPECT_DOUBLE_EQ(std::sqrt(2.0) * std::abs(xs[i] - ys[i]),
+                       pairwise_distances[i]);
+    }
+  }
+  kernels::ResetActiveIsa();
+}
+
+TEST(GeometryKernels, Distances3DMatchScalarReference) {
+  const auto xs = CreateRandomValues(kTestCount);
+  const auto ys = CreateRandomValues(kTestCount);
+  const auto zs = CreateRandomValues(kTestCount);
+  const std::array<double, 3> target{kOffsetX, kOffsetY, kScalar};
+
+  for (const auto isa : kIsas) {
+    kernels::SetActiveIsa(isa);
+    std::vector<double> distances(kTestCount);
+    kernels::CalculateDistances3D(xs.data(), ys.data(), zs.data(), kTestCount,
+                                  target.data(), distances.data());
+
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      const auto dx = xs[i] - target[0];
+      const auto dy = ys[i] - target[1];
+      const auto dz = zs[i] - target[2];
+      EXPECT_DOUBLE_EQ(std::sqrt(dx * dx + dy * dy + dz * dz), distances[i]);
+    }
+  }
+  kernels::ResetActiveIsa();
+}
+
+TEST(GeometryKernels, ArithmeticMatchesScalarReference) {
+  const auto xs = CreateRandomValues(kTestCount);
+  const auto ys = CreateRandomValues(kTestCount);
+
+  for (const auto isa : kIsas) {
+    kernels::SetActiveIsa(isa);
+    std::vector<double> sum_xs(kTestCount);
+    std::vector<double> sum_ys(kTestCount);
+    std::vector<double> difference_xs(kTestCount);
+    std::vector<double> difference_ys(kTestCount);
+    std::vector<double> scaled_xs(kTestCount);
+    std::vector<double> scaled_ys(kTestCount);
+    kernels::Add(xs.data(), ys.data(), ys.data(), xs.data(), kTestCount,
+                 sum_xs.data(), sum_ys.data());
+    kernels::Subtract(xs.data(), ys.data(), ys.data(), xs.data(), kTestCount,
+                      difference_xs.data(), difference_ys.data());
+    kernels::Scale(xs.data(), ys.data(), kTestCount, kScalar,
+                   scaled_xs.data(), scaled_ys.data());
+
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      EXPECT_DOUBLE_EQ(xs[i] + ys[i], sum_xs[i]);
+      EXPECT_DOUBLE_EQ(ys[i] + xs[i], sum_ys[i]);
+      EXPECT_DOUBLE_EQ(xs[i] - ys[i], difference_xs[i]);
+      EXPECT_DOUBLE_EQ(ys[i] - xs[i], difference_ys[i]);
+      EXPECT_DOUBLE_EQ(xs[i] * kScalar, scaled_xs[i]);
+      EXPECT_DOUBLE_EQ(ys[i] * kScalar, scaled_ys[i]);
+    }
+  }
+  kernels::ResetActiveIsa();
+}
+
+TEST(GeometryKernels, TranslateInPlace) {
+  const auto xs = CreateRandomValues(kTestCount);
+  const auto ys = CreateRandomValues(kTestCount);
+
+  for (const auto isa : kIsas) {
+    kernels::SetActiveIsa(isa);
+    auto translated_xs = xs;
+    auto translated_ys = ys;
+    kernels::Translate(translated_xs.data(), translated_ys.data(), kTestCount,
+                       kOffsetX, kOffsetY, translated_xs.data(),
+                       translated_ys.data());
+
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      EXPECT_DOUBLE_EQ(xs[i] + kOffsetX, translated_xs[i]);
+      EXPECT_DOUBLE_EQ(ys[i] + kOffsetY, translated_ys[i]);
+    }
+  }
+  kernels::ResetActiveIsa();
+}
+
+TEST(GeometryKernels, TransformMatchesScalarReference) {
+  const auto xs = CreateRandomValues(kTestCount);
+  const auto ys = CreateRandomValues(kTestCount);
+  const std::array<double, 6> matrix{0.8, -0.6, kOffsetX, 0.6, 0.8, kOffsetY};
+
+  for (const auto isa : kIsas) {
+    kernels::SetActiveIsa(isa);
+    std::vector<double> transformed_xs(kTestCount);
+    std::vector<double> transformed_ys(kTestCount);
+    kernels::Transform(xs.data(), ys.data(), kTestCount, matrix.data(),
+                       transformed_xs.data(), transformed_ys.data());
+    auto updated_xs = xs;
+    auto updated_ys = ys;
+    kernels::Transform(updated_xs.data(), updated_ys.data(), kTestCount,
+                       matrix.data(), updated_xs.data(), updated_ys.data());
+
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      const auto x = matrix[0] * xs[i] + matrix[1] * ys[i] + matrix[2];
+      const auto y = matrix[3] * xs[i] + matrix[4] * ys[i] + matrix[5];
+      EXPECT_NEAR(x, transformed_xs[i], 1.0e-9);
+      EXPECT_NEAR(y, transformed_ys[i], 1.0e-9);
+      EXPECT_EQ(transformed_xs[i], updated_xs[i]);
+      EXPECT_EQ(transformed_ys[i], updated_ys[i]);
+    }
+  }
+  kernels::ResetActiveIsa();
+}
+
+TEST(GeometryKernels, ConvertToDoubleMatchesScalarReference) {
+  const auto values = CreateRandomInt64s(kTestCount);
+
+  for (const auto isa : kIsas) {
+    kernels::SetActiveIsa(isa);
+    std::vector<double> converted(kTestCount);
+    kernels::ConvertToDouble(values.data(), kTestCount, kScalar,
+                             converted.data());
+
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      EXPECT_EQ(static_cast<double>(values[i]) * kScalar, converted[i])
+          << kernels::GetIsaName(isa) << " " << values[i];
+    }
+  }
+  kernels::ResetActiveIsa();
+}
+
+TEST(GeometryKernels, ConvertToInt64MatchesScalarReference) {
+  auto values = CreateRandomValues(kTestCount);
+  for (uint32_t i = 0; i < kTestCount; i += 3U) {
+    values[i] = std::round(values[i] * 2.0) / 2.0;  // Ties
+  }
+  const std::array<double, 10> kSpecialValues{
+      0.5, -0.5, 1.5, -2.5, 0.49999999999999994, 1.0e+300, -1.0e+300,
+      std::numeric_limits<double>::infinity(), 4503599627370497.0,
+      -9223372036854775808.0};
+  for (std::size_t i = 0; i < kSpecialValues.size(); ++i) {
+    values[i * 7U + 1U] = kSpecialValues[i];
+  }
+  const std::array<Rounding, 5> kRoundings{
+      Rounding::kTowardZero, Rounding::kDown, Rounding::kUp,
+      Rounding::kNearest, Rounding::kNearestEven};
+
+  for (const auto isa : kIsas) {
+    kernels::SetActiveIsa(isa);
+    for (const auto rounding : kRoundings) {
+      for (const auto scale : {1.0, 1.0e+9, 1.0e+16}) {
+        std::vector<int64_t> converted(kTestCount);
+        EXPECT_TRUE(kernels::ConvertToInt64(values.data(), kTestCount, scale,
+                                            rounding, converted.data()));
+        for (uint32_t i = 0; i < kTestCount; ++i) {
+          EXPECT_EQ(RoundReference(values[i] * scale, rounding), converted[i])
+              << kernels::GetIsaName(isa) << " " << values[i] << " * "
+              << scale;
+        }
+      }
+    }
+
+    auto with_nan = values;
+    with_nan[kTestCount / 2U] = std::nan("");
+    std::vector<int64_t> converted(kTestCount);
+    EXPECT_FALSE(kernels::ConvertToInt64(with_nan.data(), kTestCount, 1.0,
+                                         Rounding::kNearest,
+                                         converted.data()));
+    EXPECT_EQ(0, converted[kTestCount / 2U]);
+  }
+  kernels::ResetActiveIsa();
+}
+}  // namespace programmers::geometry
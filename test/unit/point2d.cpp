@@ -5,6 +5,8 @@
 
 #include <cmath>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -221,4 +223,116 @@ TEST(GeometryPoint2D, operatorNotEqual) {
     EXPECT_TRUE(source != target);
   }
 }
+
+TEST(GeometryPoint2D, CalculateSquaredDistance) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto kSourceX = static_cast<double>(std::rand());
+    const auto kSourceY = static_cast<double>(std::rand());
+    const auto kTargetX = static_cast<double>(std::rand());
+    const auto kTargetY = static_cast<double>(std::rand());
+
+    Point2D source(kSourceX, kSourceY);
+    Point2D target(kTargetX, kTargetY);
+
+    EXPECT_DOUBLE_EQ((kSourceX - kTargetX) * (kSourceX - kTargetX) +
+                         (kSourceY - kTargetY) * (kSourceY - kTargetY),
+                     source.CalculateSquaredDistance(target));
+    EXPECT_DOUBLE_EQ(source.CalculateSquaredDistance(target),
+                     Point2D::CalculateSquaredDistance(target, source));
+  }
+}
+
+TEST(GeometryPoint2D, IsCloser) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    Point2D origin(static_cast<double>(std::rand()),
+                   static_cast<double>(std::rand()));
+    Point2D lhs(static_cast<double>(std::rand()),
+                static_cast<double>(std::rand()));
+    Point2D rhs(static_cast<double>(std::rand()),
+                static_cast<double>(std::rand()));
+
+    EXPECT_EQ(origin.CalculateDistance(lhs) < origin.CalculateDistance(rhs),
+              Point2D::IsCloser(origin, lhs, rhs));
+  }
+  EXPECT_FALSE(Point2D::IsCloser(Point2D(), Point2D(3.0, 4.0),
+                                 Point2D(4.0, 3.0)));
+}
+
+TEST(GeometryPoint2D, IsWithinRadius) {
+  const Point2D source(1.0, 1.0);
+  const Point2D target(4.0, 5.0);
+
+  EXPECT_TRUE(source.IsWithinRadius(target, 5.0));
+  EXPECT_FALSE(source.IsWithinRadius(target, 4.999));
+  EXPECT_FALSE(source.IsWithinRadius(source, -1.0));
+  EXPECT_TRUE(source.IsWithinRadius(target, Distance(5.0)));
+  EXPECT_TRUE(
+      source.IsWithinRadius(target, Distance(5.0, Distance::Type::kKilometer),
+                            Distance::Type::kKilometer));
+  EXPECT_FALSE(source.IsWithinRadius(
+      target, Distance(4999.0, Distance::Type::kMillimeter)));
+}
+
+TEST(GeometryPoint2D, FilterWithinRadius) {
+  std::vector<Point2D> points;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    points.emplace_back(static_cast<double>(std::rand() % 1000),
+                        static_cast<double>(std::rand() % 1000));
+  }
+  const Point2D center(500.0, 500.0);
+  const auto kRadius = 250.0;
+
+  const auto indices = Point2D::FilterWithinRadius(points, center, kRadius);
+
+  std::vector<std::size_t> expected;
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    if (points[i].CalculateDistance(center) <= kRadius) {
+      expected.push_back(i);
+    }
+  }
+  EXPECT_EQ(expected, indices);
+  EXPECT_EQ(expected,
+            Point2D::FilterWithinRadius(points, center, Distance(kRadius)));
+}
+
+TEST(GeometryPoint2D, FloatPrecision) {
+  static_assert(std::is_same_v<Point2D, BasicPoint2D<double>>);
+  static_assert(sizeof(Point2F) == 2U * sizeof(float));
+  static_assert(sizeof(Point2D) == 2U * sizeof(double));
+  static_assert(!std::is_convertible_v<Point2D, Point2F>);
+  static_assert(!std::is_convertible_v<Point2F, Point2D>);
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2D source(static_cast<double>(std::rand()) / 3.0,
+                         static_cast<double>(std::rand()) / 7.0);
+    const Point2F converted(source);
+    EXPECT_EQ(static_cast<float>(source.GetX()), converted.GetX());
+    EXPECT_EQ(static_cast<float>(source.GetY()), converted.GetY());
+    EXPECT_EQ(static_cast<double>(converted.GetX()),
+              Point2D(converted).GetX());
+
+    const Point2F target(static_cast<float>(std::rand()),
+                         static_cast<float>(std::rand()));
+    const auto dx{converted.GetX() - target.GetX()};
+    const auto dy{converted.GetY() - target.GetY()};
+    EXPECT_FLOAT_EQ(std::sqrt(dx * dx + dy * dy),
+                    converted.CalculateDistance(target));
+    EXPECT_FLOAT_EQ(dx * dx + dy * dy,
+                    Point2F::CalculateSquaredDistance(converted, target));
+    EXPECT_EQ(Point2F(converted.GetX() + target.GetX(),
+                      converted.GetY() + target.GetY()),
+              converted + target);
+    EXPECT_EQ(Point2F(dx, dy), converted - target);
+    EXPECT_EQ(Point2F(converted.GetX() * 2.0F, converted.GetY() * 2.0F),
+              converted * 2.0F);
+  }
+
+  const Point2F origin;
+  EXPECT_TRUE(origin.IsWithinRadius(Point2F(3.0F, 4.0F), 5.0F));
+  EXPECT_FALSE(origin.IsWithinRadius(
+      Point2F(3.0F, 4.0F), Distance(4999.0, Distance::Type::kMillimeter)));
+  EXPECT_EQ(std::vector<std::size_t>{1U},
+            Point2F::FilterWithinRadius(
+                {Point2F(3.0F, 4.0F), Point2F(1.0F, 1.0F)}, origin, 2.0F));
+}
 }  // namespace programmers::geometry
@@ -0,0 +1,186 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/point_cloud2d.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+auto CreateRandomPoints(uint32_t count)
+    -> std::vector<programmers::geometry::Point2D> {
+  std::vector<programmers::geometry::Point2D> points;
+  for (uint32_t i = 0; i < count; ++i) {
+    points.emplace_back(static_cast<double>(std::rand()),
+                        static_cast<double>(std::rand()));
+  }
+  return points;
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryPointCloud2D, Constructor) {
+  PointCloud2D cloud1;
+  EXPECT_TRUE(cloud1.Empty());
+
+  PointCloud2D cloud2(kTestCount);
+  EXPECT_EQ(kTestCount, cloud2.Size());
+  EXPECT_EQ(Point2D(), cloud2.GetPoint(kTestCount - 1));
+
+  PointCloud2D cloud3(cloud2);
+  PointCloud2D cloud4(std::move(PointCloud2D()));
+}
+
+TEST(GeometryPointCloud2D, Alignment) {
+  PointCloud2D cloud(CreateRandomPoints(kTestCount));
+
+  EXPECT_EQ(0U, reinterpret_cast<std::uintptr_t>(cloud.XData()) %
+                    PointCloud2D::kAlignment);
+  EXPECT_EQ(0U, reinterpret_cast<std::uintptr_t>(cloud.YData()) %
+                    PointCloud2D::kAlignment);
+}
+
+TEST(GeometryPointCloud2D, ConvertPoints) {
+  const auto points = CreateRandomPoints(kTestCount);
+  PointCloud2D cloud(points);
+
+  ASSERT_EQ(points.size(), cloud.Size());
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_EQ(points[i], cloud.GetPoint(i));
+    EXPECT_DOUBLE_EQ(points[i].GetX(), cloud.GetX(i));
+    EXPECT_DOUBLE_EQ(points[i].GetY(), cloud.GetY(i));
+  }
+  EXPECT_EQ(points, cloud.ToPoints());
+}
+
+TEST(GeometryPointCloud2D, PushBackAndSetPoint) {
+  PointCloud2D cloud;
+  cloud.PushBack(Point2D(1.0, 2.0));
+  cloud.PushBack(3.0, 4.0);
+  cloud.SetPoint(0, Point2D(5.0, 6.0));
+
+  EXPECT_EQ(2U, cloud.Size());
+  EXPECT_EQ(Point2D(5.0, 6.0), cloud.GetPoint(0));
+  EXPECT_EQ(Point2D(3.0, 4.0), cloud.GetPoint(1));
+
+  cloud.Clear();
+  EXPECT_TRUE(cloud.Empty());
+}
+
+TEST(GeometryPointCloud2D, CalculateDistances) {
+  const auto points = CreateRandomPoints(kTestCount);
+  const PointCloud2D cloud(points);
+  const Point2D target(static_cast<double>(std::rand()),
+                       static_cast<double>(std::rand()));
+
+  const auto distances = cloud.CalculateDistances(target);
+
+  ASSERT_EQ(points.size(), distances.size());
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_DOUBLE_EQ(points[i].CalculateDistance(target), distances[i]);
+  }
+}
+
+TEST(GeometryPointCloud2D, CalculatePairwiseDistances) {
+  const auto sources = CreateRandomPoints(kTestCount);
+  const auto targets = CreateRandomPoints(kTestCount);
+
+  const auto distances =
+      PointCloud2D(sources).CalculatePairwiseDistances(PointCloud2D(targets));
+
+  ASSERT_EQ(sources.size(), distances.size());
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_DOUBLE_EQ(sources[i].CalculateDistance(targets[i]), distances[i]);
+  }
+  EXPECT_THROW(PointCloud2D(sources).CalculatePairwiseDistances(PointCloud2D()),
+               std::invalid_argument);
+}
+
+TEST(GeometryPointCloud2D, CalculateDistanceMatrix) {
+  const auto sources = CreateRandomPoints(kTestCount / 10U);
+  const auto targets = CreateRandomPoints(kTestCount / 20U);
+
+  const auto matrix =
+      PointCloud2D(sources).CalculateDistanceMatrix(PointCloud2D(targets));
+
+  ASSERT_EQ(sources.size() * targets.size(), matrix.size());
+  for (std::size_t i = 0; i < sources.size(); ++i) {
+    for (std::size_t j = 0; j < targets.size(); ++j) {
+      EXPECT_DOUBLE_EQ(sources[i].CalculateDistance(targets[j]),
+                       matrix[i * targets.size() + j]);
+    }
+  }
+}
+
+TEST(GeometryPointCloud2D, CalculateSquaredDistances) {
+  const auto points = CreateRandomPoints(kTestCount);
+  const PointCloud2D cloud(points);
+  const Point2D target(static_cast<double>(std::rand()),
+                       static_cast<double>(std::rand()));
+
+  const auto squared_distances = cloud.CalculateSquaredDistances(target);
+
+  ASSERT_EQ(points.size(), squared_distances.size());
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto distance = points[i].CalculateDistance(target);
+    EXPECT_DOUBLE_EQ(distance * distance, squared_distances[i]);
+  }
+}
+
+TEST(GeometryPointCloud2D, TranslateAndScale) {
+  const auto points = CreateRandomPoints(kTestCount);
+  const Point2D offset(static_cast<double>(std::rand()),
+                       static_cast<double>(std::rand()));
+  const auto kScalar = static_cast<double>(std::rand());
+
+  PointCloud2D cloud(points);
+  cloud.Translate(offset);
+  cloud.Scale(kScalar);
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_EQ((points[i] + offset) * kScalar, cloud.GetPoint(i));
+  }
+}
+
+TEST(GeometryPointCloud2D, OperatorAddAndSubtractAssign) {
+  const auto sources = CreateRandomPoints(kTestCount);
+  const auto targets = CreateRandomPoints(kTestCount);
+
+  PointCloud2D sum(sources);
+  sum += PointCloud2D(targets);
+  PointCloud2D difference(sources);
+  difference -= PointCloud2D(targets);
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_EQ(sources[i] + targets[i], sum.GetPoint(i));
+    EXPECT_EQ(sources[i] - targets[i], difference.GetPoint(i));
+  }
+  EXPECT_THROW(sum += PointCloud2D(), std::invalid_argument);
+}
+
+TEST(GeometryPointCloud2D, FilterWithinRadius) {
+  std::vector<Point2D> points;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    points.emplace_back(static_cast<double>(std::rand() % 1000),
+                        static_cast<double>(std::rand() % 1000));
+  }
+  const PointCloud2D cloud(points);
+  const Point2D center(500.0, 500.0);
+  const auto kRadius = 250.0;
+
+  const auto expected = Point2D::FilterWithinRadius(points, center, kRadius);
+
+  EXPECT_FALSE(expected.empty());
+  EXPECT_EQ(expected, cloud.FilterWithinRadius(center, kRadius));
+  EXPECT_EQ(expected, cloud.FilterWithinRadius(
+                          center, Distance(kRadius * 1.0e+2,
+                                           Distance::Type::kCentimeter)));
+  EXPECT_TRUE(cloud.FilterWithinRadius(center, -1.0).empty());
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,131 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/point_file.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+auto GetTemporaryPath(const std::string& name) -> std::string {
+  return (std::filesystem::temp_directory_path() /
+          ("geometry_point_file_" + name + ".bin"))
+      .string();
+}
+
+auto CreateRandomCloud(uint32_t count)
+    -> programmers::geometry::PointCloud2D {
+  programmers::geometry::PointCloud2D points;
+  for (uint32_t i = 0; i < count; ++i) {
+    points.PushBack(static_cast<double>(std::rand()) / RAND_MAX * 1.0e+3,
+                    static_cast<double>(std::rand()) / RAND_MAX * 1.0e+3);
+  }
+  return points;
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryPointFile, RoundTrip) {
+  const auto path{GetTemporaryPath("round_trip")};
+  const auto points{CreateRandomCloud(kTestCount)};
+  DistanceArray elevations(kTestCount);
+  DistanceArray accuracies(kTestCount);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    elevations.SetDistance(i, Distance::FromNanometer(std::rand() - 1000));
+    accuracies.SetDistance(i, Distance(i, Distance::Type::kMillimeter));
+  }
+  WritePointFile(path, points,
+                 {{"elevation", &elevations}, {"accuracy", &accuracies}});
+
+  const PointFileReader reader(path);
+  EXPECT_TRUE(reader.IsOpen());
+  ASSERT_EQ(points.Size(), reader.Size());
+  EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(reader.XData()) %
+                    point_file::kAlignment);
+  EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(reader.YData()) %
+                    point_file::kAlignment);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_EQ(points.GetPoint(i), reader.GetPoint(i));
+  }
+  EXPECT_EQ(points.ToPoints(), reader.ToPointCloud().ToPoints());
+
+  ASSERT_EQ(2U, reader.GetAttributeCount());
+  EXPECT_EQ("elevation", reader.GetAttributeName(0U));
+  EXPECT_EQ(1U, reader.FindAttribute("accuracy"));
+  EXPECT_THROW(static_cast<void>(reader.FindAttribute("speed")),
+               std::out_of_range);
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    EXPECT_EQ(elevations.GetDistance(i), reader.GetDistance(0U, i));
+    EXPECT_EQ(accuracies.GetNanometer(i), reader.AttributeData(1U)[i]);
+  }
+
+  // The mapped columns feed the distance functions without a copy.
+  const Point2D target(500.0, 500.0);
+  std::vector<double> expected(kTestCount);
+  std::vector<double> actual(kTestCount);
+  points.CalculateDistances(target, expected.data());
+  reader.CalculateDistances(target, actual.data());
+  EXPECT_EQ(expected, actual);
+  std::remove(path.c_str());
+}
+
+TEST(GeometryPointFile, Empty) {
+  const auto path{GetTemporaryPath("empty")};
+  WritePointFile(path, PointCloud2D());
+  PointFileReader reader(path);
+  EXPECT_EQ(0U, reader.Size());
+  EXPECT_EQ(0U, reader.GetAttributeCount());
+
+  PointFileReader moved(std::move(reader));
+  EXPECT_TRUE(moved.IsOpen());
+  EXPECT_FALSE(reader.IsOpen());
+  reader = std::move(moved);
+  EXPECT_TRUE(reader.IsOpen());
+  EXPECT_FALSE(PointFileReader().IsOpen());
+  std::remove(path.c_str());
+}
+
+TEST(GeometryPointFile, Invalid) {
+  const auto path{GetTemporaryPath("invalid")};
+  const auto points{CreateRandomCloud(10U)};
+  DistanceArray short_values(9U);
+  EXPECT_THROW(WritePointFile(path, points, {{"short", &short_values}}),
+               std::invalid_argument);
+  DistanceArray values(10U);
+  EXPECT_THROW(WritePointFile(path, points, {{"", &values}}),
+               std::invalid_argument);
+  EXPECT_THROW(WritePointFile(path, points, {{std::string(56U, 'a'), &values}}),
+               std::invalid_argument);
+  EXPECT_THROW(
+      WritePointFile(path, points, {{"twice", &values}, {"twice", &values}}),
+      std::invalid_argument);
+  EXPECT_THROW(WritePointFile(path, points, {{"null", nullptr}}),
+               std::invalid_argument);
+
+  EXPECT_THROW(PointFileReader(GetTemporaryPath("missing")),
+               std::system_error);
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << std::string(point_file::kHeaderSize, 'x');
+  }
+  EXPECT_THROW(PointFileReader{path}, std::runtime_error);
+
+  // A file cut short is rejected instead of read past its end.
+  WritePointFile(path, points, {{"values", &values}});
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8U);
+  EXPECT_THROW(PointFileReader{path}, std::runtime_error);
+  std::remove(path.c_str());
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,148 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/point_parser.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+/**
+ * @brief Expect a ParseError at line and column
+ */
+template <typename Parse>
+auto ExpectParseError(const Parse& parse, std::size_t line,
+                      std::size_t column) -> void {
+  try {
+    parse();
+    ADD_FAILURE() << "No ParseError";
+  } catch (const programmers::geometry::ParseError& error) {
+    EXPECT_EQ(line, error.GetLine()) << error.what();
+    EXPECT_EQ(column, error.GetColumn()) << error.what();
+  }
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryPointParser, Csv) {
+  const auto points{ParseCsvPoints("1.5,2\n-3e2, +4 \r\n\n  \n5,6")};
+  ASSERT_EQ(3U, points.Size());
+  EXPECT_EQ(Point2D(1.5, 2.0), points.GetPoint(0U));
+  EXPECT_EQ(Point2D(-300.0, 4.0), points.GetPoint(1U));
+  EXPECT_EQ(Point2D(5.0, 6.0), points.GetPoint(2U));
+  EXPECT_TRUE(ParseCsvPoints("").Empty());
+
+  CsvFormat format;
+  format.delimiter = ';';
+  format.x_field = 2U;
+  format.y_field = 0U;
+  format.has_header = true;
+  const auto fields{ParseCsvPoints("lat;name;lon\n1;a;2\n3;b;4\n", format)};
+  ASSERT_EQ(2U, fields.Size());
+  EXPECT_EQ(Point2D(2.0, 1.0), fields.GetPoint(0U));
+  EXPECT_EQ(Point2D(4.0, 3.0), fields.GetPoint(1U));
+
+  format.y_field = 2U;
+  EXPECT_THROW(static_cast<void>(ParseCsvPoints("", format)),
+               std::invalid_argument);
+}
+
+TEST(GeometryPointParser, CsvError) {
+  ExpectParseError([] { return ParseCsvPoints("1,2\n3,x\n"); }, 2U, 3U);
+  ExpectParseError([] { return ParseCsvPoints("1,2\n3\n"); }, 2U, 2U);
+  ExpectParseError([] { return ParseCsvPoints("1,2 5\n"); }, 1U, 5U);
+  ExpectParseError([] { return ParseCsvPoints("1e999,2\n"); }, 1U, 1U);
+  CsvFormat format;
+  format.has_header = true;
+  ExpectParseError([&] { return ParseCsvPoints("x,y\n\n1,?\n", format); },
+                   3U, 3U);
+}
+
+TEST(GeometryPointParser, Wkt) {
+  const auto collection{ParseWkt(
+      "POINT (1 2)\n"
+      "linestring(0 0, 1.5 -1,2 2)\n"
+      "Point Empty\n"
+      "\tLINESTRING EMPTY \n")};
+  ASSERT_EQ(4U, collection.types.size());
+  EXPECT_EQ(WktType::kPoint, collection.types[0]);
+  EXPECT_EQ(WktType::kLineString, collection.types[1]);
+  EXPECT_EQ(std::vector<std::size_t>({0U, 1U, 4U, 4U, 4U}),
+            collection.offsets);
+  ASSERT_EQ(4U, collection.points.Size());
+  EXPECT_EQ(Point2D(1.0, 2.0), collection.points.GetPoint(0U));
+  EXPECT_EQ(Point2D(1.5, -1.0), collection.points.GetPoint(2U));
+
+  ExpectParseError([] { return ParseWkt("POINT (1 2)\nPOLYGON (1 2)"); }, 2U,
+                   1U);
+  ExpectParseError([] { return ParseWkt("POINT (1 2, 3 4)"); }, 1U, 11U);
+  ExpectParseError([] { return ParseWkt("POINT (1,2)"); }, 1U, 9U);
+  ExpectParseError([] { return ParseWkt("  LINESTRING (1 2)"); }, 1U, 3U);
+  ExpectParseError([] { return ParseWkt("POINT (1 2) x"); }, 1U, 13U);
+  ExpectParseError([] { return ParseWkt("POINTZ (1 2)"); }, 1U, 1U);
+}
+
+TEST(GeometryPointParser, Parallel) {
+  // Several megabytes so that the text is split across threads.
+  std::ostringstream csv;
+  std::ostringstream wkt;
+  csv.precision(17);
+  wkt.precision(17);
+  PointCloud2D expected;
+  for (uint32_t i = 0; i < kTestCount * 200U; ++i) {
+    const auto x{static_cast<double>(std::rand()) / RAND_MAX * 1.0e+4};
+    const auto y{static_cast<double>(std::rand()) / RAND_MAX * -1.0e+4};
+    expected.PushBack(x, y);
+    csv << x << ',' << y << '\n';
+    wkt << "POINT (" << x << ' ' << y << ")\n";
+  }
+  const auto csv_text{csv.str()};
+  const auto wkt_text{wkt.str()};
+  EXPECT_EQ(expected.ToPoints(), ParseCsvPoints(csv_text).ToPoints());
+  EXPECT_EQ(expected.ToPoints(), ParseWkt(wkt_text).points.ToPoints());
+
+  // The first error is reported with its line number across chunks.
+  auto broken{csv_text + "1,2\n"};
+  broken.replace(broken.size() / 2U, 1U, "#");
+  std::size_t line{1U};
+  for (std::size_t i = 0; i < broken.size() / 2U; ++i) {
+    line += broken[i] == '\n' ? 1U : 0U;
+  }
+  broken.replace(broken.size() * 3U / 4U, 1U, "#");
+  try {
+    static_cast<void>(ParseCsvPoints(broken));
+    ADD_FAILURE() << "No ParseError";
+  } catch (const ParseError& error) {
+    EXPECT_EQ(line, error.GetLine());
+  }
+}
+
+TEST(GeometryPointParser, File) {
+  const auto path{(std::filesystem::temp_directory_path() /
+                   "geometry_point_parser.txt")
+                      .string()};
+  {
+    std::ofstream file(path);
+    file << "1,2\n3,4\n";
+  }
+  EXPECT_EQ(2U, ReadCsvPoints(path).Size());
+  {
+    std::ofstream file(path);
+    file << "POINT (1 2)\n";
+  }
+  EXPECT_EQ(1U, ReadWkt(path).points.Size());
+  std::remove(path.c_str());
+  EXPECT_THROW(static_cast<void>(ReadCsvPoints(path)), std::system_error);
+}
+}  // namespace programmers::geometry
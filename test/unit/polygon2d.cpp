@@ -0,0 +1,70 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/polygon2d.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryPolygon2D, Construct) {
+  const Polygon2D empty;
+  EXPECT_EQ(0U, empty.GetVertexCount());
+  EXPECT_TRUE(empty.GetBoundingBox().IsEmpty());
+  EXPECT_FALSE(empty.Contains({0.0, 0.0}));
+
+  // A closing vertex equal to the first is dropped.
+  const Polygon2D triangle({{0.0, 0.0}, {4.0, 0.0}, {0.0, 4.0}, {0.0, 0.0}});
+  EXPECT_EQ(3U, triangle.GetVertexCount());
+  EXPECT_EQ(Point2D(0.0, 0.0), triangle.GetBoundingBox().GetMinimum());
+  EXPECT_EQ(Point2D(4.0, 4.0), triangle.GetBoundingBox().GetMaximum());
+  EXPECT_DOUBLE_EQ(8.0, triangle.CalculateArea());
+
+  EXPECT_THROW(Polygon2D({{0.0, 0.0}, {1.0, 0.0}, {0.0, 0.0}}),
+               std::invalid_argument);
+  EXPECT_THROW(Polygon2D({{0.0, 0.0}, {1.0, 0.0}, {0.0, 1.0}},
+                         {{{0.1, 0.1}, {0.2, 0.1}}}),
+               std::invalid_argument);
+  EXPECT_THROW(
+      Polygon2D({{0.0, 0.0},
+                 {1.0, 0.0},
+                 {0.0, std::numeric_limits<double>::infinity()}}),
+      std::invalid_argument);
+}
+
+TEST(GeometryPolygon2D, Contains) {
+  // A square of side 10 with a square hole of side 4, in either winding.
+  const Polygon2D square(
+      {{0.0, 0.0}, {10.0, 0.0}, {10.0, 10.0}, {0.0, 10.0}},
+      {{{3.0, 3.0}, {3.0, 7.0}, {7.0, 7.0}, {7.0, 3.0}}});
+  EXPECT_EQ(8U, square.GetVertexCount());
+  EXPECT_EQ(1U, square.GetHoles().size());
+  EXPECT_DOUBLE_EQ(84.0, square.CalculateArea());
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto x{static_cast<double>(std::rand()) / RAND_MAX * 14.0 - 2.0};
+    const auto y{static_cast<double>(std::rand()) / RAND_MAX * 14.0 - 2.0};
+    const auto in_square{0.0 < x && x < 10.0 && 0.0 < y && y < 10.0};
+    const auto in_hole{3.0 <= x && x <= 7.0 && 3.0 <= y && y <= 7.0};
+    EXPECT_EQ(in_square && !in_hole, square.Contains({x, y}));
+  }
+  // Boundary points belong to the polygon left or below of them.
+  EXPECT_TRUE(square.Contains({0.0, 5.0}));
+  EXPECT_FALSE(square.Contains({10.0, 5.0}));
+  EXPECT_TRUE(square.Contains({5.0, 0.0}));
+  EXPECT_FALSE(square.Contains({5.0, 10.0}));
+  EXPECT_TRUE(square.Contains({7.0, 5.0}));
+  EXPECT_FALSE(square.Contains({3.0, 5.0}));
+  EXPECT_FALSE(square.Contains({std::nan(""), 5.0}));
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,149 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/polygon_index.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+using programmers::geometry::Polygon2D;
+
+/**
+ * @brief Create a star shaped ring of integer vertices around a center
+ * @details At least 6 vertices at least min_radius away, each within its
+ * sector, so the ring keeps a disk of half min_radius around the center.
+ */
+auto CreateRing(int center_x, int center_y, int min_radius, int max_radius)
+    -> Polygon2D::Ring {
+  Polygon2D::Ring ring;
+  const auto count{6 + std::rand() % 10};
+  for (int i = 0; i < count; ++i) {
+    const auto angle{
+        6.28 * (i + static_cast<double>(std::rand()) / RAND_MAX / 2.0) /
+        count};
+    const auto length{min_radius +
+                      std::rand() % (max_radius - min_radius + 1)};
+    ring.emplace_back(std::round(center_x + length * std::cos(angle)),
+                      std::round(center_y + length * std::sin(angle)));
+  }
+  return ring;
+}
+
+/**
+ * @brief Create polygons with overlapping holes that overlap each other
+ */
+auto CreatePolygons(std::size_t count) -> std::vector<Polygon2D> {
+  std::vector<Polygon2D> polygons;
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto x{std::rand() % 100};
+    const auto y{std::rand() % 100};
+    std::vector<Polygon2D::Ring> holes;
+    for (auto hole = std::rand() % 3; hole > 0; --hole) {
+      holes.push_back(CreateRing(x, y, 1, 3));
+    }
+    polygons.emplace_back(CreateRing(x, y, 8, 20), holes);
+  }
+  return polygons;
+}
+
+/**
+ * @brief Find the polygon containing point by testing every polygon
+ */
+auto FindContaining(const std::vector<Polygon2D>& polygons,
+                    const programmers::geometry::Point2D& point)
+    -> std::size_t {
+  for (std::size_t i = 0; i < polygons.size(); ++i) {
+    if (polygons[i].Contains(point)) {
+      return i;
+    }
+  }
+  return programmers::geometry::PolygonIndex::kNotFound;
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryPolygonIndex, FindContaining) {
+  const PolygonIndex empty;
+  EXPECT_EQ(0U, empty.Size());
+  EXPECT_EQ(PolygonIndex::kNotFound, empty.FindContaining({0.0, 0.0}));
+
+  for (const std::size_t count : {1U, 10U, 100U}) {
+    const auto polygons{CreatePolygons(count)};
+    const PolygonIndex index(polygons);
+    ASSERT_EQ(count, index.Size());
+    EXPECT_EQ(polygons.back().GetExterior(),
+              index.GetPolygon(count - 1U).GetExterior());
+
+    // Integer points fall on many edges and vertices.
+    for (uint32_t i = 0; i < kTestCount * 10U; ++i) {
+      const Point2D point(std::rand() % 140 - 20, std::rand() % 140 - 20);
+      EXPECT_EQ(FindContaining(polygons, point), index.FindContaining(point));
+    }
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      const Point2D point(
+          static_cast<double>(std::rand()) / RAND_MAX * 140.0 - 20.0,
+          static_cast<double>(std::rand()) / RAND_MAX * 140.0 - 20.0);
+      EXPECT_EQ(FindContaining(polygons, point), index.FindContaining(point));
+    }
+    EXPECT_EQ(PolygonIndex::kNotFound,
+              index.FindContaining({std::nan(""), 50.0}));
+    EXPECT_EQ(PolygonIndex::kNotFound,
+              index.FindContaining({50.0, std::nan("")}));
+  }
+}
+
+TEST(GeometryPolygonIndex, FindContainingComb) {
+  // Every tooth edge spans almost the whole height, so one band per edge
+  // would copy each edge into most of them.
+  constexpr int kTeeth{2000};
+  constexpr int kHeight{100};
+  Polygon2D::Ring ring{{0.0, 0.0}, {2.0 * kTeeth, 0.0}};
+  for (auto x = 2 * kTeeth; x >= 0; --x) {
+    ring.emplace_back(x, x % 2 == 0 ? kHeight : 1);
+  }
+  const Polygon2D comb(ring);
+  const PolygonIndex index({comb});
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2D point(std::rand() % (2 * kTeeth + 10) - 5,
+                        std::rand() % (kHeight + 10) - 5);
+    EXPECT_EQ(comb.Contains(point) ? 0U : PolygonIndex::kNotFound,
+              index.FindContaining(point));
+  }
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Point2D point(
+        static_cast<double>(std::rand()) / RAND_MAX * 2.0 * kTeeth,
+        static_cast<double>(std::rand()) / RAND_MAX * kHeight);
+    EXPECT_EQ(comb.Contains(point) ? 0U : PolygonIndex::kNotFound,
+              index.FindContaining(point));
+  }
+}
+
+TEST(GeometryPolygonIndex, FindContainingBatch) {
+  const auto polygons{CreatePolygons(100U)};
+  const PolygonIndex index(polygons);
+  PointCloud2D cloud;
+  for (uint32_t i = 0; i < kTestCount * 10U; ++i) {
+    cloud.PushBack(Point2D(std::rand() % 140 - 20, std::rand() % 140 - 20));
+  }
+  cloud.PushBack({std::nan(""), 0.0});
+
+  const auto found{index.FindContaining(cloud)};
+  ASSERT_EQ(cloud.Size(), found.size());
+  for (std::size_t i = 0; i < cloud.Size(); ++i) {
+    EXPECT_EQ(index.FindContaining(cloud.GetPoint(i)), found[i]);
+  }
+  EXPECT_EQ(PolygonIndex::kNotFound, found.back());
+
+  std::vector<std::size_t> output(cloud.Size());
+  index.FindContaining(cloud.XData(), cloud.YData(), cloud.Size(),
+                       output.data());
+  EXPECT_EQ(found, output);
+}
+}  // namespace programmers::geometry
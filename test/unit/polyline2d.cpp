@@ -0,0 +1,170 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/polyline2d.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+/**
+ * @brief Random walk so that consecutive segments stay close like a track
+ */
+auto CreateRandomTrajectory(uint32_t count)
+    -> std::vector<programmers::geometry::Point2D> {
+  std::vector<programmers::geometry::Point2D> points;
+  double x{0.0};
+  double y{0.0};
+  for (uint32_t i = 0; i < count; ++i) {
+    points.emplace_back(x, y);
+    x += static_cast<double>(std::rand() % 2001 - 1000) / 100.0;
+    y += static_cast<double>(std::rand() % 2001 - 1000) / 100.0;
+  }
+  return points;
+}
+
+auto ProjectBruteForce(
+    const std::vector<programmers::geometry::Point2D>& points,
+    const programmers::geometry::Point2D& query) -> double {
+  auto best{std::numeric_limits<double>::infinity()};
+  for (std::size_t i = 0; i + 1U < points.size(); ++i) {
+    const auto dx{points[i + 1U].GetX() - points[i].GetX()};
+    const auto dy{points[i + 1U].GetY() - points[i].GetY()};
+    const auto squared_length{dx * dx + dy * dy};
+    auto ratio{squared_length > 0.0
+                   ? ((query.GetX() - points[i].GetX()) * dx +
+                      (query.GetY() - points[i].GetY()) * dy) /
+                         squared_length
+                   : 0.0};
+    ratio = std::fmin(std::fmax(ratio, 0.0), 1.0);
+    const programmers::geometry::Point2D point(points[i].GetX() + dx * ratio,
+                                               points[i].GetY() + dy * ratio);
+    best = std::fmin(best, point.CalculateSquaredDistance(query));
+  }
+  return best;
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryPolyline2D, Constructor) {
+  const Polyline2D empty;
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_EQ(Distance(), empty.GetLength());
+  EXPECT_EQ(Distance::Type::kMeter, empty.GetUnit());
+  EXPECT_THROW(static_cast<void>(empty.Interpolate(Distance())),
+               std::out_of_range);
+  EXPECT_THROW(static_cast<void>(empty.FindNearest(Point2D())),
+               std::out_of_range);
+
+  const Polyline2D square({Point2D(0.0, 0.0), Point2D(3.0, 0.0),
+                           Point2D(3.0, 4.0), Point2D(0.0, 4.0)},
+                          Distance::Type::kKilometer);
+  EXPECT_EQ(4U, square.Size());
+  EXPECT_EQ(Distance(10.0, Distance::Type::kKilometer), square.GetLength());
+  EXPECT_EQ(Distance(7.0, Distance::Type::kKilometer), square.GetLength(2U));
+  EXPECT_EQ(Point2D(3.0, 4.0), square.GetPoint(2U));
+  EXPECT_EQ(4U, square.GetLengths().Size());
+}
+
+TEST(GeometryPolyline2D, Append) {
+  const auto points{CreateRandomTrajectory(kTestCount)};
+  Polyline2D polyline;
+  Distance expected;
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    if (i > 0U) {
+      expected += Distance(points[i - 1U].CalculateDistance(points[i]),
+                           Distance::Type::kMeter, Rounding::kNearest);
+    }
+    polyline.Append(points[i]);
+    EXPECT_EQ(expected, polyline.GetLength());
+  }
+  EXPECT_EQ(Polyline2D(points).GetLength(), polyline.GetLength());
+
+  EXPECT_THROW(polyline.Append(Point2D(std::nan(""), 0.0)),
+               std::invalid_argument);
+  EXPECT_EQ(points.size(), polyline.Size());
+  polyline.Clear();
+  EXPECT_TRUE(polyline.Empty());
+}
+
+TEST(GeometryPolyline2D, Interpolate) {
+  const Polyline2D polyline({Point2D(0.0, 0.0), Point2D(3.0, 0.0),
+                             Point2D(3.0, 0.0), Point2D(3.0, 4.0)});
+  EXPECT_EQ(Point2D(0.0, 0.0), polyline.Interpolate(Distance(-1.0)));
+  EXPECT_EQ(Point2D(1.5, 0.0), polyline.Interpolate(Distance(1.5)));
+  EXPECT_EQ(Point2D(3.0, 0.0), polyline.Interpolate(Distance(3.0)));
+  EXPECT_EQ(Point2D(3.0, 1.0), polyline.Interpolate(Distance(4.0)));
+  EXPECT_EQ(Point2D(3.0, 4.0), polyline.Interpolate(Distance(7.0)));
+  EXPECT_EQ(Point2D(3.0, 4.0), polyline.Interpolate(Distance(99.0)));
+  EXPECT_EQ(0U, polyline.FindSegment(Distance(2.0)));
+  EXPECT_EQ(2U, polyline.FindSegment(Distance(3.0)));
+  EXPECT_EQ(2U, polyline.FindSegment(Distance(99.0)));
+
+  const Polyline2D single({Point2D(1.0, 2.0)});
+  EXPECT_EQ(Point2D(1.0, 2.0), single.Interpolate(Distance(5.0)));
+  EXPECT_THROW(static_cast<void>(single.FindSegment(Distance())),
+               std::out_of_range);
+}
+
+TEST(GeometryPolyline2D, InterpolateBatch) {
+  const Polyline2D polyline(CreateRandomTrajectory(kTestCount));
+  const auto length{polyline.GetLength().GetNanometer()};
+  DistanceArray alongs;
+  // Ascending arc lengths with some steps back and past both ends.
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    auto along{length / kTestCount * i};
+    if (std::rand() % 10 == 0) {
+      along = static_cast<int64_t>(static_cast<double>(std::rand()) /
+                                   RAND_MAX * static_cast<double>(length));
+    }
+    alongs.PushBack(Distance::FromNanometer(along));
+  }
+  alongs.PushBack(Distance::FromNanometer(-1));
+  alongs.PushBack(Distance::FromNanometer(length + 1));
+
+  const auto points{polyline.Interpolate(alongs)};
+  ASSERT_EQ(alongs.Size(), points.Size());
+  for (std::size_t i = 0; i < alongs.Size(); ++i) {
+    EXPECT_EQ(polyline.Interpolate(alongs.GetDistance(i)),
+              points.GetPoint(i));
+  }
+}
+
+TEST(GeometryPolyline2D, FindNearest) {
+  const auto points{CreateRandomTrajectory(kTestCount)};
+  const Polyline2D polyline(points);
+  PointCloud2D queries;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    queries.PushBack(static_cast<double>(std::rand() % 600) - 300.0,
+                     static_cast<double>(std::rand() % 600) - 300.0);
+  }
+
+  const auto projections{polyline.FindNearest(queries)};
+  ASSERT_EQ(queries.Size(), projections.size());
+  for (std::size_t i = 0; i < queries.Size(); ++i) {
+    const auto& projection{projections[i]};
+    EXPECT_DOUBLE_EQ(ProjectBruteForce(points, queries.GetPoint(i)),
+                     projection.squared_distance);
+    EXPECT_LE(polyline.GetLength(projection.segment), projection.along);
+    EXPECT_GE(polyline.GetLength(projection.segment + 1U), projection.along);
+  }
+
+  const Polyline2D line({Point2D(0.0, 0.0), Point2D(10.0, 0.0)});
+  const auto projection{line.FindNearest(Point2D(4.0, 3.0))};
+  EXPECT_EQ(Point2D(4.0, 0.0), projection.point);
+  EXPECT_EQ(Distance(4.0), projection.along);
+  EXPECT_EQ(0U, projection.segment);
+  EXPECT_DOUBLE_EQ(9.0, projection.squared_distance);
+
+  const Polyline2D single({Point2D(1.0, 1.0)});
+  EXPECT_DOUBLE_EQ(2.0, single.FindNearest(Point2D()).squared_distance);
+}
+}  // namespace programmers::geometry
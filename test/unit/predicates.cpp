@@ -0,0 +1,73 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/predicates.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
+#include "geometry/exact_arithmetic.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+auto CreateRandomInteger() -> int64_t {
+  return static_cast<int64_t>(std::rand()) - RAND_MAX / 2;
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryPredicates, CalculateOrientation) {
+  EXPECT_EQ(Orientation::kCounterClockwise,
+            CalculateOrientation(Point2D(0.0, 0.0), Point2D(1.0, 0.0),
+                                 Point2D(0.0, 1.0)));
+  EXPECT_EQ(Orientation::kClockwise,
+            CalculateOrientation(Point2D(0.0, 0.0), Point2D(0.0, 1.0),
+                                 Point2D(1.0, 0.0)));
+  EXPECT_EQ(Orientation::kCollinear,
+            CalculateOrientation(Point2D(0.0, 0.0), Point2D(1.0, 1.0),
+                                 Point2D(3.0, 3.0)));
+  EXPECT_EQ(Orientation::kCollinear,
+            CalculateOrientation(Point2D(1.0, 2.0), Point2D(1.0, 2.0),
+                                 Point2D(5.0, -3.0)));
+
+  // Integer coordinates have an exact 128-bit determinant.
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto ax{CreateRandomInteger()};
+    const auto ay{CreateRandomInteger()};
+    const auto bx{CreateRandomInteger()};
+    const auto by{CreateRandomInteger()};
+    // Nearly collinear c, often exactly on the line.
+    const auto t{std::rand() % 5 - 2};
+    const auto cx{ax + t * (bx - ax) + std::rand() % 3 - 1};
+    const auto cy{ay + t * (by - ay) + std::rand() % 3 - 1};
+    const auto determinant{Int128::Multiply(ax - cx, by - cy) -
+                           Int128::Multiply(ay - cy, bx - cx)};
+    const auto expected{determinant.IsNegative() ? Orientation::kClockwise
+                        : determinant == Int128()
+                            ? Orientation::kCollinear
+                            : Orientation::kCounterClockwise};
+    EXPECT_EQ(expected, CalculateOrientation(
+                            static_cast<double>(ax), static_cast<double>(ay),
+                            static_cast<double>(bx), static_cast<double>(by),
+                            static_cast<double>(cx), static_cast<double>(cy)));
+  }
+}
+
+TEST(GeometryPredicates, NearlyCollinear) {
+  // c is i and j ulps away from a on the line y = x through a and b, so the
+  // exact turn is the sign of j - i, which the plain determinant misses.
+  const auto ulp{std::nextafter(0.5, 1.0) - 0.5};
+  for (int i = 0; i < 16; ++i) {
+    for (int j = 0; j < 16; ++j) {
+      const auto expected{j > i   ? Orientation::kCounterClockwise
+                          : j < i ? Orientation::kClockwise
+                                  : Orientation::kCollinear};
+      EXPECT_EQ(expected, CalculateOrientation(0.5 + i * ulp, 0.5 + j * ulp,
+                                               12.0, 12.0, 24.0, 24.0));
+    }
+  }
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,175 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/proximity.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+using programmers::geometry::PointCloud2D;
+using programmers::geometry::PointPair;
+
+auto CreateRandomCloud(std::size_t count, double range) -> PointCloud2D {
+  PointCloud2D cloud;
+  for (std::size_t i = 0; i < count; ++i) {
+    cloud.PushBack({static_cast<double>(std::rand()) / RAND_MAX * range,
+                    static_cast<double>(std::rand()) / RAND_MAX * range});
+  }
+  return cloud;
+}
+
+/**
+ * @brief Create points of step 0.5 in [0, range), exact in every distance
+ */
+auto CreateHalfStepCloud(std::size_t count, int range) -> PointCloud2D {
+  PointCloud2D cloud;
+  for (std::size_t i = 0; i < count; ++i) {
+    cloud.PushBack({static_cast<double>(std::rand() % (2 * range)) / 2.0,
+                    static_cast<double>(std::rand() % (2 * range)) / 2.0});
+  }
+  return cloud;
+}
+
+auto GetSquaredDistance(const PointCloud2D& cloud, std::size_t lhs,
+                        std::size_t rhs) -> double {
+  const auto dx{cloud.GetX(lhs) - cloud.GetX(rhs)};
+  const auto dy{cloud.GetY(lhs) - cloud.GetY(rhs)};
+  return dx * dx + dy * dy;
+}
+
+auto FindPairsBruteForce(const PointCloud2D& cloud, double radius)
+    -> std::vector<std::pair<std::size_t, std::size_t>> {
+  std::vector<std::pair<std::size_t, std::size_t>> pairs;
+  for (std::size_t i = 0; i < cloud.Size(); ++i) {
+    for (auto j = i + 1U; j < cloud.Size(); ++j) {
+      if (GetSquaredDistance(cloud, i, j) <= radius * radius) {
+        pairs.emplace_back(i, j);
+      }
+    }
+  }
+  return pairs;
+}
+
+auto ToSortedPairs(const std::vector<PointPair>& found)
+    -> std::vector<std::pair<std::size_t, std::size_t>> {
+  std::vector<std::pair<std::size_t, std::size_t>> pairs;
+  for (const auto& pair : found) {
+    EXPECT_LT(pair.first, pair.second);
+    pairs.emplace_back(pair.first, pair.second);
+  }
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryProximity, FindClosestPair) {
+  for (const auto range : {100.0, 1.0e-6}) {
+    const auto cloud{CreateRandomCloud(kTestCount, range)};
+    auto expected{GetSquaredDistance(cloud, 0U, 1U)};
+    for (std::size_t i = 0; i < cloud.Size(); ++i) {
+      for (auto j = i + 1U; j < cloud.Size(); ++j) {
+        expected = std::min(expected, GetSquaredDistance(cloud, i, j));
+      }
+    }
+    const auto pair{FindClosestPair(cloud)};
+    EXPECT_LT(pair.first, pair.second);
+    EXPECT_EQ(expected, pair.squared_distance);
+    EXPECT_EQ(expected, GetSquaredDistance(cloud, pair.first, pair.second));
+    EXPECT_EQ(std::sqrt(expected), pair.GetDistance());
+  }
+
+  // Large enough to solve the halves in parallel.
+  auto cloud{CreateRandomCloud(kTestCount * 100U, 1.0e4)};
+  cloud.PushBack({cloud.GetX(123U), cloud.GetY(123U) + 1.0e-9});
+  const auto pair{FindClosestPair(cloud)};
+  EXPECT_EQ(123U, pair.first);
+  EXPECT_EQ(cloud.Size() - 1U, pair.second);
+
+  const auto duplicates{PointCloud2D({{1.0, 1.0}, {3.0, 2.0}, {1.0, 1.0}})};
+  EXPECT_EQ(0.0, FindClosestPair(duplicates).squared_distance);
+  EXPECT_EQ(2U, FindClosestPair(duplicates).second);
+
+  EXPECT_THROW(static_cast<void>(FindClosestPair(PointCloud2D({{1.0, 1.0}}))),
+               std::invalid_argument);
+  EXPECT_THROW(static_cast<void>(
+                   FindClosestPair(PointCloud2D({{1.0, 1.0}, {NAN, 1.0}}))),
+               std::invalid_argument);
+}
+
+TEST(GeometryProximity, FindPairsWithin) {
+  for (const auto radius : {0.0, 1.0, 2.5, 7.0}) {
+    // Half steps put pairs exactly on every radius and stack duplicates.
+    const auto cloud{CreateHalfStepCloud(kTestCount, 20)};
+    const auto expected{FindPairsBruteForce(cloud, radius)};
+
+    std::vector<PointPair> found;
+    const auto count{FindPairsWithin(
+        cloud, radius, [&](const PointPair* pairs, std::size_t size) {
+          found.insert(found.end(), pairs, pairs + size);
+        })};
+    EXPECT_EQ(expected.size(), count);
+    EXPECT_EQ(expected, ToSortedPairs(found));
+    for (const auto& pair : found) {
+      EXPECT_EQ(GetSquaredDistance(cloud, pair.first, pair.second),
+                pair.squared_distance);
+    }
+
+    std::vector<PointPair> buffer(expected.size());
+    EXPECT_EQ(expected.size(),
+              FindPairsWithin(cloud, radius, buffer.data(), buffer.size()));
+    EXPECT_EQ(expected, ToSortedPairs(buffer));
+  }
+
+  const auto cloud{CreateRandomCloud(kTestCount, 100.0)};
+  const auto expected{FindPairsBruteForce(cloud, 5.0)};
+  ASSERT_LT(10U, expected.size());
+  std::vector<PointPair> buffer(10U);
+  EXPECT_EQ(expected.size(),
+            FindPairsWithin(cloud, 5.0, buffer.data(), buffer.size()));
+  for (const auto& pair : buffer) {
+    EXPECT_TRUE(std::binary_search(expected.begin(), expected.end(),
+                                   std::make_pair(pair.first, pair.second)));
+  }
+
+  std::size_t batches{0U};
+  EXPECT_EQ(expected.size(),
+            FindPairsWithin(
+                cloud, Distance(5000.0, Distance::Type::kMillimeter),
+                [&](const PointPair*, std::size_t) { ++batches; }));
+  EXPECT_LE(1U, batches);
+}
+
+TEST(GeometryProximity, FindPairsWithinDense) {
+  // Many batches from one cell and its neighbors.
+  const auto cloud{CreateRandomCloud(kTestCount * 2U, 1.0)};
+  std::size_t total{0U};
+  const auto count{FindPairsWithin(
+      cloud, 0.5, [&](const PointPair* pairs, std::size_t size) {
+        for (std::size_t i = 0; i < size; ++i) {
+          EXPECT_LE(pairs[i].squared_distance, 0.25);
+        }
+        total += size;
+      })};
+  EXPECT_EQ(FindPairsBruteForce(cloud, 0.5).size(), count);
+  EXPECT_EQ(count, total);
+
+  const auto ignore{[](const PointPair*, std::size_t) {}};
+  EXPECT_EQ(0U, FindPairsWithin(PointCloud2D(), 1.0, ignore));
+  EXPECT_THROW(FindPairsWithin(cloud, -1.0, ignore), std::invalid_argument);
+  EXPECT_THROW(FindPairsWithin(cloud, NAN, ignore), std::invalid_argument);
+  EXPECT_THROW(FindPairsWithin(PointCloud2D({{1.0, 1.0}, {INFINITY, 1.0}}),
+                               1.0, ignore),
+               std::invalid_argument);
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,106 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/quantity.hpp"
+
+#include <cstdlib>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+using namespace programmers::geometry::literals;
+
+// Conversions and arithmetic are usable in constant expressions.
+static_assert((5_km).GetValue() == 5.0);
+static_assert(programmers::geometry::Meters(5_km).GetValue() == 5000.0);
+static_assert((2_km).To<programmers::geometry::Distance::Type::kCentimeter>()
+                  .GetValue() == 200000.0);
+static_assert((1.5_m + 2_m).GetValue() == 3.5);
+static_assert(1_km > 999_m);
+static_assert((2.0 * 3_mm / 4.0).GetValue() == 1.5);
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryQuantity, Literal) {
+  EXPECT_DOUBLE_EQ(2038.0, (2038_km).GetValue());
+  EXPECT_DOUBLE_EQ(20.38, (20.38_m).GetValue());
+  EXPECT_DOUBLE_EQ(2038.0, (2038_cm).GetValue());
+  EXPECT_DOUBLE_EQ(2.038, (2.038_mm).GetValue());
+  EXPECT_DOUBLE_EQ(2038.0, (2038_um).GetValue());
+  EXPECT_DOUBLE_EQ(2038.0, (2038_nm).GetValue());
+}
+
+TEST(GeometryQuantity, Convert) {
+  const Meters meters{2038_km};
+  EXPECT_DOUBLE_EQ(2038000.0, meters.GetValue());
+  EXPECT_DOUBLE_EQ(2.038, Kilometers(2038_m).GetValue());
+  EXPECT_DOUBLE_EQ(2038.0e+12, Nanometers(2038_km).GetValue());
+  EXPECT_DOUBLE_EQ(2038.0, (2038_um).To<Distance::Type::kMicrometer>()
+                               .GetValue());
+  EXPECT_TRUE(5_km == 5000_m);
+  EXPECT_TRUE(1_m < 101_cm);
+}
+
+TEST(GeometryQuantity, FromDistance) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const Distance distance(static_cast<double>(std::rand()),
+                            Distance::Type::kMillimeter);
+    EXPECT_DOUBLE_EQ(distance.GetValue(Distance::Type::kKilometer),
+                     Kilometers(distance).GetValue());
+    EXPECT_DOUBLE_EQ(distance.GetValue(Distance::Type::kMeter),
+                     Meters(distance).GetValue());
+    EXPECT_DOUBLE_EQ(distance.GetValue(Distance::Type::kCentimeter),
+                     Centimeters(distance).GetValue());
+    EXPECT_DOUBLE_EQ(distance.GetValue(Distance::Type::kMillimeter),
+                     Millimeters(distance).GetValue());
+    EXPECT_DOUBLE_EQ(distance.GetValue(Distance::Type::kMicrometer),
+                     Micrometers(distance).GetValue());
+    EXPECT_DOUBLE_EQ(distance.GetValue(Distance::Type::kNanometer),
+                     Nanometers(distance).GetValue());
+  }
+}
+
+TEST(GeometryQuantity, ToDistance) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto value{static_cast<double>(std::rand()) / 7.0};
+    EXPECT_EQ(Distance(value, Distance::Type::kKilometer),
+              static_cast<Distance>(Kilometers(value)));
+    EXPECT_EQ(Distance(value, Distance::Type::kMeter),
+              static_cast<Distance>(Meters(value)));
+    EXPECT_EQ(Distance(value, Distance::Type::kCentimeter),
+              static_cast<Distance>(Centimeters(value)));
+    EXPECT_EQ(Distance(value, Distance::Type::kMillimeter),
+              static_cast<Distance>(Millimeters(value)));
+    EXPECT_EQ(Distance(value, Distance::Type::kMicrometer),
+              static_cast<Distance>(Micrometers(value)));
+    EXPECT_EQ(Distance(value, Distance::Type::kNanometer),
+              static_cast<Distance>(Nanometers(value)));
+  }
+
+  // Quantities pass wherever Distance is expected.
+  const Distance distance{2_km};
+  EXPECT_EQ(Distance(2.0, Distance::Type::kKilometer), distance);
+  EXPECT_TRUE(distance == 2000_m);
+  EXPECT_TRUE(distance > 1999_m);
+  EXPECT_EQ(Distance(2.5, Distance::Type::kKilometer), distance + 500_m);
+}
+
+TEST(GeometryQuantity, Operator) {
+  auto quantity{3_km};
+  quantity += 500_m;
+  EXPECT_DOUBLE_EQ(3.5, quantity.GetValue());
+  quantity -= 1_km;
+  EXPECT_DOUBLE_EQ(2.5, quantity.GetValue());
+  EXPECT_DOUBLE_EQ(-2.5, (-quantity).GetValue());
+  EXPECT_DOUBLE_EQ(5.0, (quantity * 2.0).GetValue());
+  EXPECT_DOUBLE_EQ(5.0, (2.0 * quantity).GetValue());
+  EXPECT_DOUBLE_EQ(1.25, (quantity / 2.0).GetValue());
+  EXPECT_DOUBLE_EQ(2.5, quantity / 1000_m);
+  EXPECT_DOUBLE_EQ(1.5, (quantity - 1000_m).GetValue());
+  EXPECT_TRUE(quantity != 2_km);
+  EXPECT_TRUE(quantity <= 2500_m);
+  EXPECT_TRUE(quantity >= 2500_m);
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,93 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/segment2d.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+using programmers::geometry::Point2D;
+
+/**
+ * @brief Cross product of integer points, exact for small coordinates
+ */
+auto Cross(const Point2D& a, const Point2D& b, const Point2D& c) -> int64_t {
+  const auto value{(b.GetX() - a.GetX()) * (c.GetY() - a.GetY()) -
+                   (b.GetY() - a.GetY()) * (c.GetX() - a.GetX())};
+  return static_cast<int64_t>(value);
+}
+
+/**
+ * @brief Check intersection by comparing parameters of integer segments
+ */
+auto IntersectsByCross(const Point2D& a, const Point2D& b, const Point2D& c,
+                       const Point2D& d) -> bool {
+  const auto sign{[](int64_t value) { return (value > 0) - (value < 0); }};
+  const auto d1{sign(Cross(a, b, c))};
+  const auto d2{sign(Cross(a, b, d))};
+  const auto d3{sign(Cross(c, d, a))};
+  const auto d4{sign(Cross(c, d, b))};
+  if (d1 * d2 < 0 && d3 * d4 < 0) {
+    return true;
+  }
+  const auto on{[](const Point2D& p, const Point2D& q, const Point2D& r) {
+    return std::min(p.GetX(), q.GetX()) <= r.GetX() &&
+           r.GetX() <= std::max(p.GetX(), q.GetX()) &&
+           std::min(p.GetY(), q.GetY()) <= r.GetY() &&
+           r.GetY() <= std::max(p.GetY(), q.GetY());
+  }};
+  return (d1 == 0 && on(a, b, c)) || (d2 == 0 && on(a, b, d)) ||
+         (d3 == 0 && on(c, d, a)) || (d4 == 0 && on(c, d, b));
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometrySegment2D, Construct) {
+  const Segment2D origin;
+  EXPECT_EQ(Point2D(0.0, 0.0), origin.GetStart());
+  EXPECT_EQ(Point2D(0.0, 0.0), origin.GetEnd());
+
+  const Segment2D segment({4.0, -1.0}, {1.0, 3.0});
+  EXPECT_EQ(Point2D(4.0, -1.0), segment.GetStart());
+  EXPECT_EQ(Point2D(1.0, 3.0), segment.GetEnd());
+  EXPECT_DOUBLE_EQ(5.0, segment.CalculateLength());
+  EXPECT_EQ(Point2D(1.0, -1.0), segment.GetBoundingBox().GetMinimum());
+  EXPECT_EQ(Point2D(4.0, 3.0), segment.GetBoundingBox().GetMaximum());
+  EXPECT_EQ(segment, Segment2D({4.0, -1.0}, {1.0, 3.0}));
+  EXPECT_NE(segment, Segment2D({1.0, 3.0}, {4.0, -1.0}));
+}
+
+TEST(GeometrySegment2D, Intersects) {
+  const Segment2D segment({0.0, 0.0}, {4.0, 4.0});
+  // Crossing, touching at an end, an end inside, and collinear overlap.
+  EXPECT_TRUE(segment.Intersects({{0.0, 4.0}, {4.0, 0.0}}));
+  EXPECT_TRUE(segment.Intersects({{4.0, 4.0}, {5.0, 0.0}}));
+  EXPECT_TRUE(segment.Intersects({{2.0, 2.0}, {3.0, 0.0}}));
+  EXPECT_TRUE(segment.Intersects({{3.0, 3.0}, {6.0, 6.0}}));
+  EXPECT_TRUE(segment.Intersects({{1.0, 1.0}, {1.0, 1.0}}));
+  // Collinear apart, parallel, and crossing the line beyond the end.
+  EXPECT_FALSE(segment.Intersects({{5.0, 5.0}, {6.0, 6.0}}));
+  EXPECT_FALSE(segment.Intersects({{0.0, 1.0}, {4.0, 5.0}}));
+  EXPECT_FALSE(segment.Intersects({{5.0, 0.0}, {6.0, 7.0}}));
+  EXPECT_FALSE(segment.Intersects({{1.0, 0.0}, {1.0, 0.0}}));
+
+  for (uint32_t i = 0; i < kTestCount * 10U; ++i) {
+    const auto random{[]() {
+      return Point2D(std::rand() % 7, std::rand() % 7);
+    }};
+    const auto a{random()};
+    const auto b{random()};
+    const auto c{random()};
+    const auto d{random()};
+    const auto expected{IntersectsByCross(a, b, c, d)};
+    EXPECT_EQ(expected, Segment2D(a, b).Intersects({c, d}));
+    EXPECT_EQ(expected, Segment2D(d, c).Intersects({b, a}));
+  }
+}
+}  // namespace programmers::geometry
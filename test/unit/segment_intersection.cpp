@@ -0,0 +1,162 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/segment_intersection.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+using programmers::geometry::Point2D;
+using programmers::geometry::Segment2D;
+using programmers::geometry::SegmentIntersectionOptions;
+using Pairs = std::vector<std::pair<std::size_t, std::size_t>>;
+
+/**
+ * @brief Create short integer segments that often touch and overlap
+ */
+auto CreateSegments(std::size_t count, int range) -> std::vector<Segment2D> {
+  std::vector<Segment2D> segments;
+  for (std::size_t i = 0; i < count; ++i) {
+    const Point2D start(std::rand() % range, std::rand() % range);
+    const Point2D offset(std::rand() % 9 - 4, std::rand() % 9 - 4);
+    segments.emplace_back(start, start + offset);
+  }
+  // A few long ones crossing many cells.
+  for (std::size_t i = 0; i < count / 100U; ++i) {
+    segments.emplace_back(Point2D(std::rand() % range, std::rand() % range),
+                          Point2D(std::rand() % range, std::rand() % range));
+  }
+  return segments;
+}
+
+auto FindBruteForce(const std::vector<Segment2D>& segments) -> Pairs {
+  Pairs pairs;
+  for (std::size_t i = 0; i < segments.size(); ++i) {
+    for (std::size_t j = i + 1U; j < segments.size(); ++j) {
+      if (segments[i].Intersects(segments[j])) {
+        pairs.emplace_back(i, j);
+      }
+    }
+  }
+  return pairs;
+}
+
+auto FindSorted(const std::vector<Segment2D>& segments,
+                const SegmentIntersectionOptions& options = {}) -> Pairs {
+  Pairs pairs;
+  const auto count{programmers::geometry::FindIntersections(
+      segments,
+      [&](const programmers::geometry::SegmentPair* batch,
+          std::size_t size) {
+        for (std::size_t i = 0; i < size; ++i) {
+          pairs.emplace_back(batch[i].first, batch[i].second);
+        }
+      },
+      options)};
+  EXPECT_EQ(pairs.size(), count);
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+auto ShareEnd(const Segment2D& lhs, const Segment2D& rhs) -> bool {
+  return lhs.GetStart() == rhs.GetStart() || lhs.GetStart() == rhs.GetEnd() ||
+         lhs.GetEnd() == rhs.GetStart() || lhs.GetEnd() == rhs.GetEnd();
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometrySegmentIntersection, FindIntersections) {
+  EXPECT_TRUE(FindSorted({}).empty());
+  EXPECT_FALSE(HasIntersection({}));
+  EXPECT_THROW(
+      static_cast<void>(HasIntersection(
+          {{{0.0, 0.0}, {std::numeric_limits<double>::quiet_NaN(), 1.0}}})),
+      std::invalid_argument);
+
+  for (const std::size_t count : {1U, 10U, 100U, 3000U}) {
+    const auto segments{CreateSegments(count, 200)};
+    const auto expected{FindBruteForce(segments)};
+    EXPECT_EQ(expected, FindSorted(segments));
+    EXPECT_EQ(!expected.empty(), HasIntersection(segments));
+
+    // Skipping shared ends only drops pairs that have one.
+    SegmentIntersectionOptions options;
+    options.ignore_shared_ends = true;
+    const auto skipped{FindSorted(segments, options)};
+    EXPECT_TRUE(std::includes(expected.begin(), expected.end(),
+                              skipped.begin(), skipped.end()));
+    for (const auto& [i, j] : expected) {
+      if (!ShareEnd(segments[i], segments[j])) {
+        EXPECT_TRUE(std::binary_search(skipped.begin(), skipped.end(),
+                                       std::make_pair(i, j)));
+      }
+    }
+    EXPECT_EQ(!skipped.empty(), HasIntersection(segments, options));
+  }
+}
+
+TEST(GeometrySegmentIntersection, LongDiagonals) {
+  // Segments spanning the whole extent cross a row or a column of cells,
+  // not every cell, and each crossing is still reported once.
+  constexpr int kRange{400};
+  auto segments{CreateSegments(kTestCount * 2U, kRange)};
+  const std::vector<Segment2D> diagonals{
+      {{0.0, 0.0}, {kRange, kRange}},
+      {{kRange, 0.0}, {0.0, kRange}},
+      {{0.0, 0.5}, {kRange, kRange + 0.5}},
+      {{kRange, kRange}, {kRange / 2.0, kRange / 2.0}},
+      {{0.0, kRange / 2.0}, {kRange, kRange / 2.0}},
+      {{kRange / 3.0, -1.0}, {kRange / 3.0, kRange}},
+      {{0.1, 0.3}, {kRange - 0.7, kRange - 0.2}},
+      {{-1.0, kRange * 0.9}, {kRange + 1.0, kRange * 0.1}}};
+  segments.insert(segments.end(), diagonals.begin(), diagonals.end());
+  const auto expected{FindBruteForce(segments)};
+  EXPECT_EQ(expected, FindSorted(segments));
+  EXPECT_TRUE(HasIntersection(segments));
+  EXPECT_EQ(FindBruteForce(diagonals), FindSorted(diagonals));
+}
+
+TEST(GeometrySegmentIntersection, SharedEnds) {
+  SegmentIntersectionOptions options;
+  options.ignore_shared_ends = true;
+
+  // A zigzag line meets its neighbors only at their shared ends.
+  std::vector<Segment2D> line;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    line.emplace_back(Point2D(i, i % 2U), Point2D(i + 1U, (i + 1U) % 2U));
+  }
+  EXPECT_EQ(kTestCount - 1U, FindSorted(line).size());
+  EXPECT_TRUE(FindSorted(line, options).empty());
+  EXPECT_FALSE(HasIntersection(line, options));
+
+  // Folding back over the last segment, continuing straight, a degenerate
+  // segment at an end, a reversed copy and an end inside a segment.
+  const Point2D last(kTestCount, kTestCount % 2U);
+  const Point2D before(kTestCount - 1U, (kTestCount - 1U) % 2U);
+  const auto direction{last - before};
+  const std::vector<Segment2D> cases{
+      {last, before + direction * 0.5},
+      {last, last + direction},
+      {last, last},
+      {last, before},
+      {before + direction * 0.5, Point2D(0.0, 10.0)}};
+  const std::vector<bool> reported{true, false, false, true, true};
+  for (std::size_t i = 0; i < cases.size(); ++i) {
+    auto segments{line};
+    segments.push_back(cases[i]);
+    EXPECT_EQ(reported[i], HasIntersection(segments, options)) << i;
+    EXPECT_TRUE(HasIntersection(segments)) << i;
+  }
+}
+}  // namespace programmers::geometry
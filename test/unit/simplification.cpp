@@ -0,0 +1,218 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/simplification.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+using programmers::geometry::Point2D;
+
+auto CreateRandomTrajectory(uint32_t count) -> std::vector<Point2D> {
+  std::vector<Point2D> points;
+  double x{0.0};
+  double y{0.0};
+  for (uint32_t i = 0; i < count; ++i) {
+    points.emplace_back(x, y);
+    x += static_cast<double>(std::rand() % 2001 - 1000) / 100.0;
+    y += static_cast<double>(std::rand() % 2001 - 1000) / 100.0;
+  }
+  return points;
+}
+
+auto GetSegmentDistance(const Point2D& point, const Point2D& start,
+                        const Point2D& end) -> double {
+  const auto dx{end.GetX() - start.GetX()};
+  const auto dy{end.GetY() - start.GetY()};
+  const auto squared_length{dx * dx + dy * dy};
+  auto ratio{squared_length > 0.0 ? ((point.GetX() - start.GetX()) * dx +
+                                     (point.GetY() - start.GetY()) * dy) /
+                                        squared_length
+                                  : 0.0};
+  ratio = std::fmin(std::fmax(ratio, 0.0), 1.0);
+  return point.CalculateDistance(
+      Point2D(start.GetX() + dx * ratio, start.GetY() + dy * ratio));
+}
+
+// Textbook recursion to compare the iterative parallel version against.
+auto MarkRecursive(const std::vector<Point2D>& points, std::size_t first,
+                   std::size_t last, double tolerance,
+                   std::vector<bool>& keep) -> void {
+  if (last - first < 2U) {
+    return;
+  }
+  auto farthest{first};
+  auto farthest_distance{-1.0};
+  for (auto i = first + 1U; i < last; ++i) {
+    const auto distance{
+        GetSegmentDistance(points[i], points[first], points[last])};
+    if (distance > farthest_distance) {
+      farthest = i;
+      farthest_distance = distance;
+    }
+  }
+  if (farthest_distance <= tolerance) {
+    return;
+  }
+  keep[farthest] = true;
+  MarkRecursive(points, first, farthest, tolerance, keep);
+  MarkRecursive(points, farthest, last, tolerance, keep);
+}
+
+/**
+ * @brief Check that every vertex between two kept ones is within tolerance
+ */
+auto ExpectWithinTolerance(const std::vector<Point2D>& points,
+                           const std::vector<std::size_t>& indices,
+                           double tolerance) -> void {
+  for (std::size_t k = 0; k + 1U < indices.size(); ++k) {
+    for (auto i = indices[k] + 1U; i < indices[k + 1U]; ++i) {
+      EXPECT_LE(GetSegmentDistance(points[i], points[indices[k]],
+                                   points[indices[k + 1U]]),
+                tolerance + 1.0e-9);
+    }
+  }
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometrySimplification, Degenerate) {
+  const Distance tolerance(1.0, Distance::Type::kMeter);
+  EXPECT_TRUE(ComputeDouglasPeucker({}, tolerance).empty());
+  EXPECT_EQ(std::vector<std::size_t>({0U}),
+            ComputeDouglasPeucker({Point2D(1.0, 2.0)}, tolerance));
+  EXPECT_EQ(std::vector<std::size_t>({0U, 1U}),
+            ComputeVisvalingamWhyatt({Point2D(), Point2D(1.0, 2.0)},
+                                     tolerance));
+  EXPECT_THROW(
+      static_cast<void>(ComputeDouglasPeucker(
+          {}, Distance::FromNanometer(-1))),
+      std::invalid_argument);
+  EXPECT_THROW(StreamingSimplifier(Distance::FromNanometer(-1)),
+               std::invalid_argument);
+  EXPECT_THROW(StreamingSimplifier(tolerance, Distance::Type::kMeter, 0U),
+               std::invalid_argument);
+}
+
+TEST(GeometrySimplification, StraightLine) {
+  std::vector<Point2D> points;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    points.emplace_back(static_cast<double>(i), 2.0 * i);
+  }
+  const Distance tolerance(1.0, Distance::Type::kMillimeter);
+  const std::vector<std::size_t> endpoints{0U, kTestCount - 1U};
+  EXPECT_EQ(endpoints, ComputeDouglasPeucker(points, tolerance));
+  EXPECT_EQ(endpoints, ComputeVisvalingamWhyatt(points, tolerance));
+
+  StreamingSimplifier simplifier(tolerance);
+  std::vector<Point2D> output;
+  for (const auto& point : points) {
+    simplifier.Push(point, output);
+  }
+  simplifier.Flush(output);
+  EXPECT_EQ(std::vector<Point2D>({points.front(), points.back()}), output);
+
+  // A square corner is kept by both, and the unit scales the tolerance.
+  const std::vector<Point2D> corner{Point2D(0.0, 0.0), Point2D(5.0, 0.0),
+                                    Point2D(5.0, 5.0)};
+  EXPECT_EQ(3U, SimplifyDouglasPeucker(corner, tolerance).size());
+  EXPECT_EQ(2U, SimplifyDouglasPeucker(corner, tolerance,
+                                       Distance::Type::kNanometer)
+                    .size());
+  EXPECT_EQ(3U, SimplifyVisvalingamWhyatt(corner, tolerance).size());
+}
+
+TEST(GeometrySimplification, DouglasPeucker) {
+  // Large enough that the ranges are split across threads.
+  const auto points{CreateRandomTrajectory(1U << 17U)};
+  for (const auto meter : {0.5, 5.0, 50.0}) {
+    const Distance tolerance(meter, Distance::Type::kMeter);
+    const auto indices{ComputeDouglasPeucker(points, tolerance)};
+
+    std::vector<bool> keep(points.size(), false);
+    keep.front() = true;
+    keep.back() = true;
+    MarkRecursive(points, 0U, points.size() - 1U, meter, keep);
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < keep.size(); ++i) {
+      if (keep[i]) {
+        expected.push_back(i);
+      }
+    }
+    EXPECT_EQ(expected, indices);
+    ExpectWithinTolerance(points, indices, meter);
+  }
+}
+
+TEST(GeometrySimplification, VisvalingamWhyatt) {
+  const auto points{CreateRandomTrajectory(kTestCount)};
+  std::size_t previous_size{points.size()};
+  for (const auto meter : {0.0, 1.0, 4.0, 16.0}) {
+    const Distance tolerance(meter, Distance::Type::kMeter);
+    const auto indices{ComputeVisvalingamWhyatt(points, tolerance)};
+    EXPECT_EQ(0U, indices.front());
+    EXPECT_EQ(points.size() - 1U, indices.back());
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+    EXPECT_LE(indices.size(), previous_size);
+    previous_size = indices.size();
+
+    // Every interior survivor spans at least the threshold area.
+    for (std::size_t k = 1; k + 1U < indices.size(); ++k) {
+      const auto& lhs{points[indices[k - 1U]]};
+      const auto& middle{points[indices[k]]};
+      const auto& rhs{points[indices[k + 1U]]};
+      const auto area{std::abs((lhs.GetX() - rhs.GetX()) *
+                                   (middle.GetY() - lhs.GetY()) -
+                               (lhs.GetX() - middle.GetX()) *
+                                   (rhs.GetY() - lhs.GetY())) /
+                      2.0};
+      EXPECT_GE(area, meter * meter * (1.0 - 1.0e-12));
+    }
+  }
+}
+
+TEST(GeometrySimplification, Streaming) {
+  const auto points{CreateRandomTrajectory(kTestCount * 10U)};
+  for (const std::size_t window : {1U, 16U, 1024U}) {
+    const auto meter{5.0};
+    StreamingSimplifier simplifier(Distance(meter, Distance::Type::kMeter),
+                                   Distance::Type::kMeter, window);
+    std::vector<Point2D> output;
+    for (const auto& point : points) {
+      simplifier.Push(point, output);
+      EXPECT_LE(simplifier.GetPendingCount(), window);
+    }
+    simplifier.Flush(output);
+    EXPECT_EQ(0U, simplifier.GetPendingCount());
+    // The last pending vertex is the candidate end, so one drops nothing.
+    if (window == 1U) {
+      EXPECT_EQ(points, output);
+    } else {
+      EXPECT_LT(output.size(), points.size());
+    }
+
+    // The output is a subsequence and covers every dropped vertex.
+    std::vector<std::size_t> indices;
+    std::size_t i{0U};
+    for (const auto& point : output) {
+      while (i < points.size() && !(points[i] == point)) {
+        ++i;
+      }
+      ASSERT_LT(i, points.size());
+      indices.push_back(i++);
+    }
+    EXPECT_EQ(0U, indices.front());
+    EXPECT_EQ(points.size() - 1U, indices.back());
+    ExpectWithinTolerance(points, indices, meter);
+  }
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,174 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/space_filling_curve.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "geometry/kernels.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+auto CreateRandomCell() -> uint32_t {
+  return (static_cast<uint32_t>(std::rand()) << 16U) ^
+         static_cast<uint32_t>(std::rand());
+}
+
+auto CreateRandomPoints(uint32_t count)
+    -> std::vector<programmers::geometry::Point2D> {
+  std::vector<programmers::geometry::Point2D> points;
+  for (uint32_t i = 0; i < count; ++i) {
+    points.emplace_back(static_cast<double>(std::rand()),
+                        static_cast<double>(std::rand()));
+  }
+  return points;
+}
+
+auto GetAllIsa() -> std::vector<programmers::geometry::kernels::Isa> {
+  using programmers::geometry::kernels::Isa;
+  return {Isa::kScalar, Isa::kSse2, Isa::kAvx2, Isa::kAvx512};
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometrySpaceFillingCurve, EncodeMorton) {
+  EXPECT_EQ(0U, EncodeMorton(0U, 0U));
+  EXPECT_EQ(1U, EncodeMorton(1U, 0U));
+  EXPECT_EQ(2U, EncodeMorton(0U, 1U));
+  EXPECT_EQ(0xFFFFFFFFFFFFFFFFULL, EncodeMorton(0xFFFFFFFFU, 0xFFFFFFFFU));
+  EXPECT_EQ(0x5555555555555555ULL, EncodeMorton(0xFFFFFFFFU, 0U));
+
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto x = CreateRandomCell();
+    const auto y = CreateRandomCell();
+    EXPECT_EQ(std::make_pair(x, y), DecodeMorton(EncodeMorton(x, y)));
+  }
+}
+
+TEST(GeometrySpaceFillingCurve, EncodeHilbert) {
+  // The first levels of the key must walk the grid one edge at a time.
+  constexpr uint32_t kLevels = 5U;
+  constexpr uint32_t kSide = 1U << kLevels;
+  std::map<uint64_t, std::pair<uint32_t, uint32_t>> cells;
+  for (uint32_t x = 0; x < kSide; ++x) {
+    for (uint32_t y = 0; y < kSide; ++y) {
+      const auto key =
+          EncodeHilbert(x << (32U - kLevels), y << (32U - kLevels));
+      cells.emplace(key >> (64U - 2U * kLevels), std::make_pair(x, y));
+    }
+  }
+  ASSERT_EQ(kSide * kSide, cells.size());
+  EXPECT_EQ(0U, cells.begin()->first);
+  EXPECT_EQ(kSide * kSide - 1U, cells.rbegin()->first);
+  for (auto it = std::next(cells.begin()); it != cells.end(); ++it) {
+    const auto [x0, y0] = std::prev(it)->second;
+    const auto [x1, y1] = it->second;
+    EXPECT_EQ(1, std::abs(static_cast<int>(x0) - static_cast<int>(x1)) +
+                     std::abs(static_cast<int>(y0) - static_cast<int>(y1)));
+  }
+  EXPECT_EQ(0U, EncodeHilbert(0U, 0U));
+}
+
+TEST(GeometrySpaceFillingCurve, KernelsAgree) {
+  std::vector<uint32_t> xs;
+  std::vector<uint32_t> ys;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    xs.push_back(CreateRandomCell());
+    ys.push_back(CreateRandomCell());
+  }
+  std::vector<uint64_t> expected_morton(kTestCount);
+  std::vector<uint64_t> expected_hilbert(kTestCount);
+  kernels::SetActiveIsa(kernels::Isa::kScalar);
+  kernels::EncodeMorton(xs.data(), ys.data(), kTestCount,
+                        expected_morton.data());
+  kernels::EncodeHilbert(xs.data(), ys.data(), kTestCount,
+                         expected_hilbert.data());
+
+  for (const auto isa : GetAllIsa()) {
+    SCOPED_TRACE(kernels::GetIsaName(kernels::SetActiveIsa(isa)));
+    std::vector<uint64_t> morton(kTestCount);
+    std::vector<uint64_t> hilbert(kTestCount);
+    kernels::EncodeMorton(xs.data(), ys.data(), kTestCount, morton.data());
+    kernels::EncodeHilbert(xs.data(), ys.data(), kTestCount, hilbert.data());
+    EXPECT_EQ(expected_morton, morton);
+    EXPECT_EQ(expected_hilbert, hilbert);
+  }
+  kernels::ResetActiveIsa();
+}
+
+TEST(GeometrySpaceFillingCurve, CurveQuantizer) {
+  const CurveQuantizer quantizer(Point2D(-10.0, 0.0), Point2D(10.0, 5.0));
+  EXPECT_EQ(std::make_pair(0U, 0U), quantizer.Quantize(Point2D(-10.0, 0.0)));
+  EXPECT_EQ(std::make_pair(0xFFFFFFFFU, 0x3FFFFFFFU),
+            quantizer.Quantize(Point2D(10.0, 5.0)));
+  EXPECT_EQ(std::make_pair(0U, 0xFFFFFFFFU),
+            quantizer.Quantize(Point2D(-20.0, 100.0)));
+
+  const PointCloud2D cloud(
+      std::vector<Point2D>{Point2D(1.0, 1.0), Point2D(3.0, 2.0)});
+  EXPECT_EQ(std::make_pair(0xFFFFFFFFU, 0x7FFFFFFFU),
+            CurveQuantizer(cloud).Quantize(Point2D(3.0, 2.0)));
+
+  EXPECT_THROW(CurveQuantizer(Point2D(1.0, 0.0), Point2D(0.0, 1.0)),
+               std::invalid_argument);
+}
+
+TEST(GeometrySpaceFillingCurve, SortByKey) {
+  for (const auto count : {0U, 1U, kTestCount, kTestCount * 200U}) {
+    std::vector<uint64_t> keys;
+    for (uint32_t i = 0; i < count; ++i) {
+      keys.push_back((static_cast<uint64_t>(CreateRandomCell()) << 32U) |
+                     static_cast<uint64_t>(std::rand() % 16));
+    }
+    const auto order = SortByKey(keys);
+
+    std::vector<uint32_t> expected(count);
+    std::iota(expected.begin(), expected.end(), 0U);
+    std::stable_sort(
+        expected.begin(), expected.end(),
+        [&](uint32_t lhs, uint32_t rhs) { return keys[lhs] < keys[rhs]; });
+    EXPECT_EQ(expected, order);
+  }
+}
+
+TEST(GeometrySpaceFillingCurve, ReorderAlongCurve) {
+  const auto points = CreateRandomPoints(kTestCount);
+  std::vector<std::string> payload;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    payload.push_back(std::to_string(i));
+  }
+
+  for (const auto curve :
+       {SpaceFillingCurve::kMorton, SpaceFillingCurve::kHilbert}) {
+    PointCloud2D cloud(points);
+    auto moved_payload = payload;
+    const auto order = ReorderAlongCurve(cloud, moved_payload, curve);
+
+    const auto keys = ComputeCurveKeys(cloud, CurveQuantizer(cloud), curve);
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      EXPECT_EQ(points[order[i]], cloud.GetPoint(i));
+      EXPECT_EQ(payload[order[i]], moved_payload[i]);
+    }
+
+    auto vector_points = points;
+    EXPECT_EQ(order, ReorderAlongCurve(vector_points, curve));
+    EXPECT_EQ(cloud.ToPoints(), vector_points);
+  }
+
+  PointCloud2D cloud(points);
+  payload.pop_back();
+  EXPECT_THROW(ReorderAlongCurve(cloud, payload), std::invalid_argument);
+}
+}  // namespace programmers::geometry
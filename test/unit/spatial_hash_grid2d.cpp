@@ -0,0 +1,160 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/spatial_hash_grid2d.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+auto CreateRandomPoint() -> programmers::geometry::Point2D {
+  return {static_cast<double>(std::rand() % 1000) - 500.0,
+          static_cast<double>(std::rand() % 1000) - 500.0};
+}
+
+auto SortedHandles(const std::vector<programmers::geometry::Neighbor>& items)
+    -> std::vector<std::size_t> {
+  std::vector<std::size_t> handles;
+  for (const auto& item : items) {
+    handles.push_back(item.index);
+  }
+  std::sort(handles.begin(), handles.end());
+  return handles;
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometrySpatialHashGrid2D, Constructor) {
+  SpatialHashGrid2D grid(Distance(50.0, Distance::Type::kCentimeter));
+  EXPECT_TRUE(grid.Empty());
+  EXPECT_DOUBLE_EQ(0.5, grid.GetCellSize());
+
+  SpatialHashGrid2D grid_in_cm(Distance(1.0, Distance::Type::kMeter),
+                               Distance::Type::kCentimeter);
+  EXPECT_DOUBLE_EQ(100.0, grid_in_cm.GetCellSize());
+
+  EXPECT_THROW(SpatialHashGrid2D(Distance(0.0)), std::invalid_argument);
+  EXPECT_THROW(SpatialHashGrid2D(Distance(-1.0)), std::invalid_argument);
+}
+
+TEST(GeometrySpatialHashGrid2D, InsertMoveRemove) {
+  SpatialHashGrid2D grid(Distance(10.0));
+  const auto first = grid.Insert(Point2D(1.0, 2.0));
+  const auto second = grid.Insert(Point2D(-30.0, 40.0));
+
+  EXPECT_EQ(2U, grid.Size());
+  EXPECT_EQ(Point2D(1.0, 2.0), grid.GetPoint(first));
+
+  grid.Move(first, Point2D(3.0, 4.0));
+  EXPECT_EQ(Point2D(3.0, 4.0), grid.GetPoint(first));
+  grid.Move(first, Point2D(300.0, -400.0));
+  EXPECT_EQ(Point2D(300.0, -400.0), grid.GetPoint(first));
+
+  grid.Remove(second);
+  EXPECT_FALSE(grid.Contains(second));
+  EXPECT_EQ(1U, grid.Size());
+  EXPECT_EQ(second, grid.Insert(Point2D(5.0, 5.0)));
+
+  EXPECT_THROW(grid.Remove(SpatialHashGrid2D::kInvalidHandle),
+               std::out_of_range);
+  EXPECT_THROW(static_cast<void>(grid.GetPoint(kTestCount)),
+               std::out_of_range);
+  const auto kNan = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_THROW(grid.Move(first, Point2D(kNan, 0.0)), std::invalid_argument);
+  EXPECT_THROW(grid.Insert(Point2D(std::numeric_limits<double>::infinity(),
+                                   0.0)),
+               std::invalid_argument);
+
+  grid.Clear();
+  EXPECT_TRUE(grid.Empty());
+  EXPECT_FALSE(grid.Contains(first));
+}
+
+TEST(GeometrySpatialHashGrid2D, FindWithinRadius) {
+  SpatialHashGrid2D grid(Distance(25.0));
+  std::vector<Point2D> points;
+  std::vector<SpatialHashGrid2D::Handle> handles;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    points.push_back(CreateRandomPoint());
+    handles.push_back(grid.Insert(points.back()));
+  }
+  // Churn the grid so the results cover moved, removed and recycled points.
+  for (uint32_t i = 0; i < kTestCount; i += 3U) {
+    points[i] = CreateRandomPoint();
+    grid.Move(handles[i], points[i]);
+  }
+  for (uint32_t i = 1; i < kTestCount; i += 7U) {
+    grid.Remove(handles[i]);
+    points[i] = CreateRandomPoint();
+    handles[i] = grid.Insert(points[i]);
+  }
+
+  for (const auto radius : {0.0, 12.5, 60.0, 2000.0}) {
+    const auto query = CreateRandomPoint();
+    std::vector<std::size_t> expected;
+    for (uint32_t i = 0; i < kTestCount; ++i) {
+      if (points[i].IsWithinRadius(query, radius)) {
+        expected.push_back(handles[i]);
+      }
+    }
+    std::sort(expected.begin(), expected.end());
+
+    const auto found = grid.FindWithinRadius(query, radius);
+    EXPECT_EQ(expected, SortedHandles(found));
+    for (const auto& neighbor : found) {
+      EXPECT_DOUBLE_EQ(
+          grid.GetPoint(static_cast<SpatialHashGrid2D::Handle>(neighbor.index))
+              .CalculateSquaredDistance(query),
+          neighbor.squared_distance);
+    }
+    EXPECT_EQ(expected, SortedHandles(grid.FindWithinRadius(
+                            query, Distance(radius * 1.0e+2,
+                                            Distance::Type::kCentimeter))));
+  }
+  EXPECT_TRUE(grid.FindWithinRadius(Point2D(), -1.0).empty());
+  EXPECT_TRUE(grid.FindWithinRadius(Point2D(std::nan(""), 0.0), 60.0).empty());
+  const Point2D infinite(0.0, -std::numeric_limits<double>::infinity());
+  EXPECT_TRUE(grid.FindWithinRadius(infinite, 60.0).empty());
+}
+
+TEST(GeometrySpatialHashGrid2D, FindNearest) {
+  SpatialHashGrid2D grid(Distance(5.0));
+  std::vector<Point2D> points;
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    points.push_back(CreateRandomPoint());
+    grid.Insert(points.back());
+  }
+
+  std::vector<Neighbor> found;
+  for (const auto k : {1U, 8U, 64U}) {
+    const auto query = CreateRandomPoint();
+    std::vector<double> expected;
+    for (const auto& point : points) {
+      expected.push_back(point.CalculateSquaredDistance(query));
+    }
+    std::sort(expected.begin(), expected.end());
+
+    grid.FindNearest(query, k, found);
+    ASSERT_EQ(k, found.size());
+    for (uint32_t i = 0; i < k; ++i) {
+      EXPECT_DOUBLE_EQ(expected[i], found[i].squared_distance);
+    }
+  }
+
+  const auto far_query = Point2D(1.0e+6, -1.0e+6);
+  EXPECT_EQ(kTestCount, grid.FindNearest(far_query, kTestCount * 2U).size());
+  EXPECT_TRUE(grid.FindNearest(far_query, 0U).empty());
+  EXPECT_TRUE(grid.FindNearest(Point2D(0.0, std::nan("")), 1U).empty());
+  EXPECT_TRUE(
+      SpatialHashGrid2D(Distance(1.0)).FindNearest(Point2D(), 1U).empty());
+}
+}  // namespace programmers::geometry
@@ -0,0 +1,180 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/spatial_join.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+
+using programmers::geometry::PointCloud2D;
+using programmers::geometry::PointPair;
+using Pairs = std::vector<std::tuple<std::size_t, std::size_t, double>>;
+
+auto CreateGridCloud(std::size_t count, int range) -> PointCloud2D {
+  PointCloud2D cloud;
+  for (std::size_t i = 0; i < count; ++i) {
+    cloud.PushBack({static_cast<double>(std::rand() % range),
+                    static_cast<double>(std::rand() % range)});
+  }
+  return cloud;
+}
+
+auto GetSquaredDistance(const PointCloud2D& left, std::size_t i,
+                        const PointCloud2D& right, std::size_t j) -> double {
+  const auto dx{left.GetX(i) - right.GetX(j)};
+  const auto dy{left.GetY(i) - right.GetY(j)};
+  return dx * dx + dy * dy;
+}
+
+auto JoinBruteForce(const PointCloud2D& left, const PointCloud2D& right,
+                    double radius) -> Pairs {
+  Pairs pairs;
+  for (std::size_t i = 0; i < left.Size(); ++i) {
+    for (std::size_t j = 0; j < right.Size(); ++j) {
+      const auto squared_distance{GetSquaredDistance(left, i, right, j)};
+      if (squared_distance <= radius * radius) {
+        pairs.emplace_back(i, j, squared_distance);
+      }
+    }
+  }
+  return pairs;
+}
+
+auto CollectPairs(Pairs& pairs) -> programmers::geometry::PairCallback {
+  return [&pairs](const PointPair* found, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+      pairs.emplace_back(found[i].first, found[i].second,
+                         found[i].squared_distance);
+    }
+  };
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometrySpatialJoin, JoinWithin) {
+  const auto left{CreateGridCloud(kTestCount, 100)};
+  const auto right{CreateGridCloud(kTestCount / 4U, 100)};
+  for (const auto radius : {0.0, 1.0, 5.0, 30.0}) {
+    const auto expected{JoinBruteForce(left, right, radius)};
+    // No limit, then limits forcing a few strips and the most strips.
+    for (const std::size_t memory_limit : {0U, 40000U, 1U}) {
+      SpatialJoinOptions options;
+      options.memory_limit = memory_limit;
+      Pairs pairs;
+      EXPECT_EQ(expected.size(), JoinWithin(left, right, radius,
+                                            CollectPairs(pairs), options));
+      std::sort(pairs.begin(), pairs.end());
+      EXPECT_EQ(expected, pairs);
+    }
+  }
+
+  // Points on one vertical line share one x bin and are cut along y, and
+  // coincident points cannot be cut at all and are joined in blocks.
+  PointCloud2D line;
+  for (std::size_t i = 0; i < kTestCount; ++i) {
+    line.PushBack({7.0, static_cast<double>(std::rand() % 1000)});
+  }
+  const PointCloud2D coincident(kTestCount / 10U);
+  for (const auto& [lhs, rhs, radius] :
+       {std::make_tuple(line, left, 5.0), std::make_tuple(line, line, 2.0),
+        std::make_tuple(coincident, coincident, 0.0)}) {
+    const auto expected{JoinBruteForce(lhs, rhs, radius)};
+    for (const std::size_t memory_limit : {6400U, 1U}) {
+      SpatialJoinOptions options;
+      options.memory_limit = memory_limit;
+      Pairs pairs;
+      EXPECT_EQ(expected.size(), JoinWithin(lhs, rhs, radius,
+                                            CollectPairs(pairs), options));
+      std::sort(pairs.begin(), pairs.end());
+      EXPECT_EQ(expected, pairs);
+    }
+  }
+
+  Pairs pairs;
+  EXPECT_EQ(JoinBruteForce(left, right, 5.0).size(),
+            JoinWithin(left, right,
+                       Distance(0.5, Distance::Type::kCentimeter),
+                       CollectPairs(pairs), Distance::Type::kMillimeter));
+  EXPECT_EQ(0U, JoinWithin(left, PointCloud2D(), 1.0, CollectPairs(pairs)));
+
+  // A mapped point file joins without loading it.
+  const auto path{(std::filesystem::temp_directory_path() /
+                   "geometry_spatial_join.bin")
+                      .string()};
+  WritePointFile(path, right);
+  {
+    const PointFileReader reader(path);
+    pairs.clear();
+    EXPECT_EQ(JoinBruteForce(left, right, 5.0).size(),
+              JoinWithin(left, reader, 5.0, CollectPairs(pairs)));
+  }
+  std::remove(path.c_str());
+
+  const PointCloud2D invalid({{1.0, NAN}});
+  EXPECT_THROW(JoinWithin(left, right, -1.0, CollectPairs(pairs)),
+               std::invalid_argument);
+  EXPECT_THROW(JoinWithin(left, invalid, 1.0, CollectPairs(pairs)),
+               std::invalid_argument);
+  SpatialJoinOptions options;
+  options.memory_limit = 1U;
+  EXPECT_THROW(JoinWithin(invalid, right, 1.0, CollectPairs(pairs), options),
+               std::invalid_argument);
+}
+
+TEST(GeometrySpatialJoin, JoinNearest) {
+  const auto left{CreateGridCloud(kTestCount, 1000)};
+  const auto right{CreateGridCloud(kTestCount / 10U, 1000)};
+  constexpr std::size_t kCount{3U};
+  for (const std::size_t memory_limit : {0U, 6400U}) {
+    SpatialJoinOptions options;
+    options.memory_limit = memory_limit;
+    std::vector<std::vector<PointPair>> rows(left.Size());
+    EXPECT_EQ(left.Size() * kCount,
+              JoinNearest(
+                  left, right, kCount,
+                  [&](const PointPair* pairs, std::size_t size) {
+                    ASSERT_EQ(0U, size % kCount);
+                    for (std::size_t i = 0; i < size; ++i) {
+                      EXPECT_EQ(pairs[i - i % kCount].first, pairs[i].first);
+                      rows[pairs[i].first].push_back(pairs[i]);
+                    }
+                  },
+                  options));
+    for (std::size_t i = 0; i < left.Size(); ++i) {
+      std::vector<double> expected;
+      for (std::size_t j = 0; j < right.Size(); ++j) {
+        expected.push_back(GetSquaredDistance(left, i, right, j));
+      }
+      std::sort(expected.begin(), expected.end());
+      ASSERT_EQ(kCount, rows[i].size());
+      for (std::size_t k = 0; k < kCount; ++k) {
+        EXPECT_EQ(expected[k], rows[i][k].squared_distance);
+        EXPECT_EQ(expected[k],
+                  GetSquaredDistance(left, i, right, rows[i][k].second));
+      }
+    }
+  }
+
+  Pairs pairs;
+  EXPECT_EQ(right.Size(), JoinNearest(PointCloud2D({{1.0, 2.0}}), right,
+                                      kTestCount, CollectPairs(pairs)));
+  EXPECT_EQ(0U, JoinNearest(left, right, 0U, CollectPairs(pairs)));
+  EXPECT_EQ(0U, JoinNearest(left, PointCloud2D(), 1U, CollectPairs(pairs)));
+  EXPECT_THROW(JoinNearest(PointCloud2D({{INFINITY, 1.0}}), right, 1U,
+                           CollectPairs(pairs)),
+               std::invalid_argument);
+}
+}  // namespace programmers::geometry
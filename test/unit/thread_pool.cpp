@@ -0,0 +1,157 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/thread_pool.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryThreadPool, Run) {
+  EXPECT_EQ(&ThreadPool::GetDefault(), &ThreadPool::GetDefault());
+  EXPECT_LE(1U, ThreadPool::GetDefault().GetThreadCount());
+
+  for (const std::size_t thread_count : {1U, 2U, 4U}) {
+    ThreadPool pool(thread_count);
+    EXPECT_EQ(thread_count, pool.GetThreadCount());
+    for (const auto affinity : {Affinity::kAny, Affinity::kStable}) {
+      std::vector<std::atomic<uint32_t>> calls(kTestCount);
+      pool.Run(
+          kTestCount, [&](std::size_t i) { ++calls[i]; }, affinity);
+      for (const auto& call : calls) {
+        EXPECT_EQ(1U, call.load());
+      }
+    }
+    pool.Run(0U, [](std::size_t) { FAIL(); });
+  }
+}
+
+TEST(GeometryThreadPool, Exception) {
+  ThreadPool pool(4U);
+  std::atomic<uint32_t> calls{0U};
+  EXPECT_THROW(pool.Run(kTestCount,
+                        [&](std::size_t i) {
+                          ++calls;
+                          if (i % 100U == 7U) {
+                            throw std::runtime_error("task failed");
+                          }
+                        }),
+               std::runtime_error);
+  EXPECT_LE(1U, calls.load());
+  // The pool stays usable after a failed call.
+  calls = 0U;
+  pool.Run(kTestCount, [&](std::size_t) { ++calls; });
+  EXPECT_EQ(kTestCount, calls.load());
+}
+
+TEST(GeometryThreadPool, Partition) {
+  ParallelOptions options;
+  options.grain = 10U;
+  options.chunking = Chunking::kFixed;
+  const Partition fixed(95U, options);
+  ASSERT_EQ(10U, fixed.Size());
+  EXPECT_EQ(0U, fixed.GetBegin(0U));
+  EXPECT_EQ(90U, fixed.GetBegin(9U));
+  EXPECT_EQ(95U, fixed.GetBegin(10U));
+  EXPECT_EQ(0U, Partition(0U, options).Size());
+
+  ThreadPool pool(4U);
+  options.pool = &pool;
+  options.chunking = Chunking::kAdaptive;
+  const Partition adaptive(kTestCount * 1000U, options);
+  EXPECT_EQ(16U, adaptive.Size());
+  for (std::size_t chunk = 0; chunk < adaptive.Size(); ++chunk) {
+    EXPECT_LT(adaptive.GetBegin(chunk), adaptive.GetBegin(chunk + 1U));
+  }
+  EXPECT_EQ(kTestCount * 1000U, adaptive.GetBegin(adaptive.Size()));
+  EXPECT_EQ(5U, Partition(45U, options).Size());
+}
+
+TEST(GeometryThreadPool, ParallelFor) {
+  ThreadPool pool(4U);
+  ParallelOptions options;
+  options.pool = &pool;
+  options.grain = 7U;
+  for (const auto chunking : {Chunking::kAdaptive, Chunking::kFixed}) {
+    options.chunking = chunking;
+    std::vector<uint32_t> visits(kTestCount, 0U);
+    ParallelFor(
+        kTestCount,
+        [&](std::size_t begin, std::size_t end) {
+          EXPECT_LT(begin, end);
+          for (auto i = begin; i < end; ++i) {
+            ++visits[i];
+          }
+        },
+        options);
+    EXPECT_EQ(std::vector<uint32_t>(kTestCount, 1U), visits);
+  }
+
+  // Nested loops help instead of waiting, so they finish on a small pool.
+  std::vector<std::atomic<uint32_t>> visits(kTestCount);
+  ParallelFor(
+      kTestCount / 10U,
+      [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          ParallelFor(
+              10U,
+              [&](std::size_t inner_begin, std::size_t inner_end) {
+                for (auto j = inner_begin; j < inner_end; ++j) {
+                  ++visits[i * 10U + j];
+                }
+              },
+              options);
+        }
+      },
+      options);
+  for (const auto& visit : visits) {
+    EXPECT_EQ(1U, visit.load());
+  }
+
+  std::atomic<uint32_t> sides{0U};
+  ParallelInvoke([&]() { sides += 1U; }, [&]() { sides += 2U; }, &pool);
+  EXPECT_EQ(3U, sides.load());
+}
+
+TEST(GeometryThreadPool, ParallelReduce) {
+  std::vector<double> values(kTestCount * 100U);
+  for (auto& value : values) {
+    value = static_cast<double>(std::rand()) / RAND_MAX - 0.5;
+  }
+  const auto sum{[&](std::size_t begin, std::size_t end) {
+    return std::accumulate(values.begin() + begin, values.begin() + end, 0.0);
+  }};
+  const auto add{[](double lhs, double rhs) { return lhs + rhs; }};
+
+  // Fixed chunks give the same floating point sum whatever the pool.
+  ParallelOptions options;
+  options.grain = 1000U;
+  options.chunking = Chunking::kFixed;
+  double expected{0.0};
+  for (std::size_t begin = 0; begin < values.size(); begin += 1000U) {
+    expected += sum(begin, begin + 1000U);
+  }
+  for (const std::size_t thread_count : {1U, 3U, 8U}) {
+    ThreadPool pool(thread_count);
+    options.pool = &pool;
+    EXPECT_EQ(expected,
+              ParallelReduce(values.size(), 0.0, sum, add, options));
+  }
+  options.pool = nullptr;
+  EXPECT_EQ(0.0, ParallelReduce(0U, 0.0, sum, add, options));
+
+  options.chunking = Chunking::kAdaptive;
+  EXPECT_NEAR(expected, ParallelReduce(values.size(), 0.0, sum, add, options),
+              1.0e-9);
+}
+}  // namespace programmers::geometry
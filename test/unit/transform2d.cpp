@@ -0,0 +1,106 @@
+// Copyright (c) 2024 Programmers, All Rights Reserved.
+// Authors: woong137
+
+#include "geometry/transform2d.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr uint32_t kTestCount = 1000U;
+constexpr double kPi = 3.14159265358979323846;
+constexpr double kTolerance = 1.0e-9;
+
+auto CreateRandomPoint() -> programmers::geometry::Point2D {
+  return {static_cast<double>(std::rand()) / RAND_MAX * 2000.0 - 1000.0,
+          static_cast<double>(std::rand()) / RAND_MAX * 2000.0 - 1000.0};
+}
+}  // namespace
+
+namespace programmers::geometry {
+TEST(GeometryTransform2D, Factories) {
+  const Point2D point(3.0, 4.0);
+  EXPECT_EQ(point, Transform2D().Apply(point));
+  EXPECT_EQ(Transform2D(), Transform2D::Identity());
+  EXPECT_EQ(Point2D(4.0, 2.0),
+            Transform2D::Translation(Point2D(1.0, -2.0)).Apply(point));
+  EXPECT_EQ(Point2D(6.0, -2.0), Transform2D::Scaling(2.0, -0.5).Apply(point));
+  EXPECT_EQ(Point2D(11.0, 4.0), Transform2D::Shearing(2.0, 0.0).Apply(point));
+
+  const auto rotated{Transform2D::Rotation(kPi / 2.0).Apply(point)};
+  EXPECT_NEAR(-4.0, rotated.GetX(), kTolerance);
+  EXPECT_NEAR(3.0, rotated.GetY(), kTolerance);
+  const Point2D center(1.0, 1.0);
+  const auto about{Transform2D::Rotation(kPi, center)};
+  EXPECT_NEAR(-1.0, about.Apply(point).GetX(), kTolerance);
+  EXPECT_NEAR(-2.0, about.Apply(point).GetY(), kTolerance);
+  EXPECT_NEAR(1.0, about.Apply(center).GetX(), kTolerance);
+  EXPECT_NEAR(1.0, about.Apply(center).GetY(), kTolerance);
+
+  EXPECT_DOUBLE_EQ(-1.0, Transform2D::Scaling(2.0, -0.5).GetDeterminant());
+  EXPECT_DOUBLE_EQ(1.0, Transform2D::Rotation(0.3).GetDeterminant());
+}
+
+TEST(GeometryTransform2D, Compose) {
+  for (uint32_t i = 0; i < kTestCount; ++i) {
+    const auto first{Transform2D::Rotation(std::rand() % 360 * kPi / 180.0)};
+    const auto second{Transform2D::Translation(CreateRandomPoint())};
+    const auto third{Transform2D::Shearing(0.25, -0.5)};
+    const auto point{CreateRandomPoint()};
+
+    const auto chained{first.Then(second).Then(third)};
+    EXPECT_EQ(third * (second * first), chained);
+    const auto expected{third.Apply(second.Apply(first.Apply(point)))};
+    EXPECT_NEAR(expected.GetX(), chained.Apply(point).GetX(), kTolerance);
+    EXPECT_NEAR(expected.GetY(), chained.Apply(point).GetY(), kTolerance);
+
+    const auto restored{chained.Inverse().Apply(chained.Apply(point))};
+    EXPECT_NEAR(point.GetX(), restored.GetX(), kTolerance);
+    EXPECT_NEAR(point.GetY(), restored.GetY(), kTolerance);
+  }
+  EXPECT_NE(Transform2D::Scaling(1.0, 2.0), Transform2D());
+}
+
+TEST(GeometryTransform2D, Inverse) {
+  EXPECT_EQ(Transform2D(), Transform2D().Inverse());
+  EXPECT_EQ(Transform2D::Translation(Point2D(-1.0, 2.0)),
+            Transform2D::Translation(Point2D(1.0, -2.0)).Inverse());
+  EXPECT_EQ(Transform2D::Scaling(0.5, 4.0),
+            Transform2D::Scaling(2.0, 0.25).Inverse());
+  EXPECT_THROW(static_cast<void>(Transform2D::Scaling(0.0, 1.0).Inverse()),
+               std::invalid_argument);
+  EXPECT_THROW(
+      static_cast<void>(Transform2D(1.0, 2.0, 0.0, 2.0, 4.0, 0.0).Inverse()),
+      std::invalid_argument);
+  EXPECT_THROW(
+      static_cast<void>(Transform2D::Scaling(NAN, 1.0).Inverse()),
+      std::invalid_argument);
+}
+
+TEST(GeometryTransform2D, ApplyCloud) {
+  std::vector<Point2D> points;
+  for (uint32_t i = 0; i < kTestCount + 3U; ++i) {
+    points.push_back(CreateRandomPoint());
+  }
+  const PointCloud2D cloud(points);
+  const auto transform{Transform2D::Rotation(0.7, Point2D(5.0, -3.0))
+                           .Then(Transform2D::Scaling(1.5, 0.5))};
+
+  const auto output{transform.Apply(cloud)};
+  auto updated{cloud};
+  transform.ApplyInPlace(updated);
+  ASSERT_EQ(points.size(), output.Size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const auto expected{transform.Apply(points[i])};
+    EXPECT_NEAR(expected.GetX(), output.GetX(i), kTolerance);
+    EXPECT_NEAR(expected.GetY(), output.GetY(i), kTolerance);
+    EXPECT_EQ(output.GetPoint(i), updated.GetPoint(i));
+  }
+  EXPECT_EQ(0U, transform.Apply(PointCloud2D()).Size());
+}
+}  // namespace programmers::geometry